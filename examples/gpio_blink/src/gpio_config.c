@@ -9,32 +9,15 @@
 
 hal_status_t gpio_config_init(void)
 {
-    hal_gpio_config_t led_config;
-    hal_gpio_config_t button_config;
+    // 所有引腳以一個配置表批次初始化
+    static const hal_gpio_config_t gpio_table[] = {
+        // LED引腳
+        { LED_PIN,    HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_LOW },
+        // 按鈕引腳 (使用內部上拉電阻，輸入模式下初始狀態無效)
+        { BUTTON_PIN, HAL_GPIO_MODE_INPUT,  HAL_GPIO_PULLUP, HAL_GPIO_LOW }
+    };
     
-    // 配置LED引腳
-    led_config.pin = LED_PIN;
-    led_config.mode = HAL_GPIO_MODE_OUTPUT;
-    led_config.pull = HAL_GPIO_NOPULL;
-    led_config.initial_state = HAL_GPIO_LOW;
-    
-    hal_status_t status = hal_gpio_init(&led_config);
-    if (status != HAL_OK) {
-        return status;
-    }
-    
-    // 配置按鈕引腳 (可選)
-    button_config.pin = BUTTON_PIN;
-    button_config.mode = HAL_GPIO_MODE_INPUT;
-    button_config.pull = HAL_GPIO_PULLUP;  // 使用內部上拉電阻
-    button_config.initial_state = HAL_GPIO_LOW;  // 輸入模式下此參數無效
-    
-    status = hal_gpio_init(&button_config);
-    if (status != HAL_OK) {
-        return status;
-    }
-    
-    return HAL_OK;
+    return hal_gpio_init_table(gpio_table, (uint16_t)(sizeof(gpio_table) / sizeof(gpio_table[0])));
 }
 
 hal_gpio_state_t gpio_read_button(void)
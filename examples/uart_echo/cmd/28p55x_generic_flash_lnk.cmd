@@ -69,6 +69,12 @@ SECTIONS
    ramgs1 : > RAMGS1
    ramgs2 : > RAMGS2
 
+   /* HAL記憶體池 (hal_pool) */
+   .hal_pool        : > RAMGS3
+
+   /* HAL_LOG格式字串: 只佔用位址 (格式ID)，不寫入快閃，內容保留在輸出檔供主機解碼 */
+   .hal_log_fmt     : > FLASH_BANK4, type = NOLOAD
+
    #if defined(__TI_EABI__)
        .TI.ramfunc : {} LOAD = FLASH_BANK0,
                         RUN = RAMLS0,
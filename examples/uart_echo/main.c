@@ -13,14 +13,19 @@
 #define WELCOME_MSG     "Cross-MCU UART Echo Example\r\n"
 #define PROMPT_MSG      "Enter text (press Enter to echo): "
 
+// 接收緩衝區由記憶體池提供，避免佔用有限的堆疊 (C2000僅0x200字)
+HAL_POOL_DEFINE(buffer_pool, HAL_BUF_POOL_BLOCK_SIZE(BUFFER_SIZE), 1);
+
 /**
  * @brief 主函式
  */
 int main(void)
 {
     hal_status_t status;
-    uint8_t rx_buffer[BUFFER_SIZE];
-    uint8_t tx_buffer[BUFFER_SIZE];
+    hal_buf_t* rx_buf;
+    hal_buf_t echo_prefix;
+    hal_buf_t echo_suffix;
+    uint8_t* rx_buffer;
     uint16_t rx_index = 0;
     uint8_t received_char;
     
@@ -42,6 +47,18 @@ int main(void)
         }
     }
     
+    // 配置接收緩衝區
+    hal_pool_init(&buffer_pool);
+    rx_buf = hal_buf_alloc(&buffer_pool);
+    if (rx_buf == NULL) {
+        // 記憶體池配置失敗
+        while (1) {
+            // 錯誤處理
+        }
+    }
+    rx_buffer = rx_buf->data;
+    memset(rx_buffer, 0, BUFFER_SIZE);
+    
     // 發送歡迎訊息
     hal_uart_transmit(CONSOLE_UART, (uint8_t*)WELCOME_MSG, strlen(WELCOME_MSG), 1000);
     hal_uart_transmit(CONSOLE_UART, (uint8_t*)PROMPT_MSG, strlen(PROMPT_MSG), 1000);
@@ -62,16 +79,19 @@ int main(void)
                     hal_uart_transmit(CONSOLE_UART, (uint8_t*)"\r\n", 2, 100);
                     
                     if (rx_index > 0) {
-                        // 準備回音訊息
-                        strcpy((char*)tx_buffer, "Echo: ");
-                        strncat((char*)tx_buffer, (char*)rx_buffer, rx_index);
-                        strcat((char*)tx_buffer, "\r\n");
+                        // 以串鏈組合回音訊息，不複製接收資料
+                        hal_buf_wrap(&echo_prefix, (const uint8_t*)"Echo: ", 6);
+                        hal_buf_wrap(&echo_suffix, (const uint8_t*)"\r\n", 2);
+                        rx_buf->len = rx_index;
+                        rx_buf->next = &echo_suffix;
+                        hal_buf_chain(&echo_prefix, hal_buf_ref(rx_buf));
                         
-                        // 發送回音
-                        hal_uart_transmit(CONSOLE_UART, tx_buffer, strlen((char*)tx_buffer), 1000);
+                        // 發送回音 (接收緩衝區多持有一個參考，發送後仍保留)
+                        hal_uart_transmit_buf(CONSOLE_UART, &echo_prefix, 1000);
+                        rx_buf->next = NULL;
                         
                         // 清空接收緩衝區
-                        memset(rx_buffer, 0, sizeof(rx_buffer));
+                        memset(rx_buffer, 0, BUFFER_SIZE);
                         rx_index = 0;
                     }
                     
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+HAL_LOG 二進位日誌解碼工具
+從建置產生的 ELF 取出 .hal_log_fmt 區段的格式字串，
+將 UART 收到的 COBS 記錄訊框還原為文字
+"""
+
+import re
+import struct
+import sys
+
+EM_TI_C2000 = 141
+
+TYPE_RECORD = 0
+TYPE_DROPPED = 1
+
+
+def load_format_table(elf_file):
+    """讀取 ELF 的 .hal_log_fmt 區段，建立 位址 -> 格式字串 對照表"""
+    with open(elf_file, 'rb') as f:
+        data = f.read()
+
+    if data[:4] != b'\x7fELF':
+        raise ValueError("不是ELF檔案")
+    if data[5] != 1:
+        raise ValueError("只支援小端序ELF")
+
+    # 32位元 (目標) 或64位元 (主機模擬) ELF
+    is64 = (data[4] == 2)
+    e_machine = struct.unpack_from('<H', data, 18)[0]
+    if is64:
+        e_shoff = struct.unpack_from('<Q', data, 40)[0]
+        e_shentsize, e_shnum, e_shstrndx = struct.unpack_from('<HHH', data, 58)
+        sh_format = '<IIQQQQIIQQ'
+    else:
+        e_shoff = struct.unpack_from('<I', data, 32)[0]
+        e_shentsize, e_shnum, e_shstrndx = struct.unpack_from('<HHH', data, 46)
+        sh_format = '<IIIIIIIIII'
+
+    sections = []
+    for i in range(e_shnum):
+        fields = struct.unpack_from(sh_format, data, e_shoff + i * e_shentsize)
+        sections.append(fields)
+
+    strtab = sections[e_shstrndx]
+    names = data[strtab[4]:strtab[4] + strtab[5]]
+
+    for sh_name, _, _, sh_addr, sh_offset, sh_size, _, _, _, _ in sections:
+        name = names[sh_name:names.index(b'\0', sh_name)].decode()
+        if name == '.hal_log_fmt':
+            raw = data[sh_offset:sh_offset + sh_size]
+            break
+    else:
+        raise ValueError("找不到 .hal_log_fmt 區段")
+
+    # C2000 以16位元字定址，每個char佔一個字
+    unit = 2 if e_machine == EM_TI_C2000 else 1
+    chars = [raw[i] for i in range(0, len(raw), unit)]
+
+    table = {}
+    i = 0
+    while i < len(chars):
+        if chars[i] == 0:
+            i += 1
+            continue
+        end = chars.index(0, i) if 0 in chars[i:] else len(chars)
+        table[sh_addr + i] = bytes(chars[i:end]).decode('utf-8', errors='replace')
+        i = end + 1
+
+    return table
+
+
+def cobs_frames(stream):
+    """以0x00分割並解碼COBS訊框"""
+    frame = bytearray()
+    for byte in stream:
+        if byte != 0:
+            frame.append(byte)
+            continue
+        if frame:
+            out = bytearray()
+            i = 0
+            valid = True
+            while i < len(frame):
+                code = frame[i]
+                block = frame[i + 1:i + code]
+                if len(block) != code - 1:
+                    valid = False
+                    break
+                out += block
+                i += code
+                if code != 0xFF and i < len(frame):
+                    out.append(0)
+            yield bytes(out) if valid else None
+        frame = bytearray()
+
+
+def crc16_ccitt(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def read_varint(payload, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = payload[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def format_message(fmt, args):
+    """將C格式字串轉為Python格式並代入參數"""
+    values = []
+    arg_iter = iter(args)
+
+    def convert(match):
+        spec = match.group(0)
+        if spec == '%%':
+            return '%%'
+        conv = spec[-1]
+        flags = re.sub(r'[hlLzjt]', '', spec[:-1])
+        try:
+            value = next(arg_iter)
+        except StopIteration:
+            return '<缺少參數>'
+        if conv in 'di':
+            values.append(value - (1 << 32) if value & 0x80000000 else value)
+            return flags + 'd'
+        if conv == 'u':
+            values.append(value)
+            return flags + 'd'
+        if conv in 'xXoc':
+            values.append(value)
+            return flags + conv
+        if conv == 'p':
+            values.append(value)
+            return '0x%08X'
+        # 字串與浮點數無法在目標端保存內容
+        values.append(value)
+        return '<%s@0x%%X>' % conv
+
+    pattern = r'%[-+ #0]*\d*(?:\.\d+)?[hlLzjt]*[diuxXocspfeEgG%]'
+    py_fmt = re.sub(pattern, convert, fmt.replace('%%', '\0')).replace('\0', '%%')
+    try:
+        return py_fmt % tuple(values)
+    except (TypeError, ValueError):
+        return fmt + ' ' + ' '.join('0x%X' % v for v in args)
+
+
+def decode_log(elf_file, stream, use_crc=True):
+    table = load_format_table(elf_file)
+    tick = 0
+
+    for payload in cobs_frames(stream):
+        if payload is None:
+            print("⚠️  訊框編碼錯誤")
+            continue
+        if use_crc:
+            if len(payload) < 3:
+                print("⚠️  訊框長度不足")
+                continue
+            if crc16_ccitt(payload[:-2]) != struct.unpack('<H', payload[-2:])[0]:
+                print("⚠️  CRC錯誤")
+                continue
+            payload = payload[:-2]
+
+        try:
+            header = payload[0]
+            record_type = header >> 4
+            if record_type == TYPE_DROPPED:
+                count, _ = read_varint(payload, 1)
+                print(f"⚠️  遺失 {count} 筆記錄")
+                continue
+            if record_type != TYPE_RECORD:
+                # 其他模組 (如HAL_PROFILER) 共用UART的訊框
+                continue
+
+            nargs = header & 0x0F
+            fmt_id, pos = read_varint(payload, 1)
+            delta, pos = read_varint(payload, pos)
+            tick += (delta >> 1) ^ -(delta & 1)
+            args = []
+            for _ in range(nargs):
+                value, pos = read_varint(payload, pos)
+                args.append(value)
+        except IndexError:
+            print("⚠️  記錄格式錯誤")
+            continue
+
+        fmt = table.get(fmt_id)
+        if fmt is None:
+            text = f"<未知格式ID 0x{fmt_id:X}> " + ' '.join('0x%X' % v for v in args)
+        else:
+            text = format_message(fmt, args)
+        print(f"[{tick // 1000:6d}.{tick % 1000:03d}] {text.rstrip()}")
+
+
+def read_stream(source):
+    """讀取檔案、標準輸入或序列埠 (需要pyserial)"""
+    if source == '-':
+        data = sys.stdin.buffer.read()
+        yield from data
+    elif source.startswith('/dev/') or source.upper().startswith('COM'):
+        import serial
+        baudrate = int(sys.argv[3]) if len(sys.argv) > 3 else 115200
+        with serial.Serial(source, baudrate) as port:
+            while True:
+                yield from port.read(port.in_waiting or 1)
+    else:
+        with open(source, 'rb') as f:
+            yield from f.read()
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("用法: log_decode.py <firmware.elf|.out> <日誌檔案|序列埠|-> [波特率]")
+        print("  範例: log_decode.py build/STM32G4_Debug/bin/uart_echo_example.elf /dev/ttyACM0 115200")
+        sys.exit(1)
+
+    try:
+        decode_log(sys.argv[1], read_stream(sys.argv[2]))
+    except FileNotFoundError as e:
+        print(f"❌ 檔案不存在: {e.filename}")
+    except ValueError as e:
+        print(f"❌ 解碼錯誤: {e}")
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,31 @@
+# HAL平台無關模組Makefile配置
+# 作者: Cross-MCU Framework Team
+# 日期: 2024
+
+# 平台無關HAL源檔案 (相對於src/hal目錄)
+HAL_COMMON_MODULES := common/hal_timer.c \
+                      common/hal_sched.c \
+                      common/hal_work.c \
+                      common/hal_pool.c \
+                      common/hal_buf.c \
+                      common/hal_packed.c \
+                      common/hal_packed_uart.c \
+                      common/hal_uart_baud.c \
+                      common/hal_frame.c \
+                      common/hal_crc.c \
+                      common/hal_log.c \
+                      common/hal_gpio_irq.c \
+                      common/hal_debounce.c \
+                      common/hal_critical.c \
+                      common/hal_irq.c \
+                      common/hal_profiler.c \
+                      common/hal_cpu_load.c \
+                      common/hal_stack.c
+
+# 需要平台SPI驅動 (hal_spi_*) 的模組，平台定義HAL_PLATFORM_HAS_SPI := 1時加入建置
+HAL_COMMON_SPI_MODULES := common/hal_buf_spi.c \
+                          common/hal_packed_spi.c
+
+ifeq ($(HAL_PLATFORM_HAS_SPI),1)
+    HAL_COMMON_MODULES += $(HAL_COMMON_SPI_MODULES)
+endif
@@ -38,7 +38,8 @@ PLATFORM_DEFINES := -DPLATFORM_STM32 \
                     -DUSE_HAL_DRIVER \
                     -DCPU_FREQ=$(CPU_FREQ) \
                     -DARM_MATH_CM4 \
-                    -D__FPU_PRESENT=1
+                    -D__FPU_PRESENT=1 \
+                    -DHAL_CRC_USE_HW=1
 
 # 平台特定包含目錄
 PLATFORM_INCLUDE_DIRS := -I$(HAL_DIR)/stm32g4
@@ -96,6 +97,9 @@ ifeq ($(CC),arm-none-eabi-gcc)
     ifneq ($(wildcard $(LINKER_SCRIPT)),)
         LDFLAGS += -T$(LINKER_SCRIPT)
     endif
+
+    # .hal_log_fmt不配置記憶體 (否則成為孤立區段被放入快閃)
+    LDFLAGS += -T$(abspath makefiles/linker_scripts/hal_log_fmt.ld)
     
     # 歸檔選項
     ARFLAGS := rcs
@@ -122,9 +126,28 @@ else
     COMPILE_CMD = $(CC) $(CFLAGS) $(INCLUDE_DIRS) $(PLATFORM_INCLUDE_DIRS) $(PLATFORM_DEFINES) -c $< -o $@
 endif
 
+# GPIO驅動後端選擇 (可以通過環境變數或命令列覆蓋)
+# 1 = LL/直接暫存器存取，0 = STM32 HAL (HAL_GPIO_Init)
+STM32G4_USE_LL ?= 1
+
 # 平台特定HAL源檔案
-PLATFORM_HAL_SOURCES := stm32g4/stm32g4_gpio.c \
-                        stm32g4/stm32g4_system.c
+ifeq ($(STM32G4_USE_LL),1)
+    STM32G4_GPIO_SOURCE := stm32g4/ll/stm32g4_gpio_ll.c
+    $(info Using LL GPIO implementation (direct register access))
+else
+    STM32G4_GPIO_SOURCE := stm32g4/stm32g4_gpio.c
+endif
+PLATFORM_DEFINES += -DSTM32G4_USE_LL=$(STM32G4_USE_LL)
+
+PLATFORM_HAL_SOURCES := $(STM32G4_GPIO_SOURCE) \
+                        stm32g4/stm32g4_gpio_table.c \
+                        stm32g4/stm32g4_gpio_irq.c \
+                        stm32g4/stm32g4_uart.c \
+                        stm32g4/stm32g4_system.c \
+                        stm32g4/stm32g4_work.c \
+                        stm32g4/stm32g4_irq.c \
+                        stm32g4/stm32g4_profiler.c \
+                        stm32g4/stm32g4_crc.c
 
 # 如果有STM32 HAL源檔案，添加到編譯列表
 ifneq ($(STM32_HAL_SOURCES),)
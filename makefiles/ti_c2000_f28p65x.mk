@@ -39,22 +39,23 @@ PLATFORM_DEFINES := --define=PLATFORM_TI_C2000 \
 # 平台特定包含目錄
 PLATFORM_INCLUDE_DIRS := -I$(HAL_DIR)/ti_c2000
 
-# TI C2000Ware路徑配置
-C2000WARE_PATH := /opt/ti/c2000/C2000Ware_6_00_00_00
+# TI C2000Ware路徑配置 (可以通過環境變數或命令列覆蓋)
+# 簡化版本與DriverLib版本都需要C2000Ware: ti_c2000_common.h包含device.h與driverlib.h，
+# 中斷分派、時脈與週邊致能使用DriverLib的Interrupt_*/SysCtl_*/GPIO_*
+C2000WARE_PATH ?= /opt/ti/c2000/C2000Ware_6_00_00_00
 DEVICE_SUPPORT_PATH := $(C2000WARE_PATH)/device_support/f28p65x
 DRIVERLIB_PATH := $(C2000WARE_PATH)/driverlib/f28p65x/driverlib
 
-# 檢查並添加TI C2000Ware包含路徑
-ifneq ($(wildcard $(DEVICE_SUPPORT_PATH)),)
-    PLATFORM_INCLUDE_DIRS += -I$(DEVICE_SUPPORT_PATH)/common/include
-    PLATFORM_INCLUDE_DIRS += -I$(DEVICE_SUPPORT_PATH)/headers/include
+# 只有建置目標需要，clean/help/info等不檢查
+ifneq ($(filter-out test bench clean distclean help info,$(or $(MAKECMDGOALS),all)),)
+    ifeq ($(wildcard $(DRIVERLIB_PATH)/driverlib.h),)
+        $(error TI C2000 platform requires C2000Ware DriverLib at $(DRIVERLIB_PATH), set C2000WARE_PATH)
+    endif
 endif
 
-# 檢查並添加DriverLib路徑
-ifneq ($(wildcard $(DRIVERLIB_PATH)),)
-    PLATFORM_INCLUDE_DIRS += -I$(DRIVERLIB_PATH)
-    PLATFORM_LIBS += -L$(DRIVERLIB_PATH) -ldriverlib.lib
-endif
+PLATFORM_INCLUDE_DIRS += -I$(DEVICE_SUPPORT_PATH)/common/include
+PLATFORM_INCLUDE_DIRS += -I$(DEVICE_SUPPORT_PATH)/headers/include
+PLATFORM_INCLUDE_DIRS += -I$(DRIVERLIB_PATH)
 
 # TI C2000特定編譯選項
 ifeq ($(CC),$(TI_CCS_PATH)/bin/cl2000)
@@ -116,9 +117,36 @@ else
     COMPILE_CMD = $(CC) $(CFLAGS) $(INCLUDE_DIRS) $(PLATFORM_INCLUDE_DIRS) $(PLATFORM_DEFINES) -c $< -o $@
 endif
 
+# DriverLib函式庫 (C2000Ware預先建置的版本)
+ifeq ($(CC),$(TI_CCS_PATH)/bin/cl2000)
+    LDFLAGS += -i"$(DRIVERLIB_PATH)/ccs/Release" -l"driverlib.lib"
+endif
+
+# VCU CRC硬體 (可以通過環境變數或命令列覆蓋)
+# ti_c2000_crc.c使用C2000Ware VCU-II CRC函式庫 (vcu2/vcu2_crc.h)
+HAL_CRC_USE_HW ?= 0
+VCU_PATH := $(C2000WARE_PATH)/libraries/dsp/VCU/c28
+VCU_LIB ?= c28x_vcu2_library_fpu32_eabi.lib
+
+ifeq ($(HAL_CRC_USE_HW),1)
+    ifeq ($(wildcard $(VCU_PATH)/include/vcu2/vcu2_crc.h),)
+        $(error HAL_CRC_USE_HW=1 requires the C2000Ware VCU library at $(VCU_PATH))
+    endif
+    PLATFORM_DEFINES += --define=HAL_CRC_USE_HW=1
+    PLATFORM_INCLUDE_DIRS += -I$(VCU_PATH)/include
+    LDFLAGS += -i"$(VCU_PATH)/lib" -l"$(VCU_LIB)"
+endif
+
 # 平台特定HAL源檔案
-PLATFORM_HAL_SOURCES := ti_c2000/ti_c2000_gpio_simple.c \
-                        ti_c2000/ti_c2000_system_simple.c
+PLATFORM_HAL_SOURCES := ti_c2000/simple/ti_c2000_gpio_simple.c \
+                        ti_c2000/simple/ti_c2000_system_simple.c \
+                        ti_c2000/simple/ti_c2000_uart_simple.c \
+                        ti_c2000/ti_c2000_gpio_table.c \
+                        ti_c2000/ti_c2000_gpio_irq.c \
+                        ti_c2000/ti_c2000_work.c \
+                        ti_c2000/ti_c2000_irq.c \
+                        ti_c2000/ti_c2000_profiler.c \
+                        ti_c2000/ti_c2000_crc.c
 
 # 根據MCU型號選擇連結描述檔 (如果使用TI編譯器)
 ifeq ($(CC),$(TI_CCS_PATH)/bin/cl2000)
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+HAL_PROFILER PC取樣分析結果解碼工具
+讀取 hal_profiler_dump() 輸出的 COBS 訊框，以 ELF 符號表或 map 檔
+將直方圖區間對應到函式，列出平面分析結果 (flat profile)
+"""
+
+import bisect
+import re
+import struct
+import sys
+
+from log_decode import cobs_frames, crc16_ccitt, read_stream, read_varint
+
+EM_ARM = 40
+
+TYPE_INFO = 2
+TYPE_BUCKETS = 3
+FLAG_LAST = 0x01
+
+STT_FUNC = 2
+SHT_SYMTAB = 2
+
+
+def load_symbols_elf(elf_file):
+    """讀取 ELF 的 .symtab，返回 [(起始位址, 大小, 名稱)]"""
+    with open(elf_file, 'rb') as f:
+        data = f.read()
+
+    if data[:4] != b'\x7fELF':
+        raise ValueError("不是ELF檔案")
+    if data[5] != 1:
+        raise ValueError("只支援小端序ELF")
+
+    is64 = (data[4] == 2)
+    e_machine = struct.unpack_from('<H', data, 18)[0]
+    if is64:
+        e_shoff = struct.unpack_from('<Q', data, 40)[0]
+        e_shentsize, e_shnum = struct.unpack_from('<HH', data, 58)
+        sh_format = '<IIQQQQIIQQ'
+    else:
+        e_shoff = struct.unpack_from('<I', data, 32)[0]
+        e_shentsize, e_shnum = struct.unpack_from('<HH', data, 46)
+        sh_format = '<IIIIIIIIII'
+
+    sections = [struct.unpack_from(sh_format, data, e_shoff + i * e_shentsize)
+                for i in range(e_shnum)]
+
+    symbols = []
+    for _, sh_type, _, _, sh_offset, sh_size, sh_link, _, _, sh_entsize in sections:
+        if sh_type != SHT_SYMTAB:
+            continue
+        strtab = sections[sh_link]
+        names = data[strtab[4]:strtab[4] + strtab[5]]
+        for offset in range(sh_offset, sh_offset + sh_size, sh_entsize):
+            if is64:
+                st_name, st_info, _, _, st_value, st_size = \
+                    struct.unpack_from('<IBBHQQ', data, offset)
+            else:
+                st_name, st_value, st_size, st_info, _, _ = \
+                    struct.unpack_from('<IIIBBH', data, offset)
+            if st_info & 0x0F != STT_FUNC or st_name == 0:
+                continue
+            name = names[st_name:names.index(b'\0', st_name)].decode(errors='replace')
+            # Thumb函式位址的bit0為1
+            if e_machine == EM_ARM:
+                st_value &= ~1
+            symbols.append((st_value, st_size, name))
+
+    if not symbols:
+        raise ValueError("ELF中沒有函式符號 (是否已strip?)")
+
+    return fill_sizes(symbols)
+
+
+def load_symbols_map(map_file):
+    """讀取 GNU ld 或 TI 連結器的 map 檔，大小以下一個符號的位址推算"""
+    gnu = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+([A-Za-z_$][\w$.]*)\s*$')
+    ti = re.compile(r'^\s*\d+\s+([0-9a-fA-F]{8})\s+([A-Za-z_$][\w$.]*)\s*$')
+
+    symbols = {}
+    with open(map_file, 'r', errors='replace') as f:
+        for line in f:
+            match = gnu.match(line) or ti.match(line)
+            if match:
+                symbols[int(match.group(1), 16)] = match.group(2)
+
+    if not symbols:
+        raise ValueError("map檔中找不到符號")
+
+    return fill_sizes([(addr, 0, name) for addr, name in symbols.items()])
+
+
+def fill_sizes(symbols):
+    """依位址排序，大小為0的符號延伸到下一個符號"""
+    symbols.sort()
+    result = []
+    for i, (addr, size, name) in enumerate(symbols):
+        if size == 0 and i + 1 < len(symbols):
+            size = symbols[i + 1][0] - addr
+        if size > 0:
+            result.append((addr, size, name))
+    return result
+
+
+def attribute(symbols, start, shift, buckets):
+    """將每個區間的取樣依位址重疊比例分配到函式"""
+    starts = [s[0] for s in symbols]
+    bucket_size = 1 << shift
+    profile = {}
+
+    for index, count in buckets.items():
+        lo = start + index * bucket_size
+        hi = lo + bucket_size
+        covered = 0
+        i = max(bisect.bisect_right(starts, lo) - 1, 0)
+        while i < len(symbols) and symbols[i][0] < hi:
+            addr, size, name = symbols[i]
+            overlap = min(hi, addr + size) - max(lo, addr)
+            if overlap > 0:
+                profile[name] = profile.get(name, 0.0) + count * overlap / bucket_size
+                covered += overlap
+            i += 1
+        if covered < bucket_size:
+            profile['<未知>'] = profile.get('<未知>', 0.0) + \
+                count * (bucket_size - covered) / bucket_size
+
+    return profile
+
+
+def print_profile(info, profile, top):
+    start, shift, _, samples, outside, hz = info
+    print(f"=== 取樣 {samples} 次 ({samples / hz:.1f} 秒 @ {hz} Hz)，"
+          f"範圍外 {outside} 次，區間大小 {1 << shift}，起點 0x{start:X} ===")
+    if samples == 0:
+        return
+    print(f"{'%':>7} {'取樣數':>10}  函式")
+    ranked = sorted(profile.items(), key=lambda item: item[1], reverse=True)
+    for name, count in ranked[:top]:
+        print(f"{100.0 * count / samples:6.2f}% {count:10.1f}  {name}")
+    if outside:
+        print(f"{100.0 * outside / samples:6.2f}% {outside:10d}  <範圍外>")
+    print()
+
+
+def decode_profile(symbol_file, stream, use_crc=True, top=30):
+    if symbol_file.endswith('.map'):
+        symbols = load_symbols_map(symbol_file)
+    else:
+        symbols = load_symbols_elf(symbol_file)
+
+    info = None
+    buckets = {}
+    index = 0
+
+    for payload in cobs_frames(stream):
+        if payload is None:
+            continue
+        if use_crc:
+            if len(payload) < 3 or \
+               crc16_ccitt(payload[:-2]) != struct.unpack('<H', payload[-2:])[0]:
+                print("⚠️  CRC錯誤")
+                continue
+            payload = payload[:-2]
+
+        # 與HAL_LOG共用UART時略過日誌記錄
+        header = payload[0]
+        frame_type = header >> 4
+        try:
+            if frame_type == TYPE_INFO:
+                fields = []
+                pos = 1
+                for _ in range(6):
+                    value, pos = read_varint(payload, pos)
+                    fields.append(value)
+                info = tuple(fields)
+                buckets = {}
+                index = 0
+            elif frame_type == TYPE_BUCKETS and info is not None:
+                pos = 1
+                while pos < len(payload):
+                    delta, pos = read_varint(payload, pos)
+                    count, pos = read_varint(payload, pos)
+                    index += delta
+                    buckets[index] = count
+                if header & FLAG_LAST:
+                    print_profile(info, attribute(symbols, info[0], info[1], buckets), top)
+                    info = None
+        except IndexError:
+            print("⚠️  訊框格式錯誤")
+            info = None
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("用法: profile_decode.py <firmware.elf|.out|.map> <資料檔案|序列埠|-> [波特率]")
+        print("  範例: profile_decode.py build/STM32G4_Release/bin/app.elf /dev/ttyACM0 115200")
+        sys.exit(1)
+
+    try:
+        decode_profile(sys.argv[1], read_stream(sys.argv[2]))
+    except FileNotFoundError as e:
+        print(f"❌ 檔案不存在: {e.filename}")
+    except ValueError as e:
+        print(f"❌ 解碼錯誤: {e}")
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,172 @@
+/**
+ * @file hal_buf.c
+ * @brief 零複製緩衝區描述子實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_buf.h"
+#include "../include/hal_uart.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static void buf_pool_release(hal_buf_t* buf)
+{
+    (void)hal_pool_free((hal_pool_t*)buf->owner, buf);
+}
+
+/* ========================================================================== */
+/*                             緩衝區介面實現                                  */
+/* ========================================================================== */
+
+hal_buf_t* hal_buf_alloc(hal_pool_t* pool)
+{
+    hal_buf_t* buf;
+    uint32_t block_size = hal_pool_get_block_size(pool);
+
+    if (block_size <= sizeof(hal_buf_t)) {
+        return NULL;
+    }
+
+    buf = (hal_buf_t*)hal_pool_alloc(pool);
+    if (buf == NULL) {
+        return NULL;
+    }
+
+    // 資料區緊接在描述子之後
+    buf->next = NULL;
+    buf->data = (uint8_t*)(buf + 1);
+    buf->len = 0;
+    block_size -= sizeof(hal_buf_t);
+    buf->capacity = (block_size > 0xFFFFUL) ? 0xFFFFU : (uint16_t)block_size;
+    buf->refcount = 1;
+    buf->release = buf_pool_release;
+    buf->owner = pool;
+
+    return buf;
+}
+
+hal_status_t hal_buf_wrap(hal_buf_t* buf, const uint8_t* data, uint16_t len)
+{
+    if (buf == NULL || (data == NULL && len > 0)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    buf->next = NULL;
+    buf->data = (uint8_t*)data;
+    buf->len = len;
+    buf->capacity = len;
+    buf->refcount = 1;
+    buf->release = NULL;
+    buf->owner = NULL;
+
+    return HAL_OK;
+}
+
+hal_buf_t* hal_buf_ref(hal_buf_t* buf)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (buf != NULL) {
+        irq_state = HAL_PORT_IRQ_SAVE();
+        buf->refcount++;
+        HAL_PORT_IRQ_RESTORE(irq_state);
+    }
+
+    return buf;
+}
+
+void hal_buf_unref(hal_buf_t* buf)
+{
+    hal_port_irq_state_t irq_state;
+
+    while (buf != NULL) {
+        hal_buf_t* next = buf->next;
+        uint16_t remaining;
+
+        irq_state = HAL_PORT_IRQ_SAVE();
+        remaining = (buf->refcount > 0) ? --buf->refcount : 0;
+        HAL_PORT_IRQ_RESTORE(irq_state);
+
+        // 仍有其他持有者時，後續節點也由其持有
+        if (remaining != 0) {
+            break;
+        }
+
+        buf->next = NULL;
+        if (buf->release != NULL) {
+            buf->release(buf);
+        }
+        buf = next;
+    }
+}
+
+hal_buf_t* hal_buf_chain(hal_buf_t* head, hal_buf_t* tail)
+{
+    hal_buf_t* last = head;
+
+    if (head == NULL) {
+        return tail;
+    }
+
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    last->next = tail;
+
+    return head;
+}
+
+uint8_t* hal_buf_put(hal_buf_t* buf, uint16_t len)
+{
+    uint8_t* tail;
+
+    if (buf == NULL || len > (uint16_t)(buf->capacity - buf->len)) {
+        return NULL;
+    }
+
+    tail = buf->data + buf->len;
+    buf->len += len;
+
+    return tail;
+}
+
+uint32_t hal_buf_chain_len(const hal_buf_t* buf)
+{
+    uint32_t total = 0;
+
+    while (buf != NULL) {
+        total += buf->len;
+        buf = buf->next;
+    }
+
+    return total;
+}
+
+/* ========================================================================== */
+/*                             串鏈傳輸介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_uart_transmit_buf(hal_uart_id_t uart_id, hal_buf_t* chain, uint32_t timeout)
+{
+    hal_status_t status = HAL_OK;
+    const hal_buf_t* seg;
+
+    if (chain == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    for (seg = chain; seg != NULL && status == HAL_OK; seg = seg->next) {
+        if (seg->len > 0) {
+            status = hal_uart_transmit(uart_id, seg->data, seg->len, timeout);
+        }
+    }
+
+    hal_buf_unref(chain);
+
+    return status;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file hal_buf_spi.c
+ * @brief 緩衝區串鏈SPI傳輸實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 依賴平台的hal_spi_*驅動，只在平台提供SPI時建置 (見makefiles/hal_common.mk)，
+ * 避免只使用hal_buf的程式連結到不存在的SPI函式。
+ */
+
+#include "../include/hal_spi.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             串鏈傳輸介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_spi_transfer_buf(hal_spi_id_t spi_id, hal_buf_t* tx_chain,
+                                  hal_buf_t* rx_chain, uint32_t timeout)
+{
+    hal_status_t status = HAL_OK;
+    hal_buf_t* tx = tx_chain;
+    hal_buf_t* rx = rx_chain;
+    uint16_t tx_offset = 0;
+    uint16_t rx_offset = 0;
+
+    if (tx_chain == NULL && rx_chain == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+    if (tx_chain != NULL && rx_chain != NULL &&
+        hal_buf_chain_len(tx_chain) != hal_buf_chain_len(rx_chain)) {
+        hal_buf_unref(tx_chain);
+        return HAL_INVALID_PARAM;
+    }
+
+    while (status == HAL_OK) {
+        uint16_t chunk;
+
+        // 跳過已用完的段落
+        while (tx != NULL && tx_offset >= tx->len) {
+            tx = tx->next;
+            tx_offset = 0;
+        }
+        while (rx != NULL && rx_offset >= rx->len) {
+            rx = rx->next;
+            rx_offset = 0;
+        }
+        if (tx == NULL && rx == NULL) {
+            break;
+        }
+
+        // 每次傳輸到發送段或接收段的邊界為止
+        if (tx != NULL && rx != NULL) {
+            chunk = tx->len - tx_offset;
+            if ((uint16_t)(rx->len - rx_offset) < chunk) {
+                chunk = rx->len - rx_offset;
+            }
+            status = hal_spi_transmit_receive(spi_id, tx->data + tx_offset,
+                                              rx->data + rx_offset, chunk, timeout);
+        } else if (tx != NULL) {
+            chunk = tx->len - tx_offset;
+            status = hal_spi_transmit(spi_id, tx->data + tx_offset, chunk, timeout);
+        } else {
+            chunk = rx->len - rx_offset;
+            status = hal_spi_receive(spi_id, rx->data + rx_offset, chunk, timeout);
+        }
+
+        if (tx != NULL) {
+            tx_offset += chunk;
+        }
+        if (rx != NULL) {
+            rx_offset += chunk;
+        }
+    }
+
+    hal_buf_unref(tx_chain);
+
+    return status;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file hal_cpu_load.c
+ * @brief CPU負載與中斷佔用量測實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 中斷端只在臨界區內累加計數；區段結算在主循環以臨界區取得一致的快照，
+ * 比例計算在臨界區外進行。
+ */
+
+#include "../include/hal_cpu_load.h"
+#include "../include/hal.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 已完成的區段
+typedef struct {
+    uint32_t elapsed;                               // 區段實際長度
+    uint32_t busy;                                  // 非閒置週期 (含中斷)
+    uint32_t isr;                                   // 中斷週期
+    uint32_t isr_cycles[HAL_CPU_LOAD_MAX_ISRS];     // 各中斷的週期
+} cpu_load_slot_t;
+
+// 各中斷的累計統計
+typedef struct {
+    uint32_t count;
+    uint32_t total_cycles;
+    uint32_t max_cycles;
+    uint32_t slot_cycles;                           // 目前區段內的週期
+} cpu_load_isr_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static cpu_load_slot_t cpu_load_slots[HAL_CPU_LOAD_WINDOW_SLOTS];
+static uint16_t cpu_load_slot_next = 0;
+static uint16_t cpu_load_slot_count = 0;
+static uint16_t cpu_load_peak = 0;
+
+static uint32_t cpu_load_slot_cycles = 0;           // 0表示尚未初始化
+static uint32_t cpu_load_slot_start = 0;
+
+// 閒置狀態 (只由主循環存取)
+static bool cpu_load_idle = false;
+static uint32_t cpu_load_idle_start = 0;
+static uint32_t cpu_load_idle_isr_base = 0;
+static uint32_t cpu_load_idle_cycles = 0;           // 目前區段已結算的閒置週期
+
+// 中斷統計 (由中斷在臨界區內更新)
+static volatile uint32_t cpu_load_isr_total = 0;    // 所有中斷的累計週期 (迴繞)
+static volatile uint32_t cpu_load_isr_slot = 0;     // 目前區段內的中斷週期
+static cpu_load_isr_t cpu_load_isrs[HAL_CPU_LOAD_MAX_ISRS];
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 計算part/whole，單位0.01%
+ */
+static uint16_t cpu_load_ratio(uint64_t part, uint64_t whole)
+{
+    if (whole == 0U) {
+        return 0;
+    }
+    if (part >= whole) {
+        return (uint16_t)HAL_CPU_LOAD_FULL;
+    }
+
+    return (uint16_t)((part * HAL_CPU_LOAD_FULL) / whole);
+}
+
+/**
+ * @brief 將閒置期間累計到目前為止並從now重新起算 (呼叫者已進入臨界區)
+ */
+static void cpu_load_idle_account(uint32_t now)
+{
+    uint32_t isr_total = cpu_load_isr_total;
+    uint32_t idle = (now - cpu_load_idle_start) - (isr_total - cpu_load_idle_isr_base);
+
+    // 閒置期間進入的中斷時間已扣除，結果不會超過經過的時間
+    cpu_load_idle_cycles += idle;
+    cpu_load_idle_start = now;
+    cpu_load_idle_isr_base = isr_total;
+}
+
+/**
+ * @brief 依比例取出[from, to)區間的份額: x * to / total - x * from / total
+ * 各區間的份額相加恰為x
+ */
+static uint32_t cpu_load_share(uint32_t x, uint64_t from, uint64_t to, uint32_t total)
+{
+    return (uint32_t)(((uint64_t)x * to) / total - ((uint64_t)x * from) / total);
+}
+
+/**
+ * @brief 寫入一個已完成的區段並更新峰值
+ */
+static void cpu_load_slot_push(const cpu_load_slot_t* src)
+{
+    uint16_t load;
+
+    cpu_load_slots[cpu_load_slot_next] = *src;
+    cpu_load_slot_next = (uint16_t)((cpu_load_slot_next + 1U) % HAL_CPU_LOAD_WINDOW_SLOTS);
+    if (cpu_load_slot_count < HAL_CPU_LOAD_WINDOW_SLOTS) {
+        cpu_load_slot_count++;
+    }
+
+    load = cpu_load_ratio(src->busy, src->elapsed);
+    if (load > cpu_load_peak) {
+        cpu_load_peak = load;
+    }
+}
+
+/**
+ * @brief 區段到期時結算 (主循環呼叫)
+ * 結算晚了多個區段長度時，經過的時間切成相同數量的區段，
+ * 忙碌與中斷週期依長度平均分配 (這段期間內的峰值因此只反映平均)
+ */
+static void cpu_load_roll(void)
+{
+    hal_port_irq_state_t irq_state;
+    cpu_load_slot_t total;
+    cpu_load_slot_t slot;
+    uint32_t now;
+    uint32_t elapsed;
+    uint32_t periods;
+    uint32_t n;
+    uint16_t i;
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    now = hal_get_cycle_count();
+    elapsed = now - cpu_load_slot_start;
+    if (elapsed < cpu_load_slot_cycles) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return;
+    }
+
+    if (cpu_load_idle) {
+        cpu_load_idle_account(now);
+    }
+
+    total.elapsed = elapsed;
+    total.busy = (cpu_load_idle_cycles < elapsed) ? (elapsed - cpu_load_idle_cycles) : 0U;
+    total.isr = cpu_load_isr_slot;
+    for (i = 0; i < HAL_CPU_LOAD_MAX_ISRS; i++) {
+        total.isr_cycles[i] = cpu_load_isrs[i].slot_cycles;
+        cpu_load_isrs[i].slot_cycles = 0;
+    }
+
+    cpu_load_isr_slot = 0;
+    cpu_load_idle_cycles = 0;
+    cpu_load_slot_start = now;
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    // 切成periods個區段，最後一個區段包含不足一個區段長度的餘數；
+    // 超出視窗的較早區段會被覆蓋，直接略過
+    periods = elapsed / cpu_load_slot_cycles;
+    n = (periods > HAL_CPU_LOAD_WINDOW_SLOTS) ? (periods - HAL_CPU_LOAD_WINDOW_SLOTS) : 0U;
+
+    for (; n < periods; n++) {
+        uint64_t from = (uint64_t)n * cpu_load_slot_cycles;
+        uint64_t to = (n + 1U == periods) ? elapsed : from + cpu_load_slot_cycles;
+
+        slot.elapsed = (uint32_t)(to - from);
+        slot.busy = cpu_load_share(total.busy, from, to, elapsed);
+        slot.isr = cpu_load_share(total.isr, from, to, elapsed);
+        for (i = 0; i < HAL_CPU_LOAD_MAX_ISRS; i++) {
+            slot.isr_cycles[i] = cpu_load_share(total.isr_cycles[i], from, to, elapsed);
+        }
+
+        cpu_load_slot_push(&slot);
+    }
+}
+
+/* ========================================================================== */
+/*                             負載量測介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_cpu_load_init(uint32_t slot_cycles)
+{
+    if (slot_cycles == 0U || slot_cycles > 0x7FFFFFFFUL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    cpu_load_slot_cycles = slot_cycles;
+    hal_cpu_load_reset();
+
+    return HAL_OK;
+}
+
+void hal_cpu_load_reset(void)
+{
+    hal_port_irq_state_t irq_state;
+    uint16_t i;
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    for (i = 0; i < HAL_CPU_LOAD_MAX_ISRS; i++) {
+        cpu_load_isrs[i].count = 0;
+        cpu_load_isrs[i].total_cycles = 0;
+        cpu_load_isrs[i].max_cycles = 0;
+        cpu_load_isrs[i].slot_cycles = 0;
+    }
+
+    cpu_load_slot_next = 0;
+    cpu_load_slot_count = 0;
+    cpu_load_peak = 0;
+    cpu_load_isr_slot = 0;
+    cpu_load_idle_cycles = 0;
+    cpu_load_slot_start = hal_get_cycle_count();
+
+    if (cpu_load_idle) {
+        cpu_load_idle_start = cpu_load_slot_start;
+        cpu_load_idle_isr_base = cpu_load_isr_total;
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+}
+
+void hal_cpu_load_idle_enter(void)
+{
+    if (cpu_load_slot_cycles == 0U) {
+        return;
+    }
+
+    if (!cpu_load_idle) {
+        hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+        cpu_load_idle_start = hal_get_cycle_count();
+        cpu_load_idle_isr_base = cpu_load_isr_total;
+        cpu_load_idle = true;
+        HAL_PORT_IRQ_RESTORE(irq_state);
+    }
+
+    cpu_load_roll();
+}
+
+void hal_cpu_load_idle_exit(void)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (!cpu_load_idle) {
+        return;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+    cpu_load_idle_account(hal_get_cycle_count());
+    cpu_load_idle = false;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+}
+
+void hal_cpu_load_isr_enter(hal_cpu_load_stamp_t* stamp)
+{
+    // 先取時間再取中斷總和: 其間巢狀的中斷同時計入兩者，離開時互相抵消
+    stamp->start = hal_get_cycle_count();
+    stamp->nested = cpu_load_isr_total;
+}
+
+void hal_cpu_load_isr_exit(uint16_t isr_id, const hal_cpu_load_stamp_t* stamp)
+{
+    hal_port_irq_state_t irq_state;
+    uint32_t cycles;
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    // 扣除巢狀中斷的時間 (它們的時間已累加到cpu_load_isr_total)
+    cycles = (hal_get_cycle_count() - stamp->start) - (cpu_load_isr_total - stamp->nested);
+
+    cpu_load_isr_total += cycles;
+    cpu_load_isr_slot += cycles;
+
+    if (isr_id < HAL_CPU_LOAD_MAX_ISRS) {
+        cpu_load_isr_t* isr = &cpu_load_isrs[isr_id];
+
+        isr->count++;
+        isr->total_cycles += cycles;
+        isr->slot_cycles += cycles;
+        if (cycles > isr->max_cycles) {
+            isr->max_cycles = cycles;
+        }
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+}
+
+hal_status_t hal_cpu_load_get(hal_cpu_load_stats_t* stats)
+{
+    uint64_t elapsed = 0;
+    uint64_t busy = 0;
+    uint64_t isr = 0;
+    uint16_t i;
+
+    if (stats == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+    if (cpu_load_slot_cycles == 0U) {
+        return HAL_ERROR;
+    }
+
+    cpu_load_roll();
+
+    for (i = 0; i < cpu_load_slot_count; i++) {
+        elapsed += cpu_load_slots[i].elapsed;
+        busy += cpu_load_slots[i].busy;
+        isr += cpu_load_slots[i].isr;
+    }
+
+    stats->load = cpu_load_ratio(busy, elapsed);
+    stats->peak = cpu_load_peak;
+    stats->isr_load = cpu_load_ratio(isr, elapsed);
+    stats->slots = cpu_load_slot_count;
+    stats->window_cycles = (elapsed > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32_t)elapsed;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_cpu_load_get_isr(uint16_t isr_id, hal_cpu_load_isr_stats_t* stats)
+{
+    hal_port_irq_state_t irq_state;
+    uint64_t elapsed = 0;
+    uint64_t cycles = 0;
+    uint16_t i;
+
+    if (isr_id >= HAL_CPU_LOAD_MAX_ISRS || stats == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+    if (cpu_load_slot_cycles == 0U) {
+        return HAL_ERROR;
+    }
+
+    cpu_load_roll();
+
+    for (i = 0; i < cpu_load_slot_count; i++) {
+        elapsed += cpu_load_slots[i].elapsed;
+        cycles += cpu_load_slots[i].isr_cycles[isr_id];
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+    stats->count = cpu_load_isrs[isr_id].count;
+    stats->total_cycles = cpu_load_isrs[isr_id].total_cycles;
+    stats->max_cycles = cpu_load_isrs[isr_id].max_cycles;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    stats->load = cpu_load_ratio(cycles, elapsed);
+
+    return HAL_OK;
+}
@@ -0,0 +1,326 @@
+/**
+ * @file hal_crc.c
+ * @brief CRC計算實現 (硬體加速與軟體表格)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_crc.h"
+#include <limits.h>
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 緊縮資料逐段展開的暫存長度 (16位元char平台)
+#define CRC_STAGE_SIZE          32U
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static uint32_t crc_mask(uint8_t width)
+{
+    return 0xFFFFFFFFUL >> (32U - width);
+}
+
+static uint32_t crc_reflect(uint32_t value, uint8_t width)
+{
+    uint32_t result = 0;
+    uint8_t i;
+
+    for (i = 0; i < width; i++) {
+        result = (result << 1) | (value & 1UL);
+        value >>= 1;
+    }
+
+    return result;
+}
+
+/**
+ * @brief 處理一個位元組的8個位元
+ * 反射演算法使用靠右對齊的反射多項式，一般演算法使用靠左對齊的多項式
+ */
+static uint32_t crc_byte_bits(uint32_t reg, uint32_t poly, bool reflect)
+{
+    uint8_t bit;
+
+    for (bit = 0; bit < 8U; bit++) {
+        if (reflect) {
+            reg = (reg & 1UL) ? ((reg >> 1) ^ poly) : (reg >> 1);
+        } else {
+            reg = (reg & 0x80000000UL) ? ((reg << 1) ^ poly) : (reg << 1);
+        }
+    }
+
+    return reg;
+}
+
+static void crc_update_bitwise(hal_crc_t* crc, const uint8_t* data, uint32_t len)
+{
+    const hal_crc_config_t* cfg = &crc->config;
+    uint32_t i;
+
+    if (cfg->reflect_in) {
+        uint32_t poly = crc_reflect(cfg->poly, cfg->width);
+        uint32_t reg = crc->reg;
+
+        for (i = 0; i < len; i++) {
+            reg = crc_byte_bits(reg ^ (data[i] & 0xFFU), poly, true);
+        }
+        crc->reg = reg;
+    } else {
+        uint8_t shift = (uint8_t)(32U - cfg->width);
+        uint32_t poly = cfg->poly << shift;
+        uint32_t reg = crc->reg << shift;
+
+        for (i = 0; i < len; i++) {
+            reg = crc_byte_bits(reg ^ ((uint32_t)(data[i] & 0xFFU) << 24), poly, false);
+        }
+        crc->reg = reg >> shift;
+    }
+}
+
+static void crc_update_table(hal_crc_t* crc, const uint8_t* data, uint32_t len)
+{
+    const uint32_t (*t)[256] = crc->table->entry;
+    uint32_t reg;
+
+    if (crc->config.reflect_in) {
+        reg = crc->reg;
+
+        // 每次處理8個位元組，8個查表互相獨立
+        while (len >= 8U) {
+            uint32_t one = reg ^ ((uint32_t)(data[0] & 0xFFU) |
+                                  ((uint32_t)(data[1] & 0xFFU) << 8) |
+                                  ((uint32_t)(data[2] & 0xFFU) << 16) |
+                                  ((uint32_t)(data[3] & 0xFFU) << 24));
+            uint32_t two = (uint32_t)(data[4] & 0xFFU) |
+                           ((uint32_t)(data[5] & 0xFFU) << 8) |
+                           ((uint32_t)(data[6] & 0xFFU) << 16) |
+                           ((uint32_t)(data[7] & 0xFFU) << 24);
+
+            reg = t[7][one & 0xFFU] ^ t[6][(one >> 8) & 0xFFU] ^
+                  t[5][(one >> 16) & 0xFFU] ^ t[4][one >> 24] ^
+                  t[3][two & 0xFFU] ^ t[2][(two >> 8) & 0xFFU] ^
+                  t[1][(two >> 16) & 0xFFU] ^ t[0][two >> 24];
+            data += 8;
+            len -= 8U;
+        }
+
+        while (len > 0) {
+            reg = (reg >> 8) ^ t[0][(reg ^ *data) & 0xFFU];
+            data++;
+            len--;
+        }
+
+        crc->reg = reg;
+    } else {
+        uint8_t shift = (uint8_t)(32U - crc->config.width);
+        reg = crc->reg << shift;
+
+        while (len >= 8U) {
+            uint32_t one = reg ^ (((uint32_t)(data[0] & 0xFFU) << 24) |
+                                  ((uint32_t)(data[1] & 0xFFU) << 16) |
+                                  ((uint32_t)(data[2] & 0xFFU) << 8) |
+                                  (uint32_t)(data[3] & 0xFFU));
+            uint32_t two = ((uint32_t)(data[4] & 0xFFU) << 24) |
+                           ((uint32_t)(data[5] & 0xFFU) << 16) |
+                           ((uint32_t)(data[6] & 0xFFU) << 8) |
+                           (uint32_t)(data[7] & 0xFFU);
+
+            reg = t[7][one >> 24] ^ t[6][(one >> 16) & 0xFFU] ^
+                  t[5][(one >> 8) & 0xFFU] ^ t[4][one & 0xFFU] ^
+                  t[3][two >> 24] ^ t[2][(two >> 16) & 0xFFU] ^
+                  t[1][(two >> 8) & 0xFFU] ^ t[0][two & 0xFFU];
+            data += 8;
+            len -= 8U;
+        }
+
+        while (len > 0) {
+            reg = (reg << 8) ^ t[0][((reg >> 24) ^ *data) & 0xFFU];
+            data++;
+            len--;
+        }
+
+        crc->reg = reg >> shift;
+    }
+}
+
+static bool crc_config_valid(const hal_crc_config_t* config)
+{
+    return (config != NULL && config->width >= 1U && config->width <= 32U &&
+            (config->poly & ~crc_mask(config->width)) == 0);
+}
+
+/* ========================================================================== */
+/*                             CRC介面實現                                     */
+/* ========================================================================== */
+
+hal_status_t hal_crc_table_build(hal_crc_table_t* table, const hal_crc_config_t* config)
+{
+    uint32_t poly;
+    uint16_t i;
+    uint16_t k;
+
+    if (table == NULL || !crc_config_valid(config)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    poly = config->reflect_in ? crc_reflect(config->poly, config->width)
+                              : (config->poly << (32U - config->width));
+
+    for (i = 0; i < 256U; i++) {
+        table->entry[0][i] = config->reflect_in ? crc_byte_bits(i, poly, true)
+                                                : crc_byte_bits((uint32_t)i << 24, poly, false);
+    }
+
+    // entry[k][i]: 位元組i之後再接k個零位元組的結果
+    for (k = 1; k < 8U; k++) {
+        for (i = 0; i < 256U; i++) {
+            uint32_t prev = table->entry[k - 1U][i];
+
+            table->entry[k][i] = config->reflect_in ?
+                ((prev >> 8) ^ table->entry[0][prev & 0xFFU]) :
+                ((prev << 8) ^ table->entry[0][prev >> 24]);
+        }
+    }
+
+    table->poly = config->poly;
+    table->width = config->width;
+    table->reflect = config->reflect_in;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_crc_init(hal_crc_t* crc, const hal_crc_config_t* config,
+                          const hal_crc_table_t* table)
+{
+    if (crc == NULL || !crc_config_valid(config)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    if (table != NULL && (table->poly != config->poly || table->width != config->width ||
+                          table->reflect != config->reflect_in)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    crc->config = *config;
+    crc->table = table;
+    crc->engine = (table != NULL) ? HAL_CRC_ENGINE_TABLE : HAL_CRC_ENGINE_BITWISE;
+
+#if HAL_CRC_USE_HW
+    if (hal_crc_port_supported(config)) {
+        crc->engine = HAL_CRC_ENGINE_HW;
+    }
+#endif
+
+    hal_crc_reset(crc);
+
+    return HAL_OK;
+}
+
+void hal_crc_reset(hal_crc_t* crc)
+{
+    if (crc == NULL) {
+        return;
+    }
+
+    crc->reg = crc->config.init & crc_mask(crc->config.width);
+    if (crc->config.reflect_in) {
+        crc->reg = crc_reflect(crc->reg, crc->config.width);
+    }
+}
+
+void hal_crc_update(hal_crc_t* crc, const uint8_t* data, uint32_t len)
+{
+    if (crc == NULL || data == NULL || len == 0) {
+        return;
+    }
+
+    switch (crc->engine) {
+#if HAL_CRC_USE_HW
+        case HAL_CRC_ENGINE_HW:
+            crc->reg = hal_crc_port_update(&crc->config, crc->reg, data, len);
+            break;
+#endif
+        case HAL_CRC_ENGINE_TABLE:
+            crc_update_table(crc, data, len);
+            break;
+        case HAL_CRC_ENGINE_BITWISE:
+        default:
+            crc_update_bitwise(crc, data, len);
+            break;
+    }
+}
+
+#if CHAR_BIT != 8
+void hal_crc_update_packed(hal_crc_t* crc, const hal_packed_t* data, uint32_t len)
+{
+    uint8_t stage[CRC_STAGE_SIZE];
+    uint32_t offset = 0;
+
+    if (crc == NULL || data == NULL) {
+        return;
+    }
+
+    while (offset < len) {
+        uint16_t chunk = (len - offset > CRC_STAGE_SIZE) ? CRC_STAGE_SIZE
+                                                         : (uint16_t)(len - offset);
+
+        hal_packed_unpack(stage, &data[offset >> 1], chunk);
+        hal_crc_update(crc, stage, chunk);
+        offset += chunk;
+    }
+}
+#endif
+
+uint32_t hal_crc_final(const hal_crc_t* crc)
+{
+    uint32_t result;
+
+    if (crc == NULL) {
+        return 0;
+    }
+
+    result = crc->reg;
+    if (crc->config.reflect_in != crc->config.reflect_out) {
+        result = crc_reflect(result, crc->config.width);
+    }
+
+    return (result ^ crc->config.xor_out) & crc_mask(crc->config.width);
+}
+
+uint32_t hal_crc_compute(const hal_crc_config_t* config, const hal_crc_table_t* table,
+                         const uint8_t* data, uint32_t len)
+{
+    hal_crc_t crc;
+
+    if (hal_crc_init(&crc, config, table) != HAL_OK) {
+        return 0;
+    }
+
+    hal_crc_update(&crc, data, len);
+
+    return hal_crc_final(&crc);
+}
+
+hal_status_t hal_crc_check_image(const void* start, uint32_t size, uint32_t expected)
+{
+    static const hal_crc_config_t crc32_config = HAL_CRC_CONFIG_CRC32;
+    hal_crc_t crc;
+
+    if (start == NULL || hal_crc_init(&crc, &crc32_config, NULL) != HAL_OK) {
+        return HAL_INVALID_PARAM;
+    }
+
+#if CHAR_BIT == 8
+    hal_crc_update(&crc, (const uint8_t*)start, size);
+#else
+    // 16位元字組定址平台: 每個字包含兩個位元組
+    hal_crc_update_packed(&crc, (const hal_packed_t*)start, size);
+#endif
+
+    return (hal_crc_final(&crc) == expected) ? HAL_OK : HAL_ERROR;
+}
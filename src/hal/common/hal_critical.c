@@ -0,0 +1,76 @@
+/**
+ * @file hal_critical.c
+ * @brief 可巢狀臨界區實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 進入/離開臨界區為hal_critical.h中的內聯函式，此處為狀態查詢、
+ * C2000的優先權轉換表與主機端模擬。
+ */
+
+#include "../include/hal_critical.h"
+
+/* ========================================================================== */
+/*                             平台狀態                                        */
+/* ========================================================================== */
+
+#if defined(PLATFORM_TI_C2000)
+
+// hal_irq登記任何向量前，優先權臨界區遮罩所有群組
+uint16_t hal_critical_ier_keep[HAL_IRQ_PRIORITY_LEVELS];
+
+#elif !defined(PLATFORM_STM32)
+
+volatile uint32_t hal_critical_host_primask = 0;
+volatile uint32_t hal_critical_host_level = HAL_CRITICAL_HOST_LEVEL_NONE;
+
+#endif
+
+/* ========================================================================== */
+/*                             臨界區介面實現                                  */
+/* ========================================================================== */
+
+bool hal_critical_is_masked(uint16_t prio)
+{
+#if defined(PLATFORM_TI_C2000)
+    // 全域遮罩 (ST1.INTM)，或可能含有該優先權處理函式的群組IER位元全部為0
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+    bool masked = ((irq_state & 0x0001U) != 0U);
+    uint16_t groups = HAL_CRITICAL_IER_GROUPS & (uint16_t)~hal_critical_ier_keep[HAL_CRITICAL_PRIO(prio)];
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return masked || ((IER & groups) == 0U);
+#elif defined(PLATFORM_STM32)
+    uint32_t basepri = __get_BASEPRI() >> (8U - __NVIC_PRIO_BITS);
+
+    if (__get_PRIMASK() != 0U) {
+        return true;
+    }
+
+    return (basepri != 0U) && (HAL_CRITICAL_PRIO(prio) >= basepri);
+#else
+    return (hal_critical_host_primask != 0U) || (HAL_CRITICAL_PRIO(prio) >= hal_critical_host_level);
+#endif
+}
+
+#if defined(PLATFORM_TI_C2000)
+void hal_critical_update_ier_keep(const uint16_t group_lowest[])
+{
+    uint16_t prio;
+    uint16_t j;
+
+    // 與hal_irq入口相同: 群組內所有登記的優先權都高於prio時才保留
+    for (prio = 0; prio < HAL_IRQ_PRIORITY_LEVELS; prio++) {
+        uint16_t keep = 0U;
+
+        for (j = 0; j < 14U; j++) {  // INT1-INT14
+            if (group_lowest[j] != 0U && group_lowest[j] <= prio) {
+                keep |= (uint16_t)(1U << j);
+            }
+        }
+
+        hal_critical_ier_keep[prio] = keep;
+    }
+}
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file hal_debounce.c
+ * @brief 位元平行輸入消抖服務實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_debounce.h"
+#include "../include/hal_gpio.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 垂直計數器更新一個字
+ * 原始值與狀態相同的位元計數器重設為3；不同的位元每次減1，
+ * 從3減到0後再一次 (連續第4次) 時翻轉狀態並回到3
+ */
+static inline uint32_t debounce_word_update(hal_debounce_word_t* w, uint32_t raw)
+{
+    uint32_t delta = raw ^ w->state;
+    uint32_t toggle;
+
+    w->cnt0 = ~(w->cnt0 & delta);
+    w->cnt1 = w->cnt0 ^ (w->cnt1 & delta);
+    toggle = delta & w->cnt0 & w->cnt1;
+
+    w->state ^= toggle;
+    return toggle;
+}
+
+/* ========================================================================== */
+/*                             消抖介面實現                                    */
+/* ========================================================================== */
+
+hal_status_t hal_debounce_init(hal_debounce_t* deb)
+{
+    uint16_t i;
+
+    if (deb == NULL || deb->words == NULL || deb->count == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    for (i = 0; i < deb->count; i++) {
+        hal_debounce_word_t* w = &deb->words[i];
+
+        w->state = (deb->ports != NULL) ? hal_gpio_read_port(deb->ports[i]) : 0UL;
+        w->cnt0 = 0xFFFFFFFFUL;
+        w->cnt1 = 0xFFFFFFFFUL;
+        w->changed = 0;
+    }
+
+    return HAL_OK;
+}
+
+bool hal_debounce_sample(hal_debounce_t* deb)
+{
+    uint32_t any = 0;
+    uint16_t i;
+
+    for (i = 0; i < deb->count; i++) {
+        uint32_t toggle = debounce_word_update(&deb->words[i], hal_gpio_read_port(deb->ports[i]));
+
+        deb->words[i].changed |= toggle;
+        any |= toggle;
+    }
+
+    return (any != 0U);
+}
+
+bool hal_debounce_update(hal_debounce_t* deb, const uint32_t* raw)
+{
+    uint32_t any = 0;
+    uint16_t i;
+
+    for (i = 0; i < deb->count; i++) {
+        uint32_t toggle = debounce_word_update(&deb->words[i], raw[i]);
+
+        deb->words[i].changed |= toggle;
+        any |= toggle;
+    }
+
+    return (any != 0U);
+}
+
+uint32_t hal_debounce_get_state(const hal_debounce_t* deb, uint16_t word)
+{
+    if (deb == NULL || word >= deb->count) {
+        return 0;
+    }
+
+    return deb->words[word].state;
+}
+
+uint32_t hal_debounce_get_changed(hal_debounce_t* deb, uint16_t word)
+{
+    hal_port_irq_state_t irq_state;
+    uint32_t changed;
+
+    if (deb == NULL || word >= deb->count) {
+        return 0;
+    }
+
+    // 取樣可能在中斷中進行，讀取與清除需為原子操作
+    irq_state = HAL_PORT_IRQ_SAVE();
+    changed = deb->words[word].changed;
+    deb->words[word].changed = 0;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return changed;
+}
@@ -0,0 +1,517 @@
+/**
+ * @file hal_frame.c
+ * @brief 封包訊框層實現 (COBS/SLIP編碼與CRC檢查)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_frame.h"
+#include "../include/hal.h"
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 位元組為8位元的平台一次比對4個位元組 (C2000每個uint8_t佔16位元，逐一比對)
+#define FRAME_WORD_SCAN         (CHAR_BIT == 8)
+
+// COBS區塊最多254個非零位元組
+#define FRAME_COBS_MAX_RUN      254U
+
+/** 編碼來源: payload與CRC尾碼兩段 */
+typedef struct {
+    const uint8_t* data[2];
+    uint16_t len[2];
+} frame_source_t;
+
+/** 緩衝區輸出參數 */
+typedef struct {
+    uint8_t* out;
+    uint16_t size;
+    uint16_t len;
+} frame_buf_sink_t;
+
+/** UART輸出參數 */
+typedef struct {
+    hal_uart_id_t uart_id;
+    uint32_t timeout;
+} frame_uart_sink_t;
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 尋找第一個等於a或b的位元組
+ * @return 位元組索引，找不到時返回n
+ */
+static uint16_t frame_scan(const uint8_t* p, uint16_t n, uint8_t a, uint8_t b)
+{
+    uint16_t i = 0;
+
+#if FRAME_WORD_SCAN
+    // (x - 0x01) & ~x & 0x80 在x含有零位元組時不為零
+    const uint32_t ones = 0x01010101UL;
+    const uint32_t highs = 0x80808080UL;
+    const uint32_t mask_a = (uint32_t)a * ones;
+    const uint32_t mask_b = (uint32_t)b * ones;
+
+    // 以剩餘長度判斷，i + 4在n接近65535時會溢位
+    for (; (uint16_t)(n - i) >= 4U; i += 4U) {
+        uint32_t word;
+        uint32_t xa;
+        uint32_t xb;
+
+        memcpy(&word, &p[i], sizeof(word));
+        xa = word ^ mask_a;
+        xb = word ^ mask_b;
+        if ((((xa - ones) & ~xa) | ((xb - ones) & ~xb)) & highs) {
+            break;
+        }
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (p[i] == a || p[i] == b) {
+            break;
+        }
+    }
+
+    return i;
+}
+
+static uint16_t frame_crc_size(hal_frame_crc_t crc)
+{
+    switch (crc) {
+        case HAL_FRAME_CRC16:
+            return 2U;
+        case HAL_FRAME_CRC32:
+            return 4U;
+        case HAL_FRAME_CRC_NONE:
+        default:
+            return 0U;
+    }
+}
+
+/**
+ * @brief 計算CRC尾碼 (低位元組在前)
+ * @return 尾碼長度
+ */
+static uint16_t frame_crc_trailer(const hal_frame_config_t* config, const uint8_t* data,
+                                  uint16_t len, uint8_t* trailer)
+{
+    static const hal_crc_config_t crc16_config = HAL_CRC_CONFIG_CRC16_CCITT;
+    static const hal_crc_config_t crc32_config = HAL_CRC_CONFIG_CRC32;
+    uint32_t value;
+    uint16_t size = frame_crc_size(config->crc);
+    uint16_t i;
+
+    if (config->crc == HAL_FRAME_CRC16) {
+        value = hal_crc_compute(&crc16_config, config->crc_table, data, len);
+    } else if (config->crc == HAL_FRAME_CRC32) {
+        value = hal_crc_compute(&crc32_config, config->crc_table, data, len);
+    } else {
+        value = 0;
+    }
+
+    for (i = 0; i < size; i++) {
+        trailer[i] = (uint8_t)((value >> (i * 8U)) & 0xFFU);
+    }
+
+    return size;
+}
+
+static hal_status_t frame_encode_cobs(const frame_source_t* src, hal_frame_write_t write,
+                                      void* context)
+{
+    static const uint8_t delimiter = 0x00U;
+    uint16_t seg = 0;
+    uint16_t pos = 0;
+    bool end = false;
+    hal_status_t status = HAL_OK;
+
+    while (!end && status == HAL_OK) {
+        const uint8_t* run_data[2];
+        uint16_t run_len[2];
+        uint16_t runs = 0;
+        uint16_t total = 0;
+        uint16_t i;
+        uint8_t code;
+
+        // 收集最多254個非零位元組，可能跨越payload與CRC尾碼
+        while (total < FRAME_COBS_MAX_RUN) {
+            uint16_t limit;
+            uint16_t n;
+
+            while (seg < 2U && pos >= src->len[seg]) {
+                seg++;
+                pos = 0;
+            }
+            if (seg >= 2U) {
+                end = true;
+                break;
+            }
+
+            limit = src->len[seg] - pos;
+            if (limit > (uint16_t)(FRAME_COBS_MAX_RUN - total)) {
+                limit = FRAME_COBS_MAX_RUN - total;
+            }
+
+            n = frame_scan(&src->data[seg][pos], limit, 0x00U, 0x00U);
+            if (n > 0) {
+                run_data[runs] = &src->data[seg][pos];
+                run_len[runs] = n;
+                runs++;
+                total += n;
+                pos += n;
+            }
+
+            // 零位元組由區塊碼值表示，不輸出
+            if (n < limit) {
+                pos++;
+                break;
+            }
+        }
+
+        code = (uint8_t)(total + 1U);
+        status = write(context, &code, 1);
+        for (i = 0; i < runs && status == HAL_OK; i++) {
+            status = write(context, run_data[i], run_len[i]);
+        }
+    }
+
+    if (status == HAL_OK) {
+        status = write(context, &delimiter, 1);
+    }
+
+    return status;
+}
+
+static hal_status_t frame_encode_slip(const frame_source_t* src, hal_frame_write_t write,
+                                      void* context)
+{
+    static const uint8_t end_char = HAL_FRAME_SLIP_END;
+    static const uint8_t esc_end[2] = { HAL_FRAME_SLIP_ESC, HAL_FRAME_SLIP_ESC_END };
+    static const uint8_t esc_esc[2] = { HAL_FRAME_SLIP_ESC, HAL_FRAME_SLIP_ESC_ESC };
+    uint16_t seg;
+    hal_status_t status;
+
+    // 前置END讓接收端捨棄雜訊
+    status = write(context, &end_char, 1);
+
+    for (seg = 0; seg < 2U && status == HAL_OK; seg++) {
+        const uint8_t* p = src->data[seg];
+        uint16_t remaining = src->len[seg];
+
+        while (remaining > 0 && status == HAL_OK) {
+            uint16_t n = frame_scan(p, remaining, HAL_FRAME_SLIP_END, HAL_FRAME_SLIP_ESC);
+
+            if (n > 0) {
+                status = write(context, p, n);
+            }
+            if (n < remaining && status == HAL_OK) {
+                status = write(context, (p[n] == HAL_FRAME_SLIP_END) ? esc_end : esc_esc, 2);
+                n++;
+            }
+            p += n;
+            remaining -= n;
+        }
+    }
+
+    if (status == HAL_OK) {
+        status = write(context, &end_char, 1);
+    }
+
+    return status;
+}
+
+static hal_status_t frame_buf_write(void* context, const uint8_t* data, uint16_t len)
+{
+    frame_buf_sink_t* sink = (frame_buf_sink_t*)context;
+
+    if (len > (uint16_t)(sink->size - sink->len)) {
+        return HAL_ERROR;
+    }
+
+    memcpy(&sink->out[sink->len], data, len * sizeof(uint8_t));
+    sink->len += len;
+
+    return HAL_OK;
+}
+
+static hal_status_t frame_uart_write(void* context, const uint8_t* data, uint16_t len)
+{
+    const frame_uart_sink_t* sink = (const frame_uart_sink_t*)context;
+
+    return hal_uart_transmit(sink->uart_id, data, len, sink->timeout);
+}
+
+static bool frame_append(hal_frame_decoder_t* decoder, uint8_t data)
+{
+    if (decoder->len >= decoder->size) {
+        decoder->discard = true;
+        return false;
+    }
+
+    decoder->buffer[decoder->len] = data;
+    decoder->len++;
+
+    return true;
+}
+
+/**
+ * @brief 收到分隔字元時檢查訊框
+ */
+static hal_status_t frame_finish(hal_frame_decoder_t* decoder, uint16_t* frame_len)
+{
+    hal_status_t status = HAL_OK;
+    uint16_t crc_size = frame_crc_size(decoder->config.crc);
+
+    // 連續分隔字元之間沒有內容
+    if (!decoder->started) {
+        hal_frame_decoder_reset(decoder);
+        return HAL_BUSY;
+    }
+
+    if (decoder->discard || decoder->escape || decoder->left != 0 || decoder->len < crc_size) {
+        status = HAL_ERROR;
+    } else if (crc_size > 0) {
+        uint8_t trailer[HAL_FRAME_CRC_MAX_SIZE];
+        uint16_t payload_len = decoder->len - crc_size;
+
+        (void)frame_crc_trailer(&decoder->config, decoder->buffer, payload_len, trailer);
+        if (memcmp(trailer, &decoder->buffer[payload_len], crc_size * sizeof(uint8_t)) != 0) {
+            status = HAL_ERROR;
+        }
+    }
+
+    if (status == HAL_OK && frame_len != NULL) {
+        *frame_len = decoder->len - crc_size;
+    }
+
+    hal_frame_decoder_reset(decoder);
+
+    return status;
+}
+
+/* ========================================================================== */
+/*                             編碼介面實現                                    */
+/* ========================================================================== */
+
+hal_status_t hal_frame_encode(const hal_frame_config_t* config, const uint8_t* data, uint16_t len,
+                              hal_frame_write_t write, void* context)
+{
+    uint8_t trailer[HAL_FRAME_CRC_MAX_SIZE];
+    frame_source_t src;
+
+    if (config == NULL || write == NULL || (data == NULL && len > 0)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 沒有CRC的空SLIP訊框只有兩個END，與訊框間的分隔無法區分，接收端會忽略
+    if (config->encoding == HAL_FRAME_SLIP && config->crc == HAL_FRAME_CRC_NONE && len == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    src.data[0] = data;
+    src.len[0] = len;
+    src.data[1] = trailer;
+    src.len[1] = frame_crc_trailer(config, data, len, trailer);
+
+    if (config->encoding == HAL_FRAME_SLIP) {
+        return frame_encode_slip(&src, write, context);
+    }
+
+    return frame_encode_cobs(&src, write, context);
+}
+
+hal_status_t hal_frame_encode_buf(const hal_frame_config_t* config, const uint8_t* data,
+                                  uint16_t len, uint8_t* out, uint16_t out_size,
+                                  uint16_t* out_len)
+{
+    frame_buf_sink_t sink;
+    hal_status_t status;
+
+    if (out == NULL || out_len == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    sink.out = out;
+    sink.size = out_size;
+    sink.len = 0;
+
+    status = hal_frame_encode(config, data, len, frame_buf_write, &sink);
+    *out_len = sink.len;
+
+    return status;
+}
+
+hal_status_t hal_frame_send(hal_uart_id_t uart_id, const hal_frame_config_t* config,
+                            const uint8_t* data, uint16_t len, uint32_t timeout)
+{
+    frame_uart_sink_t sink;
+
+    sink.uart_id = uart_id;
+    sink.timeout = timeout;
+
+    return hal_frame_encode(config, data, len, frame_uart_write, &sink);
+}
+
+/* ========================================================================== */
+/*                             解碼介面實現                                    */
+/* ========================================================================== */
+
+hal_status_t hal_frame_decoder_init(hal_frame_decoder_t* decoder, const hal_frame_config_t* config,
+                                    uint8_t* buffer, uint16_t size)
+{
+    if (decoder == NULL || config == NULL || buffer == NULL ||
+        size < frame_crc_size(config->crc)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    decoder->config = *config;
+    decoder->buffer = buffer;
+    decoder->size = size;
+    hal_frame_decoder_reset(decoder);
+
+    return HAL_OK;
+}
+
+void hal_frame_decoder_reset(hal_frame_decoder_t* decoder)
+{
+    if (decoder == NULL) {
+        return;
+    }
+
+    decoder->len = 0;
+    decoder->code = 0;
+    decoder->left = 0;
+    decoder->escape = false;
+    decoder->discard = false;
+    decoder->started = false;
+}
+
+hal_status_t hal_frame_decode(hal_frame_decoder_t* decoder, const uint8_t* data, uint16_t len,
+                              uint16_t* consumed, uint16_t* frame_len)
+{
+    bool cobs;
+    uint8_t delimiter;
+    uint16_t i = 0;
+
+    if (decoder == NULL || consumed == NULL || (data == NULL && len > 0)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    cobs = (decoder->config.encoding == HAL_FRAME_COBS);
+    delimiter = cobs ? 0x00U : HAL_FRAME_SLIP_END;
+
+    while (i < len) {
+        uint8_t byte;
+
+        // 一般資料整段複製，只有碼值、跳脫與分隔字元逐一處理
+        if (!decoder->discard && (cobs ? (decoder->left > 0) : !decoder->escape)) {
+            uint16_t n = len - i;
+            uint16_t run;
+
+            if (cobs && n > decoder->left) {
+                n = decoder->left;
+            }
+            run = cobs ? frame_scan(&data[i], n, 0x00U, 0x00U)
+                       : frame_scan(&data[i], n, HAL_FRAME_SLIP_END, HAL_FRAME_SLIP_ESC);
+
+            if (run > 0) {
+                if (run > (uint16_t)(decoder->size - decoder->len)) {
+                    decoder->discard = true;
+                } else {
+                    memcpy(&decoder->buffer[decoder->len], &data[i], run * sizeof(uint8_t));
+                    decoder->len += run;
+                }
+                if (cobs) {
+                    decoder->left -= (uint8_t)run;
+                }
+                decoder->started = true;
+                i += run;
+                continue;
+            }
+        }
+
+        byte = (uint8_t)(data[i] & 0xFFU);
+        i++;
+
+        if (byte == delimiter) {
+            hal_status_t status = frame_finish(decoder, frame_len);
+            if (status != HAL_BUSY) {
+                *consumed = i;
+                return status;
+            }
+            continue;
+        }
+
+        decoder->started = true;
+        if (decoder->discard) {
+            continue;
+        }
+
+        if (cobs) {
+            // 新區塊: 前一區塊未滿254個位元組時代表一個零位元組
+            if (decoder->code != 0 && decoder->code != 0xFFU) {
+                (void)frame_append(decoder, 0x00U);
+            }
+            decoder->code = byte;
+            decoder->left = (uint8_t)(byte - 1U);
+        } else if (decoder->escape) {
+            decoder->escape = false;
+            if (byte == HAL_FRAME_SLIP_ESC_END) {
+                (void)frame_append(decoder, HAL_FRAME_SLIP_END);
+            } else if (byte == HAL_FRAME_SLIP_ESC_ESC) {
+                (void)frame_append(decoder, HAL_FRAME_SLIP_ESC);
+            } else {
+                decoder->discard = true;
+            }
+        } else {
+            // 整段複製只會停在ESC
+            decoder->escape = true;
+        }
+    }
+
+    *consumed = i;
+
+    return HAL_BUSY;
+}
+
+hal_status_t hal_frame_receive(hal_uart_id_t uart_id, hal_frame_decoder_t* decoder,
+                               uint16_t* frame_len, uint32_t timeout)
+{
+    uint32_t start_tick = hal_get_tick();
+    hal_status_t status = HAL_BUSY;
+
+    if (decoder == NULL || frame_len == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    while (status == HAL_BUSY) {
+        uint8_t byte;
+        uint16_t consumed;
+        uint32_t wait = 0;
+
+        if (timeout != 0) {
+            uint32_t elapsed = hal_get_tick() - start_tick;
+            if (elapsed >= timeout) {
+                return HAL_TIMEOUT;
+            }
+            wait = timeout - elapsed;
+        }
+
+        status = hal_uart_getchar(uart_id, &byte, wait);
+        if (status != HAL_OK) {
+            return status;
+        }
+
+        status = hal_frame_decode(decoder, &byte, 1, &consumed, frame_len);
+    }
+
+    return status;
+}
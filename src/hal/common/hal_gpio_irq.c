@@ -0,0 +1,304 @@
+/**
+ * @file hal_gpio_irq.c
+ * @brief GPIO邊沿中斷分派與事件佇列實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 平台只負責把引腳接到中斷線 (STM32 EXTI、C2000 Input X-BAR + XINT)，
+ * 中斷服務程式呼叫hal_gpio_irq_dispatch()，回呼與事件佇列在此處理。
+ * 事件佇列與hal_work相同，為帶序號槽位的多生產者單消費者佇列，
+ * 不同優先權的中斷線可互相搶占寫入。
+ */
+
+#include "../include/hal_gpio.h"
+#include "../include/hal_port.h"
+#include "../include/hal.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define GPIO_EVENT_QUEUE_MASK   ((uint32_t)HAL_GPIO_EVENT_QUEUE_SIZE - 1UL)
+
+typedef struct {
+    hal_gpio_pin_t pin;
+    hal_gpio_edge_t edge;
+    hal_gpio_irq_callback_t callback;   // NULL表示事件模式
+    void* context;
+    volatile bool active;
+} gpio_irq_slot_t;
+
+typedef struct {
+    volatile uint32_t sequence;
+    hal_gpio_event_t event;
+} gpio_event_cell_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static gpio_irq_slot_t gpio_irq_slots[HAL_GPIO_IRQ_MAX_LINES];
+
+static gpio_event_cell_t gpio_event_cells[HAL_GPIO_EVENT_QUEUE_SIZE];
+static volatile uint32_t gpio_event_enqueue_pos = 0;
+static volatile uint32_t gpio_event_dequeue_pos = 0;
+static bool gpio_event_initialized = false;
+
+// 統計用，中斷巢狀時可能少計
+static volatile uint32_t gpio_event_dropped = 0;
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static void gpio_event_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < HAL_GPIO_EVENT_QUEUE_SIZE; i++) {
+        gpio_event_cells[i].sequence = i;
+    }
+
+    gpio_event_enqueue_pos = 0;
+    gpio_event_dequeue_pos = 0;
+    gpio_event_dropped = 0;
+    gpio_event_initialized = true;
+}
+
+static void gpio_event_push(hal_gpio_pin_t pin, hal_gpio_edge_t edge, uint32_t timestamp)
+{
+    gpio_event_cell_t* cell;
+    uint32_t pos;
+
+    pos = gpio_event_enqueue_pos;
+    while (1) {
+        int32_t diff;
+
+        cell = &gpio_event_cells[pos & GPIO_EVENT_QUEUE_MASK];
+        diff = (int32_t)(cell->sequence - pos);
+
+        if (diff == 0) {
+            if (hal_port_cas32(&gpio_event_enqueue_pos, pos, pos + 1UL)) {
+                break;
+            }
+            pos = gpio_event_enqueue_pos;
+        } else if (diff < 0) {
+            gpio_event_dropped++;
+            return;
+        } else {
+            pos = gpio_event_enqueue_pos;
+        }
+    }
+
+    cell->event.timestamp = timestamp;
+    cell->event.pin = pin;
+    cell->event.edge = edge;
+    HAL_PORT_MEMORY_BARRIER();
+    cell->sequence = pos + 1UL;
+}
+
+static void gpio_irq_deliver(const gpio_irq_slot_t* slot, hal_gpio_edge_t edge, uint32_t timestamp)
+{
+    if (slot->callback != NULL) {
+        slot->callback(slot->pin, edge, slot->context);
+    } else {
+        gpio_event_push(slot->pin, edge, timestamp);
+    }
+}
+
+static int16_t gpio_irq_find(hal_gpio_pin_t pin)
+{
+    uint16_t line;
+
+    for (line = 0; line < HAL_GPIO_IRQ_MAX_LINES; line++) {
+        if (gpio_irq_slots[line].active && gpio_irq_slots[line].pin == pin) {
+            return (int16_t)line;
+        }
+    }
+
+    return -1;
+}
+
+static hal_status_t gpio_irq_attach(hal_gpio_pin_t pin, hal_gpio_edge_t edge,
+                                    hal_gpio_irq_callback_t callback, void* context)
+{
+    gpio_irq_slot_t* slot;
+    hal_status_t status;
+    uint16_t lines;
+    uint16_t line;
+
+    if (edge < HAL_GPIO_EDGE_RISING || edge > HAL_GPIO_EDGE_BOTH) {
+        return HAL_INVALID_PARAM;
+    }
+
+    if (gpio_irq_find(pin) >= 0) {
+        return HAL_BUSY;
+    }
+
+    lines = hal_gpio_port_irq_lines(pin);
+    if (lines == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 選擇引腳可用的第一條空閒中斷線
+    for (line = 0; line < HAL_GPIO_IRQ_MAX_LINES; line++) {
+        if ((lines & (1U << line)) != 0U && !gpio_irq_slots[line].active) {
+            break;
+        }
+    }
+    if (line >= HAL_GPIO_IRQ_MAX_LINES) {
+        return HAL_BUSY;
+    }
+
+    slot = &gpio_irq_slots[line];
+    slot->pin = pin;
+    slot->edge = edge;
+    slot->callback = callback;
+    slot->context = context;
+    HAL_PORT_MEMORY_BARRIER();
+    slot->active = true;
+
+    status = hal_gpio_port_irq_enable(line, pin, edge);
+    if (status != HAL_OK) {
+        slot->active = false;
+    }
+
+    return status;
+}
+
+/* ========================================================================== */
+/*                             GPIO中斷介面實現                               */
+/* ========================================================================== */
+
+hal_status_t hal_gpio_attach_irq(hal_gpio_pin_t pin, hal_gpio_edge_t edge,
+                                 hal_gpio_irq_callback_t callback, void* context)
+{
+    if (callback == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    return gpio_irq_attach(pin, edge, callback, context);
+}
+
+hal_status_t hal_gpio_attach_irq_event(hal_gpio_pin_t pin, hal_gpio_edge_t edge)
+{
+    // 佇列在第一次註冊事件模式時初始化
+    if (!gpio_event_initialized) {
+        gpio_event_init();
+    }
+
+    return gpio_irq_attach(pin, edge, NULL, NULL);
+}
+
+hal_status_t hal_gpio_detach_irq(hal_gpio_pin_t pin)
+{
+    int16_t line = gpio_irq_find(pin);
+
+    if (line < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    hal_gpio_port_irq_disable((uint16_t)line);
+    gpio_irq_slots[line].active = false;
+
+    return HAL_OK;
+}
+
+bool hal_gpio_event_read(hal_gpio_event_t* event)
+{
+    uint32_t pos = gpio_event_dequeue_pos;
+    gpio_event_cell_t* cell = &gpio_event_cells[pos & GPIO_EVENT_QUEUE_MASK];
+
+    if (event == NULL || !gpio_event_initialized) {
+        return false;
+    }
+
+    if ((int32_t)(cell->sequence - (pos + 1UL)) < 0) {
+        return false;
+    }
+
+    *event = cell->event;
+
+    HAL_PORT_MEMORY_BARRIER();
+    cell->sequence = pos + GPIO_EVENT_QUEUE_MASK + 1UL;
+    gpio_event_dequeue_pos = pos + 1UL;
+
+    return true;
+}
+
+uint32_t hal_gpio_event_get_dropped(void)
+{
+    return gpio_event_dropped;
+}
+
+hal_status_t hal_gpio_irq_inject(hal_gpio_pin_t pin, hal_gpio_edge_t edge, uint32_t timestamp)
+{
+    int16_t line = gpio_irq_find(pin);
+
+    if (line < 0 || (edge != HAL_GPIO_EDGE_RISING && edge != HAL_GPIO_EDGE_FALLING)) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 與硬體相同，未選擇的邊沿不觸發
+    if ((gpio_irq_slots[line].edge & edge) == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    gpio_irq_deliver(&gpio_irq_slots[line], edge, timestamp);
+
+    return HAL_OK;
+}
+
+void hal_gpio_irq_dispatch(uint16_t line, hal_gpio_state_t level)
+{
+    uint32_t timestamp = hal_get_cycle_count();
+    const gpio_irq_slot_t* slot;
+    hal_gpio_edge_t edge;
+
+    if (line >= HAL_GPIO_IRQ_MAX_LINES) {
+        return;
+    }
+
+    slot = &gpio_irq_slots[line];
+    if (!slot->active) {
+        return;
+    }
+
+    // 雙沿觸發時以中斷發生時的電位判斷邊沿
+    edge = slot->edge;
+    if (edge == HAL_GPIO_EDGE_BOTH) {
+        edge = (level == HAL_GPIO_HIGH) ? HAL_GPIO_EDGE_RISING : HAL_GPIO_EDGE_FALLING;
+    }
+
+    gpio_irq_deliver(slot, edge, timestamp);
+}
+
+/* ========================================================================== */
+/*                             主機端模擬移植                                  */
+/* ========================================================================== */
+
+#if !defined(PLATFORM_TI_C2000) && !defined(PLATFORM_STM32)
+
+// 主機端沒有中斷硬體，任何引腳皆可使用所有中斷線，邊沿由hal_gpio_irq_inject()注入
+
+uint16_t hal_gpio_port_irq_lines(hal_gpio_pin_t pin)
+{
+    (void)pin;
+    return (uint16_t)((1UL << HAL_GPIO_IRQ_MAX_LINES) - 1UL);
+}
+
+hal_status_t hal_gpio_port_irq_enable(uint16_t line, hal_gpio_pin_t pin, hal_gpio_edge_t edge)
+{
+    (void)line;
+    (void)pin;
+    (void)edge;
+    return HAL_OK;
+}
+
+void hal_gpio_port_irq_disable(uint16_t line)
+{
+    (void)line;
+}
+
+#endif /* !PLATFORM_TI_C2000 && !PLATFORM_STM32 */
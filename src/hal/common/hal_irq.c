@@ -0,0 +1,200 @@
+/**
+ * @file hal_irq.c
+ * @brief 可巢狀優先權中斷分派主機端模擬
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * STM32與C2000的實現位於各平台目錄，此處以待處理旗標模擬中斷:
+ * hal_irq_trigger()設置旗標後立即分派，優先權高於目前執行中的處理函式
+ * 且未被hal_critical遮罩時巢狀呼叫，否則保留到外層處理函式返回或
+ * 下一次呼叫hal_irq_host_dispatch()。
+ */
+
+#include "../include/hal_irq.h"
+#include "../include/hal_critical.h"
+#include <stddef.h>
+
+#if !defined(PLATFORM_TI_C2000) && !defined(PLATFORM_STM32)
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+typedef struct {
+    hal_irq_handler_t handler;      // NULL表示空槽位
+    uint32_t vector;
+    uint16_t priority;
+    bool enabled;
+    bool pending;
+} irq_host_slot_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static irq_host_slot_t irq_slots[HAL_IRQ_MAX_HANDLERS];
+static uint16_t irq_current_priority = HAL_IRQ_PRIORITY_LEVELS;
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static irq_host_slot_t* irq_find(uint32_t vector)
+{
+    uint16_t i;
+
+    for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+        if (irq_slots[i].handler != NULL && irq_slots[i].vector == vector) {
+            return &irq_slots[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 找出可搶占目前程式的最高優先權待處理中斷
+ */
+static irq_host_slot_t* irq_next_pending(void)
+{
+    irq_host_slot_t* best = NULL;
+    uint16_t i;
+
+    if (hal_critical_host_primask != 0U) {
+        return NULL;
+    }
+
+    for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+        irq_host_slot_t* s = &irq_slots[i];
+
+        if (s->handler == NULL || !s->enabled || !s->pending ||
+            s->priority >= irq_current_priority || s->priority >= hal_critical_host_level) {
+            continue;
+        }
+
+        if (best == NULL || s->priority < best->priority) {
+            best = s;
+        }
+    }
+
+    return best;
+}
+
+/* ========================================================================== */
+/*                             中斷分派介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_irq_register(uint32_t vector, hal_irq_handler_t handler, uint16_t priority)
+{
+    irq_host_slot_t* s;
+    uint16_t i;
+
+    if (handler == NULL || priority >= HAL_IRQ_PRIORITY_LEVELS) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s = irq_find(vector);
+    if (s == NULL) {
+        for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+            if (irq_slots[i].handler == NULL) {
+                break;
+            }
+        }
+
+        if (i == HAL_IRQ_MAX_HANDLERS) {
+            return HAL_BUSY;
+        }
+
+        s = &irq_slots[i];
+        s->pending = false;
+    }
+
+    s->vector = vector;
+    s->priority = priority;
+    s->handler = handler;
+    s->enabled = true;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_unregister(uint32_t vector)
+{
+    irq_host_slot_t* s = irq_find(vector);
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s->handler = NULL;
+    s->enabled = false;
+    s->pending = false;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_enable(uint32_t vector)
+{
+    irq_host_slot_t* s = irq_find(vector);
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s->enabled = true;
+    hal_irq_host_dispatch();
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_disable(uint32_t vector)
+{
+    irq_host_slot_t* s = irq_find(vector);
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s->enabled = false;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_trigger(uint32_t vector)
+{
+    irq_host_slot_t* s = irq_find(vector);
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s->pending = true;
+    hal_irq_host_dispatch();
+
+    return HAL_OK;
+}
+
+uint16_t hal_irq_current_priority(void)
+{
+    return irq_current_priority;
+}
+
+/* ========================================================================== */
+/*                             主機端模擬介面                                  */
+/* ========================================================================== */
+
+void hal_irq_host_dispatch(void)
+{
+    irq_host_slot_t* s;
+
+    // 處理函式中觸發的較高優先權中斷在巢狀呼叫中執行，較低的在此迴圈中依序執行
+    while ((s = irq_next_pending()) != NULL) {
+        uint16_t saved_priority = irq_current_priority;
+
+        s->pending = false;
+        irq_current_priority = s->priority;
+        s->handler();
+        irq_current_priority = saved_priority;
+    }
+}
+
+#endif /* !PLATFORM_TI_C2000 && !PLATFORM_STM32 */
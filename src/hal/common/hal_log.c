@@ -0,0 +1,189 @@
+/**
+ * @file hal_log.c
+ * @brief 延後二進位日誌實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 記錄佇列與hal_work相同，為帶序號槽位的多生產者單消費者佇列。
+ * 寫入端只保留槽位並複製參數，編碼與發送都在消化端進行。
+ */
+
+#include "../include/hal_log.h"
+#include "../include/hal_frame.h"
+#include "../include/hal_port.h"
+#include "../include/hal.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define LOG_QUEUE_MASK      ((uint32_t)HAL_LOG_QUEUE_SIZE - 1UL)
+
+// header + 格式ID + tick差 + 參數，每個varint最多5個位元組
+#define LOG_PAYLOAD_MAX     (1U + 5U + 5U + (5U * HAL_LOG_MAX_ARGS))
+
+typedef struct {
+    volatile uint32_t sequence;
+    const char* fmt;
+    uint32_t tick;
+    uint16_t nargs;
+    hal_log_arg_t args[HAL_LOG_MAX_ARGS];
+} log_cell_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static log_cell_t log_cells[HAL_LOG_QUEUE_SIZE];
+static volatile uint32_t log_enqueue_pos = 0;
+static volatile uint32_t log_dequeue_pos = 0;
+
+// 統計用，中斷巢狀時可能少計
+static volatile uint32_t log_dropped = 0;
+static uint32_t log_dropped_reported = 0;
+
+static hal_uart_id_t log_uart;
+static uint32_t log_last_tick = 0;
+
+static const hal_frame_config_t log_frame_config = { HAL_FRAME_COBS, HAL_LOG_FRAME_CRC, NULL };
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static uint16_t log_put_varint(uint8_t* out, uint32_t value)
+{
+    uint16_t len = 0;
+
+    while (value >= 0x80UL) {
+        out[len++] = (uint8_t)((value & 0x7FUL) | 0x80UL);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+
+    return len;
+}
+
+static void log_send_dropped(uint32_t count)
+{
+    uint8_t payload[1U + 5U];
+    uint16_t len = 0;
+
+    payload[len++] = (uint8_t)(HAL_LOG_TYPE_DROPPED << 4);
+    len += log_put_varint(&payload[len], count);
+
+    (void)hal_frame_send(log_uart, &log_frame_config, payload, len, 1000);
+}
+
+/* ========================================================================== */
+/*                             日誌介面實現                                    */
+/* ========================================================================== */
+
+hal_status_t hal_log_init(hal_uart_id_t uart_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < HAL_LOG_QUEUE_SIZE; i++) {
+        log_cells[i].sequence = i;
+    }
+
+    log_enqueue_pos = 0;
+    log_dequeue_pos = 0;
+    log_dropped = 0;
+    log_dropped_reported = 0;
+    log_uart = uart_id;
+    log_last_tick = hal_get_tick();
+
+    return HAL_OK;
+}
+
+void hal_log_write(const char* fmt, uint16_t nargs, const hal_log_arg_t* args)
+{
+    log_cell_t* cell;
+    uint32_t pos;
+    uint16_t i;
+
+    pos = log_enqueue_pos;
+    while (1) {
+        int32_t diff;
+
+        cell = &log_cells[pos & LOG_QUEUE_MASK];
+        diff = (int32_t)(cell->sequence - pos);
+
+        if (diff == 0) {
+            if (hal_port_cas32(&log_enqueue_pos, pos, pos + 1UL)) {
+                break;
+            }
+            pos = log_enqueue_pos;
+        } else if (diff < 0) {
+            log_dropped++;
+            return;
+        } else {
+            pos = log_enqueue_pos;
+        }
+    }
+
+    if (nargs > HAL_LOG_MAX_ARGS) {
+        nargs = HAL_LOG_MAX_ARGS;
+    }
+
+    cell->fmt = fmt;
+    cell->tick = hal_get_tick();
+    cell->nargs = nargs;
+    for (i = 0; i < nargs; i++) {
+        cell->args[i] = args[i];
+    }
+    HAL_PORT_MEMORY_BARRIER();
+    cell->sequence = pos + 1UL;
+}
+
+uint32_t hal_log_drain(uint32_t max_records)
+{
+    uint8_t payload[LOG_PAYLOAD_MAX];
+    uint32_t sent = 0;
+    uint32_t dropped = log_dropped;
+
+    // 先回報遺失數量，主機端可在對應位置標示
+    if (dropped != log_dropped_reported) {
+        log_send_dropped(dropped - log_dropped_reported);
+        log_dropped_reported = dropped;
+    }
+
+    while (max_records == 0 || sent < max_records) {
+        uint32_t pos = log_dequeue_pos;
+        log_cell_t* cell = &log_cells[pos & LOG_QUEUE_MASK];
+        int32_t delta;
+        uint16_t len = 0;
+        uint16_t i;
+
+        if ((int32_t)(cell->sequence - (pos + 1UL)) < 0) {
+            break;
+        }
+
+        // 在釋放槽位前完成編碼
+        delta = (int32_t)(cell->tick - log_last_tick);
+        log_last_tick = cell->tick;
+
+        payload[len++] = (uint8_t)((HAL_LOG_TYPE_RECORD << 4) | (cell->nargs & 0x0FU));
+        len += log_put_varint(&payload[len], (uint32_t)(uintptr_t)cell->fmt);
+        len += log_put_varint(&payload[len], ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+        for (i = 0; i < cell->nargs; i++) {
+            len += log_put_varint(&payload[len], cell->args[i]);
+        }
+
+        HAL_PORT_MEMORY_BARRIER();
+        cell->sequence = pos + LOG_QUEUE_MASK + 1UL;
+        log_dequeue_pos = pos + 1UL;
+
+        (void)hal_frame_send(log_uart, &log_frame_config, payload, len, 1000);
+        sent++;
+    }
+
+    return sent;
+}
+
+uint32_t hal_log_get_dropped(void)
+{
+    return log_dropped;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file hal_packed.c
+ * @brief 緊縮位元組緩衝區實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_packed.h"
+
+/* ========================================================================== */
+/*                             緊縮緩衝區介面實現                              */
+/* ========================================================================== */
+
+void hal_packed_pack(hal_packed_t* dst, const uint8_t* src, uint16_t len)
+{
+    uint16_t i;
+
+    // 整字寫入，不需先讀取目的內容
+    for (i = 0; (uint16_t)(i + 1U) < len; i += 2U) {
+        dst[i >> 1] = (hal_packed_t)((src[i] & 0xFFU) | ((src[i + 1U] & 0xFFU) << 8));
+    }
+
+    if (i < len) {
+        hal_packed_set(dst, i, src[i]);
+    }
+}
+
+void hal_packed_unpack(uint8_t* dst, const hal_packed_t* src, uint16_t len)
+{
+    uint16_t i;
+
+    for (i = 0; (uint16_t)(i + 1U) < len; i += 2U) {
+        hal_packed_t word = src[i >> 1];
+        dst[i] = (uint8_t)(word & 0xFFU);
+        dst[i + 1U] = (uint8_t)((word >> 8) & 0xFFU);
+    }
+
+    if (i < len) {
+        dst[i] = (uint8_t)hal_packed_get(src, i);
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * @file hal_packed_spi.c
+ * @brief 緊縮緩衝區SPI傳輸實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 依賴平台的hal_spi_*驅動，只在平台提供SPI時建置 (見makefiles/hal_common.mk)。
+ */
+
+#include "../include/hal_packed.h"
+#include "../include/hal_spi.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 傳輸時逐段展開的暫存長度 (與SCI FIFO深度相同)
+#define PACKED_STAGE_SIZE       16U
+
+/* ========================================================================== */
+/*                             緊縮傳輸介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_spi_transmit_receive_packed(hal_spi_id_t spi_id, const hal_packed_t* tx_data,
+                                             hal_packed_t* rx_data, uint16_t size,
+                                             uint32_t timeout)
+{
+    uint8_t tx_stage[PACKED_STAGE_SIZE];
+    uint8_t rx_stage[PACKED_STAGE_SIZE];
+    uint16_t offset = 0;
+    hal_status_t status = HAL_OK;
+
+    if (tx_data == NULL || rx_data == NULL || size == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    while (offset < size && status == HAL_OK) {
+        uint16_t chunk = size - offset;
+        if (chunk > PACKED_STAGE_SIZE) {
+            chunk = PACKED_STAGE_SIZE;
+        }
+
+        hal_packed_unpack(tx_stage, &tx_data[offset >> 1], chunk);
+        status = hal_spi_transmit_receive(spi_id, tx_stage, rx_stage, chunk, timeout);
+        if (status == HAL_OK) {
+            hal_packed_pack(&rx_data[offset >> 1], rx_stage, chunk);
+            offset += chunk;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file hal_packed_uart.c
+ * @brief 緊縮緩衝區UART傳輸實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 與hal_packed.c分開，只使用緊縮/展開的模組 (例如hal_crc) 不會連結到UART驅動。
+ */
+
+#include "../include/hal_packed.h"
+#include "../include/hal_uart.h"
+#include "../include/hal.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 傳輸時逐段展開的暫存長度 (與SCI FIFO深度相同)
+#define PACKED_STAGE_SIZE       16U
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 整個傳輸共用一個期限，計算剩餘的超時時間
+ * @return false 已到期；timeout為0時沿用驅動的語義，一律返回true並傳入0
+ */
+static bool packed_remaining(uint32_t start, uint32_t timeout, uint32_t* remaining)
+{
+    uint32_t elapsed;
+
+    if (timeout == 0U) {
+        *remaining = 0U;
+        return true;
+    }
+
+    elapsed = hal_get_tick() - start;
+    if (elapsed >= timeout) {
+        return false;
+    }
+
+    *remaining = timeout - elapsed;
+    return true;
+}
+
+/* ========================================================================== */
+/*                             緊縮傳輸介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_uart_transmit_packed(hal_uart_id_t uart_id, const hal_packed_t* data,
+                                      uint16_t size, uint32_t timeout)
+{
+    uint8_t stage[PACKED_STAGE_SIZE];
+    uint16_t offset = 0;
+    uint32_t start = hal_get_tick();
+    uint32_t remaining;
+    hal_status_t status = HAL_OK;
+
+    if (data == NULL || size == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    while (offset < size && status == HAL_OK) {
+        uint16_t chunk = size - offset;
+        if (chunk > PACKED_STAGE_SIZE) {
+            chunk = PACKED_STAGE_SIZE;
+        }
+
+        if (!packed_remaining(start, timeout, &remaining)) {
+            return HAL_TIMEOUT;
+        }
+
+        // offset為偶數，可直接從對應的字開始展開
+        hal_packed_unpack(stage, &data[offset >> 1], chunk);
+        status = hal_uart_transmit(uart_id, stage, chunk, remaining);
+        offset += chunk;
+    }
+
+    return status;
+}
+
+hal_status_t hal_uart_receive_packed(hal_uart_id_t uart_id, hal_packed_t* data,
+                                     uint16_t size, uint32_t timeout, uint16_t* received)
+{
+    uint8_t stage[PACKED_STAGE_SIZE];
+    uint16_t offset = 0;
+    uint16_t count = 0;
+    uint32_t start = hal_get_tick();
+    uint32_t remaining;
+    hal_status_t status = HAL_OK;
+
+    if (received != NULL) {
+        *received = 0;
+    }
+    if (data == NULL || size == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 逐字元接收，超時時才知道這一段實際收到幾個位元組
+    while (offset + count < size) {
+        if (!packed_remaining(start, timeout, &remaining)) {
+            status = HAL_TIMEOUT;
+            break;
+        }
+
+        status = hal_uart_getchar(uart_id, &stage[count], remaining);
+        if (status != HAL_OK) {
+            break;
+        }
+
+        count++;
+        if (count == PACKED_STAGE_SIZE) {
+            hal_packed_pack(&data[offset >> 1], stage, count);
+            offset += count;
+            count = 0;
+        }
+    }
+
+    // 最後一段 (包括超時前已收到的部分)；段起點為偶數，奇數長度時保留末字的高位元組
+    if (count > 0U) {
+        hal_packed_pack(&data[offset >> 1], stage, count);
+        offset += count;
+    }
+
+    if (received != NULL) {
+        *received = offset;
+    }
+
+    return status;
+}
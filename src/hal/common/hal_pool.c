@@ -0,0 +1,180 @@
+/**
+ * @file hal_pool.c
+ * @brief 固定區塊記憶體池實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_pool.h"
+#include "../include/hal_port.h"
+
+/* ========================================================================== */
+/*                             配置位元圖                                      */
+/* ========================================================================== */
+
+/** 標記區塊為配置中 (呼叫者已遮罩中斷) */
+static void pool_map_set(hal_pool_t* pool, const hal_pool_align_t* block)
+{
+    uint32_t index = (uint32_t)(block - pool->storage) / pool->block_units;
+
+    pool->alloc_map[index / 32U] |= 1UL << (index % 32U);
+}
+
+/** 清除區塊的配置標記 (呼叫者已遮罩中斷) */
+static bool pool_map_test_clear(hal_pool_t* pool, uint32_t index)
+{
+    uint32_t mask = 1UL << (index % 32U);
+
+    if ((pool->alloc_map[index / 32U] & mask) == 0U) {
+        return false;
+    }
+
+    pool->alloc_map[index / 32U] &= ~mask;
+    return true;
+}
+
+/* ========================================================================== */
+/*                             記憶體池介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_pool_init(hal_pool_t* pool)
+{
+    hal_port_irq_state_t irq_state;
+    hal_pool_align_t* block;
+    uint16_t i;
+
+    if (pool == NULL || pool->storage == NULL ||
+        pool->block_units == 0 || pool->block_count == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    // 依位址順序串接所有區塊，每個區塊的第一個欄位存放下一個空閒區塊
+    pool->free_list = NULL;
+    for (i = pool->block_count; i > 0; i--) {
+        block = &pool->storage[(uint32_t)(i - 1U) * pool->block_units];
+        block->ptr = pool->free_list;
+        pool->free_list = block;
+    }
+
+    pool->used = 0;
+    pool->high_water = 0;
+    pool->failures = 0;
+
+    if (pool->alloc_map != NULL) {
+        for (i = 0; i < (pool->block_count + 31U) / 32U; i++) {
+            pool->alloc_map[i] = 0;
+        }
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+void* hal_pool_alloc(hal_pool_t* pool)
+{
+    hal_port_irq_state_t irq_state;
+    hal_pool_align_t* block;
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    block = (hal_pool_align_t*)pool->free_list;
+    if (block != NULL) {
+        pool->free_list = block->ptr;
+        if (pool->alloc_map != NULL) {
+            pool_map_set(pool, block);
+        }
+        pool->used++;
+        if (pool->used > pool->high_water) {
+            pool->high_water = pool->used;
+        }
+    } else {
+        pool->failures++;
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return block;
+}
+
+hal_status_t hal_pool_free(hal_pool_t* pool, void* block)
+{
+    hal_port_irq_state_t irq_state;
+    hal_pool_align_t* node = (hal_pool_align_t*)block;
+    uint32_t block_size;
+    uint32_t offset;
+
+    if (pool == NULL || node == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 只接受本記憶體池區塊的起始位址
+    if ((const char*)block < (const char*)pool->storage) {
+        return HAL_INVALID_PARAM;
+    }
+    block_size = (uint32_t)pool->block_units * sizeof(hal_pool_align_t);
+    offset = (uint32_t)((const char*)block - (const char*)pool->storage);
+    if (offset >= block_size * pool->block_count || (offset % block_size) != 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    // 區塊已在空閒串列中: 再串入一次會讓同一區塊被配置兩次
+    if (pool->alloc_map != NULL && !pool_map_test_clear(pool, offset / block_size)) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return HAL_ERROR;
+    }
+
+    node->ptr = pool->free_list;
+    pool->free_list = node;
+    if (pool->used > 0) {
+        pool->used--;
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+uint32_t hal_pool_get_block_size(const hal_pool_t* pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return (uint32_t)pool->block_units * sizeof(hal_pool_align_t);
+}
+
+uint16_t hal_pool_get_free(const hal_pool_t* pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return (uint16_t)(pool->block_count - pool->used);
+}
+
+uint16_t hal_pool_get_high_water(const hal_pool_t* pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return pool->high_water;
+}
+
+uint32_t hal_pool_get_failures(const hal_pool_t* pool)
+{
+    if (pool == NULL) {
+        return 0;
+    }
+
+    return pool->failures;
+}
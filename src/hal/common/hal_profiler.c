@@ -0,0 +1,201 @@
+/**
+ * @file hal_profiler.c
+ * @brief 統計式PC取樣分析器實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 取樣端只寫入直方圖計數，輸出端逐一讀取計數後編碼。
+ * 兩者不互相等待，輸出期間的取樣可能部分計入本次輸出。
+ */
+
+#include "../include/hal_profiler.h"
+#include "../include/hal_frame.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 每個區間訊框的最大區間數，header + 每組兩個varint
+#define PROFILER_PAIRS_PER_FRAME    16U
+#define PROFILER_PAYLOAD_MAX        (1U + (PROFILER_PAIRS_PER_FRAME * 10U))
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static volatile uint32_t profiler_buckets[HAL_PROFILER_BUCKETS];
+static volatile uint32_t profiler_samples = 0;
+static volatile uint32_t profiler_outside = 0;
+
+static uint32_t profiler_start = 0;
+static uint32_t profiler_range = 0;         // 0表示尚未初始化
+static uint16_t profiler_shift = 0;
+static uint32_t profiler_hz = 0;
+
+static const hal_frame_config_t profiler_frame_config = { HAL_FRAME_COBS, HAL_PROFILER_FRAME_CRC, NULL };
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static uint16_t profiler_put_varint(uint8_t* out, uint32_t value)
+{
+    uint16_t len = 0;
+
+    while (value >= 0x80UL) {
+        out[len++] = (uint8_t)((value & 0x7FUL) | 0x80UL);
+        value >>= 7;
+    }
+    out[len++] = (uint8_t)value;
+
+    return len;
+}
+
+/* ========================================================================== */
+/*                             分析器介面實現                                  */
+/* ========================================================================== */
+
+hal_status_t hal_profiler_init(uint32_t code_start, uint32_t code_end, uint32_t sample_hz)
+{
+    uint32_t range;
+    uint16_t shift = 0;
+
+    if (code_end <= code_start || sample_hz == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 最小的2的冪次區間大小，使所有位址落在HAL_PROFILER_BUCKETS個區間內
+    range = code_end - code_start;
+    while (((range - 1UL) >> shift) >= HAL_PROFILER_BUCKETS) {
+        shift++;
+    }
+
+    hal_profiler_port_stop();
+
+    profiler_start = code_start;
+    profiler_range = range;
+    profiler_shift = shift;
+    profiler_hz = sample_hz;
+    hal_profiler_reset();
+
+    return HAL_OK;
+}
+
+hal_status_t hal_profiler_start(void)
+{
+    if (profiler_range == 0U) {
+        return HAL_ERROR;
+    }
+
+    return hal_profiler_port_start(profiler_hz);
+}
+
+void hal_profiler_stop(void)
+{
+    hal_profiler_port_stop();
+}
+
+void hal_profiler_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < HAL_PROFILER_BUCKETS; i++) {
+        profiler_buckets[i] = 0;
+    }
+
+    profiler_samples = 0;
+    profiler_outside = 0;
+}
+
+void hal_profiler_sample(uint32_t pc)
+{
+    // 無號減法同時檢查上下界
+    uint32_t offset = pc - profiler_start;
+
+    if (offset < profiler_range) {
+        profiler_buckets[offset >> profiler_shift]++;
+    } else {
+        profiler_outside++;
+    }
+
+    profiler_samples++;
+}
+
+hal_status_t hal_profiler_dump(hal_uart_id_t uart_id)
+{
+    uint8_t payload[PROFILER_PAYLOAD_MAX];
+    hal_status_t status;
+    uint32_t last_index = 0;
+    uint16_t pairs = 0;
+    uint16_t len = 0;
+    uint32_t i;
+
+    // 1. 描述訊框
+    payload[len++] = (uint8_t)(HAL_PROFILER_TYPE_INFO << 4);
+    len += profiler_put_varint(&payload[len], profiler_start);
+    len += profiler_put_varint(&payload[len], profiler_shift);
+    len += profiler_put_varint(&payload[len], HAL_PROFILER_BUCKETS);
+    len += profiler_put_varint(&payload[len], profiler_samples);
+    len += profiler_put_varint(&payload[len], profiler_outside);
+    len += profiler_put_varint(&payload[len], profiler_hz);
+
+    status = hal_frame_send(uart_id, &profiler_frame_config, payload, len, 1000);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    // 2. 只輸出非零區間，每個訊框最多PROFILER_PAIRS_PER_FRAME組
+    len = 1;
+    for (i = 0; i < HAL_PROFILER_BUCKETS; i++) {
+        uint32_t count = profiler_buckets[i];
+
+        if (count == 0U) {
+            continue;
+        }
+
+        len += profiler_put_varint(&payload[len], i - last_index);
+        len += profiler_put_varint(&payload[len], count);
+        last_index = i;
+
+        if (++pairs == PROFILER_PAIRS_PER_FRAME) {
+            payload[0] = (uint8_t)(HAL_PROFILER_TYPE_BUCKETS << 4);
+            status = hal_frame_send(uart_id, &profiler_frame_config, payload, len, 1000);
+            if (status != HAL_OK) {
+                return status;
+            }
+            pairs = 0;
+            len = 1;
+        }
+    }
+
+    // 3. 最後一個訊框 (可能不含任何區間)
+    payload[0] = (uint8_t)((HAL_PROFILER_TYPE_BUCKETS << 4) | HAL_PROFILER_FLAG_LAST);
+
+    return hal_frame_send(uart_id, &profiler_frame_config, payload, len, 1000);
+}
+
+uint32_t hal_profiler_get_samples(void)
+{
+    return profiler_samples;
+}
+
+/* ========================================================================== */
+/*                             主機端模擬移植                                  */
+/* ========================================================================== */
+
+#if !defined(PLATFORM_TI_C2000) && !defined(PLATFORM_STM32)
+
+// 主機端沒有取樣計時器，取樣由測試直接呼叫hal_profiler_sample()
+
+hal_status_t hal_profiler_port_start(uint32_t sample_hz)
+{
+    (void)sample_hz;
+    return HAL_OK;
+}
+
+void hal_profiler_port_stop(void)
+{
+}
+
+#endif /* !PLATFORM_TI_C2000 && !PLATFORM_STM32 */
@@ -0,0 +1,197 @@
+/**
+ * @file hal_sched.c
+ * @brief 協作式run-to-completion任務排程器實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_sched.h"
+#include "../include/hal_port.h"
+#include "../include/hal_cpu_load.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// Cortex-M使用CLZ指令，主機端使用GCC內建函式，C2000沒有CLZ指令改用查表
+#if defined(PLATFORM_STM32)
+    #define SCHED_MSB_USE_CLZ       1
+#elif defined(__GNUC__) && !defined(__TI_COMPILER_VERSION__)
+    #define SCHED_MSB_USE_BUILTIN   1
+#else
+    #define SCHED_MSB_USE_TABLE     1
+#endif
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+// 依優先權索引的任務表
+static hal_task_t* sched_tasks[HAL_SCHED_MAX_PRIORITY];
+
+// 就緒位元圖 (bit n = 優先權n有待處理事件)
+static volatile uint32_t sched_ready = 0;
+
+static hal_sched_idle_hook_t sched_idle_hook = NULL;
+
+#ifdef SCHED_MSB_USE_TABLE
+// 最高位元查表
+static const uint8_t sched_msb_table[256] = {
+    0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+#endif
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 找出就緒位元圖中的最高優先權 (ready不得為0)
+ */
+static uint16_t sched_highest_priority(uint32_t ready)
+{
+#if defined(SCHED_MSB_USE_CLZ)
+    return (uint16_t)(31U - __CLZ(ready));
+#elif defined(SCHED_MSB_USE_BUILTIN)
+    return (uint16_t)(31 - __builtin_clz(ready));
+#else
+    if (ready & 0xFFFF0000UL) {
+        if (ready & 0xFF000000UL) {
+            return (uint16_t)(24 + sched_msb_table[ready >> 24]);
+        }
+        return (uint16_t)(16 + sched_msb_table[(ready >> 16) & 0xFF]);
+    }
+    if (ready & 0x0000FF00UL) {
+        return (uint16_t)(8 + sched_msb_table[(ready >> 8) & 0xFF]);
+    }
+    return sched_msb_table[ready & 0xFF];
+#endif
+}
+
+/* ========================================================================== */
+/*                             排程器介面實現                                  */
+/* ========================================================================== */
+
+void hal_sched_init(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < HAL_SCHED_MAX_PRIORITY; i++) {
+        sched_tasks[i] = NULL;
+    }
+
+    sched_ready = 0;
+    sched_idle_hook = NULL;
+}
+
+hal_status_t hal_sched_add(hal_task_t* task)
+{
+    if (task == NULL || task->handler == NULL || task->queue == NULL ||
+        task->queue_size == 0 || task->priority >= HAL_SCHED_MAX_PRIORITY) {
+        return HAL_INVALID_PARAM;
+    }
+
+    if (sched_tasks[task->priority] != NULL) {
+        return HAL_BUSY;
+    }
+
+    task->head = 0;
+    task->tail = 0;
+    task->count = 0;
+    sched_tasks[task->priority] = task;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_sched_post(hal_task_t* task, hal_sched_event_t event)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (task == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (task->count >= task->queue_size) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return HAL_BUSY;
+    }
+
+    task->queue[task->tail] = event;
+    task->tail = (uint16_t)((task->tail + 1U == task->queue_size) ? 0U : task->tail + 1U);
+    task->count++;
+    sched_ready |= (1UL << task->priority);
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+void hal_sched_wake(void* task)
+{
+    (void)hal_sched_post((hal_task_t*)task, HAL_SCHED_EVENT_WAKE);
+}
+
+bool hal_sched_run_once(void)
+{
+    hal_port_irq_state_t irq_state;
+    hal_task_t* task;
+    hal_sched_event_t event;
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (sched_ready == 0) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return false;
+    }
+
+    task = sched_tasks[sched_highest_priority(sched_ready)];
+
+    event = task->queue[task->head];
+    task->head = (uint16_t)((task->head + 1U == task->queue_size) ? 0U : task->head + 1U);
+    task->count--;
+    if (task->count == 0) {
+        sched_ready &= ~(1UL << task->priority);
+    }
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    // 結束hal_cpu_load的閒置期間 (未使用閒置鉤子量測時無動作)
+    hal_cpu_load_idle_exit();
+
+    // 在中斷開啟狀態下執行到完成
+    task->handler(task, event);
+
+    return true;
+}
+
+void hal_sched_run(void)
+{
+    while (1) {
+        if (!hal_sched_run_once() && sched_idle_hook != NULL) {
+            sched_idle_hook();
+        }
+    }
+}
+
+void hal_sched_set_idle_hook(hal_sched_idle_hook_t hook)
+{
+    sched_idle_hook = hook;
+}
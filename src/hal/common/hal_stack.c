@@ -0,0 +1,205 @@
+/**
+ * @file hal_stack.c
+ * @brief 堆疊使用量量測實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 堆疊區域預設取自工具鏈的連結器符號，自訂連結描述檔可在編譯時
+ * 同時定義HAL_STACK_REGION_BASE與HAL_STACK_REGION_END (位址，終點不含) 取代。
+ * 填色與掃描都經由volatile指標，避免編譯器改為呼叫memset (其框架會落在填色範圍內)。
+ */
+
+#include "../include/hal_stack.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             堆疊區域                                        */
+/* ========================================================================== */
+
+#ifndef HAL_STACK_REGION_BASE
+
+#if defined(PLATFORM_TI_C2000)
+
+// rts2800的啟動程式以__stack初始化SP，__STACK_END為連結器定義的.stack區段終點
+extern uint16_t __stack;
+extern uint16_t __STACK_END;
+
+#define HAL_STACK_REGION_BASE   ((uintptr_t)&__stack)
+#define HAL_STACK_REGION_END    ((uintptr_t)&__STACK_END)
+
+#elif defined(PLATFORM_STM32)
+
+// STM32CubeMX連結描述檔: _estack為RAM頂端，_Min_Stack_Size為保留的堆疊大小 (絕對符號)
+extern uint32_t _estack;
+extern uint32_t _Min_Stack_Size;
+
+#define HAL_STACK_REGION_END    ((uintptr_t)&_estack)
+#define HAL_STACK_REGION_BASE   (HAL_STACK_REGION_END - (uintptr_t)&_Min_Stack_Size)
+
+#else
+
+uint32_t hal_stack_host_region[HAL_STACK_HOST_WORDS];
+
+#define HAL_STACK_REGION_BASE   ((uintptr_t)hal_stack_host_region)
+#define HAL_STACK_REGION_END    (HAL_STACK_REGION_BASE + sizeof(hal_stack_host_region))
+
+#endif
+
+#endif /* HAL_STACK_REGION_BASE */
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 32位元字的位址單位數 (C2000: 2；STM32: 4)
+#define STACK_WORD              ((uintptr_t)sizeof(uint32_t))
+
+#define STACK_ALIGN_DOWN(addr)  ((addr) & ~(STACK_WORD - 1U))
+#define STACK_ALIGN_UP(addr)    STACK_ALIGN_DOWN((addr) + STACK_WORD - 1U)
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static volatile uint32_t* stack_low = NULL;         // 對齊後的區域起點
+static volatile uint32_t* stack_high = NULL;        // 對齊後的區域終點 (不含)
+static bool stack_painted = false;
+static bool stack_overflowed = false;
+static hal_stack_overflow_hook_t stack_overflow_hook = NULL;
+
+/* ========================================================================== */
+/*                             堆疊量測介面實現                                */
+/* ========================================================================== */
+
+void hal_stack_paint(void)
+{
+    hal_port_irq_state_t irq_state;
+    uint32_t marker = 0;
+    uintptr_t sp = (uintptr_t)&marker;
+    uintptr_t low = STACK_ALIGN_UP(HAL_STACK_REGION_BASE);
+    uintptr_t high = STACK_ALIGN_DOWN(HAL_STACK_REGION_END);
+    uintptr_t margin = (uintptr_t)HAL_STACK_PAINT_MARGIN * STACK_WORD;
+    uintptr_t start = low;
+    uintptr_t stop = high;
+    volatile uint32_t* p;
+
+    if (high <= low) {
+        stack_painted = false;
+        return;
+    }
+
+    // 目前在堆疊區域內時 (一般情況) 只填到目前位置前margin處；
+    // 在其他堆疊上呼叫時 (主機端模擬) 整個區域都未使用
+    if (sp >= low && sp < high) {
+#if HAL_STACK_GROWS_UP
+        start = STACK_ALIGN_UP(sp);
+        start = (high - start > margin) ? (start + margin) : high;
+#else
+        stop = STACK_ALIGN_DOWN(sp);
+        stop = (stop - low > margin) ? (stop - margin) : low;
+#endif
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    for (p = (volatile uint32_t*)start; p < (volatile uint32_t*)stop; p++) {
+        *p = HAL_STACK_PAINT_PATTERN;
+    }
+
+    stack_low = (volatile uint32_t*)low;
+    stack_high = (volatile uint32_t*)high;
+    stack_overflowed = false;
+    stack_painted = true;
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+}
+
+uint32_t hal_stack_get_size(void)
+{
+    if (!stack_painted) {
+        return 0;
+    }
+
+    return (uint32_t)((uintptr_t)stack_high - (uintptr_t)stack_low);
+}
+
+uint32_t hal_stack_get_high_water(void)
+{
+    volatile uint32_t* p;
+
+    if (!stack_painted) {
+        return 0;
+    }
+
+#if HAL_STACK_GROWS_UP
+    // 從終點往下找第一個被改寫的字
+    p = stack_high;
+    while (p > stack_low && p[-1] == HAL_STACK_PAINT_PATTERN) {
+        p--;
+    }
+    return (uint32_t)((uintptr_t)p - (uintptr_t)stack_low);
+#else
+    // 從起點往上找第一個被改寫的字
+    p = stack_low;
+    while (p < stack_high && *p == HAL_STACK_PAINT_PATTERN) {
+        p++;
+    }
+    return (uint32_t)((uintptr_t)stack_high - (uintptr_t)p);
+#endif
+}
+
+bool hal_stack_check(void)
+{
+    hal_port_irq_state_t irq_state;
+    volatile uint32_t* canary;
+    uintptr_t words;
+    uintptr_t i;
+    bool intact = true;
+    bool first = false;
+
+    if (!stack_painted) {
+        return true;
+    }
+
+    words = ((uintptr_t)stack_high - (uintptr_t)stack_low) / STACK_WORD;
+    if (words > HAL_STACK_CANARY_WORDS) {
+        words = HAL_STACK_CANARY_WORDS;
+    }
+
+#if HAL_STACK_GROWS_UP
+    canary = stack_high - words;
+#else
+    canary = stack_low;
+#endif
+
+    for (i = 0; i < words; i++) {
+        if (canary[i] != HAL_STACK_PAINT_PATTERN) {
+            intact = false;
+            break;
+        }
+    }
+
+    if (intact) {
+        return true;
+    }
+
+    // tick中斷與主循環可能同時檢查，回呼只執行一次
+    irq_state = HAL_PORT_IRQ_SAVE();
+    if (!stack_overflowed) {
+        stack_overflowed = true;
+        first = true;
+    }
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    if (first && stack_overflow_hook != NULL) {
+        stack_overflow_hook();
+    }
+
+    return false;
+}
+
+void hal_stack_set_overflow_hook(hal_stack_overflow_hook_t hook)
+{
+    stack_overflow_hook = hook;
+}
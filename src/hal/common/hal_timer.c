@@ -0,0 +1,317 @@
+/**
+ * @file hal_timer.c
+ * @brief 軟體計時器服務實現 (階層式計時輪)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_timer.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+#if HAL_TIMER_USE_WORK_QUEUE
+#include "../include/hal_work.h"
+#endif
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define TIMER_WHEEL_SLOTS       (1UL << HAL_TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_MASK        (TIMER_WHEEL_SLOTS - 1UL)
+#define TIMER_LEVEL_SHIFT(lvl)  ((uint32_t)(lvl) * HAL_TIMER_WHEEL_BITS)
+#define TIMER_MAX_DELTA         ((1UL << (HAL_TIMER_WHEEL_BITS * HAL_TIMER_WHEEL_LEVELS)) - 1UL)
+
+// 到期判斷以有號差值進行，延時與週期需小於2^31
+#define TIMER_MAX_DELAY         0x7FFFFFFFUL
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+// 各層槽位串列
+static hal_timer_t* timer_wheel[HAL_TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+
+// 由tick中斷累加的計數
+static volatile uint32_t timer_ticks = 0;
+
+// 下一個要處理的tick
+static uint32_t timer_wheel_time = 0;
+
+#if HAL_TIMER_USE_WORK_QUEUE
+// 計時輪處理工作已提交，尚未執行
+static volatile bool timer_work_pending = false;
+#endif
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static void timer_list_add(hal_timer_t** head, hal_timer_t* timer)
+{
+    timer->next = *head;
+    if (timer->next != NULL) {
+        timer->next->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pprev = head;
+}
+
+static void timer_list_remove(hal_timer_t* timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != NULL) {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+/**
+ * @brief 依到期時間將計時器放入對應層級的槽位
+ */
+static void timer_wheel_insert(hal_timer_t* timer)
+{
+    uint32_t expires = timer->expires;
+    uint32_t delta = expires - timer_wheel_time;
+    uint32_t level;
+
+    // 已過期的計時器放入下一個要處理的槽位
+    if ((int32_t)delta < 0) {
+        timer_list_add(&timer_wheel[0][timer_wheel_time & TIMER_WHEEL_MASK], timer);
+        return;
+    }
+
+    for (level = 0; level < HAL_TIMER_WHEEL_LEVELS; level++) {
+        if (delta < (1UL << TIMER_LEVEL_SHIFT(level + 1))) {
+            uint32_t slot = (expires >> TIMER_LEVEL_SHIFT(level)) & TIMER_WHEEL_MASK;
+            timer_list_add(&timer_wheel[level][slot], timer);
+            return;
+        }
+    }
+
+    // 超出範圍的延時放在最上層最遠的槽位，降層時再重新計算
+    expires = timer_wheel_time + TIMER_MAX_DELTA;
+    level = HAL_TIMER_WHEEL_LEVELS - 1;
+    timer_list_add(&timer_wheel[level][(expires >> TIMER_LEVEL_SHIFT(level)) & TIMER_WHEEL_MASK],
+                   timer);
+}
+
+/**
+ * @brief 將槽位串列移到區域串列頭 (呼叫者已遮罩中斷)
+ * 移出的計時器仍可由中斷中的hal_timer_start()/hal_timer_stop()經pprev安全移除
+ */
+static void timer_list_take(hal_timer_t** slot, hal_timer_t** head)
+{
+    *head = *slot;
+    *slot = NULL;
+    if (*head != NULL) {
+        (*head)->pprev = head;
+    }
+}
+
+/**
+ * @brief 將上層槽位的計時器重新分配到下層
+ * 每次只在中斷遮罩內移動一個計時器，中斷延遲不隨槽位內的計時器數量增加
+ * @return 該層目前的槽位索引 (為0時需繼續處理上一層)
+ */
+static uint32_t timer_wheel_cascade(uint32_t level)
+{
+    uint32_t slot = (timer_wheel_time >> TIMER_LEVEL_SHIFT(level)) & TIMER_WHEEL_MASK;
+    hal_port_irq_state_t irq_state;
+    hal_timer_t* pending;
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+    timer_list_take(&timer_wheel[level][slot], &pending);
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    for (;;) {
+        hal_timer_t* timer;
+
+        irq_state = HAL_PORT_IRQ_SAVE();
+        timer = pending;
+        if (timer == NULL) {
+            HAL_PORT_IRQ_RESTORE(irq_state);
+            break;
+        }
+        timer_list_remove(timer);
+        timer_wheel_insert(timer);
+        HAL_PORT_IRQ_RESTORE(irq_state);
+    }
+
+    return slot;
+}
+
+#if HAL_TIMER_USE_WORK_QUEUE
+static void timer_work_handler(void* context)
+{
+    (void)context;
+
+    // 先清除旗標，處理期間到達的tick會再次提交
+    timer_work_pending = false;
+    (void)hal_timer_process();
+}
+#endif
+
+/* ========================================================================== */
+/*                             計時器介面實現                                  */
+/* ========================================================================== */
+
+void hal_timer_service_init(void)
+{
+    uint32_t level;
+    uint32_t slot;
+
+    for (level = 0; level < HAL_TIMER_WHEEL_LEVELS; level++) {
+        for (slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+            timer_wheel[level][slot] = NULL;
+        }
+    }
+
+    timer_wheel_time = timer_ticks;
+}
+
+hal_status_t hal_timer_setup(hal_timer_t* timer, hal_timer_callback_t callback, void* context)
+{
+    if (timer == NULL || callback == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->expires = 0;
+    timer->period = 0;
+    timer->callback = callback;
+    timer->context = context;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_timer_start(hal_timer_t* timer, uint32_t delay, uint32_t period)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (timer == NULL || timer->callback == NULL ||
+        delay > TIMER_MAX_DELAY || period > TIMER_MAX_DELAY) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 工作佇列以軟體中斷消化時，計時輪可能被搶占處理
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (timer->pprev != NULL) {
+        timer_list_remove(timer);
+    }
+
+    timer->expires = timer_ticks + delay;
+    timer->period = period;
+    timer_wheel_insert(timer);
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_timer_stop(hal_timer_t* timer)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (timer == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (timer->pprev != NULL) {
+        timer_list_remove(timer);
+    }
+
+    timer->period = 0;
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+bool hal_timer_is_active(const hal_timer_t* timer)
+{
+    return (timer != NULL) && (timer->pprev != NULL);
+}
+
+void hal_timer_tick(void)
+{
+    timer_ticks++;
+
+#if HAL_TIMER_USE_WORK_QUEUE
+    if (!timer_work_pending) {
+        timer_work_pending = true;
+        if (hal_work_post(timer_work_handler, NULL) != HAL_OK) {
+            timer_work_pending = false;
+        }
+    }
+#endif
+}
+
+uint32_t hal_timer_process(void)
+{
+    uint32_t now = timer_ticks;
+    uint32_t fired = 0;
+
+    // 串列操作與hal_timer_start()/hal_timer_stop()相同，都在中斷遮罩內進行，
+    // 回呼與降層之間開放中斷
+    while ((int32_t)(now - timer_wheel_time) >= 0) {
+        uint32_t slot = timer_wheel_time & TIMER_WHEEL_MASK;
+        hal_port_irq_state_t irq_state;
+        hal_timer_t* expired;
+
+        // 最下層轉完一圈時依序從上層降層
+        if (slot == 0) {
+            uint32_t level;
+            for (level = 1; level < HAL_TIMER_WHEEL_LEVELS; level++) {
+                if (timer_wheel_cascade(level) != 0) {
+                    break;
+                }
+            }
+        }
+
+        // 取出整個到期串列，回呼中可安全地啟動/停止任何計時器
+        irq_state = HAL_PORT_IRQ_SAVE();
+        timer_list_take(&timer_wheel[0][slot], &expired);
+        timer_wheel_time++;
+        HAL_PORT_IRQ_RESTORE(irq_state);
+
+        for (;;) {
+            hal_timer_t* timer;
+            hal_timer_callback_t callback;
+            void* context;
+
+            irq_state = HAL_PORT_IRQ_SAVE();
+            timer = expired;
+            if (timer == NULL) {
+                HAL_PORT_IRQ_RESTORE(irq_state);
+                break;
+            }
+
+            timer_list_remove(timer);
+
+            if (timer->period != 0) {
+                timer->expires += timer->period;
+                timer_wheel_insert(timer);
+            }
+
+            callback = timer->callback;
+            context = timer->context;
+            HAL_PORT_IRQ_RESTORE(irq_state);
+
+            callback(timer, context);
+            fired++;
+        }
+    }
+
+    return fired;
+}
+
+uint32_t hal_timer_get_ticks(void)
+{
+    return timer_ticks;
+}
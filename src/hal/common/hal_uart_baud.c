@@ -0,0 +1,179 @@
+/**
+ * @file hal_uart_baud.c
+ * @brief UART波特率除頻計算實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 純計算函式，不存取硬體，各平台UART驅動在初始化時呼叫。
+ */
+
+#include "../include/hal_uart.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// C2000 SCI: BRR為16位元，BRR=0與BRR=1皆為LSPCLK/16
+#define SCI_BRR_MAX             0xFFFFUL
+
+// STM32 USART: 16與8倍取樣的USARTDIV皆需介於16與0xFFFF之間
+#define USART_DIV_MIN           16UL
+#define USART_DIV_MAX           0xFFFFUL
+
+// STM32G4 USART_PRESC對應的除頻值
+static const uint16_t usart_presc_div[] = {
+    1, 2, 4, 6, 8, 10, 12, 16, 32, 64, 128, 256
+};
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 四捨五入整數除法
+ */
+static uint32_t baud_div_round(uint32_t num, uint32_t den)
+{
+    return (uint32_t)(((uint64_t)num + (den / 2U)) / den);
+}
+
+/**
+ * @brief 計算實際波特率相對於要求值的誤差 (ppm)
+ */
+static int32_t baud_error_ppm(uint32_t actual, uint32_t requested)
+{
+    int64_t diff = (int64_t)actual - (int64_t)requested;
+
+    return (int32_t)((diff * 1000000LL) / (int64_t)requested);
+}
+
+static uint32_t baud_abs_ppm(int32_t ppm)
+{
+    return (ppm < 0) ? (uint32_t)(-ppm) : (uint32_t)ppm;
+}
+
+/**
+ * @brief USARTDIV轉換為BRR暫存器值 (8倍取樣時BRR[3:0] = USARTDIV[3:0] >> 1)
+ */
+static uint32_t usart_div_to_brr(uint32_t usartdiv, bool over8)
+{
+    return over8 ? ((usartdiv & 0xFFF0UL) | ((usartdiv & 0x000FUL) >> 1)) : usartdiv;
+}
+
+/* ========================================================================== */
+/*                             波特率計算實現                                  */
+/* ========================================================================== */
+
+hal_status_t hal_uart_calc_sci_divisor(uint32_t lspclk_hz, uint32_t baudrate,
+                                       hal_uart_baud_result_t* result)
+{
+    uint32_t div8;
+
+    if (result == NULL || lspclk_hz == 0 || baudrate == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 實際波特率 = LSPCLK / ((BRR + 1) * 8)，最高為LSPCLK/16
+    if (baudrate >= lspclk_hz / 16UL) {
+        div8 = 2UL;
+    } else {
+        div8 = baud_div_round(lspclk_hz, baudrate * 8UL);
+    }
+    if (div8 < 2UL) {
+        div8 = 2UL;
+    }
+    if (div8 > SCI_BRR_MAX + 1UL) {
+        div8 = SCI_BRR_MAX + 1UL;
+    }
+
+    result->divisor = div8 - 1UL;
+    result->prescaler = 0;
+    result->over8 = false;
+    result->actual_baudrate = baud_div_round(lspclk_hz, div8 * 8UL);
+    result->error_ppm = baud_error_ppm(result->actual_baudrate, baudrate);
+
+    if (baud_abs_ppm(result->error_ppm) > (uint32_t)HAL_UART_BAUD_MAX_ERROR_PPM) {
+        return HAL_INVALID_PARAM;
+    }
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_calc_usart_divisor(uint32_t kernel_hz, uint32_t baudrate,
+                                         hal_uart_baud_result_t* result)
+{
+    uint32_t best_error = 0xFFFFFFFFUL;
+    uint16_t presc;
+    uint16_t mode;
+
+    if (result == NULL || kernel_hz == 0 || baudrate == 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 預除頻由小到大搜尋，同一預除頻內16倍取樣先於8倍取樣、下取整的除頻先於上取整；只有誤差更小時才取代，
+    // 誤差相同時保留先搜尋到的候選
+    for (presc = 0; presc < (uint16_t)(sizeof(usart_presc_div) / sizeof(usart_presc_div[0])); presc++) {
+        // fck = kernel / PRESC不先截斷，以kernel / (PRESC * baud)的商與餘數取上下兩個除頻值
+        uint64_t den = (uint64_t)usart_presc_div[presc] * baudrate;
+        uint32_t quot = (uint32_t)(kernel_hz / den);
+
+        for (mode = 0; mode < 4U; mode++) {
+            bool over8 = (mode >= 2U);
+            uint32_t fck_div = quot + (mode & 1U);
+            uint32_t usartdiv;
+            uint32_t brr;
+            uint32_t actual;
+            uint32_t error;
+            int32_t ppm;
+
+            // 16倍取樣: baud = fck / USARTDIV
+            // 8倍取樣:  baud = 2 * fck / USARTDIV，BRR捨棄USARTDIV[0]，有效除頻為fck的整數倍
+            usartdiv = over8 ? (fck_div * 2UL) : fck_div;
+            if (fck_div == 0U || usartdiv < USART_DIV_MIN || usartdiv > USART_DIV_MAX) {
+                continue;
+            }
+
+            brr = usart_div_to_brr(usartdiv, over8);
+            actual = hal_uart_calc_usart_baudrate(kernel_hz, presc, over8, brr);
+            ppm = baud_error_ppm(actual, baudrate);
+            error = baud_abs_ppm(ppm);
+
+            if (error < best_error) {
+                best_error = error;
+                result->divisor = brr;
+                result->prescaler = presc;
+                result->over8 = over8;
+                result->actual_baudrate = actual;
+                result->error_ppm = ppm;
+            }
+        }
+    }
+
+    if (best_error > (uint32_t)HAL_UART_BAUD_MAX_ERROR_PPM) {
+        return HAL_INVALID_PARAM;
+    }
+
+    return HAL_OK;
+}
+
+uint32_t hal_uart_calc_usart_baudrate(uint32_t kernel_hz, uint16_t prescaler, bool over8,
+                                      uint32_t brr)
+{
+    uint64_t den;
+    uint32_t usartdiv;
+
+    if (prescaler >= (uint16_t)(sizeof(usart_presc_div) / sizeof(usart_presc_div[0]))) {
+        return 0;
+    }
+
+    // 8倍取樣時BRR[2:0] = USARTDIV[3:1]，BRR[3]保留為0
+    usartdiv = over8 ? ((brr & 0xFFF0UL) | ((brr & 0x0007UL) << 1)) : (brr & 0xFFFFUL);
+    if (usartdiv == 0U) {
+        return 0;
+    }
+
+    den = (uint64_t)usart_presc_div[prescaler] * usartdiv;
+
+    return (uint32_t)((((uint64_t)kernel_hz << (over8 ? 1 : 0)) + den / 2U) / den);
+}
@@ -0,0 +1,138 @@
+/**
+ * @file hal_work.c
+ * @brief 中斷延後處理工作佇列實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 固定容量的多生產者單消費者佇列。每個槽位帶有序號，生產者以比較交換
+ * 保留寫入位置後再發布序號，因此不需要在中斷之間持有鎖。
+ */
+
+#include "../include/hal_work.h"
+#include "../include/hal_port.h"
+#include <stddef.h>
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define WORK_QUEUE_MASK     ((uint32_t)HAL_WORK_QUEUE_SIZE - 1UL)
+
+typedef struct {
+    volatile uint32_t sequence;
+    hal_callback_t volatile func;
+    void* volatile context;
+} work_cell_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static work_cell_t work_cells[HAL_WORK_QUEUE_SIZE];
+static volatile uint32_t work_enqueue_pos = 0;
+static volatile uint32_t work_dequeue_pos = 0;
+
+// 統計用，中斷巢狀時可能少計
+static volatile uint32_t work_dropped = 0;
+
+/* ========================================================================== */
+/*                             工作佇列介面實現                                */
+/* ========================================================================== */
+
+void hal_work_init(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < HAL_WORK_QUEUE_SIZE; i++) {
+        work_cells[i].func = NULL;
+        work_cells[i].context = NULL;
+        work_cells[i].sequence = i;
+    }
+
+    work_enqueue_pos = 0;
+    work_dequeue_pos = 0;
+    work_dropped = 0;
+
+#if HAL_WORK_USE_SWI
+    hal_work_port_init();
+#endif
+}
+
+hal_status_t hal_work_post(hal_callback_t func, void* context)
+{
+    work_cell_t* cell;
+    uint32_t pos;
+
+    if (func == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    pos = work_enqueue_pos;
+    while (1) {
+        int32_t diff;
+
+        cell = &work_cells[pos & WORK_QUEUE_MASK];
+        diff = (int32_t)(cell->sequence - pos);
+
+        if (diff == 0) {
+            // 槽位空閒，嘗試保留
+            if (hal_port_cas32(&work_enqueue_pos, pos, pos + 1UL)) {
+                break;
+            }
+            pos = work_enqueue_pos;
+        } else if (diff < 0) {
+            // 佇列已滿
+            work_dropped++;
+            return HAL_BUSY;
+        } else {
+            // 被其他生產者搶先，重新讀取寫入位置
+            pos = work_enqueue_pos;
+        }
+    }
+
+    cell->func = func;
+    cell->context = context;
+    HAL_PORT_MEMORY_BARRIER();
+    cell->sequence = pos + 1UL;
+
+#if HAL_WORK_USE_SWI
+    hal_work_port_trigger();
+#endif
+
+    return HAL_OK;
+}
+
+uint32_t hal_work_drain(uint32_t max_items)
+{
+    uint32_t executed = 0;
+
+    while (max_items == 0 || executed < max_items) {
+        uint32_t pos = work_dequeue_pos;
+        work_cell_t* cell = &work_cells[pos & WORK_QUEUE_MASK];
+        hal_callback_t func;
+        void* context;
+
+        // 序號尚未發布表示佇列為空或生產者仍在寫入
+        if ((int32_t)(cell->sequence - (pos + 1UL)) < 0) {
+            break;
+        }
+
+        func = cell->func;
+        context = cell->context;
+        HAL_PORT_MEMORY_BARRIER();
+
+        // 釋放槽位給下一輪的生產者
+        cell->sequence = pos + WORK_QUEUE_MASK + 1UL;
+        work_dequeue_pos = pos + 1UL;
+
+        func(context);
+        executed++;
+    }
+
+    return executed;
+}
+
+uint32_t hal_work_get_dropped(void)
+{
+    return work_dropped;
+}
@@ -15,6 +15,21 @@
 #include "hal_spi.h"
 #include "hal_i2c.h"
 #include "hal_adc.h"
+#include "hal_timer.h"
+#include "hal_sched.h"
+#include "hal_work.h"
+#include "hal_pool.h"
+#include "hal_buf.h"
+#include "hal_packed.h"
+#include "hal_crc.h"
+#include "hal_frame.h"
+#include "hal_log.h"
+#include "hal_debounce.h"
+#include "hal_critical.h"
+#include "hal_irq.h"
+#include "hal_profiler.h"
+#include "hal_cpu_load.h"
+#include "hal_stack.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -60,6 +75,12 @@ void hal_delay_us(uint32_t us);
  */
 uint32_t hal_get_tick(void);
 
+/**
+ * @brief 獲取CPU週期計數 (32位元自由運行，用於高解析度時間戳)
+ * @return 自hal_init()起的CPU週期數 (溢位後迴繞)
+ */
+uint32_t hal_get_cycle_count(void);
+
 /**
  * @brief 系統復位
  */
@@ -0,0 +1,109 @@
+/**
+ * @file hal_buf.h
+ * @brief 零複製緩衝區描述子介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_BUF_H
+#define HAL_BUF_H
+
+#include "hal_common.h"
+#include "hal_pool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             緩衝區型別                                      */
+/* ========================================================================== */
+
+typedef struct hal_buf hal_buf_t;
+
+/** 參考計數歸零時的釋放函式 */
+typedef void (*hal_buf_release_t)(hal_buf_t* buf);
+
+/**
+ * @brief 緩衝區描述子
+ * 以next串接成分散/集中(scatter/gather)鏈，傳輸函式逐段存取資料而不複製。
+ * 串鏈擁有其後續節點：節點參考計數歸零時會一併釋放後續節點。
+ */
+struct hal_buf {
+    hal_buf_t* next;                /**< 串鏈下一段 */
+    uint8_t* data;                  /**< 資料起始位址 */
+    uint16_t len;                   /**< 有效資料長度 */
+    uint16_t capacity;              /**< 資料區容量 */
+    volatile uint16_t refcount;     /**< 參考計數 */
+    hal_buf_release_t release;      /**< 釋放函式，NULL表示靜態緩衝區 */
+    void* owner;                    /**< 釋放函式使用的擁有者 (例如記憶體池) */
+};
+
+/**
+ * @brief 記憶體池區塊大小 (描述子與資料區放在同一個區塊)
+ * @param data_size 資料區容量
+ */
+#define HAL_BUF_POOL_BLOCK_SIZE(data_size)  (sizeof(hal_buf_t) + (data_size))
+
+/* ========================================================================== */
+/*                             緩衝區介面函式                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 從記憶體池配置緩衝區 (可在中斷中呼叫)
+ * @param pool 記憶體池，區塊大小以HAL_BUF_POOL_BLOCK_SIZE()決定
+ * @return 緩衝區指標 (參考計數為1，長度為0)，NULL表示配置失敗
+ */
+hal_buf_t* hal_buf_alloc(hal_pool_t* pool);
+
+/**
+ * @brief 以既有資料初始化靜態緩衝區描述子
+ * @param buf 緩衝區描述子
+ * @param data 資料位址 (傳輸期間必須保持有效)
+ * @param len 資料長度
+ * @return HAL_OK 成功，其他值表示失敗
+ * @note 描述子不擁有資料，參考計數歸零時不做任何釋放；唯讀資料不可作為接收緩衝區
+ */
+hal_status_t hal_buf_wrap(hal_buf_t* buf, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief 增加參考計數 (可在中斷中呼叫)
+ * @param buf 緩衝區指標
+ * @return 傳入的緩衝區指標
+ */
+hal_buf_t* hal_buf_ref(hal_buf_t* buf);
+
+/**
+ * @brief 減少參考計數，歸零時釋放該段並繼續處理後續節點 (可在中斷中呼叫)
+ * @param buf 串鏈起始緩衝區
+ */
+void hal_buf_unref(hal_buf_t* buf);
+
+/**
+ * @brief 將串鏈接到另一串鏈尾端
+ * @param head 串鏈起始緩衝區
+ * @param tail 要接上的串鏈 (所有權轉移給head)
+ * @return 串鏈起始緩衝區
+ */
+hal_buf_t* hal_buf_chain(hal_buf_t* head, hal_buf_t* tail);
+
+/**
+ * @brief 在資料尾端保留空間
+ * @param buf 緩衝區指標
+ * @param len 保留長度
+ * @return 保留區域起始位址，NULL表示剩餘容量不足
+ */
+uint8_t* hal_buf_put(hal_buf_t* buf, uint16_t len);
+
+/**
+ * @brief 計算串鏈總資料長度
+ * @param buf 串鏈起始緩衝區
+ * @return 總資料長度
+ */
+uint32_t hal_buf_chain_len(const hal_buf_t* buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_BUF_H */
@@ -60,9 +60,13 @@ typedef enum {
     HAL_ERROR,
     HAL_BUSY,
     HAL_TIMEOUT,
-    HAL_INVALID_PARAM
+    HAL_INVALID_PARAM,
+    HAL_NOT_SUPPORTED
 } hal_status_t;
 
+/** 通用非同步完成回呼 */
+typedef void (*hal_callback_t)(void* context);
+
 /** GPIO引腳狀態 */
 typedef enum {
     HAL_GPIO_LOW = 0,
@@ -84,14 +88,18 @@ typedef enum {
     HAL_GPIO_PULLDOWN
 } hal_gpio_pull_t;
 
-/** UART波特率 */
-typedef enum {
-    HAL_UART_BAUDRATE_9600 = 9600,
-    HAL_UART_BAUDRATE_19200 = 19200,
-    HAL_UART_BAUDRATE_38400 = 38400,
-    HAL_UART_BAUDRATE_57600 = 57600,
-    HAL_UART_BAUDRATE_115200 = 115200
-} hal_uart_baudrate_t;
+/** UART波特率 (可為任意整數值，以下為常用值) */
+typedef uint32_t hal_uart_baudrate_t;
+
+#define HAL_UART_BAUDRATE_9600      9600UL
+#define HAL_UART_BAUDRATE_19200     19200UL
+#define HAL_UART_BAUDRATE_38400     38400UL
+#define HAL_UART_BAUDRATE_57600     57600UL
+#define HAL_UART_BAUDRATE_115200    115200UL
+#define HAL_UART_BAUDRATE_230400    230400UL
+#define HAL_UART_BAUDRATE_460800    460800UL
+#define HAL_UART_BAUDRATE_921600    921600UL
+#define HAL_UART_BAUDRATE_2000000   2000000UL
 
 /** UART資料位數 */
 typedef enum {
@@ -0,0 +1,136 @@
+/**
+ * @file hal_cpu_load.h
+ * @brief CPU負載與中斷佔用量測介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以hal_get_cycle_count()的週期計數量測 (STM32: DWT->CYCCNT；C2000: 自由運行的CPU Timer2):
+ * - 閒置: hal_cpu_load_idle_enter()與hal_cpu_load_idle_exit()之間的週期，扣除其間的中斷時間
+ * - 中斷: 處理函式頭尾以hal_cpu_load_isr_enter()/hal_cpu_load_isr_exit()取時間戳，
+ *   巢狀中斷的時間只計入被巢狀的中斷，不重複計入外層
+ * 時間以HAL_CPU_LOAD_WINDOW_SLOTS個固定長度的區段組成滑動視窗，
+ * 負載 = (區段長度 - 閒置) / 區段長度，中斷時間計入負載。
+ *
+ * hal_sched_set_idle_hook(hal_cpu_load_idle_enter)即可量測排程器的閒置時間，
+ * hal_sched_run_once()派送任務前會呼叫hal_cpu_load_idle_exit()。
+ * 自行撰寫的主循環在沒有工作時呼叫idle_enter，有工作時呼叫idle_exit。
+ *
+ * 區段在idle_enter與查詢時結算，兩次結算的間隔不可超過週期計數器的迴繞時間
+ * (STM32G4 170MHz約25秒；C2000 150MHz約28秒)。
+ * 結算晚於一個區段長度時，經過的時間依長度平均分配到對應數量的區段，
+ * 視窗平均不受影響，但這段期間內的峰值只能反映平均負載。
+ */
+
+#ifndef HAL_CPU_LOAD_H
+#define HAL_CPU_LOAD_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             負載量測配置                                    */
+/* ========================================================================== */
+
+/** 滑動視窗的區段數 */
+#ifndef HAL_CPU_LOAD_WINDOW_SLOTS
+    #define HAL_CPU_LOAD_WINDOW_SLOTS   8
+#endif
+
+/** 可個別統計的中斷數量 (識別碼0至HAL_CPU_LOAD_MAX_ISRS-1) */
+#ifndef HAL_CPU_LOAD_MAX_ISRS
+    #define HAL_CPU_LOAD_MAX_ISRS       8
+#endif
+
+/** 負載的滿刻度 (單位0.01%) */
+#define HAL_CPU_LOAD_FULL               10000U
+
+/* ========================================================================== */
+/*                             負載量測型別                                    */
+/* ========================================================================== */
+
+/** 中斷進入時間戳 (存放於處理函式的區域變數) */
+typedef struct {
+    uint32_t start;                 // 進入時的週期計數
+    uint32_t nested;                // 進入時的中斷時間總和
+} hal_cpu_load_stamp_t;
+
+/** 整體負載 */
+typedef struct {
+    uint16_t load;                  // 視窗內的平均負載 (0.01%)
+    uint16_t peak;                  // 重設後單一區段的最高負載 (0.01%)
+    uint16_t isr_load;              // 視窗內的中斷佔用 (0.01%)
+    uint16_t slots;                 // 視窗內已完成的區段數
+    uint32_t window_cycles;         // 視窗涵蓋的週期數
+} hal_cpu_load_stats_t;
+
+/** 單一中斷的統計 */
+typedef struct {
+    uint32_t count;                 // 重設後的執行次數
+    uint32_t total_cycles;          // 重設後的累計週期數 (溢位後迴繞)
+    uint32_t max_cycles;            // 單次執行的最長週期數
+    uint16_t load;                  // 視窗內的佔用 (0.01%)
+} hal_cpu_load_isr_stats_t;
+
+/* ========================================================================== */
+/*                             負載量測介面函式                                */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化並開始量測
+ * @param slot_cycles 區段長度 (週期數)，例如 hal_get_system_clock() / 10U 為100ms
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 長度為0或超過0x7FFFFFFF
+ */
+hal_status_t hal_cpu_load_init(uint32_t slot_cycles);
+
+/**
+ * @brief 清除視窗、峰值與所有中斷統計，從目前時間重新開始
+ */
+void hal_cpu_load_reset(void);
+
+/**
+ * @brief 進入閒置 (可重複呼叫，已在閒置中時只結算到期的區段)
+ * 可直接作為hal_sched的閒置鉤子
+ */
+void hal_cpu_load_idle_enter(void);
+
+/**
+ * @brief 離開閒置 (不在閒置中時無動作)
+ */
+void hal_cpu_load_idle_exit(void);
+
+/**
+ * @brief 中斷處理函式開頭取時間戳
+ * @param stamp 處理函式的區域變數
+ */
+void hal_cpu_load_isr_enter(hal_cpu_load_stamp_t* stamp);
+
+/**
+ * @brief 中斷處理函式結尾累計執行時間
+ * @param isr_id 中斷識別碼，超出範圍時只計入整體中斷時間
+ * @param stamp hal_cpu_load_isr_enter()填入的時間戳
+ */
+void hal_cpu_load_isr_exit(uint16_t isr_id, const hal_cpu_load_stamp_t* stamp);
+
+/**
+ * @brief 讀取整體負載 (由主循環呼叫，同時結算到期的區段)
+ * @param stats 輸出
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 指標為NULL；HAL_ERROR 尚未初始化
+ */
+hal_status_t hal_cpu_load_get(hal_cpu_load_stats_t* stats);
+
+/**
+ * @brief 讀取單一中斷的統計 (由主循環呼叫，同時結算到期的區段)
+ * @param isr_id 中斷識別碼
+ * @param stats 輸出
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 識別碼超出範圍或指標為NULL；HAL_ERROR 尚未初始化
+ */
+hal_status_t hal_cpu_load_get_isr(uint16_t isr_id, hal_cpu_load_isr_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_CPU_LOAD_H */
@@ -0,0 +1,185 @@
+/**
+ * @file hal_crc.h
+ * @brief CRC計算介面 (硬體加速與軟體表格)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以Rocksoft參數模型描述CRC演算法 (寬度、多項式、初始值、反射、輸出XOR)。
+ * 計算方式依序選擇: 平台CRC硬體 → slicing-by-8軟體表格 → 逐位元計算。
+ */
+
+#ifndef HAL_CRC_H
+#define HAL_CRC_H
+
+#include "hal_common.h"
+#include <limits.h>
+
+#if CHAR_BIT != 8
+    #include "hal_packed.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             CRC配置                                         */
+/* ========================================================================== */
+
+/**
+ * @brief 使用平台CRC硬體
+ * 0 = 只使用軟體計算
+ * 1 = 平台支援的參數使用CRC硬體 (STM32: CRC週邊，C2000: VCU CRC指令)
+ */
+#ifndef HAL_CRC_USE_HW
+    #define HAL_CRC_USE_HW              0
+#endif
+
+/** CRC演算法參數 */
+typedef struct {
+    uint8_t width;                  /**< CRC寬度 (1-32位元) */
+    uint32_t poly;                  /**< 生成多項式 (一般表示法，不含最高位元) */
+    uint32_t init;                  /**< 初始值 */
+    bool reflect_in;                /**< 輸入位元組反射 (LSB先處理) */
+    bool reflect_out;               /**< 輸出反射 */
+    uint32_t xor_out;               /**< 輸出XOR值 */
+} hal_crc_config_t;
+
+/** 常用CRC參數 */
+#define HAL_CRC_CONFIG_CRC8         { 8U, 0x07UL, 0x00UL, false, false, 0x00UL }
+#define HAL_CRC_CONFIG_CRC16_CCITT  { 16U, 0x1021UL, 0xFFFFUL, false, false, 0x0000UL }
+#define HAL_CRC_CONFIG_CRC16_MODBUS { 16U, 0x8005UL, 0xFFFFUL, true, true, 0x0000UL }
+#define HAL_CRC_CONFIG_CRC32        { 32U, 0x04C11DB7UL, 0xFFFFFFFFUL, true, true, 0xFFFFFFFFUL }
+#define HAL_CRC_CONFIG_CRC32C       { 32U, 0x1EDC6F41UL, 0xFFFFFFFFUL, true, true, 0xFFFFFFFFUL }
+
+/**
+ * @brief slicing-by-8查表 (8KB，每種多項式一份)
+ * 由hal_crc_table_build()產生，可放在RAM或以const產生後置於Flash
+ */
+typedef struct {
+    uint32_t entry[8][256];         /**< 查表內容 */
+    uint32_t poly;                  /**< 產生時使用的多項式 */
+    uint8_t width;                  /**< 產生時使用的寬度 */
+    bool reflect;                   /**< 產生時使用的反射設定 */
+} hal_crc_table_t;
+
+/** 計算方式 */
+typedef enum {
+    HAL_CRC_ENGINE_BITWISE = 0,     /**< 逐位元計算 */
+    HAL_CRC_ENGINE_TABLE,           /**< slicing-by-8查表 */
+    HAL_CRC_ENGINE_HW               /**< 平台CRC硬體 */
+} hal_crc_engine_t;
+
+/** CRC計算狀態 */
+typedef struct {
+    hal_crc_config_t config;        /**< 演算法參數 */
+    const hal_crc_table_t* table;   /**< 查表 (TABLE模式) */
+    hal_crc_engine_t engine;        /**< 計算方式 */
+    uint32_t reg;                   /**< CRC暫存器 (反射演算法為反射後的值) */
+} hal_crc_t;
+
+/* ========================================================================== */
+/*                             CRC介面函式                                     */
+/* ========================================================================== */
+
+/**
+ * @brief 產生slicing-by-8查表
+ * @param table 查表
+ * @param config 演算法參數
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_crc_table_build(hal_crc_table_t* table, const hal_crc_config_t* config);
+
+/**
+ * @brief 初始化CRC計算
+ * @param crc CRC計算狀態
+ * @param config 演算法參數
+ * @param table 查表，NULL表示不使用 (平台硬體支援時仍使用硬體)
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 參數錯誤或查表與參數不符
+ */
+hal_status_t hal_crc_init(hal_crc_t* crc, const hal_crc_config_t* config,
+                          const hal_crc_table_t* table);
+
+/**
+ * @brief 重新開始計算 (保留參數與計算方式)
+ * @param crc CRC計算狀態
+ */
+void hal_crc_reset(hal_crc_t* crc);
+
+/**
+ * @brief 累加資料
+ * @param crc CRC計算狀態
+ * @param data 資料 (每個元素只使用低8位元)
+ * @param len 位元組數
+ */
+void hal_crc_update(hal_crc_t* crc, const uint8_t* data, uint32_t len);
+
+#if CHAR_BIT != 8
+/**
+ * @brief 累加緊縮格式資料 (每個16位元字兩個位元組，低位元組在前)
+ * @param crc CRC計算狀態
+ * @param data 緊縮資料
+ * @param len 位元組數
+ * @note 只在16位元char平台 (C2000) 提供，其他平台不連結hal_packed
+ */
+void hal_crc_update_packed(hal_crc_t* crc, const hal_packed_t* data, uint32_t len);
+#endif
+
+/**
+ * @brief 獲取CRC結果 (不影響後續累加)
+ * @param crc CRC計算狀態
+ * @return CRC值
+ */
+uint32_t hal_crc_final(const hal_crc_t* crc);
+
+/**
+ * @brief 一次計算CRC
+ * @param config 演算法參數
+ * @param table 查表，可為NULL
+ * @param data 資料
+ * @param len 位元組數
+ * @return CRC值，參數錯誤時返回0
+ */
+uint32_t hal_crc_compute(const hal_crc_config_t* config, const hal_crc_table_t* table,
+                         const uint8_t* data, uint32_t len);
+
+/**
+ * @brief 開機時檢查韌體映像的CRC-32
+ * @param start 映像起始位址
+ * @param size 映像位元組數 (C2000為字數*2，依記憶體內容低位元組在前計算)
+ * @param expected 預期CRC-32值 (通常由建置後處理寫入映像尾端)
+ * @return HAL_OK 相符，HAL_ERROR 不符
+ */
+hal_status_t hal_crc_check_image(const void* start, uint32_t size, uint32_t expected);
+
+/* ========================================================================== */
+/*                             平台移植介面                                    */
+/* ========================================================================== */
+
+#if HAL_CRC_USE_HW
+
+/**
+ * @brief 檢查CRC硬體是否支援指定參數 (由平台實現)
+ * @param config 演算法參數
+ * @return true 支援
+ */
+bool hal_crc_port_supported(const hal_crc_config_t* config);
+
+/**
+ * @brief 以CRC硬體累加資料 (由平台實現，可在中斷中呼叫)
+ * @param config 演算法參數
+ * @param reg 目前CRC暫存器 (與hal_crc_t.reg相同表示法)
+ * @param data 資料
+ * @param len 位元組數
+ * @return 累加後的CRC暫存器
+ */
+uint32_t hal_crc_port_update(const hal_crc_config_t* config, uint32_t reg,
+                             const uint8_t* data, uint32_t len);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_CRC_H */
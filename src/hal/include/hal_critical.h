@@ -0,0 +1,183 @@
+/**
+ * @file hal_critical.h
+ * @brief 可巢狀臨界區介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * hal_critical_enter()禁用所有可遮罩中斷，hal_critical_enter_level()只遮罩
+ * 指定優先權及以下的中斷，較高優先權的控制迴路中斷仍可搶占。
+ * prio為hal_irq的邏輯優先權 (0最高，小於HAL_IRQ_PRIORITY_LEVELS)，由各平台轉換:
+ * - STM32 (Cortex-M4): hal_irq優先權即NVIC優先權，以BASEPRI遮罩prio及數值更大的中斷
+ * - TI C2000: 以CPU IER遮罩含有prio及較低優先權處理函式的PIE群組，
+ *   各優先權保留的群組由hal_irq登記時更新 (與hal_irq入口的群組遮罩規則相同)
+ * 兩種臨界區皆返回進入前的狀態，離開時恢復，可任意巢狀；
+ * 巢狀的enter_level只會提高遮罩範圍，不會解除外層的遮罩。
+ */
+
+#ifndef HAL_CRITICAL_H
+#define HAL_CRITICAL_H
+
+#include "hal_common.h"
+#include "hal_irq.h"
+#include "hal_port.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             臨界區型別                                      */
+/* ========================================================================== */
+
+/** hal_critical_enter()返回的中斷狀態 */
+typedef hal_port_irq_state_t hal_critical_state_t;
+
+/** hal_critical_enter_level()返回的遮罩狀態 */
+typedef uint32_t hal_critical_level_t;
+
+#if defined(PLATFORM_TI_C2000)
+
+    // CPU中斷致能暫存器 (與cpu.h的宣告相同)
+    extern __cregister volatile unsigned int IER;
+
+    // IER bit0-13對應INT1-INT14，bit14-15 (DLOGINT/RTOSINT) 不受影響
+    #define HAL_CRITICAL_IER_GROUPS     0x3FFFU
+
+    /**
+     * 各邏輯優先權的臨界區中保留的IER群組位元
+     * 群組內所有hal_irq登記的處理函式優先權都較高時才保留，沒有登記的群組一律遮罩
+     */
+    extern uint16_t hal_critical_ier_keep[HAL_IRQ_PRIORITY_LEVELS];
+
+#elif !defined(PLATFORM_STM32)
+
+    // 主機端模擬的中斷狀態，供單元測試檢查巢狀行為
+    extern volatile uint32_t hal_critical_host_primask;
+    extern volatile uint32_t hal_critical_host_level;
+
+    /** 主機端沒有遮罩任何優先權時的hal_critical_host_level */
+    #define HAL_CRITICAL_HOST_LEVEL_NONE    0xFFFFFFFFUL
+
+#endif
+
+/** 超出範圍的優先權視為最低優先權 */
+#define HAL_CRITICAL_PRIO(prio) \
+    (((prio) < HAL_IRQ_PRIORITY_LEVELS) ? (prio) : HAL_IRQ_PRIORITY_LOWEST)
+
+/* ========================================================================== */
+/*                             臨界區介面函式                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 進入臨界區 (禁用所有可遮罩中斷)
+ * @return 進入前的中斷狀態，傳給hal_critical_exit()
+ */
+static inline hal_critical_state_t hal_critical_enter(void)
+{
+#if defined(PLATFORM_TI_C2000) || defined(PLATFORM_STM32)
+    return HAL_PORT_IRQ_SAVE();
+#else
+    hal_critical_state_t state = hal_critical_host_primask;
+    hal_critical_host_primask = 1U;
+    return state;
+#endif
+}
+
+/**
+ * @brief 離開臨界區，恢復hal_critical_enter()之前的中斷狀態
+ * @param state hal_critical_enter()的返回值
+ */
+static inline void hal_critical_exit(hal_critical_state_t state)
+{
+#if defined(PLATFORM_TI_C2000) || defined(PLATFORM_STM32)
+    HAL_PORT_IRQ_RESTORE(state);
+#else
+    hal_critical_host_primask = state;
+#endif
+}
+
+/**
+ * @brief 進入優先權臨界區，只遮罩prio及較低優先權的中斷
+ * @param prio hal_irq優先權 (0最高)，超出範圍時視為HAL_IRQ_PRIORITY_LOWEST；
+ *             STM32為0時等同hal_critical_enter()
+ * @return 進入前的遮罩狀態，傳給hal_critical_exit_level()
+ */
+static inline hal_critical_level_t hal_critical_enter_level(uint16_t prio)
+{
+#if defined(PLATFORM_TI_C2000)
+    hal_port_irq_state_t irq_state;
+    hal_critical_level_t state;
+    uint16_t keep = hal_critical_ier_keep[HAL_CRITICAL_PRIO(prio)];
+
+    // IER的讀改寫需在INTM遮罩下進行，避免中斷返回時覆寫
+    irq_state = HAL_PORT_IRQ_SAVE();
+    state = IER;
+    IER &= (uint16_t)(keep | (uint16_t)~HAL_CRITICAL_IER_GROUPS);
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return state;
+#elif defined(PLATFORM_STM32)
+    // 同時保存PRIMASK，prio為0時BASEPRI無法遮罩，改用PRIMASK
+    hal_critical_level_t state = __get_BASEPRI() | (__get_PRIMASK() << 8);
+
+    if (prio == 0U) {
+        __disable_irq();
+    } else {
+        // BASEPRI_MAX只會提高遮罩，巢狀時不會解除外層的設定
+        __set_BASEPRI_MAX((uint32_t)HAL_CRITICAL_PRIO(prio) << (8U - __NVIC_PRIO_BITS));
+    }
+
+    return state;
+#else
+    hal_critical_level_t state = hal_critical_host_level;
+
+    if (HAL_CRITICAL_PRIO(prio) < hal_critical_host_level) {
+        hal_critical_host_level = HAL_CRITICAL_PRIO(prio);
+    }
+
+    return state;
+#endif
+}
+
+/**
+ * @brief 離開優先權臨界區，恢復hal_critical_enter_level()之前的遮罩狀態
+ * @param state hal_critical_enter_level()的返回值
+ */
+static inline void hal_critical_exit_level(hal_critical_level_t state)
+{
+#if defined(PLATFORM_TI_C2000)
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+
+    // 只恢復群組位元，保留期間由其他程式致能的DLOGINT/RTOSINT
+    IER = (IER & (uint16_t)~HAL_CRITICAL_IER_GROUPS) | ((uint16_t)state & HAL_CRITICAL_IER_GROUPS);
+    HAL_PORT_IRQ_RESTORE(irq_state);
+#elif defined(PLATFORM_STM32)
+    __set_BASEPRI(state & 0xFFU);
+    __set_PRIMASK(state >> 8);
+#else
+    hal_critical_host_level = state;
+#endif
+}
+
+/**
+ * @brief 檢查指定優先權的中斷目前是否被遮罩
+ * 用於驅動程式檢查呼叫者是否已進入足夠的臨界區
+ * @param prio 優先權，意義與hal_critical_enter_level()相同
+ * @return true 該優先權的中斷不會搶占目前的程式
+ */
+bool hal_critical_is_masked(uint16_t prio);
+
+#if defined(PLATFORM_TI_C2000)
+/**
+ * @brief 依hal_irq的群組配置更新hal_critical_ier_keep (由hal_irq登記/移除時呼叫)
+ * @param group_lowest INT1-INT14群組內最低的登記優先權加1，0表示沒有登記
+ * @note 呼叫者需遮罩INTM
+ */
+void hal_critical_update_ier_keep(const uint16_t group_lowest[]);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_CRITICAL_H */
@@ -0,0 +1,105 @@
+/**
+ * @file hal_debounce.h
+ * @brief 位元平行輸入消抖服務介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以固定週期讀取整個GPIO埠，每個32位元字以垂直計數器同時消抖32個輸入:
+ * 每個位元有一個2位元計數器 (cnt1:cnt0)，原始值與消抖狀態連續4次不同才翻轉，
+ * 一次取樣只需數個位元運算指令，與輸入數量無關。
+ * 消抖時間 = 4 × 取樣週期 (例如1ms取樣為4ms)。
+ */
+
+#ifndef HAL_DEBOUNCE_H
+#define HAL_DEBOUNCE_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             消抖型別                                        */
+/* ========================================================================== */
+
+/** 一個消抖字 (32個輸入) */
+typedef struct {
+    uint32_t state;             /**< 消抖後狀態 */
+    uint32_t cnt0;              /**< 垂直計數器bit0 */
+    uint32_t cnt1;              /**< 垂直計數器bit1 */
+    volatile uint32_t changed;  /**< 上次讀取後翻轉過的位元 */
+} hal_debounce_word_t;
+
+/**
+ * @brief 消抖器
+ * 使用HAL_DEBOUNCE_DEFINE靜態配置
+ */
+typedef struct {
+    hal_debounce_word_t* words; /**< 消抖字陣列 */
+    const uint16_t* ports;      /**< 各字對應的GPIO埠 (hal_gpio_read_port) */
+    uint16_t count;             /**< 字數 */
+} hal_debounce_t;
+
+/**
+ * @brief 靜態定義消抖器
+ * @param name 消抖器變數名稱
+ * @param ... 要取樣的GPIO埠編號，每個埠佔一個字
+ *
+ * 範例: HAL_DEBOUNCE_DEFINE(panel, 0, 1, 2);   // 埠0-2共96個輸入
+ */
+#define HAL_DEBOUNCE_DEFINE(name, ...)                                          \
+    static const uint16_t name##_ports[] = { __VA_ARGS__ };                     \
+    static hal_debounce_word_t name##_words[sizeof(name##_ports) / sizeof(name##_ports[0])]; \
+    hal_debounce_t name = { name##_words, name##_ports,                         \
+                            (uint16_t)(sizeof(name##_ports) / sizeof(name##_ports[0])) }
+
+/* ========================================================================== */
+/*                             消抖介面函式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化消抖器，以目前的埠讀值作為初始狀態 (不產生變化)
+ * @param deb 消抖器指標
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_debounce_init(hal_debounce_t* deb);
+
+/**
+ * @brief 讀取所有埠並更新消抖狀態 (由tick中斷或週期計時器呼叫)
+ * @param deb 消抖器指標
+ * @return true 本次有位元翻轉
+ */
+bool hal_debounce_sample(hal_debounce_t* deb);
+
+/**
+ * @brief 以外部提供的原始值更新消抖狀態
+ * 用於非GPIO來源 (移位暫存器、I/O擴展器) 或主機端模擬
+ * @param deb 消抖器指標
+ * @param raw 原始值陣列，長度為deb->count
+ * @return true 本次有位元翻轉
+ */
+bool hal_debounce_update(hal_debounce_t* deb, const uint32_t* raw);
+
+/**
+ * @brief 獲取消抖後狀態
+ * @param deb 消抖器指標
+ * @param word 字索引
+ * @return 消抖後狀態，無效索引返回0
+ */
+uint32_t hal_debounce_get_state(const hal_debounce_t* deb, uint16_t word);
+
+/**
+ * @brief 獲取並清除翻轉位元
+ * 上升沿 = changed & state，下降沿 = changed & ~state
+ * @param deb 消抖器指標
+ * @param word 字索引
+ * @return 上次呼叫後翻轉過的位元，無效索引返回0
+ */
+uint32_t hal_debounce_get_changed(hal_debounce_t* deb, uint16_t word);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_DEBOUNCE_H */
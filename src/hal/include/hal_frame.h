@@ -0,0 +1,183 @@
+/**
+ * @file hal_frame.h
+ * @brief 封包訊框層介面 (COBS/SLIP編碼與CRC檢查)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 編碼器直接從來源資料分段輸出，不需要暫存整個編碼後訊框；
+ * 解碼器逐段接收串流資料，直接解碼到呼叫者的緩衝區。
+ * 訊框格式: 編碼(payload + CRC尾碼，低位元組在前) + 分隔字元
+ */
+
+#ifndef HAL_FRAME_H
+#define HAL_FRAME_H
+
+#include "hal_common.h"
+#include "hal_uart.h"
+#include "hal_crc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             訊框定義                                        */
+/* ========================================================================== */
+
+/** 編碼方式 */
+typedef enum {
+    HAL_FRAME_COBS = 0,             /**< COBS，以0x00分隔訊框 */
+    HAL_FRAME_SLIP                  /**< SLIP (RFC 1055)，以0xC0分隔訊框 */
+} hal_frame_encoding_t;
+
+/** CRC尾碼 */
+typedef enum {
+    HAL_FRAME_CRC_NONE = 0,         /**< 無CRC */
+    HAL_FRAME_CRC16,                /**< CRC-16/CCITT-FALSE (2位元組) */
+    HAL_FRAME_CRC32                 /**< CRC-32/IEEE (4位元組) */
+} hal_frame_crc_t;
+
+/** 訊框配置 */
+typedef struct {
+    hal_frame_encoding_t encoding;  /**< 編碼方式 */
+    hal_frame_crc_t crc;            /**< CRC尾碼 */
+    const hal_crc_table_t* crc_table; /**< CRC查表，NULL時使用CRC硬體或逐位元計算 */
+} hal_frame_config_t;
+
+/** SLIP特殊字元 */
+#define HAL_FRAME_SLIP_END          0xC0U
+#define HAL_FRAME_SLIP_ESC          0xDBU
+#define HAL_FRAME_SLIP_ESC_END      0xDCU
+#define HAL_FRAME_SLIP_ESC_ESC      0xDDU
+
+/** CRC尾碼最大長度 */
+#define HAL_FRAME_CRC_MAX_SIZE      4U
+
+/**
+ * @brief 編碼後訊框最大長度 (含CRC與分隔字元)
+ * @param n payload長度
+ */
+#define HAL_FRAME_COBS_MAX_SIZE(n)  ((n) + HAL_FRAME_CRC_MAX_SIZE + \
+                                     (((n) + HAL_FRAME_CRC_MAX_SIZE) / 254U) + 2U)
+#define HAL_FRAME_SLIP_MAX_SIZE(n)  ((((n) + HAL_FRAME_CRC_MAX_SIZE) * 2U) + 2U)
+
+/**
+ * @brief 編碼輸出函式
+ * @param context 輸出參數
+ * @param data 編碼資料 (可能直接指向來源資料)
+ * @param len 資料長度
+ * @return HAL_OK 成功，其他值會中止編碼
+ */
+typedef hal_status_t (*hal_frame_write_t)(void* context, const uint8_t* data, uint16_t len);
+
+/**
+ * @brief 串流解碼器
+ * 解碼結果 (payload + CRC尾碼) 直接寫入buffer
+ */
+typedef struct {
+    hal_frame_config_t config;      /**< 訊框配置 */
+    uint8_t* buffer;                /**< 解碼緩衝區 */
+    uint16_t size;                  /**< 緩衝區大小 (需容納CRC尾碼) */
+    uint16_t len;                   /**< 已解碼長度 */
+    uint8_t code;                   /**< COBS目前區塊的碼值 */
+    uint8_t left;                   /**< COBS目前區塊剩餘位元組數 */
+    bool escape;                    /**< SLIP收到跳脫字元 */
+    bool discard;                   /**< 訊框錯誤，捨棄到下一個分隔字元 */
+    bool started;                   /**< 已收到訊框內容 */
+} hal_frame_decoder_t;
+
+/* ========================================================================== */
+/*                             編碼介面函式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 編碼訊框並分段輸出
+ * @param config 訊框配置
+ * @param data payload資料
+ * @param len payload長度
+ * @param write 輸出函式
+ * @param context 輸出參數
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 參數錯誤，其他值為輸出函式的錯誤
+ * @note SLIP且無CRC時payload長度需大於0 (空訊框與連續的分隔字元無法區分)
+ */
+hal_status_t hal_frame_encode(const hal_frame_config_t* config, const uint8_t* data, uint16_t len,
+                              hal_frame_write_t write, void* context);
+
+/**
+ * @brief 編碼訊框到緩衝區
+ * @param config 訊框配置
+ * @param data payload資料
+ * @param len payload長度
+ * @param out 輸出緩衝區 (大小見HAL_FRAME_COBS_MAX_SIZE/HAL_FRAME_SLIP_MAX_SIZE)
+ * @param out_size 輸出緩衝區大小
+ * @param out_len 編碼後長度
+ * @return HAL_OK 成功，HAL_ERROR 輸出緩衝區不足，HAL_INVALID_PARAM 參數錯誤
+ */
+hal_status_t hal_frame_encode_buf(const hal_frame_config_t* config, const uint8_t* data,
+                                  uint16_t len, uint8_t* out, uint16_t out_size,
+                                  uint16_t* out_len);
+
+/**
+ * @brief 編碼並由UART發送訊框
+ * @param uart_id UART識別碼
+ * @param config 訊框配置
+ * @param data payload資料
+ * @param len payload長度
+ * @param timeout 每段發送的超時時間(ms)
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_frame_send(hal_uart_id_t uart_id, const hal_frame_config_t* config,
+                            const uint8_t* data, uint16_t len, uint32_t timeout);
+
+/* ========================================================================== */
+/*                             解碼介面函式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化串流解碼器
+ * @param decoder 解碼器
+ * @param config 訊框配置
+ * @param buffer 解碼緩衝區
+ * @param size 緩衝區大小 (payload最大長度 + CRC尾碼長度)
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_frame_decoder_init(hal_frame_decoder_t* decoder, const hal_frame_config_t* config,
+                                    uint8_t* buffer, uint16_t size);
+
+/**
+ * @brief 重設解碼器，捨棄目前訊框
+ * @param decoder 解碼器
+ */
+void hal_frame_decoder_reset(hal_frame_decoder_t* decoder);
+
+/**
+ * @brief 輸入串流資料
+ * @param decoder 解碼器
+ * @param data 接收資料
+ * @param len 資料長度
+ * @param consumed 已處理的位元組數
+ * @param frame_len 完整訊框的payload長度 (返回HAL_OK時有效)
+ * @return HAL_OK 收到完整訊框 (位於decoder->buffer)，
+ *         HAL_BUSY 資料已全部處理、訊框尚未結束，
+ *         HAL_ERROR 訊框錯誤 (CRC錯誤、編碼錯誤或超過緩衝區) 已捨棄
+ * @note 返回HAL_OK或HAL_ERROR時可能尚有未處理資料，應從data + *consumed繼續輸入
+ */
+hal_status_t hal_frame_decode(hal_frame_decoder_t* decoder, const uint8_t* data, uint16_t len,
+                              uint16_t* consumed, uint16_t* frame_len);
+
+/**
+ * @brief 由UART接收一個完整訊框
+ * @param uart_id UART識別碼
+ * @param decoder 解碼器
+ * @param frame_len 訊框payload長度
+ * @param timeout 超時時間(ms)
+ * @return HAL_OK 成功，HAL_TIMEOUT 超時，HAL_ERROR 訊框錯誤
+ */
+hal_status_t hal_frame_receive(hal_uart_id_t uart_id, hal_frame_decoder_t* decoder,
+                               uint16_t* frame_len, uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_FRAME_H */
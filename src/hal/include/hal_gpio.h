@@ -14,6 +14,44 @@
 extern "C" {
 #endif
 
+/* ========================================================================== */
+/*                             GPIO中斷配置                                   */
+/* ========================================================================== */
+
+/** 中斷線數量上限 (STM32 EXTI0-15，C2000使用XINT1-4) */
+#define HAL_GPIO_IRQ_MAX_LINES          16U
+
+/** 邊沿事件佇列容量 (必須為2的冪次) */
+#ifndef HAL_GPIO_EVENT_QUEUE_SIZE
+    #define HAL_GPIO_EVENT_QUEUE_SIZE   32
+#endif
+
+#if (HAL_GPIO_EVENT_QUEUE_SIZE & (HAL_GPIO_EVENT_QUEUE_SIZE - 1)) != 0
+    #error "HAL_GPIO_EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+/** GPIO中斷邊沿 */
+typedef enum {
+    HAL_GPIO_EDGE_RISING = 1,
+    HAL_GPIO_EDGE_FALLING = 2,
+    HAL_GPIO_EDGE_BOTH = 3
+} hal_gpio_edge_t;
+
+/**
+ * @brief GPIO中斷回呼 (在中斷環境中執行)
+ * @param pin 觸發的引腳
+ * @param edge 觸發的邊沿 (RISING或FALLING)
+ * @param context 註冊時傳入的使用者資料
+ */
+typedef void (*hal_gpio_irq_callback_t)(hal_gpio_pin_t pin, hal_gpio_edge_t edge, void* context);
+
+/** GPIO邊沿事件 */
+typedef struct {
+    uint32_t timestamp;     // hal_get_cycle_count()的值
+    hal_gpio_pin_t pin;
+    hal_gpio_edge_t edge;
+} hal_gpio_event_t;
+
 /* ========================================================================== */
 /*                             GPIO介面函式                                   */
 /* ========================================================================== */
@@ -21,10 +59,22 @@ extern "C" {
 /**
  * @brief 初始化GPIO引腳
  * @param config GPIO配置結構體指標
- * @return HAL_OK 成功，其他值表示失敗
+ * @return HAL_OK 成功，HAL_NOT_SUPPORTED 平台不支援所選的下拉，其他值表示失敗
  */
 hal_status_t hal_gpio_init(const hal_gpio_config_t* config);
 
+/**
+ * @brief 依配置表批次初始化GPIO引腳
+ * 依埠分組後，每個埠的時鐘只使能一次，每個配置暫存器只寫入一次
+ * @param configs GPIO配置陣列
+ * @param count 配置數量
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 任一引腳無效，
+ *         HAL_NOT_SUPPORTED 任一項使用平台不支援的下拉 (兩者都不修改任何暫存器)
+ * @note 輸出引腳先寫入初始狀態再切換方向，切換時不會產生突波；
+ *       同一引腳出現多次時以最後一項為準
+ */
+hal_status_t hal_gpio_init_table(const hal_gpio_config_t* configs, uint16_t count);
+
 /**
  * @brief 反初始化GPIO引腳
  * @param pin GPIO引腳識別碼
@@ -66,10 +116,108 @@ hal_status_t hal_gpio_set_mode(hal_gpio_pin_t pin, hal_gpio_mode_t mode);
  * @brief 配置GPIO引腳上拉/下拉
  * @param pin GPIO引腳識別碼
  * @param pull 上拉/下拉配置
- * @return HAL_OK 成功，其他值表示失敗
+ * @return HAL_OK 成功，HAL_NOT_SUPPORTED 平台不支援此配置，其他值表示失敗
+ * @note TI C2000沒有內建下拉電阻，HAL_GPIO_PULLDOWN返回HAL_NOT_SUPPORTED且不修改暫存器
  */
 hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull);
 
+/**
+ * @brief 一次讀取整個埠的輸入狀態
+ * @param port 埠編號 (STM32: 0=GPIOA, 1=GPIOB...，即pin >> 8；
+ *             C2000: 0=GPIO0-31, 1=GPIO32-63...，即pin >> 5)
+ * @return 埠輸入資料 (bit n = 埠內第n腳)，無效埠返回0
+ */
+uint32_t hal_gpio_read_port(uint16_t port);
+
+/* ========================================================================== */
+/*                             GPIO中斷介面                                   */
+/* ========================================================================== */
+
+/**
+ * @brief 註冊GPIO邊沿中斷回呼
+ * @param pin GPIO引腳識別碼 (需已配置為輸入)
+ * @param edge 觸發邊沿
+ * @param callback 中斷回呼
+ * @param context 傳給回呼的使用者資料
+ * @return HAL_OK 成功，HAL_BUSY 沒有可用的中斷線，其他值表示失敗
+ * @note STM32同一個EXTI線只能對應一個埠的引腳 (PA0與PB0不可同時使用)
+ */
+hal_status_t hal_gpio_attach_irq(hal_gpio_pin_t pin, hal_gpio_edge_t edge,
+                                 hal_gpio_irq_callback_t callback, void* context);
+
+/**
+ * @brief 註冊GPIO邊沿中斷，邊沿以事件形式存入佇列
+ * 中斷只記錄 (引腳, 邊沿, 時間戳)，突發邊沿由hal_gpio_event_read()在中斷外處理
+ * @param pin GPIO引腳識別碼 (需已配置為輸入)
+ * @param edge 觸發邊沿
+ * @return HAL_OK 成功，HAL_BUSY 沒有可用的中斷線，其他值表示失敗
+ */
+hal_status_t hal_gpio_attach_irq_event(hal_gpio_pin_t pin, hal_gpio_edge_t edge);
+
+/**
+ * @brief 取消GPIO邊沿中斷
+ * @param pin GPIO引腳識別碼
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 引腳未註冊
+ */
+hal_status_t hal_gpio_detach_irq(hal_gpio_pin_t pin);
+
+/**
+ * @brief 從佇列讀取一個邊沿事件
+ * @param event 事件輸出
+ * @return true 讀到事件，false 佇列為空
+ * @note 只能有一個讀取者
+ */
+bool hal_gpio_event_read(hal_gpio_event_t* event);
+
+/**
+ * @brief 獲取因佇列已滿而被丟棄的事件數
+ * @return 丟棄的事件數
+ */
+uint32_t hal_gpio_event_get_dropped(void);
+
+/**
+ * @brief 注入一個邊沿，行為與硬體中斷相同
+ * 用於主機端模擬與目標上的自我測試，引腳必須已註冊
+ * @param pin GPIO引腳識別碼
+ * @param edge 注入的邊沿 (RISING或FALLING)
+ * @param timestamp 事件時間戳
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 引腳未註冊或邊沿不符
+ */
+hal_status_t hal_gpio_irq_inject(hal_gpio_pin_t pin, hal_gpio_edge_t edge, uint32_t timestamp);
+
+/**
+ * @brief 中斷線分派 (由平台中斷服務程式呼叫)
+ * @param line 中斷線編號
+ * @param level 中斷發生時的引腳電位，用於判斷雙沿觸發的邊沿
+ */
+void hal_gpio_irq_dispatch(uint16_t line, hal_gpio_state_t level);
+
+/* ========================================================================== */
+/*                             平台移植介面                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 引腳可使用的中斷線
+ * @param pin GPIO引腳識別碼
+ * @return 中斷線位元遮罩 (bit n = 線n)，0表示引腳不支援中斷
+ */
+uint16_t hal_gpio_port_irq_lines(hal_gpio_pin_t pin);
+
+/**
+ * @brief 將引腳連接到中斷線並使能
+ * @param line 中斷線編號
+ * @param pin GPIO引腳識別碼
+ * @param edge 觸發邊沿
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_gpio_port_irq_enable(uint16_t line, hal_gpio_pin_t pin, hal_gpio_edge_t edge);
+
+/**
+ * @brief 禁用中斷線
+ * @param line 中斷線編號
+ */
+void hal_gpio_port_irq_disable(uint16_t line);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,111 @@
+/**
+ * @file hal_irq.h
+ * @brief 可巢狀優先權中斷分派介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * hal_irq_register()登記中斷處理函式並指定優先權 (0最高)，
+ * 較高優先權的中斷可搶占正在執行的較低優先權處理函式:
+ * - STM32 (Cortex-M4): 處理函式直接寫入RAM向量表，優先權即NVIC優先權，由硬體巢狀
+ * - TI C2000: 所有登記的向量指向共用入口，入口依優先權遮罩IER與自身群組的PIEIER，
+ *   確認PIE後重新開啟INTM再呼叫處理函式
+ * 處理函式為一般函式 (不加__interrupt)，不需要確認PIE或清除NVIC旗標，
+ * 但仍需清除週邊本身的中斷旗標。
+ *
+ * hal_init()會初始化PIE (C2000: 清除所有PIEIER/PIEIFR、向量指向預設處理函式、設置ENPIE)
+ * 並開啟全域中斷，應用程式不需自行設定；在hal_init()之前登記的向量會被清除。
+ */
+
+#ifndef HAL_IRQ_H
+#define HAL_IRQ_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             中斷分派配置                                    */
+/* ========================================================================== */
+
+/** 可同時登記的處理函式數量 */
+#ifndef HAL_IRQ_MAX_HANDLERS
+    #define HAL_IRQ_MAX_HANDLERS        16
+#endif
+
+/** 優先權數量 (與STM32G4的4位元NVIC優先權相同) */
+#define HAL_IRQ_PRIORITY_LEVELS         16U
+
+/** 最高與最低優先權 */
+#define HAL_IRQ_PRIORITY_HIGHEST        0U
+#define HAL_IRQ_PRIORITY_LOWEST         (HAL_IRQ_PRIORITY_LEVELS - 1U)
+
+/* ========================================================================== */
+/*                             中斷分派型別                                    */
+/* ========================================================================== */
+
+/** 中斷處理函式 */
+typedef void (*hal_irq_handler_t)(void);
+
+/* ========================================================================== */
+/*                             中斷分派介面函式                                */
+/* ========================================================================== */
+
+/**
+ * @brief 登記中斷處理函式並致能該中斷
+ * 重複登記同一向量時更新處理函式與優先權
+ * @param vector STM32: IRQn；C2000: DriverLib中斷編號 (INT_xxx)
+ * @param handler 處理函式
+ * @param priority 優先權 (0最高，小於HAL_IRQ_PRIORITY_LEVELS)
+ * @return HAL_OK 成功；HAL_BUSY 登記數量已滿
+ */
+hal_status_t hal_irq_register(uint32_t vector, hal_irq_handler_t handler, uint16_t priority);
+
+/**
+ * @brief 禁用中斷並移除處理函式
+ * @param vector 中斷向量
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 向量未登記
+ */
+hal_status_t hal_irq_unregister(uint32_t vector);
+
+/**
+ * @brief 致能已登記的中斷
+ * @param vector 中斷向量
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 向量未登記
+ */
+hal_status_t hal_irq_enable(uint32_t vector);
+
+/**
+ * @brief 禁用已登記的中斷，處理函式保留
+ * @param vector 中斷向量
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 向量未登記
+ */
+hal_status_t hal_irq_disable(uint32_t vector);
+
+/**
+ * @brief 以軟體觸發已登記的中斷 (STM32設置NVIC待處理，C2000設置PIEIFR)
+ * @param vector 中斷向量
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 向量未登記；HAL_ERROR 平台不支援
+ */
+hal_status_t hal_irq_trigger(uint32_t vector);
+
+/**
+ * @brief 取得目前正在執行的處理函式優先權
+ * @return 優先權；不在登記的處理函式中時返回HAL_IRQ_PRIORITY_LEVELS
+ */
+uint16_t hal_irq_current_priority(void);
+
+#if !defined(PLATFORM_TI_C2000) && !defined(PLATFORM_STM32)
+/**
+ * @brief 主機端模擬: 執行可搶占目前程式的待處理中斷
+ * 離開hal_critical臨界區後呼叫，模擬硬體在解除遮罩時進入待處理的中斷
+ */
+void hal_irq_host_dispatch(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_IRQ_H */
@@ -0,0 +1,152 @@
+/**
+ * @file hal_log.h
+ * @brief 延後二進位日誌介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * HAL_LOG()只記錄格式字串位址 (格式ID) 與原始參數，不在目標上格式化文字。
+ * 格式字串放在不載入目標的.hal_log_fmt區段，主機工具log_decode.py
+ * 從建置產生的ELF取出ID→字串對照表後還原文字。
+ *
+ * 傳輸格式: 每筆記錄為一個COBS訊框 (hal_frame)，payload為
+ *   header (bit3-0: 參數數量，bit7-4: 類型) +
+ *   類型0 (日誌): varint(格式ID) + zigzag varint(與前一筆的tick差) + varint(參數)...
+ *   類型1 (遺失): varint(遺失筆數)
+ */
+
+#ifndef HAL_LOG_H
+#define HAL_LOG_H
+
+#include "hal_common.h"
+#include "hal_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             日誌配置                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 日誌功能開關
+ * 0 = HAL_LOG()不產生任何程式碼
+ */
+#ifndef HAL_LOG_ENABLE
+    #define HAL_LOG_ENABLE              1
+#endif
+
+/** 日誌佇列容量 (記錄數，必須為2的冪次) */
+#ifndef HAL_LOG_QUEUE_SIZE
+    #define HAL_LOG_QUEUE_SIZE          32
+#endif
+
+#if (HAL_LOG_QUEUE_SIZE & (HAL_LOG_QUEUE_SIZE - 1)) != 0
+    #error "HAL_LOG_QUEUE_SIZE must be a power of two"
+#endif
+
+/** 每筆記錄的最大參數數量 */
+#define HAL_LOG_MAX_ARGS                6
+
+/** 記錄訊框的CRC尾碼 (hal_frame_crc_t) */
+#ifndef HAL_LOG_FRAME_CRC
+    #define HAL_LOG_FRAME_CRC           HAL_FRAME_CRC16
+#endif
+
+/** 格式字串區段 */
+#define HAL_LOG_SECTION                 ".hal_log_fmt"
+
+/** 記錄類型 */
+#define HAL_LOG_TYPE_RECORD             0U
+#define HAL_LOG_TYPE_DROPPED            1U
+
+/** 日誌參數 (整數、字元與指標，浮點數不支援) */
+typedef uint32_t hal_log_arg_t;
+
+/* ========================================================================== */
+/*                             日誌巨集                                        */
+/* ========================================================================== */
+
+#if HAL_LOG_ENABLE
+
+/**
+ * @brief 記錄日誌
+ * 用法與printf相同，格式字串必須為字串常數，最多HAL_LOG_MAX_ARGS個參數。
+ * 可在中斷中呼叫，只複製格式ID與參數。
+ */
+#define HAL_LOG(...) \
+    HAL_LOG_SELECT(__VA_ARGS__, HAL_LOG_6, HAL_LOG_5, HAL_LOG_4, HAL_LOG_3, \
+                   HAL_LOG_2, HAL_LOG_1, HAL_LOG_0, ~)(__VA_ARGS__)
+
+#define HAL_LOG_SELECT(fmt, a1, a2, a3, a4, a5, a6, name, ...) name
+
+#define HAL_LOG_RECORD(fmt, n, args) \
+    do { \
+        static const char hal_log_fmt_[] \
+            __attribute__((section(HAL_LOG_SECTION), used)) = fmt; \
+        hal_log_write(hal_log_fmt_, (n), (args)); \
+    } while (0)
+
+#define HAL_LOG_ARGS(...)               ((const hal_log_arg_t[]){ __VA_ARGS__ })
+#define HAL_LOG_0(fmt)                  HAL_LOG_RECORD(fmt, 0U, NULL)
+#define HAL_LOG_1(fmt, a)               HAL_LOG_RECORD(fmt, 1U, HAL_LOG_ARGS((hal_log_arg_t)(a)))
+#define HAL_LOG_2(fmt, a, b)            HAL_LOG_RECORD(fmt, 2U, HAL_LOG_ARGS((hal_log_arg_t)(a), \
+                                            (hal_log_arg_t)(b)))
+#define HAL_LOG_3(fmt, a, b, c)         HAL_LOG_RECORD(fmt, 3U, HAL_LOG_ARGS((hal_log_arg_t)(a), \
+                                            (hal_log_arg_t)(b), (hal_log_arg_t)(c)))
+#define HAL_LOG_4(fmt, a, b, c, d)      HAL_LOG_RECORD(fmt, 4U, HAL_LOG_ARGS((hal_log_arg_t)(a), \
+                                            (hal_log_arg_t)(b), (hal_log_arg_t)(c), \
+                                            (hal_log_arg_t)(d)))
+#define HAL_LOG_5(fmt, a, b, c, d, e)   HAL_LOG_RECORD(fmt, 5U, HAL_LOG_ARGS((hal_log_arg_t)(a), \
+                                            (hal_log_arg_t)(b), (hal_log_arg_t)(c), \
+                                            (hal_log_arg_t)(d), (hal_log_arg_t)(e)))
+#define HAL_LOG_6(fmt, a, b, c, d, e, f) HAL_LOG_RECORD(fmt, 6U, HAL_LOG_ARGS((hal_log_arg_t)(a), \
+                                            (hal_log_arg_t)(b), (hal_log_arg_t)(c), \
+                                            (hal_log_arg_t)(d), (hal_log_arg_t)(e), \
+                                            (hal_log_arg_t)(f)))
+
+#else
+
+#define HAL_LOG(...)                    ((void)0)
+
+#endif /* HAL_LOG_ENABLE */
+
+/* ========================================================================== */
+/*                             日誌介面函式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化日誌並清空佇列
+ * @param uart_id 輸出UART (需已初始化)
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_log_init(hal_uart_id_t uart_id);
+
+/**
+ * @brief 寫入一筆記錄 (無鎖，可在任意中斷中呼叫)
+ * @param fmt 格式字串位址 (作為格式ID，不會讀取內容)
+ * @param nargs 參數數量
+ * @param args 參數陣列
+ * @note 一般使用HAL_LOG()，佇列已滿時記錄會被丟棄並計數
+ */
+void hal_log_write(const char* fmt, uint16_t nargs, const hal_log_arg_t* args);
+
+/**
+ * @brief 編碼並由UART發送佇列中的記錄 (由主循環或工作佇列呼叫)
+ * @param max_records 最多發送的記錄數，0表示發送到佇列為空
+ * @return 實際發送的記錄數
+ * @note 只能有一個消化者
+ */
+uint32_t hal_log_drain(uint32_t max_records);
+
+/**
+ * @brief 獲取因佇列已滿而被丟棄的記錄數
+ * @return 丟棄的記錄數
+ */
+uint32_t hal_log_get_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_LOG_H */
@@ -0,0 +1,135 @@
+/**
+ * @file hal_packed.h
+ * @brief 緊縮位元組緩衝區介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * C2000的最小定址單位為16位元，uint8_t陣列每個元素佔用一個字。
+ * 緊縮緩衝區在每個16位元字中存放兩個位元組 (低位元組在前)，
+ * 位元組緩衝區的RAM用量減半。其他平台使用相同的記憶體格式。
+ */
+
+#ifndef HAL_PACKED_H
+#define HAL_PACKED_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             緊縮緩衝區定義                                  */
+/* ========================================================================== */
+
+/** 緊縮緩衝區儲存單位 (每個單位兩個位元組) */
+typedef uint16_t hal_packed_t;
+
+/** 容納指定位元組數所需的儲存單位數 */
+#define HAL_PACKED_WORDS(nbytes)        (((nbytes) + 1U) / 2U)
+
+/**
+ * @brief 定義緊縮緩衝區
+ * @param name 陣列名稱
+ * @param nbytes 位元組容量
+ */
+#define HAL_PACKED_DEFINE(name, nbytes) hal_packed_t name[HAL_PACKED_WORDS(nbytes)]
+
+/* ========================================================================== */
+/*                             位元組存取                                      */
+/* ========================================================================== */
+
+/**
+ * @brief 讀取緊縮緩衝區中的位元組
+ * @param buf 緊縮緩衝區
+ * @param index 位元組索引
+ * @return 位元組值 (0-255)
+ */
+static inline uint16_t hal_packed_get(const hal_packed_t* buf, uint16_t index)
+{
+#if defined(__TI_COMPILER_VERSION__) && defined(__TMS320C2000__)
+    return (uint16_t)__byte((int*)buf, index);
+#else
+    return (uint16_t)((buf[index >> 1] >> ((index & 1U) * 8U)) & 0xFFU);
+#endif
+}
+
+/**
+ * @brief 寫入緊縮緩衝區中的位元組
+ * @param buf 緊縮緩衝區
+ * @param index 位元組索引
+ * @param value 位元組值 (只使用低8位元)
+ */
+static inline void hal_packed_set(hal_packed_t* buf, uint16_t index, uint16_t value)
+{
+#if defined(__TI_COMPILER_VERSION__) && defined(__TMS320C2000__)
+    __byte((int*)buf, index) = (int)(value & 0xFFU);
+#else
+    uint16_t shift = (uint16_t)((index & 1U) * 8U);
+    buf[index >> 1] = (hal_packed_t)((buf[index >> 1] & ~(0xFFU << shift)) |
+                                     ((value & 0xFFU) << shift));
+#endif
+}
+
+/* ========================================================================== */
+/*                             緊縮緩衝區介面函式                              */
+/* ========================================================================== */
+
+/**
+ * @brief 將位元組陣列緊縮到緊縮緩衝區
+ * @param dst 目的緊縮緩衝區 (至少HAL_PACKED_WORDS(len)個單位)
+ * @param src 來源位元組陣列 (每個元素一個位元組)
+ * @param len 位元組數
+ */
+void hal_packed_pack(hal_packed_t* dst, const uint8_t* src, uint16_t len);
+
+/**
+ * @brief 將緊縮緩衝區展開為位元組陣列
+ * @param dst 目的位元組陣列
+ * @param src 來源緊縮緩衝區
+ * @param len 位元組數
+ */
+void hal_packed_unpack(uint8_t* dst, const hal_packed_t* src, uint16_t len);
+
+/**
+ * @brief 發送緊縮緩衝區資料
+ * @param uart_id UART識別碼
+ * @param data 緊縮資料
+ * @param size 位元組數
+ * @param timeout 整個傳輸的超時時間(ms)
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_uart_transmit_packed(hal_uart_id_t uart_id, const hal_packed_t* data,
+                                      uint16_t size, uint32_t timeout);
+
+/**
+ * @brief 接收資料到緊縮緩衝區
+ * @param uart_id UART識別碼
+ * @param data 緊縮緩衝區
+ * @param size 位元組數
+ * @param timeout 整個傳輸的超時時間(ms)
+ * @param received 實際收到的位元組數 (超時時也已寫入data)，可為NULL
+ * @return HAL_OK 成功，HAL_TIMEOUT 超時，其他值表示失敗
+ */
+hal_status_t hal_uart_receive_packed(hal_uart_id_t uart_id, hal_packed_t* data,
+                                     uint16_t size, uint32_t timeout, uint16_t* received);
+
+/**
+ * @brief SPI以緊縮緩衝區傳輸資料
+ * @param spi_id SPI識別碼
+ * @param tx_data 發送緊縮資料
+ * @param rx_data 接收緊縮緩衝區
+ * @param size 位元組數
+ * @param timeout 超時時間(ms)
+ * @return HAL_OK 成功，其他值表示失敗
+ * @note 實現於common/hal_packed_spi.c，只在平台提供SPI驅動時建置
+ */
+hal_status_t hal_spi_transmit_receive_packed(hal_spi_id_t spi_id, const hal_packed_t* tx_data,
+                                             hal_packed_t* rx_data, uint16_t size,
+                                             uint32_t timeout);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_PACKED_H */
@@ -0,0 +1,173 @@
+/**
+ * @file hal_pool.h
+ * @brief 固定區塊記憶體池介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_POOL_H
+#define HAL_POOL_H
+
+#include "hal_common.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             記憶體池配置                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 記憶體池預設連結區段
+ * C2000預設放入.hal_pool區段，由連結命令檔指定到RAMGS；
+ * 其他平台預設不指定區段，可在編譯時定義HAL_POOL_SECTION覆寫
+ */
+#ifndef HAL_POOL_SECTION
+    #ifdef PLATFORM_TI_C2000
+        #define HAL_POOL_SECTION    ".hal_pool"
+    #endif
+#endif
+
+#ifdef HAL_POOL_SECTION
+    #define HAL_POOL_ATTR           __attribute__((section(HAL_POOL_SECTION)))
+#else
+    #define HAL_POOL_ATTR
+#endif
+
+/**
+ * @brief 是否以配置位元圖偵測重複釋放
+ * 每個區塊佔1位元，釋放未配置的區塊時hal_pool_free()返回HAL_ERROR。
+ * 預設啟用，不隨NDEBUG改變；關閉時只是不配置位元圖，hal_pool_t的配置不變，
+ * 以不同設定編譯的目標檔仍可混用 (沒有位元圖的記憶體池不做檢查)
+ */
+#ifndef HAL_POOL_CHECK_DOUBLE_FREE
+    #define HAL_POOL_CHECK_DOUBLE_FREE      1
+#endif
+
+/* ========================================================================== */
+/*                             記憶體池型別                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 區塊對齊單位
+ * 每個區塊至少容納一個指標 (空閒串列)，並對齊到最嚴格的基本型別
+ */
+typedef union {
+    void* ptr;
+    uint32_t u32;
+    float f32;
+} hal_pool_align_t;
+
+/**
+ * @brief 固定區塊記憶體池
+ * 使用HAL_POOL_DEFINE靜態配置，儲存空間在編譯時決定
+ */
+typedef struct {
+    void* free_list;                /**< 空閒區塊串列 */
+    hal_pool_align_t* storage;      /**< 區塊儲存空間 */
+    uint16_t block_units;           /**< 每個區塊的對齊單位數 */
+    uint16_t block_count;           /**< 區塊總數 */
+    volatile uint16_t used;         /**< 目前配置中的區塊數 */
+    volatile uint16_t high_water;   /**< 配置數最高水位 */
+    volatile uint32_t failures;     /**< 配置失敗次數 */
+    uint32_t* alloc_map;            /**< 配置中區塊的位元圖，NULL表示不檢查重複釋放 */
+} hal_pool_t;
+
+/** 區塊大小換算為對齊單位數 */
+#define HAL_POOL_BLOCK_UNITS(block_size)                                        \
+    (((block_size) + sizeof(hal_pool_align_t) - 1U) / sizeof(hal_pool_align_t))
+
+#if HAL_POOL_CHECK_DOUBLE_FREE
+    #define HAL_POOL_MAP_DEFINE(name, count)                                    \
+        static uint32_t name##_map[((count) + 31U) / 32U];
+    #define HAL_POOL_MAP_INIT(name)     , name##_map
+#else
+    #define HAL_POOL_MAP_DEFINE(name, count)
+    #define HAL_POOL_MAP_INIT(name)     , NULL
+#endif
+
+/**
+ * @brief 靜態定義記憶體池並放入指定區段
+ * @param name 記憶體池變數名稱
+ * @param block_size 區塊大小 (sizeof單位)
+ * @param count 區塊數量
+ * @param attr 儲存空間屬性 (例如__attribute__((section(".xxx"))))
+ */
+#define HAL_POOL_DEFINE_ATTR(name, block_size, count, attr)                     \
+    static hal_pool_align_t name##_storage[HAL_POOL_BLOCK_UNITS(block_size) * (count)] attr; \
+    HAL_POOL_MAP_DEFINE(name, count)                                            \
+    hal_pool_t name = { NULL, name##_storage,                                   \
+                        (uint16_t)HAL_POOL_BLOCK_UNITS(block_size),             \
+                        (uint16_t)(count), 0, 0, 0 HAL_POOL_MAP_INIT(name) }
+
+/**
+ * @brief 靜態定義記憶體池 (放入HAL_POOL_SECTION區段)
+ * @param name 記憶體池變數名稱
+ * @param block_size 區塊大小 (sizeof單位)
+ * @param count 區塊數量
+ */
+#define HAL_POOL_DEFINE(name, block_size, count)                                \
+    HAL_POOL_DEFINE_ATTR(name, block_size, count, HAL_POOL_ATTR)
+
+/* ========================================================================== */
+/*                             記憶體池介面函式                                */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化記憶體池，將所有區塊放回空閒串列
+ * @param pool 記憶體池指標
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_pool_init(hal_pool_t* pool);
+
+/**
+ * @brief 配置一個區塊 (O(1)，可在中斷中呼叫)
+ * @param pool 記憶體池指標
+ * @return 區塊指標，NULL表示記憶體池已用盡
+ */
+void* hal_pool_alloc(hal_pool_t* pool);
+
+/**
+ * @brief 釋放區塊 (O(1)，可在中斷中呼叫)
+ * @param pool 記憶體池指標
+ * @param block 由hal_pool_alloc()取得的區塊
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 區塊不屬於此記憶體池或不是區塊起始位址，
+ *         HAL_ERROR 區塊未被配置 (重複釋放，僅在HAL_POOL_CHECK_DOUBLE_FREE啟用時偵測)
+ */
+hal_status_t hal_pool_free(hal_pool_t* pool, void* block);
+
+/**
+ * @brief 獲取區塊大小
+ * @param pool 記憶體池指標
+ * @return 區塊大小 (sizeof單位，已對齊)
+ */
+uint32_t hal_pool_get_block_size(const hal_pool_t* pool);
+
+/**
+ * @brief 獲取空閒區塊數
+ * @param pool 記憶體池指標
+ * @return 空閒區塊數
+ */
+uint16_t hal_pool_get_free(const hal_pool_t* pool);
+
+/**
+ * @brief 獲取配置數最高水位
+ * @param pool 記憶體池指標
+ * @return 自初始化以來同時配置的最大區塊數
+ */
+uint16_t hal_pool_get_high_water(const hal_pool_t* pool);
+
+/**
+ * @brief 獲取配置失敗次數
+ * @param pool 記憶體池指標
+ * @return 記憶體池用盡時的配置請求次數
+ */
+uint32_t hal_pool_get_failures(const hal_pool_t* pool);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_POOL_H */
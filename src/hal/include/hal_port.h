@@ -0,0 +1,117 @@
+/**
+ * @file hal_port.h
+ * @brief 平台無關模組使用的移植層原語
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_PORT_H
+#define HAL_PORT_H
+
+#include "hal_common.h"
+
+#ifdef PLATFORM_STM32
+    #include "stm32g4xx.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             中斷狀態保存/恢復                               */
+/* ========================================================================== */
+
+/*
+ * HAL_PORT_IRQ_SAVE()       禁用中斷並返回先前的中斷狀態
+ * HAL_PORT_IRQ_RESTORE(s)   恢復HAL_PORT_IRQ_SAVE()返回的中斷狀態
+ *
+ * 兩者成對使用，可巢狀呼叫，只用於保護數個指令長度的共享資料更新。
+ */
+
+#if defined(PLATFORM_TI_C2000)
+
+    // TI C28x編譯器內建函式，返回並恢復ST1 (包含INTM位元)
+    typedef uint16_t hal_port_irq_state_t;
+    #define HAL_PORT_IRQ_SAVE()             ((hal_port_irq_state_t)__disable_interrupts())
+    #define HAL_PORT_IRQ_RESTORE(state)     __restore_interrupts(state)
+
+#elif defined(PLATFORM_STM32)
+
+    typedef uint32_t hal_port_irq_state_t;
+
+    static inline hal_port_irq_state_t hal_port_irq_save(void)
+    {
+        hal_port_irq_state_t primask = __get_PRIMASK();
+        __disable_irq();
+        return primask;
+    }
+
+    #define HAL_PORT_IRQ_SAVE()             hal_port_irq_save()
+    #define HAL_PORT_IRQ_RESTORE(state)     __set_PRIMASK(state)
+
+#else
+
+    // 主機端模擬環境沒有中斷
+    typedef uint32_t hal_port_irq_state_t;
+    #define HAL_PORT_IRQ_SAVE()             ((hal_port_irq_state_t)0)
+    #define HAL_PORT_IRQ_RESTORE(state)     ((void)(state))
+
+#endif
+
+/* ========================================================================== */
+/*                             原子比較交換                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 32位元比較交換: *ptr等於expected時寫入desired
+ * @return true 交換成功，false *ptr已被其他執行環境修改
+ * @note C28x沒有CAS指令，以數個指令長度的INTM遮罩實現
+ */
+#if defined(PLATFORM_TI_C2000)
+
+    static inline bool hal_port_cas32(volatile uint32_t* ptr, uint32_t expected, uint32_t desired)
+    {
+        hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+        bool swapped = (*ptr == expected);
+        if (swapped) {
+            *ptr = desired;
+        }
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return swapped;
+    }
+
+    #define HAL_PORT_MEMORY_BARRIER()   ((void)0)
+
+#elif defined(PLATFORM_STM32)
+
+    static inline bool hal_port_cas32(volatile uint32_t* ptr, uint32_t expected, uint32_t desired)
+    {
+        do {
+            if (__LDREXW(ptr) != expected) {
+                __CLREX();
+                return false;
+            }
+        } while (__STREXW(desired, ptr) != 0U);
+        return true;
+    }
+
+    #define HAL_PORT_MEMORY_BARRIER()   __DMB()
+
+#else
+
+    static inline bool hal_port_cas32(volatile uint32_t* ptr, uint32_t expected, uint32_t desired)
+    {
+        return __atomic_compare_exchange_n(ptr, &expected, desired, false,
+                                           __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    #define HAL_PORT_MEMORY_BARRIER()   __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_PORT_H */
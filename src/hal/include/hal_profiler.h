@@ -0,0 +1,122 @@
+/**
+ * @file hal_profiler.h
+ * @brief 統計式PC取樣分析器介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 高頻率計時器中斷取出被中斷的返回位址，累加到程式碼位址的直方圖:
+ * - STM32: TIM7，由例外堆疊框取出PC
+ * - TI C2000: CPU Timer1 (INT13)，由自動保存的中斷上下文取出PC
+ * 直方圖將[code_start, code_end)等分為HAL_PROFILER_BUCKETS個2的冪次大小的區間，
+ * 取樣只做一次減法、比較與累加，可在量產版本中持續執行。
+ *
+ * hal_profiler_dump()以hal_frame COBS訊框輸出，header的bit7-4為類型
+ * (與hal_log相同，可共用同一個UART):
+ *   類型2 (描述): varint(code_start) + varint(shift) + varint(區間數)
+ *                + varint(取樣總數) + varint(範圍外取樣數) + varint(取樣頻率)
+ *   類型3 (區間): 多組 varint(與前一個非零區間的索引差) + varint(取樣數)，
+ *                header bit0為1表示最後一個訊框
+ * 主機工具profile_decode.py以ELF符號表或map檔將區間對應到函式並列出平面分析結果。
+ */
+
+#ifndef HAL_PROFILER_H
+#define HAL_PROFILER_H
+
+#include "hal_common.h"
+#include "hal_uart.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             分析器配置                                      */
+/* ========================================================================== */
+
+/** 直方圖區間數 (每個區間一個32位元計數) */
+#ifndef HAL_PROFILER_BUCKETS
+    #define HAL_PROFILER_BUCKETS        512U
+#endif
+
+/** 輸出訊框的CRC尾碼 (hal_frame_crc_t) */
+#ifndef HAL_PROFILER_FRAME_CRC
+    #define HAL_PROFILER_FRAME_CRC      HAL_FRAME_CRC16
+#endif
+
+/** 訊框類型 (header bit7-4，接在HAL_LOG_TYPE_*之後) */
+#define HAL_PROFILER_TYPE_INFO          2U
+#define HAL_PROFILER_TYPE_BUCKETS       3U
+
+/** 區間訊框header bit0: 最後一個訊框 */
+#define HAL_PROFILER_FLAG_LAST          0x01U
+
+/* ========================================================================== */
+/*                             分析器介面函式                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化分析器並清除直方圖 (不啟動取樣)
+ * 區間大小為涵蓋整個範圍的最小2的冪次，範圍越小解析度越高
+ * @param code_start 取樣範圍起點 (C2000為字位址)
+ * @param code_end 取樣範圍終點 (不含)
+ * @param sample_hz 取樣頻率
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 範圍或頻率無效
+ */
+hal_status_t hal_profiler_init(uint32_t code_start, uint32_t code_end, uint32_t sample_hz);
+
+/**
+ * @brief 啟動取樣計時器
+ * @return HAL_OK 成功；HAL_ERROR 尚未初始化或計時器無法達到取樣頻率
+ */
+hal_status_t hal_profiler_start(void);
+
+/**
+ * @brief 停止取樣計時器，直方圖保留
+ */
+void hal_profiler_stop(void);
+
+/**
+ * @brief 清除直方圖
+ */
+void hal_profiler_reset(void);
+
+/**
+ * @brief 累加一個取樣 (由平台的取樣中斷呼叫)
+ * @param pc 被中斷的返回位址
+ */
+void hal_profiler_sample(uint32_t pc);
+
+/**
+ * @brief 由UART輸出直方圖 (由主循環呼叫，取樣繼續進行)
+ * @param uart_id 輸出UART (需已初始化)
+ * @return HAL_OK 成功；其他值為hal_frame_send()的錯誤
+ */
+hal_status_t hal_profiler_dump(hal_uart_id_t uart_id);
+
+/**
+ * @brief 獲取取樣總數 (含範圍外的取樣)
+ * @return 取樣總數
+ */
+uint32_t hal_profiler_get_samples(void);
+
+/* ========================================================================== */
+/*                             平台移植介面                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 以指定頻率啟動取樣中斷，中斷中呼叫hal_profiler_sample()
+ * @param sample_hz 取樣頻率
+ * @return HAL_OK 成功；HAL_ERROR 計時器無法達到取樣頻率
+ */
+hal_status_t hal_profiler_port_start(uint32_t sample_hz);
+
+/**
+ * @brief 停止取樣中斷
+ */
+void hal_profiler_port_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_PROFILER_H */
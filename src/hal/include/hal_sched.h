@@ -0,0 +1,118 @@
+/**
+ * @file hal_sched.h
+ * @brief 協作式run-to-completion任務排程器介面
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_SCHED_H
+#define HAL_SCHED_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             排程器定義                                      */
+/* ========================================================================== */
+
+/** 優先權數量 (0為最低，31為最高，每個優先權一個任務) */
+#define HAL_SCHED_MAX_PRIORITY      32
+
+/** 事件代碼 */
+typedef uint16_t hal_sched_event_t;
+
+/** 保留事件: 由hal_sched_wake()發送的喚醒事件 */
+#define HAL_SCHED_EVENT_WAKE        ((hal_sched_event_t)0)
+
+typedef struct hal_task hal_task_t;
+
+/** 任務事件處理函式，每個事件執行到完成後返回 */
+typedef void (*hal_task_handler_t)(hal_task_t* task, hal_sched_event_t event);
+
+/** 空閒回呼函式，沒有就緒任務時由hal_sched_run()呼叫 */
+typedef void (*hal_sched_idle_hook_t)(void);
+
+/**
+ * @brief 任務描述子
+ * 使用HAL_SCHED_TASK_DEFINE靜態配置，事件佇列由描述子自帶
+ */
+struct hal_task {
+    hal_task_handler_t handler;     /**< 事件處理函式 */
+    void* context;                  /**< 任務私有資料 */
+    hal_sched_event_t* queue;       /**< 事件佇列緩衝區 */
+    uint16_t queue_size;            /**< 事件佇列容量 */
+    uint16_t priority;              /**< 任務優先權 */
+    volatile uint16_t head;         /**< 佇列讀取位置 */
+    volatile uint16_t tail;         /**< 佇列寫入位置 */
+    volatile uint16_t count;        /**< 佇列中事件數量 */
+};
+
+/**
+ * @brief 靜態定義任務描述子與其事件佇列
+ * @param name 任務變數名稱
+ * @param handler 事件處理函式
+ * @param context 任務私有資料
+ * @param prio 任務優先權 (0-31)
+ * @param queue_len 事件佇列容量
+ */
+#define HAL_SCHED_TASK_DEFINE(name, handler, context, prio, queue_len)          \
+    static hal_sched_event_t name##_queue[queue_len];                           \
+    hal_task_t name = { (handler), (context), name##_queue, (queue_len),        \
+                        (prio), 0, 0, 0 }
+
+/* ========================================================================== */
+/*                             排程器介面函式                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化排程器
+ */
+void hal_sched_init(void);
+
+/**
+ * @brief 註冊任務
+ * @param task 任務描述子指標
+ * @return HAL_OK 成功，HAL_BUSY 該優先權已被使用，其他值表示失敗
+ */
+hal_status_t hal_sched_add(hal_task_t* task);
+
+/**
+ * @brief 發送事件給任務 (可在中斷中呼叫)
+ * @param task 任務描述子指標
+ * @param event 事件代碼
+ * @return HAL_OK 成功，HAL_BUSY 事件佇列已滿，其他值表示失敗
+ */
+hal_status_t hal_sched_post(hal_task_t* task, hal_sched_event_t event);
+
+/**
+ * @brief 喚醒任務 (可在中斷中呼叫)
+ * @param task 任務描述子指標 (hal_task_t*)
+ * @note 符合hal_callback_t原型，可直接作為HAL非同步完成回呼
+ */
+void hal_sched_wake(void* task);
+
+/**
+ * @brief 派送一個事件給最高優先權的就緒任務
+ * @return true 已派送事件，false 沒有就緒任務
+ */
+bool hal_sched_run_once(void);
+
+/**
+ * @brief 進入排程循環 (不會返回)
+ */
+void hal_sched_run(void);
+
+/**
+ * @brief 設置空閒回呼函式
+ * @param hook 空閒回呼函式，NULL表示不使用
+ */
+void hal_sched_set_idle_hook(hal_sched_idle_hook_t hook);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_SCHED_H */
@@ -9,6 +9,7 @@
 #define HAL_SPI_H
 
 #include "hal_common.h"
+#include "hal_buf.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,6 +68,18 @@ hal_status_t hal_spi_transmit(hal_spi_id_t spi_id, const uint8_t* data,
 hal_status_t hal_spi_receive(hal_spi_id_t spi_id, uint8_t* data, 
                              uint16_t size, uint32_t timeout);
 
+/**
+ * @brief SPI以緩衝區串鏈傳輸資料 (分散/集中，零複製)
+ * @param spi_id SPI識別碼
+ * @param tx_chain 發送串鏈，NULL表示只接收；所有權轉移給此函式，返回前釋放
+ * @param rx_chain 接收串鏈，NULL表示只發送；依各段len接收，由呼叫者保有
+ * @param timeout 每段的超時時間(ms)
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 兩串鏈總長度不同，其他值表示失敗
+ * @note 實現於common/hal_buf_spi.c，只在平台提供SPI驅動時建置
+ */
+hal_status_t hal_spi_transfer_buf(hal_spi_id_t spi_id, hal_buf_t* tx_chain,
+                                  hal_buf_t* rx_chain, uint32_t timeout);
+
 /**
  * @brief 檢查SPI是否忙碌
  * @param spi_id SPI識別碼
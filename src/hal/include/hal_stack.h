@@ -0,0 +1,117 @@
+/**
+ * @file hal_stack.h
+ * @brief 堆疊使用量量測 (填色與高水位)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * hal_init()開頭以HAL_STACK_PAINT_PATTERN填滿堆疊區域中尚未使用的部分，
+ * 之後從遠離堆疊起點的一端以32位元字逐一比對，第一個被改寫的字即為歷來最深的位置。
+ * 堆疊區域取自連結器符號:
+ * - TI C2000: .stack區段 (__stack至__STACK_END，大小為--stack_size)，向高位址成長
+ * - STM32: _estack往下_Min_Stack_Size的範圍，向低位址成長；
+ *   沒有RTOS時主程式與所有中斷共用MSP，高水位已包含中斷巢狀的最深用量
+ * 自訂連結描述檔可同時定義HAL_STACK_REGION_BASE與HAL_STACK_REGION_END取代上述符號。
+ * 大小與高水位的單位為位址單位 (C2000: 16位元字，與--stack_size相同；STM32: 位元組)。
+ *
+ * 遠端的HAL_STACK_CANARY_WORDS個字作為溢位哨兵，hal_stack_check()檢查其是否被改寫。
+ * HAL_STACK_TICK_CHECK為1時系統tick中斷每次都會檢查。
+ * 只宣告不寫入的大型區域變數可能跳過哨兵與填色，量得的高水位因此偏低。
+ */
+
+#ifndef HAL_STACK_H
+#define HAL_STACK_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             堆疊量測配置                                    */
+/* ========================================================================== */
+
+/** 填色圖樣 */
+#ifndef HAL_STACK_PAINT_PATTERN
+    #define HAL_STACK_PAINT_PATTERN     0xA5A5A5A5UL
+#endif
+
+/** 填色時目前堆疊指標附近保留不填的32位元字數 (避免改寫填色函式本身的框架) */
+#ifndef HAL_STACK_PAINT_MARGIN
+    #define HAL_STACK_PAINT_MARGIN      8U
+#endif
+
+/** 遠端作為溢位哨兵的32位元字數 */
+#ifndef HAL_STACK_CANARY_WORDS
+    #define HAL_STACK_CANARY_WORDS      4U
+#endif
+
+/** 是否在系統tick中斷中檢查溢位哨兵 */
+#ifndef HAL_STACK_TICK_CHECK
+    #define HAL_STACK_TICK_CHECK        0
+#endif
+
+/** 主機端模擬堆疊的32位元字數 */
+#ifndef HAL_STACK_HOST_WORDS
+    #define HAL_STACK_HOST_WORDS        256U
+#endif
+
+/** 堆疊成長方向 */
+#if defined(PLATFORM_TI_C2000)
+    #define HAL_STACK_GROWS_UP          1
+#else
+    #define HAL_STACK_GROWS_UP          0
+#endif
+
+/* ========================================================================== */
+/*                             堆疊量測型別                                    */
+/* ========================================================================== */
+
+/** 偵測到溢位時的回呼 (可能在tick中斷中執行) */
+typedef void (*hal_stack_overflow_hook_t)(void);
+
+/* ========================================================================== */
+/*                             堆疊量測介面函式                                */
+/* ========================================================================== */
+
+/**
+ * @brief 填色堆疊中目前未使用的部分並重新開始量測 (由hal_init()呼叫)
+ * 填色期間遮罩中斷，避免改寫中斷框架
+ */
+void hal_stack_paint(void);
+
+/**
+ * @brief 獲取堆疊區域大小
+ * @return 位址單位，尚未填色時為0
+ */
+uint32_t hal_stack_get_size(void);
+
+/**
+ * @brief 獲取填色後的最大使用量 (從遠端逐字掃描，耗時與未使用的大小成正比)
+ * @return 位址單位，以32位元字為粒度；尚未填色時為0
+ */
+uint32_t hal_stack_get_high_water(void);
+
+/**
+ * @brief 檢查溢位哨兵 (可在中斷中呼叫)
+ * 第一次發現哨兵被改寫時呼叫溢位回呼
+ * @return true 哨兵完整或尚未填色，false 已溢位
+ */
+bool hal_stack_check(void);
+
+/**
+ * @brief 設定溢位回呼
+ * @param hook 回呼函式，NULL表示只由hal_stack_check()的返回值回報
+ */
+void hal_stack_set_overflow_hook(hal_stack_overflow_hook_t hook);
+
+#if !defined(PLATFORM_TI_C2000) && !defined(PLATFORM_STM32)
+// 主機端模擬的堆疊區域 (向低位址成長)，直接寫入以模擬堆疊使用
+extern uint32_t hal_stack_host_region[HAL_STACK_HOST_WORDS];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_STACK_H */
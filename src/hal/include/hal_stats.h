@@ -0,0 +1,103 @@
+/**
+ * @file hal_stats.h
+ * @brief 週邊驅動效能與錯誤統計
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 每個週邊實例一份hal_stats_t，由驅動程式在熱路徑上以巨集更新，
+ * 透過hal_uart_get_stats()讀取。目前只有UART驅動，SPI/I2C/ADC驅動加入時
+ * 以相同形式提供hal_xxx_get_stats()/hal_xxx_reset_stats()。HAL_STATS_ENABLE為0時巨集不產生任何程式碼。
+ * 阻塞時間以hal_get_cycle_count()的CPU週期數計算。
+ * 計數不使用原子操作，中斷與主循環同時更新同一欄位時可能偶有遺漏，
+ * 讀取與清除時會遮罩中斷以取得一致的內容。
+ */
+
+#ifndef HAL_STATS_H
+#define HAL_STATS_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             統計配置                                        */
+/* ========================================================================== */
+
+/** 是否在驅動程式中累計統計 */
+#ifndef HAL_STATS_ENABLE
+    #define HAL_STATS_ENABLE            1
+#endif
+
+/* ========================================================================== */
+/*                             統計型別                                        */
+/* ========================================================================== */
+
+/** 單一週邊實例的統計 (計數溢位後迴繞) */
+typedef struct {
+    uint32_t tx_bytes;              // 發送的位元組數 (ADC: 未使用)
+    uint32_t rx_bytes;              // 接收的位元組數 (ADC: 轉換結果數)
+    uint32_t transfers;             // 成功完成的傳輸次數
+    uint32_t busy_cycles;           // 阻塞函式的累計週期數
+    uint32_t max_block_cycles;      // 單次阻塞函式的最長週期數
+    uint32_t overruns;              // 接收溢位 (硬體或軟體緩衝區)
+    uint32_t parity_errors;         // 同位錯誤
+    uint32_t framing_errors;        // 框架錯誤
+    uint32_t nacks;                 // 從機未確認 (I2C)
+    uint32_t timeouts;              // 返回HAL_TIMEOUT的次數
+} hal_stats_t;
+
+/* ========================================================================== */
+/*                             驅動程式更新巨集                                */
+/* ========================================================================== */
+
+#if HAL_STATS_ENABLE
+
+// 與hal.h相同的宣告，驅動程式不需為了統計巨集包含hal.h
+uint32_t hal_get_cycle_count(void);
+
+/** 累加欄位 */
+#define HAL_STATS_ADD(stats, field, n)          ((stats)->field += (uint32_t)(n))
+
+/** 條件成立時欄位加一 */
+#define HAL_STATS_COUNT_IF(stats, field, cond)  \
+    do { if (cond) { (stats)->field++; } } while (0)
+
+/** 阻塞函式開頭取時間戳 */
+#define HAL_STATS_BLOCK_BEGIN()                 hal_get_cycle_count()
+
+/** 阻塞函式返回前累計阻塞時間 */
+#define HAL_STATS_BLOCK_END(stats, start)       hal_stats_block_end((stats), (start))
+
+/**
+ * @brief 累計一次阻塞時間
+ */
+static inline void hal_stats_block_end(hal_stats_t* stats, uint32_t start)
+{
+    uint32_t cycles = hal_get_cycle_count() - start;
+
+    stats->busy_cycles += cycles;
+    if (cycles > stats->max_block_cycles) {
+        stats->max_block_cycles = cycles;
+    }
+}
+
+#else
+
+// 參考統計指標，避免只用於統計的區域變數產生未使用警告
+#define HAL_STATS_ADD(stats, field, n)          ((void)(stats), (void)(n))
+#define HAL_STATS_COUNT_IF(stats, field, cond)  ((void)(stats))
+#define HAL_STATS_BLOCK_BEGIN()                 0U
+#define HAL_STATS_BLOCK_END(stats, start)       ((void)(stats), (void)(start))
+
+#endif /* HAL_STATS_ENABLE */
+
+/** 欄位加一 */
+#define HAL_STATS_INC(stats, field)             HAL_STATS_ADD(stats, field, 1U)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_STATS_H */
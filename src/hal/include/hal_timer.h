@@ -0,0 +1,136 @@
+/**
+ * @file hal_timer.h
+ * @brief 軟體計時器服務介面 (階層式計時輪)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_TIMER_H
+#define HAL_TIMER_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             計時輪配置                                      */
+/* ========================================================================== */
+
+/**
+ * @brief 每層計時輪的槽位元數 (每層槽數 = 2^BITS)
+ */
+#ifndef HAL_TIMER_WHEEL_BITS
+    #define HAL_TIMER_WHEEL_BITS        6
+#endif
+
+/**
+ * @brief 計時輪層數
+ * 可直接定位的最長延時為 2^(BITS*LEVELS) 個tick，更長的延時會在最上層循環重排
+ */
+#ifndef HAL_TIMER_WHEEL_LEVELS
+    #define HAL_TIMER_WHEEL_LEVELS      4
+#endif
+
+/**
+ * @brief 到期處理方式
+ * 0 = 由主循環呼叫hal_timer_process()
+ * 1 = 每個tick由hal_timer_tick()提交到工作佇列 (hal_work)，回呼在工作佇列消化時執行
+ */
+#ifndef HAL_TIMER_USE_WORK_QUEUE
+    #define HAL_TIMER_USE_WORK_QUEUE    0
+#endif
+
+#if (HAL_TIMER_WHEEL_BITS * HAL_TIMER_WHEEL_LEVELS) >= 32
+    #error "HAL_TIMER_WHEEL_BITS * HAL_TIMER_WHEEL_LEVELS must be less than 32"
+#endif
+
+/* ========================================================================== */
+/*                             計時器型別                                      */
+/* ========================================================================== */
+
+typedef struct hal_timer hal_timer_t;
+
+/** 計時器到期回呼函式 (在hal_timer_process()的執行緒環境中呼叫) */
+typedef void (*hal_timer_callback_t)(hal_timer_t* timer, void* context);
+
+/**
+ * @brief 軟體計時器
+ * 由呼叫者靜態配置，計時輪以侵入式串列連結，不需要動態記憶體
+ */
+struct hal_timer {
+    hal_timer_t* next;              /**< 槽位串列下一個節點 */
+    hal_timer_t** pprev;            /**< 指向前一節點next欄位，NULL表示未啟動 */
+    uint32_t expires;               /**< 到期tick (絕對值) */
+    uint32_t period;                /**< 週期tick，0表示單次計時器 */
+    hal_timer_callback_t callback;  /**< 到期回呼函式 */
+    void* context;                  /**< 回呼函式參數 */
+};
+
+/* ========================================================================== */
+/*                             計時器介面函式                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化計時器服務
+ * @note 會捨棄所有已啟動的計時器
+ */
+void hal_timer_service_init(void);
+
+/**
+ * @brief 初始化計時器物件
+ * @param timer 計時器指標
+ * @param callback 到期回呼函式
+ * @param context 回呼函式參數
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_timer_setup(hal_timer_t* timer, hal_timer_callback_t callback, void* context);
+
+/**
+ * @brief 啟動計時器 (O(1))
+ * @param timer 計時器指標
+ * @param delay 首次到期延時(tick)，需小於0x80000000
+ * @param period 週期(tick)，0表示單次計時器，需小於0x80000000
+ * @return HAL_OK 成功；HAL_INVALID_PARAM 參數無效或延時/週期超出範圍
+ * @note 對已啟動的計時器呼叫會以新的延時重新啟動
+ */
+hal_status_t hal_timer_start(hal_timer_t* timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief 停止計時器 (O(1))
+ * @param timer 計時器指標
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_timer_stop(hal_timer_t* timer);
+
+/**
+ * @brief 檢查計時器是否已啟動
+ * @param timer 計時器指標
+ * @return true 已啟動，false 未啟動
+ */
+bool hal_timer_is_active(const hal_timer_t* timer);
+
+/**
+ * @brief 計時器tick (由系統tick中斷呼叫)
+ * @note 只累加tick計數，到期處理延後至hal_timer_process()或工作佇列
+ */
+void hal_timer_tick(void);
+
+/**
+ * @brief 推進計時輪並執行到期回呼 (由主循環或工作佇列呼叫)
+ * @return 本次執行的回呼數量
+ */
+uint32_t hal_timer_process(void);
+
+/**
+ * @brief 獲取計時器服務tick計數
+ * @return tick計數值
+ */
+uint32_t hal_timer_get_ticks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_TIMER_H */
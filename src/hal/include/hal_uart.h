@@ -9,11 +9,68 @@
 #define HAL_UART_H
 
 #include "hal_common.h"
+#include "hal_stats.h"
+#include "hal_buf.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* ========================================================================== */
+/*                             波特率計算                                      */
+/* ========================================================================== */
+
+/**
+ * @brief 允許的最大波特率誤差 (ppm)
+ * 超過此誤差時初始化返回HAL_INVALID_PARAM
+ */
+#ifndef HAL_UART_BAUD_MAX_ERROR_PPM
+    #define HAL_UART_BAUD_MAX_ERROR_PPM     25000L
+#endif
+
+/** 波特率除頻計算結果 */
+typedef struct {
+    uint32_t divisor;               /**< 除頻暫存器值 (C2000: BRR，STM32: USART_BRR) */
+    uint16_t prescaler;             /**< 預除頻暫存器值 (STM32: USART_PRESC，C2000固定為0) */
+    bool over8;                     /**< 8倍取樣 (STM32: CR1.OVER8) */
+    uint32_t actual_baudrate;       /**< 實際波特率 */
+    int32_t error_ppm;              /**< 相對於要求波特率的誤差 (ppm) */
+} hal_uart_baud_result_t;
+
+/**
+ * @brief 計算C2000 SCI波特率除頻值
+ * @param lspclk_hz SCI時鐘 (LSPCLK, Hz)
+ * @param baudrate 要求的波特率
+ * @param result 計算結果
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 超出範圍或誤差超過HAL_UART_BAUD_MAX_ERROR_PPM
+ * @note 實際波特率 = LSPCLK / ((BRR + 1) * 8)
+ */
+hal_status_t hal_uart_calc_sci_divisor(uint32_t lspclk_hz, uint32_t baudrate,
+                                       hal_uart_baud_result_t* result);
+
+/**
+ * @brief 計算STM32 USART波特率除頻值 (搜尋所有預除頻值與16/8倍取樣)
+ * @param kernel_hz USART核心時鐘 (Hz)
+ * @param baudrate 要求的波特率
+ * @param result 計算結果
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 超出範圍或誤差超過HAL_UART_BAUD_MAX_ERROR_PPM
+ * @note 誤差相同時取先搜尋到的候選: 預除頻值由小到大，同一預除頻值內16倍取樣先於8倍取樣、
+ *       較小的除頻值先於較大的
+ */
+hal_status_t hal_uart_calc_usart_divisor(uint32_t kernel_hz, uint32_t baudrate,
+                                         hal_uart_baud_result_t* result);
+
+/**
+ * @brief 由STM32 USART的BRR暫存器值計算實際波特率
+ * @param kernel_hz USART核心時鐘 (Hz)
+ * @param prescaler USART_PRESC暫存器值
+ * @param over8 8倍取樣 (CR1.OVER8)
+ * @param brr BRR暫存器值
+ * @return 實際波特率，參數無效時為0
+ */
+uint32_t hal_uart_calc_usart_baudrate(uint32_t kernel_hz, uint16_t prescaler, bool over8,
+                                      uint32_t brr);
+
 /* ========================================================================== */
 /*                             UART介面函式                                   */
 /* ========================================================================== */
@@ -44,6 +101,15 @@ hal_status_t hal_uart_deinit(hal_uart_id_t uart_id);
 hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data, 
                                uint16_t size, uint32_t timeout);
 
+/**
+ * @brief 發送緩衝區串鏈 (零複製)
+ * @param uart_id UART識別碼
+ * @param chain 緩衝區串鏈，所有權轉移給此函式，返回前釋放
+ * @param timeout 每段的超時時間(ms)
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_uart_transmit_buf(hal_uart_id_t uart_id, hal_buf_t* chain, uint32_t timeout);
+
 /**
  * @brief 接收資料
  * @param uart_id UART識別碼
@@ -72,6 +138,24 @@ hal_status_t hal_uart_putchar(hal_uart_id_t uart_id, uint8_t ch);
  */
 hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeout);
 
+/**
+ * @brief 獲取目前使用的波特率設定
+ * @param uart_id UART識別碼
+ * @param result 除頻值、實際波特率與誤差
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_uart_get_baud_info(hal_uart_id_t uart_id, hal_uart_baud_result_t* result);
+
+/**
+ * @brief 自動偵測波特率並鎖定
+ * @param uart_id UART識別碼 (需先以hal_uart_init()設定資料格式)
+ * @param timeout 等待同步字元的超時時間(ms)，0表示一直等待
+ * @param baudrate 偵測到的波特率，可為NULL
+ * @return HAL_OK 成功，HAL_TIMEOUT 超時，其他值表示失敗
+ * @note 對方需發送同步字元：C2000 SCI為'A'或'a'，STM32 USART為0x55
+ */
+hal_status_t hal_uart_autobaud(hal_uart_id_t uart_id, uint32_t timeout, uint32_t* baudrate);
+
 /**
  * @brief 檢查UART是否忙碌
  * @param uart_id UART識別碼
@@ -100,6 +184,78 @@ hal_status_t hal_uart_flush_rx(hal_uart_id_t uart_id);
  */
 hal_status_t hal_uart_flush_tx(hal_uart_id_t uart_id);
 
+/* ========================================================================== */
+/*                             訊框接收                                        */
+/* ========================================================================== */
+
+/** 不使用結束字元 */
+#define HAL_UART_FRAME_NO_MATCH         (-1)
+
+/** 預設閒置判定時間 (位元時間) */
+#ifndef HAL_UART_FRAME_IDLE_BITS
+    #define HAL_UART_FRAME_IDLE_BITS    20U
+#endif
+
+/**
+ * @brief 設置訊框結束條件
+ * @param uart_id UART識別碼
+ * @param idle_bits 線路閒置多少位元時間視為訊框結束，0表示使用HAL_UART_FRAME_IDLE_BITS
+ * @param match_char 訊框結束字元 (0-255)，HAL_UART_FRAME_NO_MATCH表示不使用
+ * @return HAL_OK 成功，HAL_NOT_SUPPORTED 後端不支援訊框接收，其他值表示失敗
+ * @note 需在hal_uart_init()之後、沒有等待中的訊框時呼叫
+ * @note C2000簡化後端 (TI_C2000_USE_DRIVERLIB=0) 只以輪詢收發，訊框介面返回HAL_NOT_SUPPORTED
+ */
+hal_status_t hal_uart_config_frame(hal_uart_id_t uart_id, uint16_t idle_bits, int16_t match_char);
+
+/**
+ * @brief 啟動訊框接收 (非阻塞)
+ * @param uart_id UART識別碼
+ * @param buffer 接收緩衝區
+ * @param max_size 緩衝區大小，收滿時訊框結束
+ * @param length 訊框結束時寫入實際長度
+ * @param callback 訊框結束時呼叫 (可能在中斷環境)，NULL表示以hal_uart_frame_pending()輪詢
+ * @param context 回呼函式參數
+ * @return HAL_OK 成功，HAL_BUSY 已有等待中的訊框，HAL_NOT_SUPPORTED 後端不支援，
+ *         其他值表示失敗
+ * @note 訊框在線路閒置、收到結束字元或緩衝區已滿時結束，每個訊框只需少數幾次中斷；
+ *       回呼中可再次呼叫此函式接收下一個訊框
+ */
+hal_status_t hal_uart_receive_frame(hal_uart_id_t uart_id, uint8_t* buffer, uint16_t max_size,
+                                    uint16_t* length, hal_callback_t callback, void* context);
+
+/**
+ * @brief 檢查是否有等待中的訊框
+ * @param uart_id UART識別碼
+ * @return true 訊框尚未結束，false 沒有等待中的訊框
+ */
+bool hal_uart_frame_pending(hal_uart_id_t uart_id);
+
+/**
+ * @brief 取消等待中的訊框 (不呼叫回呼)
+ * @param uart_id UART識別碼
+ * @return HAL_OK 成功，其他值表示失敗
+ */
+hal_status_t hal_uart_abort_frame(hal_uart_id_t uart_id);
+
+/* ========================================================================== */
+/*                             效能與錯誤統計                                  */
+/* ========================================================================== */
+
+/**
+ * @brief 讀取UART統計
+ * @param uart_id UART識別碼
+ * @param stats 統計輸出
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 參數無效，HAL_ERROR HAL_STATS_ENABLE為0
+ */
+hal_status_t hal_uart_get_stats(hal_uart_id_t uart_id, hal_stats_t* stats);
+
+/**
+ * @brief 清除UART統計
+ * @param uart_id UART識別碼
+ * @return HAL_OK 成功，HAL_INVALID_PARAM 參數無效
+ */
+hal_status_t hal_uart_reset_stats(hal_uart_id_t uart_id);
+
 #ifdef __cplusplus
 }
 #endif
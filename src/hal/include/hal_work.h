@@ -0,0 +1,95 @@
+/**
+ * @file hal_work.h
+ * @brief 中斷延後處理工作佇列介面 (bottom half)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef HAL_WORK_H
+#define HAL_WORK_H
+
+#include "hal_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/*                             工作佇列配置                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 工作佇列容量 (必須為2的冪次)
+ */
+#ifndef HAL_WORK_QUEUE_SIZE
+    #define HAL_WORK_QUEUE_SIZE         16
+#endif
+
+#if (HAL_WORK_QUEUE_SIZE & (HAL_WORK_QUEUE_SIZE - 1)) != 0
+    #error "HAL_WORK_QUEUE_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief 工作佇列消化方式
+ * 0 = 由主循環呼叫hal_work_drain()
+ * 1 = 由低優先權軟體中斷消化 (C2000使用未使用的PIE通道，STM32使用PendSV)
+ */
+#ifndef HAL_WORK_USE_SWI
+    #define HAL_WORK_USE_SWI            0
+#endif
+
+/* ========================================================================== */
+/*                             工作佇列介面函式                                */
+/* ========================================================================== */
+
+/**
+ * @brief 初始化工作佇列
+ * @note 使用軟體中斷時會同時配置並使能該中斷
+ */
+void hal_work_init(void);
+
+/**
+ * @brief 提交延後處理工作 (無鎖，可在任意中斷中呼叫)
+ * @param func 工作函式
+ * @param context 工作函式參數
+ * @return HAL_OK 成功，HAL_BUSY 佇列已滿，其他值表示失敗
+ */
+hal_status_t hal_work_post(hal_callback_t func, void* context);
+
+/**
+ * @brief 依提交順序執行佇列中的工作
+ * @param max_items 最多執行的工作數量，0表示執行到佇列為空
+ * @return 實際執行的工作數量
+ * @note 只能有一個消化者 (主循環或軟體中斷擇一)
+ */
+uint32_t hal_work_drain(uint32_t max_items);
+
+/**
+ * @brief 獲取因佇列已滿而被丟棄的工作數量
+ * @return 丟棄的工作數量
+ */
+uint32_t hal_work_get_dropped(void);
+
+/* ========================================================================== */
+/*                             平台移植介面                                    */
+/* ========================================================================== */
+
+#if HAL_WORK_USE_SWI
+
+/**
+ * @brief 配置並使能消化工作佇列的軟體中斷 (由平台實現)
+ */
+void hal_work_port_init(void);
+
+/**
+ * @brief 觸發消化工作佇列的軟體中斷 (由平台實現)
+ */
+void hal_work_port_trigger(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HAL_WORK_H */
@@ -0,0 +1,182 @@
+/**
+ * @file stm32g4_gpio_ll.c
+ * @brief STM32G4系列GPIO硬體抽象層LL實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 直接存取GPIO暫存器，不呼叫HAL_GPIO_Init。
+ * set_mode/set_pull只讀改寫MODER/PUPDR中該引腳的2位元欄位，不影響其他設定；
+ * 寫入與翻轉為單一BSRR寫入，不需要關中斷即可與其他引腳的操作並行。
+ */
+
+#include "../include/hal_gpio.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define STM32_GPIO_PIN_COUNT    16U
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 檢查引腳並取得所在埠
+ * @return GPIO埠指標，無效引腳返回NULL
+ */
+static inline GPIO_TypeDef* stm32_gpio_port_checked(hal_gpio_pin_t pin)
+{
+    if (((uint32_t)pin & 0xFFU) >= STM32_GPIO_PIN_COUNT) {
+        return NULL;
+    }
+
+    return stm32g4_gpio_port_from_pin(pin);
+}
+
+/* ========================================================================== */
+/*                             GPIO介面實現                                   */
+/* ========================================================================== */
+
+hal_status_t hal_gpio_init(const hal_gpio_config_t* config)
+{
+    stm32g4_gpio_batch_t batch = { 0 };
+    GPIO_TypeDef* gpio_port;
+
+    if (config == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    gpio_port = stm32_gpio_port_checked(config->pin);
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 使能GPIO埠時鐘 (GPIOAEN-GPIOGEN為連續位元)
+    SET_BIT(RCC->AHB2ENR, RCC_AHB2ENR_GPIOAEN << (((uint32_t)config->pin >> 8) & 0xFFU));
+    (void)READ_REG(RCC->AHB2ENR);
+
+    stm32g4_gpio_batch_add(&batch, config);
+    stm32g4_gpio_batch_apply(gpio_port, &batch);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_gpio_deinit(hal_gpio_pin_t pin)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+    uint32_t pin_number;
+    uint32_t field;
+
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    pin_number = (uint32_t)pin & 0xFFU;
+    field = 3UL << (pin_number * 2U);
+
+    // 回到重設狀態: 類比模式、無上下拉、低速、推挽、AF0
+    SET_BIT(gpio_port->MODER, field);
+    CLEAR_BIT(gpio_port->PUPDR, field);
+    CLEAR_BIT(gpio_port->OSPEEDR, field);
+    CLEAR_BIT(gpio_port->OTYPER, 1UL << pin_number);
+    CLEAR_BIT(gpio_port->AFR[pin_number >> 3], 0xFUL << ((pin_number & 7U) * 4U));
+
+    return HAL_OK;
+}
+
+hal_status_t hal_gpio_write(hal_gpio_pin_t pin, hal_gpio_state_t state)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+    uint32_t mask;
+
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    mask = 1UL << ((uint32_t)pin & 0xFFU);
+
+    // BSRR低16位設定、高16位清除
+    WRITE_REG(gpio_port->BSRR, (state == HAL_GPIO_HIGH) ? mask : (mask << 16));
+
+    return HAL_OK;
+}
+
+hal_gpio_state_t hal_gpio_read(hal_gpio_pin_t pin)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+
+    if (gpio_port == NULL) {
+        return HAL_GPIO_LOW;
+    }
+
+    return ((READ_REG(gpio_port->IDR) & (1UL << ((uint32_t)pin & 0xFFU))) != 0U) ? HAL_GPIO_HIGH
+                                                                                  : HAL_GPIO_LOW;
+}
+
+hal_status_t hal_gpio_toggle(hal_gpio_pin_t pin)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+    uint32_t mask;
+    uint32_t odr;
+
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    mask = 1UL << ((uint32_t)pin & 0xFFU);
+    odr = READ_REG(gpio_port->ODR);
+
+    // 由ODR決定設定或清除，經BSRR寫入，不會覆寫中斷中修改的其他引腳
+    WRITE_REG(gpio_port->BSRR, ((odr & mask) << 16) | (~odr & mask));
+
+    return HAL_OK;
+}
+
+hal_status_t hal_gpio_set_mode(hal_gpio_pin_t pin, hal_gpio_mode_t mode)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+    uint32_t shift;
+
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 只修改MODER，上下拉、速度與輸出類型保持不變
+    shift = ((uint32_t)pin & 0xFFU) * 2U;
+    MODIFY_REG(gpio_port->MODER, 3UL << shift, stm32g4_gpio_moder_value(mode) << shift);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull)
+{
+    GPIO_TypeDef* gpio_port = stm32_gpio_port_checked(pin);
+    uint32_t shift;
+
+    if (gpio_port == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 只修改PUPDR，模式保持不變
+    shift = ((uint32_t)pin & 0xFFU) * 2U;
+    MODIFY_REG(gpio_port->PUPDR, 3UL << shift, stm32g4_gpio_pupdr_value(pull) << shift);
+
+    return HAL_OK;
+}
+
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    GPIO_TypeDef* gpio_port = stm32g4_gpio_port_from_pin((hal_gpio_pin_t)(port << 8));
+
+    if (gpio_port == NULL) {
+        return 0;
+    }
+
+    return READ_REG(gpio_port->IDR) & 0xFFFFU;
+}
+
+#endif /* PLATFORM_STM32 */
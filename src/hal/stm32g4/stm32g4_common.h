@@ -38,6 +38,19 @@ extern "C" {
     #include "stm32g4xx_ll_utils.h"
 #endif
 
+/* ========================================================================== */
+/*                             驅動後端選擇                                   */
+/* ========================================================================== */
+
+/**
+ * @brief GPIO驅動後端 (由makefiles/stm32g4.mk的STM32G4_USE_LL選擇)
+ * 0 = STM32 HAL (HAL_GPIO_Init等)
+ * 1 = LL/直接暫存器存取 (stm32g4/ll/)
+ */
+#ifndef STM32G4_USE_LL
+    #define STM32G4_USE_LL              1
+#endif
+
 /* ========================================================================== */
 /*                             系統時鐘定義                                    */
 /* ========================================================================== */
@@ -64,6 +77,79 @@ extern "C" {
 #define STM32_GPIOF             ((GPIO_TypeDef*)GPIOF_BASE)
 #define STM32_GPIOG             ((GPIO_TypeDef*)GPIOG_BASE)
 
+#define STM32G4_GPIO_PORT_COUNT 7U      // GPIOA-GPIOG
+
+/**
+ * @brief 由引腳編號取得GPIO埠 (高8位為埠號，低8位為引腳號)
+ * @return GPIO埠指標，無效埠返回NULL
+ */
+static inline GPIO_TypeDef* stm32g4_gpio_port_from_pin(hal_gpio_pin_t pin)
+{
+    static GPIO_TypeDef* const gpio_ports[STM32G4_GPIO_PORT_COUNT] = {
+        GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOF, GPIOG
+    };
+    uint32_t index = ((uint32_t)pin >> 8) & 0xFFU;
+
+    return (index < STM32G4_GPIO_PORT_COUNT) ? gpio_ports[index] : NULL;
+}
+
+/** HAL GPIO模式對應的MODER欄位值 */
+static inline uint32_t stm32g4_gpio_moder_value(hal_gpio_mode_t mode)
+{
+    switch (mode) {
+        case HAL_GPIO_MODE_OUTPUT:
+            return 1U;
+        case HAL_GPIO_MODE_ALTERNATE:
+            return 2U;
+        case HAL_GPIO_MODE_ANALOG:
+            return 3U;
+        case HAL_GPIO_MODE_INPUT:
+        default:
+            return 0U;
+    }
+}
+
+/** HAL上拉/下拉配置對應的PUPDR欄位值 */
+static inline uint32_t stm32g4_gpio_pupdr_value(hal_gpio_pull_t pull)
+{
+    switch (pull) {
+        case HAL_GPIO_PULLUP:
+            return 1U;
+        case HAL_GPIO_PULLDOWN:
+            return 2U;
+        case HAL_GPIO_NOPULL:
+        default:
+            return 0U;
+    }
+}
+
+/* ========================================================================== */
+/*                             GPIO批次配置                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 一個埠累積的暫存器欄位
+ * hal_gpio_init_table()與LL版hal_gpio_init()共用 (stm32g4_gpio_table.c)
+ */
+typedef struct {
+    uint32_t pins;          // 配置到的引腳
+    uint32_t field_mask;    // 2位元欄位遮罩 (MODER/PUPDR/OSPEEDR)
+    uint32_t moder;
+    uint32_t pupdr;
+    uint32_t bsrr;          // 輸出初始狀態
+} stm32g4_gpio_batch_t;
+
+/**
+ * @brief 將一個引腳的配置累積到所在埠的批次
+ * 同一引腳重複加入時以最後一次為準
+ */
+void stm32g4_gpio_batch_add(stm32g4_gpio_batch_t* batch, const hal_gpio_config_t* config);
+
+/**
+ * @brief 將一個埠的累積欄位寫入暫存器，每個暫存器只讀改寫一次
+ */
+void stm32g4_gpio_batch_apply(GPIO_TypeDef* gpio_port, const stm32g4_gpio_batch_t* batch);
+
 /* ========================================================================== */
 /*                             週邊介面定義                                    */
 /* ========================================================================== */
@@ -94,6 +180,40 @@ extern "C" {
 #define STM32_ADC4              ADC4
 #define STM32_ADC5              ADC5
 
+/* ========================================================================== */
+/*                             UART配置                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 每個UART的軟體接收環形緩衝區大小 (必須為2的冪次)
+ */
+#ifndef STM32G4_UART_RX_BUFFER_SIZE
+    #define STM32G4_UART_RX_BUFFER_SIZE     128U
+#endif
+
+/**
+ * @brief 接收超時 (位元時間)
+ * 線路閒置超過此時間時由RTOF中斷取出FIFO中剩餘的資料
+ */
+#ifndef STM32G4_UART_RX_TIMEOUT_BITS
+    #define STM32G4_UART_RX_TIMEOUT_BITS    20U
+#endif
+
+/**
+ * @brief UART中斷優先權
+ */
+#ifndef STM32G4_UART_IRQ_PRIORITY
+    #define STM32G4_UART_IRQ_PRIORITY       5U
+#endif
+
+/**
+ * @brief 分析器取樣中斷 (TIM7) 優先權
+ * 預設為最高優先權，其他中斷服務程式中的時間也能被取樣
+ */
+#ifndef STM32G4_PROFILER_IRQ_PRIORITY
+    #define STM32G4_PROFILER_IRQ_PRIORITY   0U
+#endif
+
 /* ========================================================================== */
 /*                             工具巨集                                        */
 /* ========================================================================== */
@@ -0,0 +1,113 @@
+/**
+ * @file stm32g4_crc.c
+ * @brief STM32G4系列CRC週邊實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * CRC週邊支援7/8/16/32位元可程式多項式。週邊只有一個，
+ * 每段計算前重新載入多項式與目前暫存器值，不同hal_crc_t可交錯使用。
+ */
+
+#include "../include/hal_crc.h"
+#include "../include/hal_port.h"
+#include "stm32g4_common.h"
+
+#if defined(PLATFORM_STM32) && HAL_CRC_USE_HW
+
+#include "stm32g4xx_ll_bus.h"
+#include "stm32g4xx_ll_crc.h"
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 關閉中斷的最長計算段落 (位元組)
+#define STM32_CRC_CHUNK_SIZE    256U
+
+static bool crc_clock_enabled = false;
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static uint32_t stm32_crc_reflect(uint32_t value, uint8_t width)
+{
+    // RBIT反轉32位元，再移到寬度範圍內
+    return __RBIT(value) >> (32U - width);
+}
+
+static uint32_t stm32_crc_poly_length(uint8_t width)
+{
+    switch (width) {
+        case 7U:
+            return LL_CRC_POLYLENGTH_7B;
+        case 8U:
+            return LL_CRC_POLYLENGTH_8B;
+        case 16U:
+            return LL_CRC_POLYLENGTH_16B;
+        case 32U:
+        default:
+            return LL_CRC_POLYLENGTH_32B;
+    }
+}
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+bool hal_crc_port_supported(const hal_crc_config_t* config)
+{
+    // 偶數多項式無法作為生成多項式
+    return (config->width == 7U || config->width == 8U ||
+            config->width == 16U || config->width == 32U) &&
+           ((config->poly & 1UL) != 0);
+}
+
+uint32_t hal_crc_port_update(const hal_crc_config_t* config, uint32_t reg,
+                             const uint8_t* data, uint32_t len)
+{
+    uint32_t mask = 0xFFFFFFFFUL >> (32U - config->width);
+
+    if (!crc_clock_enabled) {
+        LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_CRC);
+        crc_clock_enabled = true;
+    }
+
+    while (len > 0) {
+        uint32_t chunk = (len > STM32_CRC_CHUNK_SIZE) ? STM32_CRC_CHUNK_SIZE : len;
+        uint32_t i = 0;
+        hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+
+        // 硬體暫存器固定為一般表示法，反射演算法以輸入位元組反轉計算
+        LL_CRC_SetPolynomialSize(CRC, stm32_crc_poly_length(config->width));
+        LL_CRC_SetPolynomialCoef(CRC, config->poly);
+        LL_CRC_SetInputDataReverseMode(CRC, config->reflect_in ? LL_CRC_INDATA_REVERSE_BYTE
+                                                               : LL_CRC_INDATA_REVERSE_NONE);
+        LL_CRC_SetOutputDataReverseMode(CRC, LL_CRC_OUTDATA_REVERSE_NONE);
+        LL_CRC_SetInitialData(CRC, config->reflect_in ? stm32_crc_reflect(reg, config->width) : reg);
+        LL_CRC_ResetCRCCalculationUnit(CRC);
+
+        // 32位元寫入先處理最高位元組
+        for (; i + 4U <= chunk; i += 4U) {
+            LL_CRC_FeedData32(CRC, ((uint32_t)data[i] << 24) | ((uint32_t)data[i + 1U] << 16) |
+                                   ((uint32_t)data[i + 2U] << 8) | (uint32_t)data[i + 3U]);
+        }
+        for (; i < chunk; i++) {
+            LL_CRC_FeedData8(CRC, data[i]);
+        }
+
+        reg = LL_CRC_ReadData32(CRC) & mask;
+        if (config->reflect_in) {
+            reg = stm32_crc_reflect(reg, config->width);
+        }
+
+        HAL_PORT_IRQ_RESTORE(irq_state);
+
+        data += chunk;
+        len -= chunk;
+    }
+
+    return reg;
+}
+
+#endif /* PLATFORM_STM32 && HAL_CRC_USE_HW */
@@ -168,6 +168,16 @@ hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull)
     return HAL_OK;
 }
 
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    GPIO_TypeDef* gpio_port = stm32_get_gpio_port_from_pin((hal_gpio_pin_t)(port << 8));
+    if (gpio_port == NULL) {
+        return 0;
+    }
+    
+    return gpio_port->IDR & 0xFFFFU;
+}
+
 /* ========================================================================== */
 /*                             內部函式實現                                    */
 /* ========================================================================== */
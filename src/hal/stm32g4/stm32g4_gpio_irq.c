@@ -0,0 +1,150 @@
+/**
+ * @file stm32g4_gpio_irq.c
+ * @brief STM32G4系列GPIO邊沿中斷實現 (EXTI)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * EXTI線n只能連接各埠的第n腳，由SYSCFG_EXTICR選擇來源埠。
+ * HAL與LL兩種GPIO後端共用此檔案。
+ */
+
+#include "../include/hal_gpio.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             內部函式聲明                                    */
+/* ========================================================================== */
+
+static IRQn_Type stm32_get_exti_irqn(uint16_t line);
+static uint32_t stm32_get_exti_group_mask(uint16_t line);
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+// 各EXTI線目前連接的埠，用於讀取雙沿觸發時的電位
+static GPIO_TypeDef* exti_ports[HAL_GPIO_IRQ_MAX_LINES];
+
+/* ========================================================================== */
+/*                             平台移植介面實現 (EXTI)                        */
+/* ========================================================================== */
+
+uint16_t hal_gpio_port_irq_lines(hal_gpio_pin_t pin)
+{
+    uint32_t pin_number = (uint32_t)pin & 0xFFU;
+
+    // EXTI線n只能連接各埠的第n腳
+    if (stm32g4_gpio_port_from_pin(pin) == NULL || pin_number > 15U) {
+        return 0;
+    }
+
+    return (uint16_t)(1U << pin_number);
+}
+
+hal_status_t hal_gpio_port_irq_enable(uint16_t line, hal_gpio_pin_t pin, hal_gpio_edge_t edge)
+{
+    uint32_t port_index = ((uint32_t)pin >> 8) & 0xFFU;
+    uint32_t shift = (line & 0x3U) * 4U;
+    uint32_t mask = 1UL << line;
+
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+
+    exti_ports[line] = stm32g4_gpio_port_from_pin(pin);
+
+    // 選擇EXTI線來源埠
+    MODIFY_REG(SYSCFG->EXTICR[line >> 2], 0xFUL << shift, port_index << shift);
+
+    if ((edge & HAL_GPIO_EDGE_RISING) != 0) {
+        SET_BIT(EXTI->RTSR1, mask);
+    } else {
+        CLEAR_BIT(EXTI->RTSR1, mask);
+    }
+    if ((edge & HAL_GPIO_EDGE_FALLING) != 0) {
+        SET_BIT(EXTI->FTSR1, mask);
+    } else {
+        CLEAR_BIT(EXTI->FTSR1, mask);
+    }
+
+    // 清除舊的擱置旗標後再開啟遮罩
+    WRITE_REG(EXTI->PR1, mask);
+    SET_BIT(EXTI->IMR1, mask);
+
+    NVIC_EnableIRQ(stm32_get_exti_irqn(line));
+
+    return HAL_OK;
+}
+
+void hal_gpio_port_irq_disable(uint16_t line)
+{
+    uint32_t mask = 1UL << line;
+
+    CLEAR_BIT(EXTI->IMR1, mask);
+    CLEAR_BIT(EXTI->RTSR1, mask);
+    CLEAR_BIT(EXTI->FTSR1, mask);
+    WRITE_REG(EXTI->PR1, mask);
+
+    // EXTI9_5與EXTI15_10共用中斷向量，群組內全部禁用後才關閉NVIC
+    if ((READ_REG(EXTI->IMR1) & stm32_get_exti_group_mask(line)) == 0U) {
+        NVIC_DisableIRQ(stm32_get_exti_irqn(line));
+    }
+}
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 處理一組EXTI線的擱置中斷
+ */
+static void stm32_exti_handle(uint32_t group_mask)
+{
+    uint32_t pending = READ_REG(EXTI->PR1) & READ_REG(EXTI->IMR1) & group_mask;
+
+    while (pending != 0U) {
+        uint16_t line = (uint16_t)__CLZ(__RBIT(pending));
+        hal_gpio_state_t level;
+
+        WRITE_REG(EXTI->PR1, 1UL << line);
+        level = ((exti_ports[line]->IDR & (1UL << line)) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW;
+        hal_gpio_irq_dispatch(line, level);
+
+        pending &= pending - 1U;
+    }
+}
+
+// 使用hal_gpio中斷時，應用程式不可再定義這些EXTI向量
+void EXTI0_IRQHandler(void)     { stm32_exti_handle(0x0001UL); }
+void EXTI1_IRQHandler(void)     { stm32_exti_handle(0x0002UL); }
+void EXTI2_IRQHandler(void)     { stm32_exti_handle(0x0004UL); }
+void EXTI3_IRQHandler(void)     { stm32_exti_handle(0x0008UL); }
+void EXTI4_IRQHandler(void)     { stm32_exti_handle(0x0010UL); }
+void EXTI9_5_IRQHandler(void)   { stm32_exti_handle(0x03E0UL); }
+void EXTI15_10_IRQHandler(void) { stm32_exti_handle(0xFC00UL); }
+
+/* ========================================================================== */
+/*                             內部函式實現                                    */
+/* ========================================================================== */
+
+static IRQn_Type stm32_get_exti_irqn(uint16_t line)
+{
+    switch (line) {
+        case 0: return EXTI0_IRQn;
+        case 1: return EXTI1_IRQn;
+        case 2: return EXTI2_IRQn;
+        case 3: return EXTI3_IRQn;
+        case 4: return EXTI4_IRQn;
+        default: return (line < 10U) ? EXTI9_5_IRQn : EXTI15_10_IRQn;
+    }
+}
+
+static uint32_t stm32_get_exti_group_mask(uint16_t line)
+{
+    if (line < 5U) {
+        return 1UL << line;
+    }
+    return (line < 10U) ? 0x03E0UL : 0xFC00UL;
+}
+
+#endif /* PLATFORM_STM32 */
@@ -0,0 +1,103 @@
+/**
+ * @file stm32g4_gpio_table.c
+ * @brief STM32G4系列GPIO批次配置 (HAL與LL後端共用)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 依埠累積整個配置表後，所有用到的埠時鐘以一次AHB2ENR寫入使能，
+ * 每個埠的MODER/PUPDR/OSPEEDR/OTYPER只讀改寫一次。
+ */
+
+#include "../include/hal_gpio.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define STM32_GPIO_PIN_COUNT    16U
+
+// OSPEEDR高速 (與HAL後端的GPIO_SPEED_FREQ_HIGH相同)
+#define STM32_GPIO_SPEED_HIGH   0xAAAAAAAAUL
+
+/* ========================================================================== */
+/*                             批次配置實現                                    */
+/* ========================================================================== */
+
+void stm32g4_gpio_batch_add(stm32g4_gpio_batch_t* batch, const hal_gpio_config_t* config)
+{
+    uint32_t pin_number = (uint32_t)config->pin & 0xFFU;
+    uint32_t shift = pin_number * 2U;
+    uint32_t field = 3UL << shift;
+
+    // 先清除此引腳先前累積的欄位，配置表中重複的引腳以最後一項為準
+    batch->moder &= ~field;
+    batch->pupdr &= ~field;
+    batch->bsrr &= ~((1UL << pin_number) | (1UL << (pin_number + 16U)));
+
+    batch->pins |= (1UL << pin_number);
+    batch->field_mask |= field;
+    batch->moder |= stm32g4_gpio_moder_value(config->mode) << shift;
+    batch->pupdr |= stm32g4_gpio_pupdr_value(config->pull) << shift;
+
+    if (config->mode == HAL_GPIO_MODE_OUTPUT) {
+        batch->bsrr |= (config->initial_state == HAL_GPIO_HIGH) ? (1UL << pin_number)
+                                                                : (1UL << (pin_number + 16U));
+    }
+}
+
+void stm32g4_gpio_batch_apply(GPIO_TypeDef* gpio_port, const stm32g4_gpio_batch_t* batch)
+{
+    // 先寫入輸出值，MODER切換為輸出時即為初始狀態
+    WRITE_REG(gpio_port->BSRR, batch->bsrr);
+    MODIFY_REG(gpio_port->OSPEEDR, batch->field_mask, STM32_GPIO_SPEED_HIGH & batch->field_mask);
+    CLEAR_BIT(gpio_port->OTYPER, batch->pins);
+    MODIFY_REG(gpio_port->PUPDR, batch->field_mask, batch->pupdr);
+    MODIFY_REG(gpio_port->MODER, batch->field_mask, batch->moder);
+}
+
+/* ========================================================================== */
+/*                             GPIO介面實現                                   */
+/* ========================================================================== */
+
+hal_status_t hal_gpio_init_table(const hal_gpio_config_t* configs, uint16_t count)
+{
+    stm32g4_gpio_batch_t batch[STM32G4_GPIO_PORT_COUNT] = { 0 };
+    uint32_t clock_enable = 0;
+    uint16_t i;
+
+    if (configs == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 1. 檢查所有引腳並依埠累積暫存器欄位
+    for (i = 0; i < count; i++) {
+        uint32_t port_index = ((uint32_t)configs[i].pin >> 8) & 0xFFU;
+
+        if (port_index >= STM32G4_GPIO_PORT_COUNT ||
+            ((uint32_t)configs[i].pin & 0xFFU) >= STM32_GPIO_PIN_COUNT) {
+            return HAL_INVALID_PARAM;
+        }
+
+        stm32g4_gpio_batch_add(&batch[port_index], &configs[i]);
+        clock_enable |= (RCC_AHB2ENR_GPIOAEN << port_index);
+    }
+
+    // 2. 一次使能所有用到的埠時鐘 (GPIOAEN-GPIOGEN為連續位元)
+    SET_BIT(RCC->AHB2ENR, clock_enable);
+    (void)READ_REG(RCC->AHB2ENR);
+
+    // 3. 依埠寫入暫存器
+    for (i = 0; i < STM32G4_GPIO_PORT_COUNT; i++) {
+        if (batch[i].pins != 0U) {
+            stm32g4_gpio_batch_apply(stm32g4_gpio_port_from_pin((hal_gpio_pin_t)(i << 8)),
+                                     &batch[i]);
+        }
+    }
+
+    return HAL_OK;
+}
+
+#endif /* PLATFORM_STM32 */
@@ -0,0 +1,168 @@
+/**
+ * @file stm32g4_irq.c
+ * @brief STM32G4系列可巢狀優先權中斷分派實現 (NVIC)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * NVIC依優先權自動巢狀，這裡只需把處理函式放進向量表並設定優先權。
+ * 第一次登記時將向量表複製到RAM並切換VTOR，處理函式直接寫入RAM向量表，
+ * 進入中斷不經過額外的分派程式。未登記的向量保留原本連結的處理函式。
+ */
+
+#include "../include/hal_irq.h"
+#include "../include/hal_port.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 16個系統例外 + 外部中斷 (STM32G474為102個)，向量表需對齊到大於其大小的2的冪次
+#define STM32_IRQ_VECTOR_COUNT      128U
+#define STM32_IRQ_EXTERNAL_COUNT    (STM32_IRQ_VECTOR_COUNT - 16U)
+
+// 4位元優先權全部作為搶占優先權 (與HAL_Init的NVIC_PRIORITYGROUP_4相同)
+#define STM32_IRQ_PRIGROUP          3U
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static uint32_t irq_ram_vectors[STM32_IRQ_VECTOR_COUNT] __ALIGNED(512);
+static const uint32_t* irq_flash_vectors = NULL;
+static uint16_t irq_registered_count = 0;
+static uint8_t irq_registered[STM32_IRQ_EXTERNAL_COUNT];
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 將向量表複製到RAM並切換VTOR
+ */
+static void stm32_irq_init(void)
+{
+    uint32_t i;
+
+    irq_flash_vectors = (const uint32_t*)SCB->VTOR;
+    for (i = 0; i < STM32_IRQ_VECTOR_COUNT; i++) {
+        irq_ram_vectors[i] = irq_flash_vectors[i];
+    }
+
+    NVIC_SetPriorityGrouping(STM32_IRQ_PRIGROUP);
+
+    // 切換前確保向量表寫入完成
+    __DSB();
+    SCB->VTOR = (uint32_t)irq_ram_vectors;
+    __DSB();
+    __ISB();
+}
+
+/* ========================================================================== */
+/*                             中斷分派介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_irq_register(uint32_t vector, hal_irq_handler_t handler, uint16_t priority)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (handler == NULL || priority >= HAL_IRQ_PRIORITY_LEVELS ||
+        vector >= STM32_IRQ_EXTERNAL_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (irq_flash_vectors == NULL) {
+        stm32_irq_init();
+    }
+
+    if (irq_registered[vector] == 0U) {
+        if (irq_registered_count >= HAL_IRQ_MAX_HANDLERS) {
+            HAL_PORT_IRQ_RESTORE(irq_state);
+            return HAL_BUSY;
+        }
+
+        irq_registered[vector] = 1U;
+        irq_registered_count++;
+    }
+
+    irq_ram_vectors[16U + vector] = (uint32_t)handler;
+    __DSB();
+
+    NVIC_SetPriority((IRQn_Type)vector, priority);
+    NVIC_EnableIRQ((IRQn_Type)vector);
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_unregister(uint32_t vector)
+{
+    hal_port_irq_state_t irq_state;
+
+    if (vector >= STM32_IRQ_EXTERNAL_COUNT || irq_registered[vector] == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    NVIC_DisableIRQ((IRQn_Type)vector);
+    NVIC_ClearPendingIRQ((IRQn_Type)vector);
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+    irq_ram_vectors[16U + vector] = irq_flash_vectors[16U + vector];
+    irq_registered[vector] = 0U;
+    irq_registered_count--;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_enable(uint32_t vector)
+{
+    if (vector >= STM32_IRQ_EXTERNAL_COUNT || irq_registered[vector] == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    NVIC_EnableIRQ((IRQn_Type)vector);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_disable(uint32_t vector)
+{
+    if (vector >= STM32_IRQ_EXTERNAL_COUNT || irq_registered[vector] == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    NVIC_DisableIRQ((IRQn_Type)vector);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_trigger(uint32_t vector)
+{
+    if (vector >= STM32_IRQ_EXTERNAL_COUNT || irq_registered[vector] == 0U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    NVIC_SetPendingIRQ((IRQn_Type)vector);
+
+    return HAL_OK;
+}
+
+uint16_t hal_irq_current_priority(void)
+{
+    uint32_t ipsr = __get_IPSR();
+
+    // IPSR為目前例外編號，外部中斷從16開始
+    if (ipsr < 16U || ipsr >= STM32_IRQ_VECTOR_COUNT || irq_registered[ipsr - 16U] == 0U) {
+        return HAL_IRQ_PRIORITY_LEVELS;
+    }
+
+    return (uint16_t)NVIC_GetPriority((IRQn_Type)(ipsr - 16U));
+}
+
+#endif /* PLATFORM_STM32 */
@@ -0,0 +1,95 @@
+/**
+ * @file stm32g4_profiler.c
+ * @brief STM32G4系列分析器取樣計時器實現 (TIM7)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * TIM7更新中斷以STM32G4_PROFILER_IRQ_PRIORITY執行，由例外堆疊框取出被中斷的PC。
+ * STM32G474的TIM7與DAC欠載共用向量，啟用分析器時不可使用DAC欠載中斷。
+ */
+
+#include "../include/hal_profiler.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 取樣中斷主體
+ * @param frame 例外堆疊框 (R0-R3, R12, LR, PC, xPSR)，FPU延伸框不影響PC的位置
+ */
+static void __attribute__((used, noinline)) stm32_profiler_isr(const uint32_t* frame)
+{
+    WRITE_REG(TIM7->SR, ~TIM_SR_UIF);
+    hal_profiler_sample(frame[6]);
+}
+
+/**
+ * @brief TIM7中斷入口
+ * 依EXC_RETURN bit2選擇被中斷程式使用的堆疊 (MSP/PSP)，
+ * 以尾端跳躍進入主體，LR保持為EXC_RETURN
+ */
+__attribute__((naked)) void TIM7_DAC_IRQHandler(void)
+{
+    __asm volatile(
+        "tst    lr, #4                  \n"
+        "ite    eq                      \n"
+        "mrseq  r0, msp                 \n"
+        "mrsne  r0, psp                 \n"
+        "b      stm32_profiler_isr      \n");
+}
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_profiler_port_start(uint32_t sample_hz)
+{
+    // APB1不分頻 (stm32g4_system.c)，TIM7時鐘即為SystemCoreClock
+    uint32_t ticks = SystemCoreClock / sample_hz;
+    uint32_t prescaler;
+
+    if (ticks < 2U) {
+        return HAL_ERROR;
+    }
+
+    prescaler = (ticks - 1U) >> 16;
+
+    SET_BIT(RCC->APB1ENR1, RCC_APB1ENR1_TIM7EN);
+    (void)READ_REG(RCC->APB1ENR1);
+
+    CLEAR_BIT(TIM7->CR1, TIM_CR1_CEN);
+    WRITE_REG(TIM7->PSC, prescaler);
+    WRITE_REG(TIM7->ARR, (ticks / (prescaler + 1U)) - 1U);
+
+    // 以UG載入預除頻器，並清除UG產生的更新旗標
+    WRITE_REG(TIM7->EGR, TIM_EGR_UG);
+    WRITE_REG(TIM7->SR, 0U);
+    WRITE_REG(TIM7->DIER, TIM_DIER_UIE);
+
+    NVIC_SetPriority(TIM7_DAC_IRQn, STM32G4_PROFILER_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TIM7_DAC_IRQn);
+
+    SET_BIT(TIM7->CR1, TIM_CR1_CEN);
+
+    return HAL_OK;
+}
+
+void hal_profiler_port_stop(void)
+{
+    // 時鐘未開啟時TIM7暫存器不可寫入
+    if (READ_BIT(RCC->APB1ENR1, RCC_APB1ENR1_TIM7EN) == 0U) {
+        return;
+    }
+
+    CLEAR_BIT(TIM7->CR1, TIM_CR1_CEN);
+    WRITE_REG(TIM7->DIER, 0U);
+    NVIC_DisableIRQ(TIM7_DAC_IRQn);
+    WRITE_REG(TIM7->SR, 0U);
+    NVIC_ClearPendingIRQ(TIM7_DAC_IRQn);
+}
+
+#endif /* PLATFORM_STM32 */
@@ -18,6 +18,9 @@ hal_status_t hal_init(void)
 {
     HAL_StatusTypeDef status;
     
+    // 填色堆疊以量測使用量 (SysTick尚未啟動)
+    hal_stack_paint();
+    
     // 初始化HAL函式庫
     status = HAL_Init();
     if (status != HAL_OK) {
@@ -77,11 +80,32 @@ uint32_t hal_get_tick(void)
     return HAL_GetTick();
 }
 
+uint32_t hal_get_cycle_count(void)
+{
+    return DWT->CYCCNT;
+}
+
 void hal_system_reset(void)
 {
     HAL_NVIC_SystemReset();
 }
 
+/**
+ * @brief 覆寫STM32 HAL的弱定義HAL_IncTick，由SysTick中斷呼叫
+ */
+void HAL_IncTick(void)
+{
+    uwTick += (uint32_t)uwTickFreq;
+    
+    // 驅動軟體計時器服務
+    hal_timer_tick();
+    
+#if HAL_STACK_TICK_CHECK
+    // 檢查堆疊溢位哨兵
+    (void)hal_stack_check();
+#endif
+}
+
 /* ========================================================================== */
 /*                             STM32G4特定函式實現                            */
 /* ========================================================================== */
@@ -129,7 +153,7 @@ hal_status_t stm32g4_init_system_clock(void)
 
 hal_status_t stm32g4_init_peripheral_clocks(void)
 {
-    // 使能DWT (用於微秒延時)
+    // 使能DWT (用於微秒延時與週期計數)
     CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
     DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
     DWT->CYCCNT = 0;
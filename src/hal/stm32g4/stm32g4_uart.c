@@ -0,0 +1,771 @@
+/**
+ * @file stm32g4_uart.c
+ * @brief STM32G4系列UART硬體抽象層實現 (LL暫存器存取，FIFO模式)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 發送以TXFNF旗標直接填入8級發送FIFO (輪詢，不使用發送FIFO中斷)。
+ * 接收使用FIFO閾值中斷(RXFT)與接收超時中斷(RTOF)：每累積半個FIFO或線路閒置時
+ * 才進入一次中斷，將資料搬到軟體環形緩衝區，可變長度封包不需要逐位元組中斷。
+ * 訊框接收時資料直接寫入呼叫者的緩衝區，並以RTOF/字元比對(CMF)結束訊框。
+ */
+
+#include "../include/hal_uart.h"
+#include "../include/hal.h"
+#include "stm32g4_common.h"
+
+#ifdef PLATFORM_STM32
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define STM32_UART_RX_MASK      (STM32G4_UART_RX_BUFFER_SIZE - 1U)
+
+#if (STM32G4_UART_RX_BUFFER_SIZE & STM32_UART_RX_MASK) != 0
+    #error "STM32G4_UART_RX_BUFFER_SIZE must be a power of two"
+#endif
+
+/** UART引腳與時鐘描述 */
+typedef struct {
+    USART_TypeDef* instance;
+    IRQn_Type irqn;
+    GPIO_TypeDef* tx_port;
+    uint32_t tx_pin;
+    GPIO_TypeDef* rx_port;
+    uint32_t rx_pin;
+    uint32_t alternate;
+} stm32_uart_desc_t;
+
+/** UART執行狀態 */
+typedef struct {
+    uint8_t rx_buffer[STM32G4_UART_RX_BUFFER_SIZE];
+    volatile uint16_t rx_head;      /**< 中斷寫入位置 */
+    volatile uint16_t rx_tail;      /**< 讀取位置 */
+    hal_uart_baud_result_t baud;
+    hal_stats_t stats;              /**< 效能與錯誤統計 (環形緩衝區溢位計入overruns) */
+    uint8_t* frame_buffer;          /**< 訊框接收緩衝區 */
+    uint16_t* frame_length;         /**< 訊框長度輸出 */
+    hal_callback_t frame_callback;  /**< 訊框結束回呼 */
+    void* frame_context;            /**< 回呼函式參數 */
+    uint16_t frame_max;             /**< 訊框緩衝區大小 */
+    uint16_t frame_count;           /**< 已接收長度 */
+    int16_t frame_match;            /**< 訊框結束字元 */
+    volatile bool frame_armed;      /**< 有等待中的訊框 */
+} stm32_uart_state_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static const stm32_uart_desc_t uart_descs[] = {
+    { USART1, USART1_IRQn, GPIOA, LL_GPIO_PIN_9,  GPIOA, LL_GPIO_PIN_10, LL_GPIO_AF_7 },
+    { USART2, USART2_IRQn, GPIOA, LL_GPIO_PIN_2,  GPIOA, LL_GPIO_PIN_3,  LL_GPIO_AF_7 },
+    { USART3, USART3_IRQn, GPIOB, LL_GPIO_PIN_10, GPIOB, LL_GPIO_PIN_11, LL_GPIO_AF_7 },
+#ifdef UART4
+    { UART4,  UART4_IRQn,  GPIOC, LL_GPIO_PIN_10, GPIOC, LL_GPIO_PIN_11, LL_GPIO_AF_5 },
+#endif
+#ifdef UART5
+    { UART5,  UART5_IRQn,  GPIOC, LL_GPIO_PIN_12, GPIOD, LL_GPIO_PIN_2,  LL_GPIO_AF_5 },
+#endif
+};
+
+#define STM32_UART_COUNT    (sizeof(uart_descs) / sizeof(uart_descs[0]))
+
+static stm32_uart_state_t uart_states[STM32_UART_COUNT];
+
+/* ========================================================================== */
+/*                             內部函式聲明                                    */
+/* ========================================================================== */
+
+static int32_t stm32_uart_get_index(hal_uart_id_t uart_id);
+static void stm32_uart_enable_clocks(USART_TypeDef* instance);
+static uint32_t stm32_uart_get_kernel_clock(USART_TypeDef* instance);
+static void stm32_uart_config_gpio(const stm32_uart_desc_t* desc);
+static void stm32_uart_enable(USART_TypeDef* usart);
+static bool stm32_uart_frame_put(stm32_uart_state_t* state, uint8_t data, bool check_match);
+static void stm32_uart_frame_complete(stm32_uart_state_t* state);
+static void stm32_uart_irq_handler(uint32_t index);
+
+/* ========================================================================== */
+/*                             UART介面實現                                   */
+/* ========================================================================== */
+
+hal_status_t hal_uart_init(hal_uart_id_t uart_id, const hal_uart_config_t* config)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (config == NULL || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    const stm32_uart_desc_t* desc = &uart_descs[index];
+    stm32_uart_state_t* state = &uart_states[index];
+    USART_TypeDef* usart = desc->instance;
+
+    // M[1:0]的字長包含奇偶校驗位元，最長9位元: 9個資料位元加校驗無法設定
+    uint32_t frame_bits = (uint32_t)config->databits +
+                          ((config->parity != HAL_UART_PARITY_NONE) ? 1U : 0U);
+    if (frame_bits < 7U || frame_bits > 9U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    stm32_uart_enable_clocks(usart);
+
+    // 搜尋預除頻與取樣倍率的最佳組合
+    hal_uart_baud_result_t baud;
+    if (hal_uart_calc_usart_divisor(stm32_uart_get_kernel_clock(usart),
+                                    config->baudrate, &baud) != HAL_OK) {
+        return HAL_INVALID_PARAM;
+    }
+
+    stm32_uart_config_gpio(desc);
+
+    LL_USART_Disable(usart);
+
+    if (frame_bits == 7U) {
+        LL_USART_SetDataWidth(usart, LL_USART_DATAWIDTH_7B);
+    } else if (frame_bits == 8U) {
+        LL_USART_SetDataWidth(usart, LL_USART_DATAWIDTH_8B);
+    } else {
+        LL_USART_SetDataWidth(usart, LL_USART_DATAWIDTH_9B);
+    }
+
+    switch (config->parity) {
+        case HAL_UART_PARITY_EVEN:
+            LL_USART_SetParity(usart, LL_USART_PARITY_EVEN);
+            break;
+        case HAL_UART_PARITY_ODD:
+            LL_USART_SetParity(usart, LL_USART_PARITY_ODD);
+            break;
+        case HAL_UART_PARITY_NONE:
+        default:
+            LL_USART_SetParity(usart, LL_USART_PARITY_NONE);
+            break;
+    }
+
+    LL_USART_SetStopBitsLength(usart, (config->stopbits == HAL_UART_STOPBITS_2) ?
+                               LL_USART_STOPBITS_2 : LL_USART_STOPBITS_1);
+    LL_USART_SetTransferDirection(usart, LL_USART_DIRECTION_TX_RX);
+    LL_USART_SetHWFlowCtrl(usart, LL_USART_HWCONTROL_NONE);
+    LL_USART_ConfigAsyncMode(usart);
+
+    // 波特率
+    LL_USART_SetPrescaler(usart, baud.prescaler);
+    LL_USART_SetOverSampling(usart, baud.over8 ? LL_USART_OVERSAMPLING_8 :
+                                                 LL_USART_OVERSAMPLING_16);
+    usart->BRR = baud.divisor;
+    state->baud = baud;
+
+    // FIFO模式: 接收半滿時中斷，閒置超時取出剩餘資料
+    LL_USART_EnableFIFO(usart);
+    LL_USART_SetRXFIFOThreshold(usart, LL_USART_FIFOTHRESHOLD_1_2);
+    LL_USART_SetRxTimeout(usart, STM32G4_UART_RX_TIMEOUT_BITS);
+    LL_USART_EnableRxTimeout(usart);
+
+    state->rx_head = 0;
+    state->rx_tail = 0;
+    state->frame_armed = false;
+    state->frame_match = HAL_UART_FRAME_NO_MATCH;
+
+    stm32_uart_enable(usart);
+
+    LL_USART_ClearFlag_RTO(usart);
+    LL_USART_EnableIT_RXFT(usart);
+    LL_USART_EnableIT_RTO(usart);
+    LL_USART_EnableIT_ERROR(usart);
+
+    // EIE只涵蓋FE/NE/ORE，同位錯誤需另外啟用PEIE
+    if (config->parity != HAL_UART_PARITY_NONE) {
+        LL_USART_EnableIT_PE(usart);
+    } else {
+        LL_USART_DisableIT_PE(usart);
+    }
+
+    NVIC_SetPriority(desc->irqn, STM32G4_UART_IRQ_PRIORITY);
+    NVIC_EnableIRQ(desc->irqn);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_deinit(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    const stm32_uart_desc_t* desc = &uart_descs[index];
+
+    NVIC_DisableIRQ(desc->irqn);
+    LL_USART_DisableIT_RXFT(desc->instance);
+    LL_USART_DisableIT_RTO(desc->instance);
+    LL_USART_DisableIT_CM(desc->instance);
+    LL_USART_DisableIT_ERROR(desc->instance);
+    LL_USART_DisableIT_PE(desc->instance);
+    LL_USART_Disable(desc->instance);
+    uart_states[index].frame_armed = false;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data,
+                               uint16_t size, uint32_t timeout)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (data == NULL || size == 0 || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    USART_TypeDef* usart = uart_descs[index].instance;
+    hal_stats_t* stats = &uart_states[index].stats;
+    uint32_t block_start = HAL_STATS_BLOCK_BEGIN();
+    uint32_t start_tick = hal_get_tick();
+    uint16_t sent = 0;
+
+    while (sent < size) {
+        // FIFO未滿時連續寫入，移位暫存器不會出現空檔
+        if (LL_USART_IsActiveFlag_TXE_TXFNF(usart)) {
+            LL_USART_TransmitData8(usart, data[sent]);
+            sent++;
+        } else if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+            HAL_STATS_ADD(stats, tx_bytes, sent);
+            HAL_STATS_INC(stats, timeouts);
+            HAL_STATS_BLOCK_END(stats, block_start);
+            return HAL_TIMEOUT;
+        }
+    }
+
+    HAL_STATS_ADD(stats, tx_bytes, size);
+    HAL_STATS_INC(stats, transfers);
+    HAL_STATS_BLOCK_END(stats, block_start);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_receive(hal_uart_id_t uart_id, uint8_t* data,
+                              uint16_t size, uint32_t timeout)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (data == NULL || size == 0 || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    stm32_uart_state_t* state = &uart_states[index];
+    uint32_t block_start = HAL_STATS_BLOCK_BEGIN();
+    uint32_t start_tick = hal_get_tick();
+    uint16_t received = 0;
+
+    while (received < size) {
+        uint16_t tail = state->rx_tail;
+
+        if (tail != state->rx_head) {
+            data[received] = state->rx_buffer[tail];
+            state->rx_tail = (uint16_t)((tail + 1U) & STM32_UART_RX_MASK);
+            received++;
+        } else if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+            HAL_STATS_INC(&state->stats, timeouts);
+            HAL_STATS_BLOCK_END(&state->stats, block_start);
+            return HAL_TIMEOUT;
+        }
+    }
+
+    HAL_STATS_INC(&state->stats, transfers);
+    HAL_STATS_BLOCK_END(&state->stats, block_start);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_putchar(hal_uart_id_t uart_id, uint8_t ch)
+{
+    return hal_uart_transmit(uart_id, &ch, 1, 1000);
+}
+
+hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeout)
+{
+    return hal_uart_receive(uart_id, ch, 1, timeout);
+}
+
+hal_status_t hal_uart_get_baud_info(hal_uart_id_t uart_id, hal_uart_baud_result_t* result)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (result == NULL || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    *result = uart_states[index].baud;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_autobaud(hal_uart_id_t uart_id, uint32_t timeout, uint32_t* baudrate)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    USART_TypeDef* usart = uart_descs[index].instance;
+    stm32_uart_state_t* state = &uart_states[index];
+    uint32_t start_tick = hal_get_tick();
+    hal_status_t status = HAL_OK;
+
+    // ABREN只能在UE=0時設置，以0x55字元的邊沿量測波特率
+    LL_USART_Disable(usart);
+    LL_USART_SetAutoBaudRateMode(usart, LL_USART_AUTOBAUD_DETECT_ON_55_FRAME);
+    LL_USART_EnableAutoBaudRate(usart);
+    stm32_uart_enable(usart);
+
+    while (!LL_USART_IsActiveFlag_ABR(usart)) {
+        if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+            status = HAL_TIMEOUT;
+            break;
+        }
+    }
+    if (status == HAL_OK && LL_USART_IsActiveFlag_ABRE(usart)) {
+        status = HAL_ERROR;
+    }
+
+    LL_USART_Disable(usart);
+    LL_USART_DisableAutoBaudRate(usart);
+    stm32_uart_enable(usart);
+
+    if (status != HAL_OK) {
+        // 恢復初始化時的波特率
+        usart->BRR = state->baud.divisor;
+        return status;
+    }
+
+    // 由硬體寫入的BRR計算實際波特率
+    state->baud.actual_baudrate = hal_uart_calc_usart_baudrate(stm32_uart_get_kernel_clock(usart),
+                                                               state->baud.prescaler,
+                                                               state->baud.over8, usart->BRR);
+    state->baud.divisor = usart->BRR;
+    state->baud.error_ppm = 0;
+
+    // 捨棄同步字元
+    (void)hal_uart_flush_rx(uart_id);
+
+    if (baudrate != NULL) {
+        *baudrate = state->baud.actual_baudrate;
+    }
+
+    return HAL_OK;
+}
+
+bool hal_uart_is_busy(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return false;
+    }
+
+    // TC在FIFO與移位暫存器皆空時才會設置
+    return !LL_USART_IsActiveFlag_TC(uart_descs[index].instance);
+}
+
+bool hal_uart_data_available(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return false;
+    }
+
+    return (uart_states[index].rx_head != uart_states[index].rx_tail);
+}
+
+hal_status_t hal_uart_flush_rx(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    const stm32_uart_desc_t* desc = &uart_descs[index];
+    stm32_uart_state_t* state = &uart_states[index];
+
+    NVIC_DisableIRQ(desc->irqn);
+    LL_USART_RequestRxDataFlush(desc->instance);
+    state->rx_tail = state->rx_head;
+    NVIC_EnableIRQ(desc->irqn);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_flush_tx(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 等待FIFO與移位暫存器發送完成
+    while (!LL_USART_IsActiveFlag_TC(uart_descs[index].instance)) {
+        // 等待發送完成
+    }
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_config_frame(hal_uart_id_t uart_id, uint16_t idle_bits, int16_t match_char)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0 || match_char > 0xFF || match_char < HAL_UART_FRAME_NO_MATCH) {
+        return HAL_INVALID_PARAM;
+    }
+
+    USART_TypeDef* usart = uart_descs[index].instance;
+    stm32_uart_state_t* state = &uart_states[index];
+
+    if (state->frame_armed) {
+        return HAL_BUSY;
+    }
+
+    LL_USART_SetRxTimeout(usart, (idle_bits != 0U) ? idle_bits : HAL_UART_FRAME_IDLE_BITS);
+
+    // ADD欄位只能在UE=0時寫入。非靜音模式下硬體以整個8位元字元比對ADD[7:0]
+    // (ADDM7只影響靜音模式的位址長度)，直接寫入完整的一個位元組
+    LL_USART_Disable(usart);
+    if (match_char != HAL_UART_FRAME_NO_MATCH) {
+        MODIFY_REG(usart->CR2, USART_CR2_ADD, (uint32_t)match_char << USART_CR2_ADD_Pos);
+        LL_USART_EnableIT_CM(usart);
+    } else {
+        LL_USART_DisableIT_CM(usart);
+    }
+    stm32_uart_enable(usart);
+    state->frame_match = match_char;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_receive_frame(hal_uart_id_t uart_id, uint8_t* buffer, uint16_t max_size,
+                                    uint16_t* length, hal_callback_t callback, void* context)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (buffer == NULL || max_size == 0 || length == NULL || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    const stm32_uart_desc_t* desc = &uart_descs[index];
+    stm32_uart_state_t* state = &uart_states[index];
+    bool completed = false;
+
+    NVIC_DisableIRQ(desc->irqn);
+
+    if (state->frame_armed) {
+        NVIC_EnableIRQ(desc->irqn);
+        return HAL_BUSY;
+    }
+
+    state->frame_buffer = buffer;
+    state->frame_max = max_size;
+    state->frame_length = length;
+    state->frame_callback = callback;
+    state->frame_context = context;
+    state->frame_count = 0;
+    state->frame_armed = true;
+
+    // 已在環形緩衝區中的資料屬於此訊框，這些字元的CMF已在搬移時清除，需以軟體比對
+    while (state->rx_tail != state->rx_head && !completed) {
+        uint16_t tail = state->rx_tail;
+        completed = stm32_uart_frame_put(state, state->rx_buffer[tail], true);
+        state->rx_tail = (uint16_t)((tail + 1U) & STM32_UART_RX_MASK);
+    }
+
+    if (completed) {
+        state->frame_armed = false;
+        *length = state->frame_count;
+    }
+
+    NVIC_EnableIRQ(desc->irqn);
+
+    if (completed && callback != NULL) {
+        callback(context);
+    }
+
+    return HAL_OK;
+}
+
+bool hal_uart_frame_pending(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return false;
+    }
+
+    return uart_states[index].frame_armed;
+}
+
+hal_status_t hal_uart_abort_frame(hal_uart_id_t uart_id)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 與中斷中的訊框結束互斥，返回後不會再寫入訊框緩衝區或呼叫回呼
+    IRQn_Type irqn = uart_descs[index].irqn;
+
+    NVIC_DisableIRQ(irqn);
+    uart_states[index].frame_armed = false;
+    NVIC_EnableIRQ(irqn);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_get_stats(hal_uart_id_t uart_id, hal_stats_t* stats)
+{
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (stats == NULL || index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+#if HAL_STATS_ENABLE
+    IRQn_Type irqn = uart_descs[index].irqn;
+
+    NVIC_DisableIRQ(irqn);
+    *stats = uart_states[index].stats;
+    NVIC_EnableIRQ(irqn);
+
+    return HAL_OK;
+#else
+    return HAL_ERROR;
+#endif
+}
+
+hal_status_t hal_uart_reset_stats(hal_uart_id_t uart_id)
+{
+    static const hal_stats_t zero = { 0 };
+    int32_t index = stm32_uart_get_index(uart_id);
+    if (index < 0) {
+        return HAL_INVALID_PARAM;
+    }
+
+    IRQn_Type irqn = uart_descs[index].irqn;
+
+    NVIC_DisableIRQ(irqn);
+    uart_states[index].stats = zero;
+    NVIC_EnableIRQ(irqn);
+
+    return HAL_OK;
+}
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+void USART1_IRQHandler(void)
+{
+    stm32_uart_irq_handler(0);
+}
+
+void USART2_IRQHandler(void)
+{
+    stm32_uart_irq_handler(1);
+}
+
+void USART3_IRQHandler(void)
+{
+    stm32_uart_irq_handler(2);
+}
+
+#ifdef UART4
+void UART4_IRQHandler(void)
+{
+    stm32_uart_irq_handler(3);
+}
+#endif
+
+#ifdef UART5
+void UART5_IRQHandler(void)
+{
+    stm32_uart_irq_handler(4);
+}
+#endif
+
+/* ========================================================================== */
+/*                             內部函式實現                                    */
+/* ========================================================================== */
+
+static int32_t stm32_uart_get_index(hal_uart_id_t uart_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < STM32_UART_COUNT; i++) {
+        if ((void*)uart_descs[i].instance == uart_id) {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+static void stm32_uart_enable_clocks(USART_TypeDef* instance)
+{
+    if (instance == USART1) {
+        __HAL_RCC_USART1_CLK_ENABLE();
+        __HAL_RCC_GPIOA_CLK_ENABLE();
+    } else if (instance == USART2) {
+        __HAL_RCC_USART2_CLK_ENABLE();
+        __HAL_RCC_GPIOA_CLK_ENABLE();
+    } else if (instance == USART3) {
+        __HAL_RCC_USART3_CLK_ENABLE();
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+#ifdef UART4
+    } else if (instance == UART4) {
+        __HAL_RCC_UART4_CLK_ENABLE();
+        __HAL_RCC_GPIOC_CLK_ENABLE();
+#endif
+#ifdef UART5
+    } else if (instance == UART5) {
+        __HAL_RCC_UART5_CLK_ENABLE();
+        __HAL_RCC_GPIOC_CLK_ENABLE();
+        __HAL_RCC_GPIOD_CLK_ENABLE();
+#endif
+    }
+}
+
+/**
+ * @brief 獲取USART核心時鐘 (假設時鐘源為預設的PCLK)
+ */
+static uint32_t stm32_uart_get_kernel_clock(USART_TypeDef* instance)
+{
+    // USART1在APB2，其他在APB1
+    if (instance == USART1) {
+        return HAL_RCC_GetPCLK2Freq();
+    }
+
+    return HAL_RCC_GetPCLK1Freq();
+}
+
+static void stm32_uart_config_gpio(const stm32_uart_desc_t* desc)
+{
+    LL_GPIO_InitTypeDef gpio_init;
+
+    gpio_init.Mode = LL_GPIO_MODE_ALTERNATE;
+    gpio_init.Speed = LL_GPIO_SPEED_FREQ_HIGH;
+    gpio_init.OutputType = LL_GPIO_OUTPUT_PUSHPULL;
+    gpio_init.Pull = LL_GPIO_PULL_UP;
+    gpio_init.Alternate = desc->alternate;
+
+    gpio_init.Pin = desc->tx_pin;
+    LL_GPIO_Init(desc->tx_port, &gpio_init);
+
+    gpio_init.Pin = desc->rx_pin;
+    LL_GPIO_Init(desc->rx_port, &gpio_init);
+}
+
+/**
+ * @brief 使能USART並等待發送/接收器就緒 (TEACK/REACK)
+ */
+static void stm32_uart_enable(USART_TypeDef* usart)
+{
+    LL_USART_Enable(usart);
+    while (!LL_USART_IsActiveFlag_TEACK(usart) || !LL_USART_IsActiveFlag_REACK(usart)) {
+        // 等待發送/接收器就緒
+    }
+}
+
+/**
+ * @brief 將一個位元組寫入訊框
+ * @param check_match 是否比對結束字元 (只在硬體回報CMF後需要)
+ * @return true 訊框已結束 (結束字元或緩衝區已滿)
+ */
+static bool stm32_uart_frame_put(stm32_uart_state_t* state, uint8_t data, bool check_match)
+{
+    state->frame_buffer[state->frame_count] = data;
+    state->frame_count++;
+
+    return ((check_match && state->frame_match != HAL_UART_FRAME_NO_MATCH &&
+             data == (uint8_t)state->frame_match) ||
+            state->frame_count >= state->frame_max);
+}
+
+/**
+ * @brief 結束訊框並呼叫回呼 (回呼中可重新啟動訊框接收)
+ */
+static void stm32_uart_frame_complete(stm32_uart_state_t* state)
+{
+    *state->frame_length = state->frame_count;
+    state->frame_armed = false;
+    HAL_STATS_INC(&state->stats, transfers);
+
+    if (state->frame_callback != NULL) {
+        state->frame_callback(state->frame_context);
+    }
+}
+
+/**
+ * @brief UART中斷處理: 將接收FIFO中的資料搬到訊框或環形緩衝區
+ */
+static void stm32_uart_irq_handler(uint32_t index)
+{
+    USART_TypeDef* usart = uart_descs[index].instance;
+    stm32_uart_state_t* state = &uart_states[index];
+    bool idle = false;
+    bool matched = false;
+    uint32_t received = 0;
+
+    // 錯誤旗標只需清除並計數，資料仍留在FIFO中
+    if (LL_USART_IsActiveFlag_ORE(usart)) {
+        LL_USART_ClearFlag_ORE(usart);
+        HAL_STATS_INC(&state->stats, overruns);
+    }
+    if (LL_USART_IsActiveFlag_FE(usart)) {
+        LL_USART_ClearFlag_FE(usart);
+        HAL_STATS_INC(&state->stats, framing_errors);
+    }
+    if (LL_USART_IsActiveFlag_NE(usart)) {
+        LL_USART_ClearFlag_NE(usart);
+    }
+    if (LL_USART_IsActiveFlag_PE(usart)) {
+        LL_USART_ClearFlag_PE(usart);
+        HAL_STATS_INC(&state->stats, parity_errors);
+    }
+    if (LL_USART_IsActiveFlag_CM(usart)) {
+        LL_USART_ClearFlag_CM(usart);
+        matched = true;
+    }
+    if (LL_USART_IsActiveFlag_RTO(usart)) {
+        LL_USART_ClearFlag_RTO(usart);
+        idle = true;
+    }
+
+    // 閾值、字元比對或超時中斷皆取出FIFO中全部資料。
+    // 結束字元只在硬體設置CMF後才逐位元組定位: 取出下一個字元前CMF仍為0，
+    // 表示FIFO中到此為止都沒有結束字元 (字元進入FIFO時即設置CMF)
+    while (LL_USART_IsActiveFlag_RXNE_RXFNE(usart)) {
+        if (!matched && state->frame_armed && state->frame_match != HAL_UART_FRAME_NO_MATCH &&
+            LL_USART_IsActiveFlag_CM(usart)) {
+            LL_USART_ClearFlag_CM(usart);
+            matched = true;
+        }
+
+        uint8_t data = LL_USART_ReceiveData8(usart);
+
+        received++;
+        if (state->frame_armed) {
+            if (stm32_uart_frame_put(state, data, matched)) {
+                stm32_uart_frame_complete(state);
+            }
+        } else {
+            uint16_t head = state->rx_head;
+            uint16_t next = (uint16_t)((head + 1U) & STM32_UART_RX_MASK);
+
+            if (next != state->rx_tail) {
+                state->rx_buffer[head] = data;
+                state->rx_head = next;
+            } else {
+                HAL_STATS_INC(&state->stats, overruns);
+            }
+        }
+    }
+
+    HAL_STATS_ADD(&state->stats, rx_bytes, received);
+
+    // 線路閒置，結束已收到資料的訊框
+    if (idle && state->frame_armed && state->frame_count > 0) {
+        stm32_uart_frame_complete(state);
+    }
+}
+
+#endif /* PLATFORM_STM32 */
@@ -0,0 +1,40 @@
+/**
+ * @file stm32g4_work.c
+ * @brief STM32G4系列工作佇列軟體中斷實現 (PendSV)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_work.h"
+#include "stm32g4_common.h"
+
+#if defined(PLATFORM_STM32) && HAL_WORK_USE_SWI
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+void hal_work_port_init(void)
+{
+    // PendSV設為最低優先權，所有週邊中斷皆可搶占工作佇列
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+}
+
+void hal_work_port_trigger(void)
+{
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief PendSV中斷 (與使用PendSV的RTOS不可同時使用)
+ */
+void PendSV_Handler(void)
+{
+    (void)hal_work_drain(0);
+}
+
+#endif /* PLATFORM_STM32 && HAL_WORK_USE_SWI */
@@ -50,10 +50,6 @@ static uint32_t hal_gpio_pull_to_driverlib_type(hal_gpio_pull_t pull)
         case HAL_GPIO_PULLUP:
             return GPIO_PIN_TYPE_PULLUP;
             
-        case HAL_GPIO_PULLDOWN:
-            // C2000系列沒有內建下拉電阻，使用標準配置
-            return GPIO_PIN_TYPE_STD;
-            
         case HAL_GPIO_NOPULL:
         default:
             return GPIO_PIN_TYPE_STD;
@@ -77,6 +73,11 @@ hal_status_t hal_gpio_init(const hal_gpio_config_t* config)
         return HAL_INVALID_PARAM;
     }
     
+    // C2000系列沒有內建下拉電阻
+    if (config->pull == HAL_GPIO_PULLDOWN) {
+        return HAL_NOT_SUPPORTED;
+    }
+    
     TI_DEBUG_ASSERT(config->mode <= HAL_GPIO_MODE_ANALOG);
     TI_DEBUG_ASSERT(config->pull <= HAL_GPIO_PULLDOWN);
     
@@ -157,6 +158,16 @@ hal_gpio_state_t hal_gpio_read(hal_gpio_pin_t pin)
     return (pin_value != 0) ? HAL_GPIO_HIGH : HAL_GPIO_LOW;
 }
 
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    // 埠A-H (GPIO0-255)
+    if (port > 7) {
+        return 0;
+    }
+    
+    return GPIO_readPortData((GPIO_Port)port);
+}
+
 hal_status_t hal_gpio_toggle(hal_gpio_pin_t pin)
 {
     if (pin > 168) {
@@ -198,6 +209,10 @@ hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull)
         return HAL_INVALID_PARAM;
     }
     
+    if (pull == HAL_GPIO_PULLDOWN) {
+        return HAL_NOT_SUPPORTED;
+    }
+    
     TI_EALLOW();
     
     uint32_t pin_type = hal_gpio_pull_to_driverlib_type(pull);
@@ -217,26 +232,23 @@ hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull)
  * @param pin GPIO引腳編號
  * @param int_type 中斷類型 (0=禁用, 1=上升沿, 2=下降沿, 3=雙沿)
  * @return HAL_OK 成功，其他值表示失敗
+ * @note 邊沿以事件形式存入佇列，由hal_gpio_event_read()讀取；
+ *       需要回呼時請使用hal_gpio_attach_irq()
  */
 hal_status_t hal_gpio_set_interrupt(hal_gpio_pin_t pin, uint32_t int_type)
 {
-    if (pin > 168) {
+    if (pin > 168 || int_type > HAL_GPIO_EDGE_BOTH) {
         return HAL_INVALID_PARAM;
     }
     
-    // 只有部分GPIO支援中斷功能
-    if (pin > 31) {
-        return HAL_ERROR;  // GPIO32-168不支援中斷
-    }
-    
-    TI_EALLOW();
+    // 先取消既有的註冊，未註冊時忽略錯誤
+    (void)hal_gpio_detach_irq(pin);
     
-    // 簡化的中斷配置，實際使用時需要更詳細的實現
-    // 這裡只是示例代碼
-    
-    TI_EDIS();
+    if (int_type == 0) {
+        return HAL_OK;
+    }
     
-    return HAL_OK;
+    return hal_gpio_attach_irq_event(pin, (hal_gpio_edge_t)int_type);
 }
 
 /**
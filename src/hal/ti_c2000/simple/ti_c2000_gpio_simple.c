@@ -3,6 +3,10 @@
  * @brief TI C2000系列GPIO硬體抽象層簡化實現
  * @author Cross-MCU Framework Team
  * @date 2024
+ *
+ * 直接存取GPxSET/GPxCLEAR/GPxTOGGLE/GPxDAT暫存器，不呼叫DriverLib。
+ * 埠與位元由引腳編號計算 (pin >> 5、1UL << (pin & 31))，
+ * 輸出操作為單一32位元寫入，可在中斷中使用。
  */
 
 #include "../include/hal_gpio.h"
@@ -10,92 +14,162 @@
 
 #ifdef PLATFORM_TI_C2000
 
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define TI_GPIO_EALLOW()        __asm(" EALLOW")
+#define TI_GPIO_EDIS()          __asm(" EDIS")
+
 /* ========================================================================== */
 /*                             GPIO介面實現                                   */
 /* ========================================================================== */
 
 hal_status_t hal_gpio_init(const hal_gpio_config_t* config)
 {
-    if (config == NULL) {
+    ti_gpio_batch_t batch = { 0 };
+
+    if (config == NULL || config->pin > TI_GPIO_MAX_PIN) {
         return HAL_INVALID_PARAM;
     }
-    
-    hal_gpio_pin_t pin = config->pin;
-    
-    // 檢查引腳範圍 
-    if (pin > 168) {
-        return HAL_INVALID_PARAM;
+    if (config->pull == HAL_GPIO_PULLDOWN) {
+        return HAL_NOT_SUPPORTED;
     }
-    
-    // 基本的GPIO初始化
-    // 這裡使用最基本的配置，避免複雜的DriverLib API
-    
+
+    // 單一引腳的批次，與hal_gpio_init_table()使用相同的暫存器寫入順序
+    ti_gpio_batch_add(&batch, config);
+
+    TI_GPIO_EALLOW();
+    ti_gpio_batch_apply(config->pin >> 5, &batch);
+    TI_GPIO_EDIS();
+
     return HAL_OK;
 }
 
 hal_status_t hal_gpio_deinit(hal_gpio_pin_t pin)
 {
-    if (pin > 168) {
-        return HAL_INVALID_PARAM;
-    }
-    
-    return HAL_OK;
+    hal_gpio_config_t config;
+
+    // 重設為輸入、無上拉
+    config.pin = pin;
+    config.mode = HAL_GPIO_MODE_INPUT;
+    config.pull = HAL_GPIO_NOPULL;
+    config.initial_state = HAL_GPIO_LOW;
+
+    return hal_gpio_init(&config);
 }
 
 hal_status_t hal_gpio_write(hal_gpio_pin_t pin, hal_gpio_state_t state)
 {
-    if (pin > 168) {
+    if (pin > TI_GPIO_MAX_PIN) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 基本的GPIO寫入操作
-    // 這裡需要根據實際的寄存器操作來實現
-    
+
+    if (state == HAL_GPIO_HIGH) {
+        ti_gpio_fast_set(pin);
+    } else {
+        ti_gpio_fast_clear(pin);
+    }
+
     return HAL_OK;
 }
 
 hal_gpio_state_t hal_gpio_read(hal_gpio_pin_t pin)
 {
-    if (pin > 168) {
+    if (pin > TI_GPIO_MAX_PIN) {
         return HAL_GPIO_LOW;
     }
-    
-    // 基本的GPIO讀取操作
-    // 這裡需要根據實際的寄存器操作來實現
-    
-    return HAL_GPIO_LOW;
+
+    return (ti_gpio_fast_read(pin) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW;
+}
+
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    // 埠A-H (GPIO0-255)
+    if (port > 7) {
+        return 0;
+    }
+
+    return ti_gpio_data_regs((uint32_t)port << 5)[TI_GPIO_DAT];
 }
 
 hal_status_t hal_gpio_toggle(hal_gpio_pin_t pin)
 {
-    if (pin > 168) {
+    if (pin > TI_GPIO_MAX_PIN) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 基本的GPIO切換操作
-    hal_gpio_state_t current_state = hal_gpio_read(pin);
-    hal_gpio_state_t new_state = (current_state == HAL_GPIO_HIGH) ? HAL_GPIO_LOW : HAL_GPIO_HIGH;
-    
-    return hal_gpio_write(pin, new_state);
+
+    // GPxTOGGLE由硬體翻轉，不需要讀改寫
+    ti_gpio_fast_toggle(pin);
+
+    return HAL_OK;
 }
 
 hal_status_t hal_gpio_set_mode(hal_gpio_pin_t pin, hal_gpio_mode_t mode)
 {
-    if (pin > 168) {
+    volatile uint32_t* ctrl;
+    uint32_t bit;
+    uint32_t field;
+
+    if (pin > TI_GPIO_MAX_PIN) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 基本的GPIO模式設置
+
+    ctrl = ti_gpio_ctrl_regs(pin);
+    bit = 1UL << (pin & 31U);
+    field = 3UL << ((pin & 15U) * 2U);
+
+    TI_GPIO_EALLOW();
+
+    // 輸入/輸出模式選擇GPIO功能，複用/類比模式保留目前的功能選擇
+    if (mode == HAL_GPIO_MODE_INPUT || mode == HAL_GPIO_MODE_OUTPUT) {
+        if ((pin & 31U) < 16U) {
+            ctrl[TI_GPIO_MUX1] &= ~field;
+            ctrl[TI_GPIO_GMUX1] &= ~field;
+        } else {
+            ctrl[TI_GPIO_MUX2] &= ~field;
+            ctrl[TI_GPIO_GMUX2] &= ~field;
+        }
+    }
+
+    if (mode == HAL_GPIO_MODE_OUTPUT) {
+        ctrl[TI_GPIO_DIR] |= bit;
+    } else {
+        ctrl[TI_GPIO_DIR] &= ~bit;
+    }
+
+    TI_GPIO_EDIS();
+
     return HAL_OK;
 }
 
 hal_status_t hal_gpio_set_pull(hal_gpio_pin_t pin, hal_gpio_pull_t pull)
 {
-    if (pin > 168) {
+    volatile uint32_t* ctrl;
+    uint32_t bit;
+
+    if (pin > TI_GPIO_MAX_PIN) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 基本的GPIO上拉/下拉設置
+
+    // C2000系列沒有內建下拉電阻
+    if (pull == HAL_GPIO_PULLDOWN) {
+        return HAL_NOT_SUPPORTED;
+    }
+
+    ctrl = ti_gpio_ctrl_regs(pin);
+    bit = 1UL << (pin & 31U);
+
+    TI_GPIO_EALLOW();
+
+    if (pull == HAL_GPIO_PULLUP) {
+        ctrl[TI_GPIO_PUD] &= ~bit;
+    } else {
+        ctrl[TI_GPIO_PUD] |= bit;
+    }
+
+    TI_GPIO_EDIS();
+
     return HAL_OK;
 }
 
@@ -6,32 +6,87 @@
  */
 
 #include "../include/hal.h"
+#include "ti_c2000_config.h"
 #include "ti_c2000_common.h"
 
 #ifdef PLATFORM_TI_C2000
 
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// PIE向量表項數 (含F28P65x的延伸群組)，每項為32位元位址
+#define TI_PIE_VECTOR_COUNT     0xE0U
+
+// 一般PIE群組數 (INT1-INT12)
+#define TI_PIE_GROUPS           12U
+
+// 系統tick頻率 (hal_get_tick()以毫秒為單位)
+#define TI_TICK_HZ              1000UL
+
 /* ========================================================================== */
 /*                             內部變數                                        */
 /* ========================================================================== */
 
 static volatile uint32_t system_tick_counter = 0;
 
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+// CPU Timer0系統tick (經hal_irq分派，PIE已由共用入口確認)
+static void ti_c2000_tick_handler(void)
+{
+    // TIF寫1清除
+    HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TCR) |= CPUTIMER_TCR_TIF;
+    
+    system_tick_counter++;
+    
+    // 驅動軟體計時器服務
+    hal_timer_tick();
+    
+#if HAL_STACK_TICK_CHECK
+    // 檢查堆疊溢位哨兵
+    (void)hal_stack_check();
+#endif
+}
+
+// 未登記的向量: 連接除錯器時停在此處
+static __interrupt void ti_c2000_default_isr(void)
+{
+    __asm(" ESTOP0");
+    
+    while (1) {
+        __asm(" NOP");
+    }
+}
+
 /* ========================================================================== */
 /*                             系統初始化實現                                  */
 /* ========================================================================== */
 
 hal_status_t hal_init(void)
 {
+    // 填色堆疊以量測使用量
+    hal_stack_paint();
+    
     // 基本的系統初始化
     ti_c2000_init_system_clock();
     ti_c2000_disable_watchdog();
     ti_c2000_init_peripheral_clocks();
     
+    // 初始化PIE、啟動系統tick後開啟全域中斷
+    ti_c2000_init_pie();
+    ti_c2000_init_tick();
+    ti_c2000_enable_global_interrupts();
+    
     return HAL_OK;
 }
 
 hal_status_t hal_deinit(void)
 {
+    ti_c2000_disable_global_interrupts();
+    
     return HAL_OK;
 }
 
@@ -65,6 +120,12 @@ uint32_t hal_get_tick(void)
     return system_tick_counter;
 }
 
+uint32_t hal_get_cycle_count(void)
+{
+    // CPU Timer2向下計數，反轉後為遞增的週期數
+    return ~HWREG(CPUTIMER2_BASE + CPUTIMER_O_TIM);
+}
+
 void hal_system_reset(void)
 {
     // 基本的系統復位
@@ -88,6 +149,12 @@ void ti_c2000_init_system_clock(void)
 void ti_c2000_init_peripheral_clocks(void)
 {
     // 基本的週邊時鐘初始化
+    
+    // CPU Timer2以SYSCLK自由運行，作為週期計數器 (TRB重新載入並啟動)
+    HWREG(CPUTIMER2_BASE + CPUTIMER_O_PRD) = 0xFFFFFFFFUL;
+    HWREGH(CPUTIMER2_BASE + CPUTIMER_O_TPR) = 0U;
+    HWREGH(CPUTIMER2_BASE + CPUTIMER_O_TPRH) = 0U;
+    HWREGH(CPUTIMER2_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TRB;
 }
 
 void ti_c2000_disable_watchdog(void)
@@ -97,7 +164,45 @@ void ti_c2000_disable_watchdog(void)
 
 void ti_c2000_init_pie(void)
 {
-    // 基本的PIE初始化
+    uint16_t i;
+    
+    // 禁用CPU中斷與PIE向量擷取
+    __asm(" SETC INTM");
+    HWREGH(PIECTRL_BASE + PIE_O_CTRL) &= (uint16_t)~PIE_CTRL_ENPIE;
+    
+    // 清除群組1-12的致能與旗標 (PIEIFRx緊接在PIEIERx之後)
+    for (i = 0; i < TI_PIE_GROUPS; i++) {
+        HWREGH(PIECTRL_BASE + PIE_O_IER1 + (i * 2U)) = 0U;
+        HWREGH(PIECTRL_BASE + PIE_O_IER1 + (i * 2U) + 1U) = 0U;
+    }
+    IER = 0x0000U;
+    IFR = 0x0000U;
+    
+    // 所有向量先指向預設處理函式
+    EALLOW;
+    for (i = 0; i < TI_PIE_VECTOR_COUNT; i++) {
+        HWREG(PIEVECTTABLE_BASE + (i * 2U)) = (uint32_t)&ti_c2000_default_isr;
+    }
+    EDIS;
+    
+    // 致能PIE並確認所有群組，讓第一次中斷可以進入
+    HWREGH(PIECTRL_BASE + PIE_O_CTRL) |= PIE_CTRL_ENPIE;
+    HWREGH(PIECTRL_BASE + PIE_O_ACK) = 0xFFFFU;
+}
+
+void ti_c2000_init_tick(void)
+{
+    // 停止並以SYSCLK計數 (不預除頻)，每1ms歸零一次
+    HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TSS;
+    HWREG(CPUTIMER0_BASE + CPUTIMER_O_PRD) = (CPU_FREQ / TI_TICK_HZ) - 1UL;
+    HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TPR) = 0U;
+    HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TPRH) = 0U;
+    
+    (void)hal_irq_register(INT_TIMER0, ti_c2000_tick_handler, TI_C2000_TICK_IRQ_PRIORITY);
+    
+    // 重新載入、清除旗標、致能中斷並啟動 (TSS = 0)
+    HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TRB | CPUTIMER_TCR_TIF |
+                                              CPUTIMER_TCR_TIE;
 }
 
 void ti_c2000_enable_global_interrupts(void)
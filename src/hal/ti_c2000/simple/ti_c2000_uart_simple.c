@@ -3,68 +3,361 @@
  * @brief TI C2000系列UART硬體抽象層簡化實現
  * @author Cross-MCU Framework Team
  * @date 2024
+ *
+ * 直接存取SCI暫存器，不呼叫DriverLib。發送與接收依FIFO深度 (TXFFST/RXFFST)
+ * 一次搬移多個字元，移位暫存器不會出現空檔，可達到完整線路速率。
+ * 超時以CPU Timer2週期數計算，不依賴系統tick中斷。
+ * 不使用SCI中斷，因此不支援訊框接收 (hal_uart_*_frame返回HAL_NOT_SUPPORTED)。
  */
 
 #include "../include/hal_uart.h"
+#include "../include/hal.h"
+#include "../include/hal_port.h"
 #include "ti_c2000_common.h"
 
 #ifdef PLATFORM_TI_C2000
 
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define TI_UART_COUNT           3U      // SCIA-C
+#define TI_UART_NO_PIN          0xFFFFU
+
+#define TI_UART_LSPCLK_HZ       ((uint32_t)LSPCLK_FREQ_MHZ * 1000000UL)
+#define TI_UART_CYCLES_PER_MS   ((uint32_t)CPU_FREQ_MHZ * 1000UL)
+
+#define TI_UART_EALLOW()        __asm(" EALLOW")
+#define TI_UART_EDIS()          __asm(" EDIS")
+
+/** SCI引腳與多工選擇 (GMUX = mux >> 2，MUX = mux & 3) */
+typedef struct {
+    uint16_t rx_pin;
+    uint16_t tx_pin;
+    uint16_t mux;
+} ti_uart_pins_t;
+
+/** 以毫秒計算的超時 */
+typedef struct {
+    uint32_t start;
+    uint32_t elapsed_ms;
+    uint32_t timeout;
+} ti_uart_deadline_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static const ti_uart_pins_t uart_pins[TI_UART_COUNT] = {
+    { 28U, 29U, 1U },                               // SCIA: GPIO28-RX、GPIO29-TX
+#ifdef MCU_F28P65X
+    { 15U, 14U, 2U },                               // SCIB: GPIO15-RX、GPIO14-TX
+#else
+    { 15U, 14U, 6U },
+#endif
+    { TI_UART_NO_PIN, TI_UART_NO_PIN, 0U }          // SCIC: 依實際硬體連接配置
+};
+
+// 各UART目前的波特率設定
+static hal_uart_baud_result_t uart_baud_info[TI_UART_COUNT];
+
+// 各UART的效能與錯誤統計
+static hal_stats_t uart_stats[TI_UART_COUNT];
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static void ti_uart_deadline_start(ti_uart_deadline_t* d, uint32_t timeout)
+{
+    d->start = hal_get_cycle_count();
+    d->elapsed_ms = 0;
+    d->timeout = timeout;
+}
+
+/**
+ * @brief 檢查是否超時 (timeout為0表示一直等待)
+ * 以整毫秒累計，長超時不會因32位元週期數溢位而失效；滿timeout毫秒即超時
+ */
+static bool ti_uart_deadline_expired(ti_uart_deadline_t* d)
+{
+    if (d->timeout == 0U) {
+        return false;
+    }
+
+    while ((hal_get_cycle_count() - d->start) >= TI_UART_CYCLES_PER_MS) {
+        d->start += TI_UART_CYCLES_PER_MS;
+        d->elapsed_ms++;
+    }
+
+    return (d->elapsed_ms >= d->timeout);
+}
+
+/**
+ * @brief 將引腳切換到SCI功能 (呼叫者需已EALLOW)
+ */
+static void ti_uart_mux_pin(uint32_t pin, uint16_t mux, bool rx)
+{
+    volatile uint32_t* ctrl = ti_gpio_ctrl_regs(pin);
+    uint32_t bit = 1UL << (pin & 31U);
+    uint32_t shift = (pin & 15U) * 2U;
+    uint32_t field = 3UL << shift;
+    uint16_t mux_reg = ((pin & 31U) < 16U) ? TI_GPIO_MUX1 : TI_GPIO_MUX2;
+    uint16_t gmux_reg = ((pin & 31U) < 16U) ? TI_GPIO_GMUX1 : TI_GPIO_GMUX2;
+    uint16_t qsel_reg = ((pin & 31U) < 16U) ? TI_GPIO_QSEL1 : TI_GPIO_QSEL2;
+
+    // 使能上拉，RX使用非同步限定 (QSEL = 3)，由SCI自行取樣
+    ctrl[TI_GPIO_PUD] &= ~bit;
+    if (rx) {
+        ctrl[qsel_reg] |= field;
+    }
+
+    // 先將MUX清為0再改GMUX，避免中間狀態選到其他週邊
+    ctrl[mux_reg] &= ~field;
+    ctrl[gmux_reg] = (ctrl[gmux_reg] & ~field) | ((uint32_t)(mux >> 2) << shift);
+    ctrl[mux_reg] |= (uint32_t)(mux & 3U) << shift;
+}
+
+/**
+ * @brief 清除接收錯誤
+ * SCIRXST的錯誤旗標只能由軟體重設清除，RX FIFO中的資料保留，
+ * 但移位中的發送字元會中斷
+ */
+static void ti_uart_clear_errors(volatile uint16_t* sci)
+{
+    sci[TI_SCI_CTL1] &= ~TI_SCI_CTL1_SWRESET;
+    sci[TI_SCI_CTL1] |= TI_SCI_CTL1_SWRESET;
+    sci[TI_SCI_FFRX] |= TI_SCI_FFRX_OVFCLR;
+}
+
+/**
+ * @brief 檢查並清除接收錯誤 (中斷、框架、同位、溢位或FIFO溢位)
+ * 框架與同位錯誤由接收字元的旗標統計，此處只統計溢位
+ * @return true 發生過錯誤
+ */
+static bool ti_uart_check_errors(volatile uint16_t* sci, hal_stats_t* stats)
+{
+    uint16_t rxst = sci[TI_SCI_RXST];
+    uint16_t ffrx = sci[TI_SCI_FFRX];
+
+    if ((rxst & TI_SCI_RXST_RXERROR) != 0U || (ffrx & TI_SCI_FFRX_OVF) != 0U) {
+        HAL_STATS_COUNT_IF(stats, overruns,
+                           (rxst & TI_SCI_RXST_OE) != 0U || (ffrx & TI_SCI_FFRX_OVF) != 0U);
+        ti_uart_clear_errors(sci);
+        return true;
+    }
+
+    return false;
+}
+
 /* ========================================================================== */
 /*                             UART介面實現                                   */
 /* ========================================================================== */
 
 hal_status_t hal_uart_init(hal_uart_id_t uart_id, const hal_uart_config_t* config)
 {
-    if (config == NULL) {
+    const ti_uart_pins_t* pins;
+    volatile uint16_t* sci;
+    hal_uart_baud_result_t baud;
+    uint16_t ccr;
+
+    if (config == NULL || uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // SCI字元長度為1-8位元
+    if (config->databits != HAL_UART_DATABITS_7 && config->databits != HAL_UART_DATABITS_8) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 簡化的UART初始化
-    // 在實際實現中，這裡會配置UART寄存器
-    
+
+    // 計算最接近的波特率除頻值 (四捨五入)
+    if (hal_uart_calc_sci_divisor(TI_UART_LSPCLK_HZ, config->baudrate, &baud) != HAL_OK) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 資料格式: SCICHAR = 資料位數 - 1
+    ccr = (uint16_t)config->databits - 1U;
+    if (config->stopbits == HAL_UART_STOPBITS_2) {
+        ccr |= TI_SCI_CCR_STOP2;
+    }
+    if (config->parity == HAL_UART_PARITY_EVEN) {
+        ccr |= TI_SCI_CCR_PAR_ENA | TI_SCI_CCR_PAR_EVEN;
+    } else if (config->parity == HAL_UART_PARITY_ODD) {
+        ccr |= TI_SCI_CCR_PAR_ENA;
+    }
+
+    pins = &uart_pins[uart_id];
+    sci = ti_sci_regs((uint16_t)uart_id);
+
+    TI_UART_EALLOW();
+    *(volatile uint32_t*)TI_C2000_REG_ADDR(TI_SYSCTL_PCLKCR7_ADDR) |= (1UL << uart_id);
+    if (pins->rx_pin != TI_UART_NO_PIN) {
+        ti_uart_mux_pin(pins->rx_pin, pins->mux, true);
+        ti_uart_mux_pin(pins->tx_pin, pins->mux, false);
+    }
+    TI_UART_EDIS();
+
+    // 軟體重設期間配置格式與波特率
+    sci[TI_SCI_CTL1] = 0U;
+    sci[TI_SCI_CCR] = ccr;
+    sci[TI_SCI_HBAUD] = (uint16_t)(baud.divisor >> 8);
+    sci[TI_SCI_LBAUD] = (uint16_t)(baud.divisor & 0xFFU);
+    sci[TI_SCI_PRI] = TI_SCI_PRI_SOFT;
+    uart_baud_info[uart_id] = baud;
+
+    // 重設SCI通道與FIFO後使能FIFO，TX FIFO不插入字元間延遲
+    sci[TI_SCI_FFTX] = TI_SCI_FFTX_FFENA;
+    sci[TI_SCI_FFTX] = TI_SCI_FFTX_SCIRST | TI_SCI_FFTX_FFENA;
+    sci[TI_SCI_FFTX] = TI_SCI_FFTX_SCIRST | TI_SCI_FFTX_FFENA | TI_SCI_FFTX_FIFORESET;
+    sci[TI_SCI_FFRX] = TI_SCI_FFRX_OVFCLR;
+    sci[TI_SCI_FFRX] = TI_SCI_FFRX_FIFORESET;
+    sci[TI_SCI_FFCT] = 0U;
+
+    sci[TI_SCI_CTL1] = TI_SCI_CTL1_SWRESET | TI_SCI_CTL1_TXENA | TI_SCI_CTL1_RXENA;
+
     return HAL_OK;
 }
 
 hal_status_t hal_uart_deinit(hal_uart_id_t uart_id)
 {
-    // 簡化的UART反初始化
+    volatile uint16_t* sci;
+
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+
+    // 停止收發並保持FIFO在重設狀態
+    sci[TI_SCI_CTL1] = 0U;
+    sci[TI_SCI_FFTX] = 0U;
+    sci[TI_SCI_FFRX] = 0U;
+
+    TI_UART_EALLOW();
+    *(volatile uint32_t*)TI_C2000_REG_ADDR(TI_SYSCTL_PCLKCR7_ADDR) &= ~(1UL << uart_id);
+    TI_UART_EDIS();
+
     return HAL_OK;
 }
 
-hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data, 
+hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data,
                                uint16_t size, uint32_t timeout)
 {
-    if (data == NULL || size == 0) {
+    volatile uint16_t* sci;
+    hal_stats_t* stats;
+    ti_uart_deadline_t deadline;
+    uint32_t block_start;
+    uint16_t sent = 0;
+
+    if (data == NULL || size == 0 || uart_id >= TI_UART_COUNT) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 簡化的UART發送實現
-    // 在實際實現中，這裡會操作UART寄存器發送資料
-    uint16_t i;
-    for (i = 0; i < size; i++) {
-        // 模擬發送延時
-        hal_delay_us(100);
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+    stats = &uart_stats[uart_id];
+    block_start = HAL_STATS_BLOCK_BEGIN();
+    ti_uart_deadline_start(&deadline, timeout);
+
+    while (sent < size) {
+        // 依FIFO剩餘空間一次寫入多個字元
+        uint16_t space = TI_SCI_FIFO_DEPTH - ti_sci_tx_level(sci);
+
+        if (space == 0U) {
+            if (ti_uart_deadline_expired(&deadline)) {
+                HAL_STATS_ADD(stats, tx_bytes, sent);
+                HAL_STATS_INC(stats, timeouts);
+                HAL_STATS_BLOCK_END(stats, block_start);
+                return HAL_TIMEOUT;
+            }
+            continue;
+        }
+
+        if (space > (uint16_t)(size - sent)) {
+            space = size - sent;
+        }
+
+        while (space > 0U) {
+            sci[TI_SCI_TXBUF] = (uint16_t)data[sent];
+            sent++;
+            space--;
+        }
     }
-    
+
+    HAL_STATS_ADD(stats, tx_bytes, size);
+    HAL_STATS_INC(stats, transfers);
+    HAL_STATS_BLOCK_END(stats, block_start);
+
     return HAL_OK;
 }
 
-hal_status_t hal_uart_receive(hal_uart_id_t uart_id, uint8_t* data, 
+hal_status_t hal_uart_receive(hal_uart_id_t uart_id, uint8_t* data,
                               uint16_t size, uint32_t timeout)
 {
-    if (data == NULL || size == 0) {
+    volatile uint16_t* sci;
+    hal_stats_t* stats;
+    ti_uart_deadline_t deadline;
+    uint32_t block_start;
+    uint16_t received = 0;
+    bool error = false;
+
+    if (data == NULL || size == 0 || uart_id >= TI_UART_COUNT) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 簡化的UART接收實現
-    // 在實際實現中，這裡會從UART寄存器讀取資料
-    uint16_t i;
-    for (i = 0; i < size; i++) {
-        data[i] = 0; // 模擬接收到的資料
-        hal_delay_us(100);
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+    stats = &uart_stats[uart_id];
+    block_start = HAL_STATS_BLOCK_BEGIN();
+    ti_uart_deadline_start(&deadline, timeout);
+
+    while (received < size) {
+        // 依FIFO中的資料數一次讀取多個字元
+        uint16_t level = ti_sci_rx_level(sci);
+
+        if (level == 0U) {
+            // 線路錯誤時接收器停止，不再等待後續字元
+            if (ti_uart_check_errors(sci, stats)) {
+                HAL_STATS_ADD(stats, rx_bytes, received);
+                HAL_STATS_BLOCK_END(stats, block_start);
+                return HAL_ERROR;
+            }
+            if (ti_uart_deadline_expired(&deadline)) {
+                // 超時前已讀出的字元仍留在緩衝區中，計入接收位元組數
+                HAL_STATS_ADD(stats, rx_bytes, received);
+                HAL_STATS_INC(stats, timeouts);
+                HAL_STATS_BLOCK_END(stats, block_start);
+                return HAL_TIMEOUT;
+            }
+            continue;
+        }
+
+        if (level > (uint16_t)(size - received)) {
+            level = size - received;
+        }
+
+        while (level > 0U) {
+            uint16_t rx = sci[TI_SCI_RXBUF];
+
+            if ((rx & (TI_SCI_RXBUF_FE | TI_SCI_RXBUF_PE)) != 0U) {
+                HAL_STATS_COUNT_IF(stats, framing_errors, (rx & TI_SCI_RXBUF_FE) != 0U);
+                HAL_STATS_COUNT_IF(stats, parity_errors, (rx & TI_SCI_RXBUF_PE) != 0U);
+                error = true;
+            }
+            data[received] = (uint8_t)(rx & TI_SCI_RXBUF_SAR);
+            received++;
+            level--;
+        }
+    }
+
+    HAL_STATS_ADD(stats, rx_bytes, received);
+    HAL_STATS_BLOCK_END(stats, block_start);
+
+    // 資料已全部讀出，錯誤字元仍保留在緩衝區中，由返回值告知呼叫者
+    if (ti_uart_check_errors(sci, stats) || error) {
+        return HAL_ERROR;
     }
-    
+
+    HAL_STATS_INC(stats, transfers);
+
     return HAL_OK;
 }
 
@@ -75,40 +368,197 @@ hal_status_t hal_uart_putchar(hal_uart_id_t uart_id, uint8_t ch)
 
 hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeout)
 {
-    if (ch == NULL) {
+    return hal_uart_receive(uart_id, ch, 1, timeout);
+}
+
+hal_status_t hal_uart_get_baud_info(hal_uart_id_t uart_id, hal_uart_baud_result_t* result)
+{
+    if (result == NULL || uart_id >= TI_UART_COUNT) {
         return HAL_INVALID_PARAM;
     }
-    
-    // 簡化的字元接收實現
-    *ch = 0;
-    hal_delay_us(100);
-    
+
+    *result = uart_baud_info[uart_id];
+
     return HAL_OK;
 }
 
-bool hal_uart_is_busy(hal_uart_id_t uart_id)
+hal_status_t hal_uart_autobaud(hal_uart_id_t uart_id, uint32_t timeout, uint32_t* baudrate)
 {
-    // 簡化實現，假設UART總是不忙
+    volatile uint16_t* sci;
+    ti_uart_deadline_t deadline;
+    hal_uart_baud_result_t* info;
+
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+    ti_uart_deadline_start(&deadline, timeout);
+
+    // 以最高速率開始偵測，由硬體調整BRR直到收到'A'/'a'
+    sci[TI_SCI_HBAUD] = 0U;
+    sci[TI_SCI_LBAUD] = 1U;
+    sci[TI_SCI_FFCT] |= TI_SCI_FFCT_CDC | TI_SCI_FFCT_ABDCLR;
+
+    while ((sci[TI_SCI_FFCT] & TI_SCI_FFCT_ABD) == 0U) {
+        if (ti_uart_deadline_expired(&deadline)) {
+            sci[TI_SCI_FFCT] &= ~TI_SCI_FFCT_CDC;
+            return HAL_TIMEOUT;
+        }
+    }
+
+    sci[TI_SCI_FFCT] |= TI_SCI_FFCT_ABDCLR;
+    sci[TI_SCI_FFCT] &= ~TI_SCI_FFCT_CDC;
+
+    // 由鎖定的BRR計算實際波特率
+    info = &uart_baud_info[uart_id];
+    info->divisor = ((uint32_t)sci[TI_SCI_HBAUD] << 8) | (sci[TI_SCI_LBAUD] & 0xFFU);
+    info->prescaler = 0;
+    info->over8 = false;
+    info->actual_baudrate = TI_UART_LSPCLK_HZ / (((info->divisor < 1UL) ? 2UL : (info->divisor + 1UL)) * 8UL);
+    info->error_ppm = 0;
+
+    // 捨棄同步字元
+    (void)hal_uart_flush_rx(uart_id);
+
+    if (baudrate != NULL) {
+        *baudrate = info->actual_baudrate;
+    }
+
+    return HAL_OK;
+}
+
+/*
+ * 訊框接收需要RX中斷與閒置計時 (DriverLib版以PIE中斷與軟體計時器實現)，
+ * 簡化實現只以輪詢收發，訊框介面一律返回HAL_NOT_SUPPORTED
+ */
+hal_status_t hal_uart_config_frame(hal_uart_id_t uart_id, uint16_t idle_bits, int16_t match_char)
+{
+    (void)uart_id;
+    (void)idle_bits;
+    (void)match_char;
+
+    return HAL_NOT_SUPPORTED;
+}
+
+hal_status_t hal_uart_receive_frame(hal_uart_id_t uart_id, uint8_t* buffer, uint16_t max_size,
+                                    uint16_t* length, hal_callback_t callback, void* context)
+{
+    (void)uart_id;
+    (void)buffer;
+    (void)max_size;
+    (void)length;
+    (void)callback;
+    (void)context;
+
+    return HAL_NOT_SUPPORTED;
+}
+
+bool hal_uart_frame_pending(hal_uart_id_t uart_id)
+{
+    (void)uart_id;
+
     return false;
 }
 
+hal_status_t hal_uart_abort_frame(hal_uart_id_t uart_id)
+{
+    (void)uart_id;
+
+    return HAL_NOT_SUPPORTED;
+}
+
+hal_status_t hal_uart_get_stats(hal_uart_id_t uart_id, hal_stats_t* stats)
+{
+    if (stats == NULL || uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+#if HAL_STATS_ENABLE
+    hal_port_irq_state_t irq_state;
+
+    // 輪詢驅動沒有自己的中斷，但傳輸函式可能由中斷或工作佇列呼叫，複製時遮罩全域中斷
+    irq_state = HAL_PORT_IRQ_SAVE();
+    *stats = uart_stats[uart_id];
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+#else
+    return HAL_ERROR;
+#endif
+}
+
+hal_status_t hal_uart_reset_stats(hal_uart_id_t uart_id)
+{
+    static const hal_stats_t zero = { 0 };
+    hal_port_irq_state_t irq_state;
+
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+    uart_stats[uart_id] = zero;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+bool hal_uart_is_busy(hal_uart_id_t uart_id)
+{
+    volatile uint16_t* sci;
+
+    if (uart_id >= TI_UART_COUNT) {
+        return false;
+    }
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+
+    // FIFO中仍有資料或移位暫存器仍在發送
+    return (ti_sci_tx_level(sci) != 0U) || ((sci[TI_SCI_CTL2] & TI_SCI_CTL2_TXEMPTY) == 0U);
+}
+
 bool hal_uart_data_available(hal_uart_id_t uart_id)
 {
-    // 簡化實現，假設總是有資料可用
-    return true;
+    if (uart_id >= TI_UART_COUNT) {
+        return false;
+    }
+
+    return (ti_sci_rx_level(ti_sci_regs((uint16_t)uart_id)) != 0U);
 }
 
 hal_status_t hal_uart_flush_rx(hal_uart_id_t uart_id)
 {
-    // 簡化的接收緩衝區清空實現
+    volatile uint16_t* sci;
+
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    sci = ti_sci_regs((uint16_t)uart_id);
+
+    // 讀取所有待處理的接收資料，並清除殘留的錯誤狀態
+    while (ti_sci_rx_level(sci) != 0U) {
+        volatile uint16_t dummy = sci[TI_SCI_RXBUF];
+        (void)dummy;
+    }
+    (void)ti_uart_check_errors(sci, &uart_stats[uart_id]);
+
     return HAL_OK;
 }
 
 hal_status_t hal_uart_flush_tx(hal_uart_id_t uart_id)
 {
-    // 簡化的發送緩衝區清空實現
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 等待FIFO與移位暫存器皆發送完成
+    while (hal_uart_is_busy(uart_id)) {
+        // 等待發送緩衝區空
+    }
+
     return HAL_OK;
 }
 
 #endif /* PLATFORM_TI_C2000 */
-
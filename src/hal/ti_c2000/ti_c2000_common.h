@@ -57,6 +57,119 @@ extern "C" {
 #define TI_GPIO_34      34
 #define TI_GPIO_35      35
 
+/* ========================================================================== */
+/*                             GPIO暫存器直接存取                             */
+/* ========================================================================== */
+
+/*
+ * 裝置位址轉換為存取用的指標位址。目標平台上為原值；
+ * 主機端暫存器模型 (tests/model) 定義為轉換到模擬記憶體的函式
+ */
+#ifndef TI_C2000_REG_ADDR
+    #define TI_C2000_REG_ADDR(addr)     (addr)
+#endif
+
+// 暫存器位址依TRM，不依賴DriverLib
+#ifndef TI_GPIO_CTRL_BASE
+    #define TI_GPIO_CTRL_BASE       0x00007C00UL
+#endif
+#ifndef TI_GPIO_DATA_BASE
+    #define TI_GPIO_DATA_BASE       0x00007F00UL
+#endif
+
+// 每個埠 (32個引腳) 的暫存器間距，以32位元暫存器為單位
+#define TI_GPIO_CTRL_STEP       0x20U
+#define TI_GPIO_DATA_STEP       0x04U
+
+// 控制暫存器索引 (GPxQSEL1 ... GPxGMUX2)
+#define TI_GPIO_QSEL1           0x01U
+#define TI_GPIO_QSEL2           0x02U
+#define TI_GPIO_MUX1            0x03U
+#define TI_GPIO_MUX2            0x04U
+#define TI_GPIO_DIR             0x05U
+#define TI_GPIO_PUD             0x06U
+#define TI_GPIO_INV             0x08U
+#define TI_GPIO_ODR             0x09U
+#define TI_GPIO_GMUX1           0x10U
+#define TI_GPIO_GMUX2           0x11U
+
+// 資料暫存器索引 (GPxDAT/GPxSET/GPxCLEAR/GPxTOGGLE)
+#define TI_GPIO_DAT             0x00U
+#define TI_GPIO_SET             0x01U
+#define TI_GPIO_CLEAR           0x02U
+#define TI_GPIO_TOGGLE          0x03U
+
+/** 引腳所在埠的控制暫存器 */
+static inline volatile uint32_t* ti_gpio_ctrl_regs(uint32_t pin)
+{
+    return (volatile uint32_t*)TI_C2000_REG_ADDR(TI_GPIO_CTRL_BASE) +
+           ((pin >> 5) * TI_GPIO_CTRL_STEP);
+}
+
+/** 引腳所在埠的資料暫存器 */
+static inline volatile uint32_t* ti_gpio_data_regs(uint32_t pin)
+{
+    return (volatile uint32_t*)TI_C2000_REG_ADDR(TI_GPIO_DATA_BASE) +
+           ((pin >> 5) * TI_GPIO_DATA_STEP);
+}
+
+/*
+ * 輸出操作各為一次32位元寫入 (單一MOVL指令)，只影響寫1的位元，
+ * 不需要讀改寫，可在任意中斷中使用
+ */
+static inline void ti_gpio_fast_set(uint32_t pin)
+{
+    ti_gpio_data_regs(pin)[TI_GPIO_SET] = 1UL << (pin & 31U);
+}
+
+static inline void ti_gpio_fast_clear(uint32_t pin)
+{
+    ti_gpio_data_regs(pin)[TI_GPIO_CLEAR] = 1UL << (pin & 31U);
+}
+
+static inline void ti_gpio_fast_toggle(uint32_t pin)
+{
+    ti_gpio_data_regs(pin)[TI_GPIO_TOGGLE] = 1UL << (pin & 31U);
+}
+
+static inline uint32_t ti_gpio_fast_read(uint32_t pin)
+{
+    return (ti_gpio_data_regs(pin)[TI_GPIO_DAT] >> (pin & 31U)) & 1UL;
+}
+
+/* ========================================================================== */
+/*                             GPIO批次配置                                    */
+/* ========================================================================== */
+
+#define TI_GPIO_MAX_PIN         168U
+#define TI_GPIO_PORT_COUNT      6U      // 埠A-F (GPIO0-191)
+
+/**
+ * @brief 一個埠累積的暫存器位元
+ * hal_gpio_init_table()與簡化版hal_gpio_init()共用 (ti_c2000_gpio_table.c)
+ */
+typedef struct {
+    uint32_t pins;          // 配置到的引腳
+    uint32_t gpio_func;     // 設為GPIO功能的引腳 (輸入/輸出模式)
+    uint32_t dir;           // 輸出引腳
+    uint32_t pullup;        // 使能上拉的引腳
+    uint32_t inputs;        // 輸入引腳 (同步限定)
+    uint32_t set;           // 初始為高電位的輸出
+    uint32_t clear;         // 初始為低電位的輸出
+} ti_gpio_batch_t;
+
+/**
+ * @brief 將一個引腳的配置累積到所在埠的批次
+ * 同一引腳重複加入時以最後一次為準
+ */
+void ti_gpio_batch_add(ti_gpio_batch_t* batch, const hal_gpio_config_t* config);
+
+/**
+ * @brief 將一個埠的累積位元寫入暫存器，每個暫存器只讀改寫一次 (呼叫者需已EALLOW)
+ * @param port 埠編號 (pin >> 5)
+ */
+void ti_gpio_batch_apply(uint32_t port, const ti_gpio_batch_t* batch);
+
 /* ========================================================================== */
 /*                             UART模組定義                                   */
 /* ========================================================================== */
@@ -65,6 +178,95 @@ extern "C" {
 #define TI_UART_B       1
 #define TI_UART_C       2
 
+/* ========================================================================== */
+/*                             SCI暫存器直接存取                              */
+/* ========================================================================== */
+
+// SCI模組基底位址，模組間距0x10
+#ifndef TI_SCI_BASE
+    #define TI_SCI_BASE             0x00007200UL
+#endif
+#define TI_SCI_STEP             0x10U
+
+// 週邊時鐘控制 (CpuSysRegs.PCLKCR7，CPUSYS基底0x5D300 + 0x30，bit0-2為SCIA-C)
+#ifndef TI_SYSCTL_PCLKCR7_ADDR
+    #define TI_SYSCTL_PCLKCR7_ADDR  0x0005D330UL
+#endif
+
+// 暫存器索引，以16位元暫存器為單位
+#define TI_SCI_CCR              0x0U    // 通訊控制 (資料格式)
+#define TI_SCI_CTL1             0x1U    // 控制1 (致能、軟體重設)
+#define TI_SCI_HBAUD            0x2U
+#define TI_SCI_LBAUD            0x3U
+#define TI_SCI_CTL2             0x4U    // 控制2 (TXRDY/TXEMPTY)
+#define TI_SCI_RXST             0x5U    // 接收狀態
+#define TI_SCI_RXBUF            0x7U
+#define TI_SCI_TXBUF            0x9U
+#define TI_SCI_FFTX             0xAU
+#define TI_SCI_FFRX             0xBU
+#define TI_SCI_FFCT             0xCU
+#define TI_SCI_PRI              0xFU
+
+// SCICCR
+#define TI_SCI_CCR_STOP2        0x0080U
+#define TI_SCI_CCR_PAR_EVEN     0x0040U
+#define TI_SCI_CCR_PAR_ENA      0x0020U
+
+// SCICTL1
+#define TI_SCI_CTL1_SWRESET     0x0020U
+#define TI_SCI_CTL1_TXENA       0x0002U
+#define TI_SCI_CTL1_RXENA       0x0001U
+
+// SCICTL2
+#define TI_SCI_CTL2_TXEMPTY     0x0040U
+
+// SCIRXST (RXERROR = BRKDT | FE | OE | PE)
+#define TI_SCI_RXST_RXERROR     0x0080U
+#define TI_SCI_RXST_OE          0x0008U
+
+// SCIRXBUF (FIFO模式下每個字元附帶的錯誤旗標)
+#define TI_SCI_RXBUF_FE         0x8000U
+#define TI_SCI_RXBUF_PE         0x4000U
+#define TI_SCI_RXBUF_SAR        0x00FFU
+
+// SCIFFTX / SCIFFRX
+#define TI_SCI_FFTX_SCIRST      0x8000U
+#define TI_SCI_FFTX_FFENA       0x4000U
+#define TI_SCI_FFTX_FIFORESET   0x2000U
+#define TI_SCI_FFRX_OVF         0x8000U
+#define TI_SCI_FFRX_OVFCLR      0x4000U
+#define TI_SCI_FFRX_FIFORESET   0x2000U
+#define TI_SCI_FF_LEVEL_SHIFT   8U
+#define TI_SCI_FF_LEVEL_MASK    0x1FU
+#define TI_SCI_FIFO_DEPTH       16U
+
+// SCIFFCT
+#define TI_SCI_FFCT_ABD         0x8000U
+#define TI_SCI_FFCT_ABDCLR      0x4000U
+#define TI_SCI_FFCT_CDC         0x2000U
+
+// SCIPRI: SOFT為位元3，FREE為位元4 (FREE=1時除錯暫停不影響SCI)；
+// FREE=0、SOFT=1: 除錯暫停時完成目前的收發字元後停止
+#define TI_SCI_PRI_SOFT         0x0008U
+
+/** SCI模組的暫存器 */
+static inline volatile uint16_t* ti_sci_regs(uint16_t uart_id)
+{
+    return (volatile uint16_t*)TI_C2000_REG_ADDR(TI_SCI_BASE) + ((uint32_t)uart_id * TI_SCI_STEP);
+}
+
+/** TX FIFO中的字元數 (0-16) */
+static inline uint16_t ti_sci_tx_level(volatile const uint16_t* sci)
+{
+    return (sci[TI_SCI_FFTX] >> TI_SCI_FF_LEVEL_SHIFT) & TI_SCI_FF_LEVEL_MASK;
+}
+
+/** RX FIFO中的字元數 (0-16) */
+static inline uint16_t ti_sci_rx_level(volatile const uint16_t* sci)
+{
+    return (sci[TI_SCI_FFRX] >> TI_SCI_FF_LEVEL_SHIFT) & TI_SCI_FF_LEVEL_MASK;
+}
+
 /* ========================================================================== */
 /*                             SPI模組定義                                    */
 /* ========================================================================== */
@@ -113,6 +315,11 @@ void ti_c2000_disable_watchdog(void);
  */
 void ti_c2000_init_pie(void);
 
+/**
+ * @brief 以CPU Timer0啟動1ms系統tick (經hal_irq登記INT_TIMER0)
+ */
+void ti_c2000_init_tick(void);
+
 /**
  * @brief 使能全域中斷
  */
@@ -123,6 +330,23 @@ void ti_c2000_enable_global_interrupts(void);
  */
 void ti_c2000_disable_global_interrupts(void);
 
+/**
+ * @brief hal_irq登記的向量在hal_cpu_load中的識別碼 (TI_C2000_IRQ_CPU_LOAD = 1時由共用入口累計)
+ * @param vector DriverLib中斷編號
+ * @return 槽位索引，登記後不變；未登記時返回HAL_CPU_LOAD_MAX_ISRS
+ * 槽位索引不小於HAL_CPU_LOAD_MAX_ISRS的向量只計入整體中斷時間
+ */
+uint16_t ti_c2000_irq_load_id(uint32_t vector);
+
+/**
+ * @brief 中斷延遲量測 (TI_C2000_IRQ_LATENCY_PROBE = 1時有效)
+ * 記錄CPU Timer0 (簡化版本的系統tick，由hal_init()經hal_irq登記) 從歸零到進入
+ * 共用入口的CPU週期數，包含被其他中斷或臨界區延後的時間
+ */
+uint32_t ti_c2000_irq_latency_max(void);
+uint32_t ti_c2000_irq_latency_last(void);
+void ti_c2000_irq_latency_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
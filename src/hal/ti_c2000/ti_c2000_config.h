@@ -74,4 +74,56 @@
  */
 #define TI_C2000_DMA_SUPPORT_ENABLED    0
 
+/**
+ * @brief 工作佇列軟體中斷使用的PIE通道 (HAL_WORK_USE_SWI = 1時有效)
+ * 預設使用PIE群組12的XINT5，該群組的其他通道不應同時使用，
+ * 以避免軟體設置PIEIFR時與硬體旗標競爭
+ */
+#ifndef TI_C2000_WORK_SWI_INT
+    #define TI_C2000_WORK_SWI_INT       INT_XINT5
+#endif
+
+/**
+ * @brief GPIO邊沿中斷可使用的XINT (bit0-3 = XINT1-4)
+ * XINT1/2位於PIE群組1；XINT3/4與工作佇列SWI同在群組12，
+ * 預設只使用XINT1/2，工作佇列SWI移到其他群組後可設為0x000F
+ */
+#ifndef TI_C2000_GPIO_IRQ_LINES
+    #define TI_C2000_GPIO_IRQ_LINES     0x0003U
+#endif
+
+/**
+ * @brief 中斷延遲量測 (hal_irq)
+ * 1 = 在共用入口記錄CPU Timer0 (簡化版本的系統tick) 歸零到進入中斷的週期數，
+ *     由ti_c2000_irq_latency_max()讀取
+ */
+#ifndef TI_C2000_IRQ_LATENCY_PROBE
+    #define TI_C2000_IRQ_LATENCY_PROBE  0
+#endif
+
+/**
+ * @brief hal_irq處理函式的CPU負載統計
+ * 1 = 共用入口在處理函式前後呼叫hal_cpu_load_isr_enter()/exit()，
+ *     識別碼由ti_c2000_irq_load_id()取得；處理函式內不需再自行取時間戳
+ */
+#ifndef TI_C2000_IRQ_CPU_LOAD
+    #define TI_C2000_IRQ_CPU_LOAD       0
+#endif
+
+/**
+ * @brief 簡化版本系統tick (CPU Timer0) 的hal_irq優先權
+ * 0-1保留給可搶占tick的控制迴路中斷
+ */
+#ifndef TI_C2000_TICK_IRQ_PRIORITY
+    #define TI_C2000_TICK_IRQ_PRIORITY  2U
+#endif
+
+/**
+ * @brief hal_irq處理函式執行期間一律保留的IER位元
+ * 例如0x1000 (INT13) 讓分析器的CPU Timer1取樣中斷可搶占所有登記的中斷
+ */
+#ifndef TI_C2000_IRQ_IER_ALWAYS
+    #define TI_C2000_IRQ_IER_ALWAYS     0x0000U
+#endif
+
 #endif /* TI_C2000_CONFIG_H */
@@ -0,0 +1,130 @@
+/**
+ * @file ti_c2000_crc.c
+ * @brief TI C2000系列VCU CRC實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 使用C2000Ware VCU-II CRC函式庫 (vcu2_crc)，以VCU CRC指令計算固定多項式:
+ * CRC8 0x07、CRC16 0x8005/0x1021、CRC32 0x04C11DB7/0x1EDC6F41，一般與反射版本。
+ * 函式庫輸入為緊縮位元組 (每字兩個位元組)，資料逐段緊縮後計算。
+ *
+ * 反射設定分開對應: reflect_in選擇Reflected函式 (VCU在移入前反轉每個輸入位元組)，
+ * VCU的CRC暫存器 (種子與結果) 固定為一般表示法，反射演算法的暫存器在此轉換；
+ * reflect_out不是VCU參數，由hal_crc_final()依reflect_in != reflect_out反轉結果。
+ * 包含路徑與函式庫由makefiles/ti_c2000_*.mk在HAL_CRC_USE_HW=1時加入
+ * (C2000Ware libraries/dsp/VCU/c28)。
+ */
+
+#include "../include/hal_crc.h"
+#include "../include/hal_packed.h"
+#include "ti_c2000_config.h"
+#include "ti_c2000_common.h"
+
+#if defined(PLATFORM_TI_C2000) && HAL_CRC_USE_HW
+
+#include "vcu2/vcu2_crc.h"
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// 每次緊縮計算的位元組數
+#define TI_CRC_STAGE_SIZE       64U
+
+/** VCU CRC計算函式 */
+typedef void (*ti_crc_run_t)(CRC_Handle handle);
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 反轉低width位元 (反射演算法的暫存器與VCU一般表示法互換)
+ */
+static uint32_t ti_crc_reflect(uint32_t value, uint8_t width)
+{
+    uint32_t result = 0;
+    uint8_t i;
+
+    for (i = 0; i < width; i++) {
+        result = (result << 1) | (value & 1UL);
+        value >>= 1;
+    }
+
+    return result;
+}
+
+/**
+ * @brief 依多項式與輸入反射選擇VCU計算函式
+ * @note 只由reflect_in決定，reflect_out與VCU無關
+ */
+static ti_crc_run_t ti_crc_get_run(const hal_crc_config_t* config)
+{
+    bool reflect = config->reflect_in;
+
+    if (config->width == 8U && config->poly == 0x07UL) {
+        return reflect ? CRC_run8BitReflected : CRC_run8Bit;
+    }
+    if (config->width == 16U && config->poly == 0x8005UL) {
+        return reflect ? CRC_run16BitPoly1Reflected : CRC_run16BitPoly1;
+    }
+    if (config->width == 16U && config->poly == 0x1021UL) {
+        return reflect ? CRC_run16BitPoly2Reflected : CRC_run16BitPoly2;
+    }
+    if (config->width == 32U && config->poly == 0x04C11DB7UL) {
+        return reflect ? CRC_run32BitPoly1Reflected : CRC_run32BitPoly1;
+    }
+    if (config->width == 32U && config->poly == 0x1EDC6F41UL) {
+        return reflect ? CRC_run32BitPoly2Reflected : CRC_run32BitPoly2;
+    }
+
+    return NULL;
+}
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+bool hal_crc_port_supported(const hal_crc_config_t* config)
+{
+    return (ti_crc_get_run(config) != NULL);
+}
+
+uint32_t hal_crc_port_update(const hal_crc_config_t* config, uint32_t reg,
+                             const uint8_t* data, uint32_t len)
+{
+    HAL_PACKED_DEFINE(stage, TI_CRC_STAGE_SIZE);
+    ti_crc_run_t run = ti_crc_get_run(config);
+    CRC_Obj crc_obj;
+
+    crc_obj.parity = CRC_parity_even;
+    crc_obj.pMsgBuffer = stage;
+    crc_obj.pCrcTable = NULL;
+
+    // 反射演算法的暫存器在hal_crc_t中為反射表示法，VCU種子與結果為一般表示法
+    if (config->reflect_in) {
+        reg = ti_crc_reflect(reg, config->width);
+    }
+
+    while (len > 0) {
+        uint16_t chunk = (len > TI_CRC_STAGE_SIZE) ? TI_CRC_STAGE_SIZE : (uint16_t)len;
+
+        // 暫存器值作為下一段的種子
+        hal_packed_pack(stage, data, chunk);
+        crc_obj.seedValue = reg;
+        crc_obj.nMsgBytes = chunk;
+        run(&crc_obj);
+        reg = crc_obj.crcResult;
+
+        data += chunk;
+        len -= chunk;
+    }
+
+    if (config->reflect_in) {
+        reg = ti_crc_reflect(reg, config->width);
+    }
+
+    return reg;
+}
+
+#endif /* PLATFORM_TI_C2000 && HAL_CRC_USE_HW */
@@ -108,6 +108,16 @@ hal_gpio_state_t hal_gpio_read(hal_gpio_pin_t pin)
     return (pin_state != 0) ? HAL_GPIO_HIGH : HAL_GPIO_LOW;
 }
 
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    // 埠A-H (GPIO0-255)
+    if (port > 7) {
+        return 0;
+    }
+    
+    return GPIO_readPortData((GPIO_Port)port);
+}
+
 hal_status_t hal_gpio_toggle(hal_gpio_pin_t pin)
 {
     if (pin > 168) {
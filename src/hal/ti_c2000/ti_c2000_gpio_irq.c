@@ -0,0 +1,124 @@
+/**
+ * @file ti_c2000_gpio_irq.c
+ * @brief TI C2000系列GPIO邊沿中斷實現 (Input X-BAR + XINT)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 任意GPIO經Input X-BAR (INPUT4/5/6/13) 連接到XINT1-4，
+ * 中斷線n對應XINTn+1，可用的線由TI_C2000_GPIO_IRQ_LINES決定。
+ */
+
+#include "../include/hal_gpio.h"
+#include "ti_c2000_config.h"
+#include "ti_c2000_common.h"
+
+#ifdef PLATFORM_TI_C2000
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define TI_XINT_COUNT           4U
+
+typedef struct {
+    GPIO_ExternalIntNum xint;
+    uint32_t int_number;
+    uint16_t ack_group;
+} ti_xint_info_t;
+
+static const ti_xint_info_t ti_xint_info[TI_XINT_COUNT] = {
+    { GPIO_INT_XINT1, INT_XINT1, INTERRUPT_ACK_GROUP1 },
+    { GPIO_INT_XINT2, INT_XINT2, INTERRUPT_ACK_GROUP1 },
+    { GPIO_INT_XINT3, INT_XINT3, INTERRUPT_ACK_GROUP12 },
+    { GPIO_INT_XINT4, INT_XINT4, INTERRUPT_ACK_GROUP12 }
+};
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+// 各XINT目前連接的引腳，用於讀取雙沿觸發時的電位
+static uint32_t xint_pins[TI_XINT_COUNT];
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+static inline void ti_xint_handle(uint16_t line)
+{
+    hal_gpio_state_t level = (GPIO_readPin(xint_pins[line]) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW;
+
+    hal_gpio_irq_dispatch(line, level);
+
+    Interrupt_clearACKGroup(ti_xint_info[line].ack_group);
+}
+
+static __interrupt void ti_xint1_isr(void) { ti_xint_handle(0U); }
+static __interrupt void ti_xint2_isr(void) { ti_xint_handle(1U); }
+static __interrupt void ti_xint3_isr(void) { ti_xint_handle(2U); }
+static __interrupt void ti_xint4_isr(void) { ti_xint_handle(3U); }
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+uint16_t hal_gpio_port_irq_lines(hal_gpio_pin_t pin)
+{
+    // Input X-BAR可選擇任意GPIO
+    if (pin > 168) {
+        return 0;
+    }
+
+    return (uint16_t)(TI_C2000_GPIO_IRQ_LINES & ((1U << TI_XINT_COUNT) - 1U));
+}
+
+hal_status_t hal_gpio_port_irq_enable(uint16_t line, hal_gpio_pin_t pin, hal_gpio_edge_t edge)
+{
+    static void (* const isr_table[TI_XINT_COUNT])(void) = {
+        ti_xint1_isr, ti_xint2_isr, ti_xint3_isr, ti_xint4_isr
+    };
+    const ti_xint_info_t* info;
+    GPIO_IntType int_type;
+
+    if (line >= TI_XINT_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    info = &ti_xint_info[line];
+    xint_pins[line] = pin;
+
+    switch (edge) {
+        case HAL_GPIO_EDGE_RISING:
+            int_type = GPIO_INT_TYPE_RISING_EDGE;
+            break;
+        case HAL_GPIO_EDGE_FALLING:
+            int_type = GPIO_INT_TYPE_FALLING_EDGE;
+            break;
+        case HAL_GPIO_EDGE_BOTH:
+        default:
+            int_type = GPIO_INT_TYPE_BOTH_EDGES;
+            break;
+    }
+
+    // 設置Input X-BAR來源引腳與觸發邊沿
+    GPIO_setInterruptPin(pin, info->xint);
+    GPIO_setInterruptType(info->xint, int_type);
+
+    Interrupt_register(info->int_number, isr_table[line]);
+    GPIO_enableInterrupt(info->xint);
+    Interrupt_enable(info->int_number);
+
+    return HAL_OK;
+}
+
+void hal_gpio_port_irq_disable(uint16_t line)
+{
+    if (line >= TI_XINT_COUNT) {
+        return;
+    }
+
+    GPIO_disableInterrupt(ti_xint_info[line].xint);
+    Interrupt_disable(ti_xint_info[line].int_number);
+}
+
+#endif /* PLATFORM_TI_C2000 */
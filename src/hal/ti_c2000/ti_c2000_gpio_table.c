@@ -0,0 +1,145 @@
+/**
+ * @file ti_c2000_gpio_table.c
+ * @brief TI C2000系列GPIO批次配置 (DriverLib與簡化版後端共用)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 依埠累積整個配置表後，每個埠的GPxDIR/GPxPUD/GPxMUX等暫存器只讀改寫一次，
+ * 所有埠在同一次EALLOW內完成。直接存取暫存器，不依賴DriverLib。
+ */
+
+#include "../include/hal_gpio.h"
+#include "ti_c2000_common.h"
+
+#ifdef PLATFORM_TI_C2000
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+#define TI_GPIO_TABLE_EALLOW()  __asm(" EALLOW")
+#define TI_GPIO_TABLE_EDIS()    __asm(" EDIS")
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 將16個引腳位元展開為MUX/QSEL的2位元欄位遮罩
+ */
+static uint32_t ti_gpio_expand_2bit(uint32_t bits)
+{
+    uint32_t mask = 0;
+    uint16_t i;
+
+    for (i = 0; i < 16U; i++) {
+        if ((bits & (1UL << i)) != 0U) {
+            mask |= (3UL << (i * 2U));
+        }
+    }
+
+    return mask;
+}
+
+/* ========================================================================== */
+/*                             批次配置實現                                    */
+/* ========================================================================== */
+
+void ti_gpio_batch_add(ti_gpio_batch_t* batch, const hal_gpio_config_t* config)
+{
+    uint32_t bit = 1UL << (config->pin & 31U);
+
+    // 先清除此引腳先前累積的位元，配置表中重複的引腳以最後一項為準
+    batch->gpio_func &= ~bit;
+    batch->dir &= ~bit;
+    batch->pullup &= ~bit;
+    batch->inputs &= ~bit;
+    batch->set &= ~bit;
+    batch->clear &= ~bit;
+
+    batch->pins |= bit;
+    if (config->pull == HAL_GPIO_PULLUP) {
+        batch->pullup |= bit;
+    }
+
+    if (config->mode == HAL_GPIO_MODE_OUTPUT) {
+        batch->gpio_func |= bit;
+        batch->dir |= bit;
+        if (config->initial_state == HAL_GPIO_HIGH) {
+            batch->set |= bit;
+        } else {
+            batch->clear |= bit;
+        }
+    } else if (config->mode == HAL_GPIO_MODE_INPUT) {
+        batch->gpio_func |= bit;
+        batch->inputs |= bit;
+    }
+}
+
+void ti_gpio_batch_apply(uint32_t port, const ti_gpio_batch_t* batch)
+{
+    volatile uint32_t* ctrl = ti_gpio_ctrl_regs(port << 5);
+    volatile uint32_t* data = ti_gpio_data_regs(port << 5);
+    uint32_t func_lo = ti_gpio_expand_2bit(batch->gpio_func & 0xFFFFU);
+    uint32_t func_hi = ti_gpio_expand_2bit(batch->gpio_func >> 16);
+
+    // 先寫入輸出值，GPxDIR切換為輸出時即為初始狀態
+    data[TI_GPIO_SET] = batch->set;
+    data[TI_GPIO_CLEAR] = batch->clear;
+
+    // 上拉: GPxPUD為0表示使能
+    ctrl[TI_GPIO_PUD] = (ctrl[TI_GPIO_PUD] | batch->pins) & ~batch->pullup;
+    ctrl[TI_GPIO_INV] &= ~batch->pins;
+    ctrl[TI_GPIO_ODR] &= ~batch->pins;
+
+    // 輸入同步限定 (QSEL = 0)
+    ctrl[TI_GPIO_QSEL1] &= ~ti_gpio_expand_2bit(batch->inputs & 0xFFFFU);
+    ctrl[TI_GPIO_QSEL2] &= ~ti_gpio_expand_2bit(batch->inputs >> 16);
+
+    // GPIO功能 (GMUX = 0、MUX = 0)，先清MUX再清GMUX避免中間狀態選到其他週邊
+    ctrl[TI_GPIO_MUX1] &= ~func_lo;
+    ctrl[TI_GPIO_MUX2] &= ~func_hi;
+    ctrl[TI_GPIO_GMUX1] &= ~func_lo;
+    ctrl[TI_GPIO_GMUX2] &= ~func_hi;
+
+    ctrl[TI_GPIO_DIR] = (ctrl[TI_GPIO_DIR] & ~batch->pins) | batch->dir;
+}
+
+/* ========================================================================== */
+/*                             GPIO介面實現                                   */
+/* ========================================================================== */
+
+hal_status_t hal_gpio_init_table(const hal_gpio_config_t* configs, uint16_t count)
+{
+    ti_gpio_batch_t batch[TI_GPIO_PORT_COUNT] = { 0 };
+    uint32_t port;
+    uint16_t i;
+
+    if (configs == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // 先檢查整個配置表並依埠累積，避免只配置到一部分
+    for (i = 0; i < count; i++) {
+        if (configs[i].pin > TI_GPIO_MAX_PIN) {
+            return HAL_INVALID_PARAM;
+        }
+        if (configs[i].pull == HAL_GPIO_PULLDOWN) {
+            return HAL_NOT_SUPPORTED;
+        }
+        ti_gpio_batch_add(&batch[configs[i].pin >> 5], &configs[i]);
+    }
+
+    // 所有埠在同一次EALLOW內配置
+    TI_GPIO_TABLE_EALLOW();
+    for (port = 0; port < TI_GPIO_PORT_COUNT; port++) {
+        if (batch[port].pins != 0U) {
+            ti_gpio_batch_apply(port, &batch[port]);
+        }
+    }
+    TI_GPIO_TABLE_EDIS();
+
+    return HAL_OK;
+}
+
+#endif /* PLATFORM_TI_C2000 */
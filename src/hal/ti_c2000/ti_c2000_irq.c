@@ -0,0 +1,438 @@
+/**
+ * @file ti_c2000_irq.c
+ * @brief TI C2000系列可巢狀優先權中斷分派實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * C28x進入中斷時設置INTM，預設不巢狀；PIE的固定優先權只決定同時待處理時的順序。
+ * 所有登記的向量指向ti_irq_entry()，由PIECTRL.PIEVECT找出槽位後:
+ * 保存IER與自身群組PIEIER → 只保留較高優先權的群組/通道 → 確認PIE → EINT
+ * → 呼叫處理函式 → DINT → 恢復PIEIER與IER。
+ * 其他群組以整個群組為單位允許搶占: 群組內所有登記的向量優先權都較高時才保留，
+ * 同群組中未經hal_irq登記、由驅動程式自行致能的通道會一併被允許。
+ * 各槽位的遮罩在登記時預先計算，中斷入口只做數次暫存器讀寫；
+ * 同時更新hal_critical_enter_level()各優先權保留的群組。
+ * TI_C2000_IRQ_CPU_LOAD = 1時入口在處理函式前後取hal_cpu_load時間戳，
+ * 以槽位索引作為中斷識別碼。
+ */
+
+#include "../include/hal_irq.h"
+#include "../include/hal_cpu_load.h"
+#include "../include/hal_critical.h"
+#include "../include/hal_port.h"
+#include "ti_c2000_config.h"
+#include "ti_c2000_common.h"
+
+#ifdef PLATFORM_TI_C2000
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// DriverLib中斷編號: bit31-16為PIE向量ID，bit15-8為PIE群組，bit7-0為群組內通道
+#define TI_IRQ_VECTOR_ID(v)     ((uint16_t)((v) >> 16U))
+#define TI_IRQ_GROUP(v)         ((uint16_t)(((v) & 0xFF00U) >> 8U))
+#define TI_IRQ_CHANNEL(v)       ((uint16_t)((v) & 0xFFU))
+
+// PIE向量表項數 (含F28P65x的延伸群組)
+#define TI_IRQ_VECTOR_COUNT     0xE0U
+
+// PIE向量ID對應的PIEACK位元: ID 32-127為群組1-12的通道1-8，ID 128-223為通道9-16
+#define TI_IRQ_ID_ACK_BIT(id)   ((uint16_t)((((id) >= 128U) ? ((id) - 128U) : ((id) - 32U)) >> 3U))
+
+// IER bit0-13對應INT1-INT14，bit14-15 (DLOGINT/RTOSINT) 不受分派影響
+#define TI_IRQ_IER_GROUPS       0x3FFFU
+#define TI_IRQ_IER_BITS         14U
+
+// 槽位對應表中表示未登記
+#define TI_IRQ_SLOT_NONE        0xFFU
+
+/** 登記的處理函式與預先計算的遮罩 */
+typedef struct {
+    hal_irq_handler_t handler;      // NULL表示空槽位
+    uint32_t vector;
+    uint16_t priority;
+    uint16_t ier_bit;               // 所在CPU中斷 (INTx的x-1)
+    uint16_t pie_bit;               // 群組內通道位元，INT13/INT14為0
+    uint16_t pieier_reg;            // PIEIERx位址
+    uint16_t ier_keep;              // 執行期間保留的IER位元
+    uint16_t pieier_keep;           // 執行期間保留的自身群組PIEIER位元
+    bool enabled;
+} ti_irq_slot_t;
+
+/* ========================================================================== */
+/*                             內部變數                                        */
+/* ========================================================================== */
+
+static ti_irq_slot_t irq_slots[HAL_IRQ_MAX_HANDLERS];
+static uint16_t irq_slot_map[TI_IRQ_VECTOR_COUNT];
+static bool irq_initialized = false;
+
+// 正在執行的處理函式優先權 (巢狀時由入口保存與恢復)
+static volatile uint16_t irq_current_priority = HAL_IRQ_PRIORITY_LEVELS;
+
+#if TI_C2000_IRQ_LATENCY_PROBE
+static volatile uint32_t irq_latency_max = 0;
+static volatile uint32_t irq_latency_last = 0;
+#endif
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static void ti_irq_init(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < TI_IRQ_VECTOR_COUNT; i++) {
+        irq_slot_map[i] = TI_IRQ_SLOT_NONE;
+    }
+
+    irq_initialized = true;
+}
+
+static ti_irq_slot_t* ti_irq_find(uint32_t vector)
+{
+    uint16_t id = TI_IRQ_VECTOR_ID(vector);
+
+    if (id >= TI_IRQ_VECTOR_COUNT || irq_slot_map[id] == TI_IRQ_SLOT_NONE) {
+        return NULL;
+    }
+
+    return &irq_slots[irq_slot_map[id]];
+}
+
+/**
+ * @brief 重新計算所有槽位的遮罩 (登記或移除後呼叫)
+ * 呼叫者需遮罩INTM，避免入口讀到一半更新的遮罩
+ */
+static void ti_irq_update_masks(void)
+{
+    uint16_t group_lowest[TI_IRQ_IER_BITS];     // 群組內最低的優先權 (最大數值)
+    uint16_t i;
+    uint16_t j;
+
+    for (i = 0; i < TI_IRQ_IER_BITS; i++) {
+        group_lowest[i] = 0U;
+    }
+
+    // 沒有登記任何向量的群組保持0，不允許搶占 (優先權未知)
+    for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+        const ti_irq_slot_t* s = &irq_slots[i];
+
+        if (s->handler != NULL && s->priority + 1U > group_lowest[s->ier_bit]) {
+            group_lowest[s->ier_bit] = s->priority + 1U;
+        }
+    }
+
+    for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+        ti_irq_slot_t* s = &irq_slots[i];
+        uint16_t ier_keep = (uint16_t)(~TI_IRQ_IER_GROUPS | TI_C2000_IRQ_IER_ALWAYS);
+        uint16_t pieier_keep = 0U;
+
+        if (s->handler == NULL) {
+            continue;
+        }
+
+        for (j = 0; j < TI_IRQ_IER_BITS; j++) {
+            if (j != s->ier_bit && group_lowest[j] != 0U && group_lowest[j] <= s->priority) {
+                ier_keep |= (uint16_t)(1U << j);
+            }
+        }
+
+        // 自身群組只保留優先權較高的通道
+        for (j = 0; j < HAL_IRQ_MAX_HANDLERS; j++) {
+            const ti_irq_slot_t* o = &irq_slots[j];
+
+            if (o->handler != NULL && o->ier_bit == s->ier_bit && o->priority < s->priority) {
+                pieier_keep |= o->pie_bit;
+            }
+        }
+
+        if (pieier_keep != 0U) {
+            ier_keep |= (uint16_t)(1U << s->ier_bit);
+        }
+
+        s->ier_keep = ier_keep;
+        s->pieier_keep = pieier_keep;
+    }
+
+    // hal_critical_enter_level()以相同的群組規則轉換優先權
+    hal_critical_update_ier_keep(group_lowest);
+}
+
+#if TI_C2000_IRQ_LATENCY_PROBE
+/**
+ * @brief 記錄CPU Timer0從歸零到進入中斷的週期數
+ * 計時器歸零時重新載入PRD並觸發中斷，進入時PRD - TIM即為經過的計時器週期
+ */
+static inline void ti_irq_latency_sample(void)
+{
+    uint32_t tim = HWREG(CPUTIMER0_BASE + CPUTIMER_O_TIM);
+    uint32_t prd = HWREG(CPUTIMER0_BASE + CPUTIMER_O_PRD);
+    uint32_t prescale = (HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TPR) & 0xFFU) |
+                        ((HWREGH(CPUTIMER0_BASE + CPUTIMER_O_TPRH) & 0xFFU) << 8U);
+    uint32_t cycles = (prd - tim) * (prescale + 1UL);
+
+    irq_latency_last = cycles;
+    if (cycles > irq_latency_max) {
+        irq_latency_max = cycles;
+    }
+}
+#endif
+
+/* ========================================================================== */
+/*                             中斷入口                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 所有登記向量的共用入口
+ * PIEVECT為正在服務的向量表項位址，(位址 - 向量表基底) / 2即為向量ID
+ */
+static __interrupt void ti_irq_entry(void)
+{
+    uint16_t id = (uint16_t)(((HWREGH(PIECTRL_BASE + PIE_O_CTRL) & PIE_CTRL_PIEVECT_M) -
+                              (uint16_t)PIEVECTTABLE_BASE) >> 1U);
+    const ti_irq_slot_t* s;
+    uint16_t saved_ier;
+    uint16_t saved_pieier;
+    uint16_t saved_priority;
+#if TI_C2000_IRQ_CPU_LOAD
+    hal_cpu_load_stamp_t stamp;
+#endif
+
+#if TI_C2000_IRQ_LATENCY_PROBE
+    if (id == TI_IRQ_VECTOR_ID(INT_TIMER0)) {
+        ti_irq_latency_sample();
+    }
+#endif
+
+    // 移除登記前已進入PIE的向量: 只確認群組，否則同群組之後的中斷不會再送出
+    if (id >= TI_IRQ_VECTOR_COUNT || irq_slot_map[id] == TI_IRQ_SLOT_NONE) {
+        if (id >= 32U && id < TI_IRQ_VECTOR_COUNT) {
+            HWREGH(PIECTRL_BASE + PIE_O_ACK) = (uint16_t)(1U << TI_IRQ_ID_ACK_BIT(id));
+        }
+        return;
+    }
+
+    s = &irq_slots[irq_slot_map[id]];
+
+    // 1. 只保留較高優先權的群組與通道
+    saved_ier = IER;
+    IER &= s->ier_keep;
+    saved_pieier = 0U;
+    if (s->pie_bit != 0U) {
+        saved_pieier = HWREGH(s->pieier_reg);
+        HWREGH(s->pieier_reg) = saved_pieier & s->pieier_keep;
+
+        // 2. 確認自身群組，同群組較高優先權的通道才能再次進入
+        HWREGH(PIECTRL_BASE + PIE_O_ACK) = (uint16_t)(1U << s->ier_bit);
+    }
+
+    saved_priority = irq_current_priority;
+    irq_current_priority = s->priority;
+
+    // 3. 等待PIEIER寫入生效後開啟中斷
+    __asm(" NOP");
+    EINT;
+
+#if TI_C2000_IRQ_CPU_LOAD
+    hal_cpu_load_isr_enter(&stamp);
+    s->handler();
+    hal_cpu_load_isr_exit(irq_slot_map[id], &stamp);
+#else
+    s->handler();
+#endif
+
+    DINT;
+    irq_current_priority = saved_priority;
+    if (s->pie_bit != 0U) {
+        HWREGH(s->pieier_reg) = saved_pieier;
+    }
+    IER = saved_ier;
+}
+
+/* ========================================================================== */
+/*                             中斷分派介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_irq_register(uint32_t vector, hal_irq_handler_t handler, uint16_t priority)
+{
+    uint16_t id = TI_IRQ_VECTOR_ID(vector);
+    uint16_t group = TI_IRQ_GROUP(vector);
+    uint16_t channel = TI_IRQ_CHANNEL(vector);
+    hal_port_irq_state_t irq_state;
+    ti_irq_slot_t* s;
+    uint16_t i;
+
+    if (handler == NULL || priority >= HAL_IRQ_PRIORITY_LEVELS || id >= TI_IRQ_VECTOR_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // PIE群組1-12 (F28P65x延伸到群組16時只支援1-12)，或直接連接CPU的INT13/INT14
+    if (group == 0U) {
+        if (id != 13U && id != 14U) {
+            return HAL_INVALID_PARAM;
+        }
+    } else if (group > 12U || channel == 0U || channel > 16U) {
+        return HAL_INVALID_PARAM;
+    }
+
+    irq_state = HAL_PORT_IRQ_SAVE();
+
+    if (!irq_initialized) {
+        ti_irq_init();
+    }
+
+    s = ti_irq_find(vector);
+    if (s == NULL) {
+        for (i = 0; i < HAL_IRQ_MAX_HANDLERS; i++) {
+            if (irq_slots[i].handler == NULL) {
+                break;
+            }
+        }
+
+        if (i == HAL_IRQ_MAX_HANDLERS) {
+            HAL_PORT_IRQ_RESTORE(irq_state);
+            return HAL_BUSY;
+        }
+
+        s = &irq_slots[i];
+        irq_slot_map[id] = i;
+    }
+
+    s->vector = vector;
+    s->priority = priority;
+    if (group == 0U) {
+        s->ier_bit = id - 1U;
+        s->pie_bit = 0U;
+        s->pieier_reg = 0U;
+    } else {
+        s->ier_bit = group - 1U;
+        s->pie_bit = (uint16_t)(1U << (channel - 1U));
+        s->pieier_reg = (uint16_t)(PIECTRL_BASE + PIE_O_IER1 + ((group - 1U) * 2U));
+    }
+    s->handler = handler;
+
+    ti_irq_update_masks();
+
+    Interrupt_register(vector, &ti_irq_entry);
+    Interrupt_enable(vector);
+    s->enabled = true;
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_unregister(uint32_t vector)
+{
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+    ti_irq_slot_t* s = irq_initialized ? ti_irq_find(vector) : NULL;
+
+    if (s == NULL) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return HAL_INVALID_PARAM;
+    }
+
+    Interrupt_disable(vector);
+    Interrupt_unregister(vector);
+
+    s->handler = NULL;
+    s->enabled = false;
+    irq_slot_map[TI_IRQ_VECTOR_ID(vector)] = TI_IRQ_SLOT_NONE;
+
+    // 移除後其他群組可能全部成為較高優先權
+    ti_irq_update_masks();
+
+    HAL_PORT_IRQ_RESTORE(irq_state);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_enable(uint32_t vector)
+{
+    ti_irq_slot_t* s = irq_initialized ? ti_irq_find(vector) : NULL;
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    s->enabled = true;
+    Interrupt_enable(vector);
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_disable(uint32_t vector)
+{
+    ti_irq_slot_t* s = irq_initialized ? ti_irq_find(vector) : NULL;
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // Interrupt_disable()依TRM程序清除PIEIER並處理已鎖存的旗標
+    Interrupt_disable(vector);
+    s->enabled = false;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_irq_trigger(uint32_t vector)
+{
+    ti_irq_slot_t* s = irq_initialized ? ti_irq_find(vector) : NULL;
+
+    if (s == NULL) {
+        return HAL_INVALID_PARAM;
+    }
+
+    // INT13/INT14沒有PIE旗標可設置
+    if (s->pie_bit == 0U) {
+        return HAL_ERROR;
+    }
+
+    // 設置PIEIFR旗標以軟體觸發中斷 (PIEIFRx緊接在PIEIERx之後)
+    HWREGH(s->pieier_reg + 1U) |= s->pie_bit;
+
+    return HAL_OK;
+}
+
+uint16_t hal_irq_current_priority(void)
+{
+    return irq_current_priority;
+}
+
+uint16_t ti_c2000_irq_load_id(uint32_t vector)
+{
+    uint16_t id = TI_IRQ_VECTOR_ID(vector);
+
+    if (!irq_initialized || id >= TI_IRQ_VECTOR_COUNT || irq_slot_map[id] == TI_IRQ_SLOT_NONE) {
+        return HAL_CPU_LOAD_MAX_ISRS;
+    }
+
+    return irq_slot_map[id];
+}
+
+/* ========================================================================== */
+/*                             延遲量測                                        */
+/* ========================================================================== */
+
+#if TI_C2000_IRQ_LATENCY_PROBE
+uint32_t ti_c2000_irq_latency_max(void)
+{
+    return irq_latency_max;
+}
+
+uint32_t ti_c2000_irq_latency_last(void)
+{
+    return irq_latency_last;
+}
+
+void ti_c2000_irq_latency_reset(void)
+{
+    irq_latency_max = 0;
+}
+#endif
+
+#endif /* PLATFORM_TI_C2000 */
@@ -0,0 +1,91 @@
+/**
+ * @file ti_c2000_profiler.c
+ * @brief TI C2000系列分析器取樣計時器實現 (CPU Timer1)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * CPU Timer1直接連接CPU INT13，不經過PIE，也不需要確認。
+ * 進入中斷時CPU自動保存的上下文最後一項為被中斷的PC，
+ * 入口以組合語言在任何暫存器被C程式碼改動前取出，再跳到C中斷服務程式。
+ * INTM為1的程式區段 (未巢狀的中斷服務程式、臨界區) 會被計入其後第一個可中斷的位置；
+ * 經hal_irq登記的中斷在TI_C2000_IRQ_IER_ALWAYS包含INT13時可被取樣。
+ */
+
+#include "../include/hal_profiler.h"
+#include "ti_c2000_config.h"
+#include "ti_c2000_common.h"
+
+#ifdef PLATFORM_TI_C2000
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// INT13在IER中的位元
+#define TI_PROFILER_IER_BIT     0x1000U
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+// 入口保存的被中斷PC (組合語言以DP直接定址寫入，32位元變數不會跨DP頁)
+volatile uint32_t ti_c2000_profiler_pc;
+
+__interrupt void ti_c2000_profiler_isr(void);
+void ti_c2000_profiler_entry(void);
+
+/*
+ * 中斷入口: 自動上下文保存的順序為T:ST0、AH:AL、PH:PL、AR1:AR0、DP:ST1、
+ * DBGSTAT:IER、PC，此時PC位於*-SP[2]。ACC與DP已由硬體保存，
+ * IRET時恢復，可直接使用後跳到C中斷服務程式 (由它保存其餘暫存器並IRET)。
+ */
+__asm("        .sect   \".text\"\n"
+      "        .global ti_c2000_profiler_entry\n"
+      "ti_c2000_profiler_entry:\n"
+      "        MOVL    ACC, *-SP[2]\n"
+      "        MOVW    DP, #ti_c2000_profiler_pc\n"
+      "        MOVL    @ti_c2000_profiler_pc, ACC\n"
+      "        LB      ti_c2000_profiler_isr\n");
+
+__interrupt void ti_c2000_profiler_isr(void)
+{
+    hal_profiler_sample(ti_c2000_profiler_pc);
+}
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+hal_status_t hal_profiler_port_start(uint32_t sample_hz)
+{
+    uint32_t period = ((uint32_t)CPU_FREQ_MHZ * 1000000UL) / sample_hz;
+
+    if (period < 2U) {
+        return HAL_ERROR;
+    }
+
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TIMER1);
+
+    // 停止並以SYSCLK計數 (不預除頻)
+    HWREGH(CPUTIMER1_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TSS;
+    HWREG(CPUTIMER1_BASE + CPUTIMER_O_PRD) = period - 1UL;
+    HWREGH(CPUTIMER1_BASE + CPUTIMER_O_TPR) = 0U;
+    HWREGH(CPUTIMER1_BASE + CPUTIMER_O_TPRH) = 0U;
+
+    Interrupt_register(INT_TIMER1, &ti_c2000_profiler_entry);
+    IER |= TI_PROFILER_IER_BIT;
+
+    // 重新載入、清除旗標、致能中斷並啟動 (TSS = 0)
+    HWREGH(CPUTIMER1_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TRB | CPUTIMER_TCR_TIF |
+                                              CPUTIMER_TCR_TIE;
+
+    return HAL_OK;
+}
+
+void hal_profiler_port_stop(void)
+{
+    HWREGH(CPUTIMER1_BASE + CPUTIMER_O_TCR) = CPUTIMER_TCR_TSS | CPUTIMER_TCR_TIF;
+    IER &= (uint16_t)~TI_PROFILER_IER_BIT;
+}
+
+#endif /* PLATFORM_TI_C2000 */
@@ -22,6 +22,9 @@ static volatile uint32_t system_tick_counter = 0;
 
 hal_status_t hal_init(void)
 {
+    // 填色堆疊以量測使用量
+    hal_stack_paint();
+    
     // 初始化系統時鐘
     ti_c2000_init_system_clock();
     
@@ -68,6 +71,12 @@ uint32_t hal_get_tick(void)
     return system_tick_counter;
 }
 
+uint32_t hal_get_cycle_count(void)
+{
+    // CPU Timer2向下計數，反轉後為遞增的週期數
+    return ~CPUTimer_getTimerCount(CPUTIMER2_BASE);
+}
+
 void hal_system_reset(void)
 {
     SysCtl_resetDevice();
@@ -112,6 +121,13 @@ void ti_c2000_init_peripheral_clocks(void)
     SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TIMER1);
     SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TIMER2);
     
+    // CPU Timer2以SYSCLK自由運行，作為週期計數器
+    CPUTimer_stopTimer(CPUTIMER2_BASE);
+    CPUTimer_setPeriod(CPUTIMER2_BASE, 0xFFFFFFFFUL);
+    CPUTimer_setPreScaler(CPUTIMER2_BASE, 0U);
+    CPUTimer_reloadTimerCounter(CPUTIMER2_BASE);
+    CPUTimer_startTimer(CPUTIMER2_BASE);
+    
     // GPIO時鐘通常在系統啟動時已經使能
     // 其他週邊時鐘根據需要在各自的初始化函式中使能
 }
@@ -159,6 +175,14 @@ __interrupt void cpu_timer0_isr(void)
 {
     system_tick_counter++;
     
+    // 驅動軟體計時器服務
+    hal_timer_tick();
+    
+#if HAL_STACK_TICK_CHECK
+    // 檢查堆疊溢位哨兵
+    (void)hal_stack_check();
+#endif
+    
     // 確認中斷
     Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
 }
@@ -6,6 +6,9 @@
  */
 
 #include "../include/hal_uart.h"
+#include "../include/hal_timer.h"
+#include "../include/hal_port.h"
+#include "../include/hal.h"
 #include "ti_c2000_common.h"
 
 #ifdef PLATFORM_TI_C2000
@@ -23,12 +26,56 @@ static const uint32_t uart_bases[] = {
 #endif
 };
 
+#define TI_UART_COUNT   (sizeof(uart_bases)/sizeof(uart_bases[0]))
+
+// 各UART目前的波特率設定
+static hal_uart_baud_result_t uart_baud_info[TI_UART_COUNT];
+
+// 各UART的效能與錯誤統計
+static hal_stats_t uart_stats[TI_UART_COUNT];
+
+// 訊框接收時的RX FIFO中斷觸發深度
+#define TI_UART_FRAME_FIFO_LEVEL    SCI_FIFO_RX8
+
+/**
+ * @brief 訊框接收狀態
+ * SCI沒有接收超時與字元比對硬體：FIFO達到深度時由中斷取出資料，
+ * 剩餘資料與線路閒置由每tick執行的計時器檢查。
+ */
+typedef struct {
+    uint8_t* buffer;                /**< 訊框接收緩衝區 */
+    uint16_t* length;               /**< 訊框長度輸出 */
+    hal_callback_t callback;        /**< 訊框結束回呼 */
+    void* context;                  /**< 回呼函式參數 */
+    uint16_t max;                   /**< 訊框緩衝區大小 */
+    uint16_t count;                 /**< 已接收長度 */
+    int16_t match;                  /**< 訊框結束字元 */
+    uint16_t idle_bits;             /**< 閒置判定位元時間 */
+    uint32_t last_rx_tick;          /**< 最後收到資料的tick */
+    volatile bool armed;            /**< 有等待中的訊框 */
+} ti_uart_frame_t;
+
+static ti_uart_frame_t uart_frames[TI_UART_COUNT];
+static hal_timer_t uart_frame_timer;
+static bool uart_frame_timer_ready = false;
+
 /* ========================================================================== */
 /*                             內部函式聲明                                    */
 /* ========================================================================== */
 
 static hal_status_t ti_uart_config_gpio(hal_uart_id_t uart_id);
 static uint32_t ti_uart_get_base(hal_uart_id_t uart_id);
+static uint8_t ti_uart_read_rx(hal_uart_id_t uart_id, uint32_t uart_base);
+static void ti_uart_check_overflow(hal_uart_id_t uart_id, uint32_t uart_base);
+static bool ti_uart_frame_drain(hal_uart_id_t uart_id, uint32_t uart_base);
+static void ti_uart_frame_finish(hal_uart_id_t uart_id, uint32_t uart_base);
+static void ti_uart_frame_rx_isr(hal_uart_id_t uart_id, uint16_t ack_group);
+static void ti_uart_frame_poll(hal_timer_t* timer, void* context);
+static __interrupt void ti_uart_rxa_isr(void);
+static __interrupt void ti_uart_rxb_isr(void);
+#ifdef TI_UART_C
+static __interrupt void ti_uart_rxc_isr(void);
+#endif
 
 /* ========================================================================== */
 /*                             UART介面實現                                   */
@@ -45,6 +92,12 @@ hal_status_t hal_uart_init(hal_uart_id_t uart_id, const hal_uart_config_t* confi
         return HAL_INVALID_PARAM;
     }
     
+    // 計算最接近的波特率除頻值
+    hal_uart_baud_result_t baud;
+    if (hal_uart_calc_sci_divisor(DEVICE_LSPCLK_FREQ, config->baudrate, &baud) != HAL_OK) {
+        return HAL_INVALID_PARAM;
+    }
+    
     // 配置GPIO引腳
     hal_status_t status = ti_uart_config_gpio(uart_id);
     if (status != HAL_OK) {
@@ -69,9 +122,6 @@ hal_status_t hal_uart_init(hal_uart_id_t uart_id, const hal_uart_config_t* confi
     // 配置UART參數
     SCI_disableModule(uart_base);
     
-    // 設置波特率
-    SCI_setBaud(uart_base, DEVICE_LSPCLK_FREQ, config->baudrate);
-    
     // 設置資料格式
     uint16_t config_reg = 0;
     
@@ -111,6 +161,16 @@ hal_status_t hal_uart_init(hal_uart_id_t uart_id, const hal_uart_config_t* confi
     
     SCI_setConfig(uart_base, DEVICE_LSPCLK_FREQ, config->baudrate, config_reg);
     
+    // SCI_setConfig以截斷計算BRR，改寫為四捨五入的結果 (高波特率時誤差較小)
+    HWREGH(uart_base + SCI_O_HBAUD) = (uint16_t)(baud.divisor >> 8);
+    HWREGH(uart_base + SCI_O_LBAUD) = (uint16_t)(baud.divisor & 0xFFU);
+    uart_baud_info[uart_id] = baud;
+    
+    // 訊框接收預設值
+    uart_frames[uart_id].armed = false;
+    uart_frames[uart_id].idle_bits = HAL_UART_FRAME_IDLE_BITS;
+    uart_frames[uart_id].match = HAL_UART_FRAME_NO_MATCH;
+    
     // 使能FIFO
     SCI_enableFIFO(uart_base);
     SCI_enableModule(uart_base);
@@ -130,7 +190,9 @@ hal_status_t hal_uart_deinit(hal_uart_id_t uart_id)
         return HAL_INVALID_PARAM;
     }
     
-    // 禁用SCI模組
+    // 停止訊框接收並禁用SCI模組
+    SCI_disableInterrupt(uart_base, SCI_INT_RXFF);
+    uart_frames[uart_id].armed = false;
     SCI_disableModule(uart_base);
     
     // 禁用SCI模組時鐘
@@ -163,21 +225,41 @@ hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data,
         return HAL_INVALID_PARAM;
     }
     
+    hal_stats_t* stats = &uart_stats[uart_id];
+    uint32_t block_start = HAL_STATS_BLOCK_BEGIN();
     uint32_t start_tick = hal_get_tick();
+    uint16_t sent = 0;
     
-    uint16_t i;
-    for (i = 0; i < size; i++) {
-        // 等待發送緩衝區空
-        while (!SCI_isTransmitterEmpty(uart_base)) {
+    while (sent < size) {
+        // 依FIFO剩餘空間一次寫入多個位元組，移位暫存器不會出現空檔
+        uint16_t space = (uint16_t)SCI_FIFO_TX16 - (uint16_t)SCI_getTxFIFOStatus(uart_base);
+        
+        if (space == 0) {
             if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+                HAL_STATS_ADD(stats, tx_bytes, sent);
+                HAL_STATS_INC(stats, timeouts);
+                HAL_STATS_BLOCK_END(stats, block_start);
                 return HAL_TIMEOUT;
             }
+            continue;
         }
         
-        // 發送資料
-        SCI_writeCharBlockingFIFO(uart_base, data[i]);
+        if (space > (uint16_t)(size - sent)) {
+            space = size - sent;
+        }
+        
+        // 已確認FIFO空間，直接寫入TXBUF
+        while (space > 0) {
+            HWREGH(uart_base + SCI_O_TXBUF) = (uint16_t)data[sent];
+            sent++;
+            space--;
+        }
     }
     
+    HAL_STATS_ADD(stats, tx_bytes, size);
+    HAL_STATS_INC(stats, transfers);
+    HAL_STATS_BLOCK_END(stats, block_start);
+    
     return HAL_OK;
 }
 
@@ -193,21 +275,40 @@ hal_status_t hal_uart_receive(hal_uart_id_t uart_id, uint8_t* data,
         return HAL_INVALID_PARAM;
     }
     
+    hal_stats_t* stats = &uart_stats[uart_id];
+    uint32_t block_start = HAL_STATS_BLOCK_BEGIN();
     uint32_t start_tick = hal_get_tick();
+    uint16_t received = 0;
     
-    uint16_t i;
-    for (i = 0; i < size; i++) {
-        // 等待接收資料
-        while (!SCI_isDataAvailableNonFIFO(uart_base)) {
+    while (received < size) {
+        // 依FIFO中的資料數一次讀取多個位元組
+        uint16_t level = (uint16_t)SCI_getRxFIFOStatus(uart_base);
+        
+        if (level == 0) {
             if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+                ti_uart_check_overflow(uart_id, uart_base);
+                HAL_STATS_INC(stats, timeouts);
+                HAL_STATS_BLOCK_END(stats, block_start);
                 return HAL_TIMEOUT;
             }
+            continue;
+        }
+        
+        if (level > (uint16_t)(size - received)) {
+            level = size - received;
         }
         
-        // 讀取資料
-        data[i] = SCI_readCharBlockingFIFO(uart_base);
+        while (level > 0) {
+            data[received] = ti_uart_read_rx(uart_id, uart_base);
+            received++;
+            level--;
+        }
     }
     
+    ti_uart_check_overflow(uart_id, uart_base);
+    HAL_STATS_INC(stats, transfers);
+    HAL_STATS_BLOCK_END(stats, block_start);
+    
     return HAL_OK;
 }
 
@@ -221,6 +322,64 @@ hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeo
     return hal_uart_receive(uart_id, ch, 1, timeout);
 }
 
+hal_status_t hal_uart_get_baud_info(hal_uart_id_t uart_id, hal_uart_baud_result_t* result)
+{
+    if (result == NULL || uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    *result = uart_baud_info[uart_id];
+    
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_autobaud(hal_uart_id_t uart_id, uint32_t timeout, uint32_t* baudrate)
+{
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    uint32_t uart_base = ti_uart_get_base(uart_id);
+    if (uart_base == 0) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    uint32_t start_tick = hal_get_tick();
+    
+    // 以最高速率開始偵測，由硬體調整BRR直到收到'A'/'a'
+    HWREGH(uart_base + SCI_O_HBAUD) = 0U;
+    HWREGH(uart_base + SCI_O_LBAUD) = 1U;
+    HWREGH(uart_base + SCI_O_FFCT) |= SCI_FFCT_CDC | SCI_FFCT_ABDCLR;
+    
+    while ((HWREGH(uart_base + SCI_O_FFCT) & SCI_FFCT_ABD) != SCI_FFCT_ABD) {
+        if (timeout != 0 && (hal_get_tick() - start_tick) > timeout) {
+            HWREGH(uart_base + SCI_O_FFCT) &= ~SCI_FFCT_CDC;
+            return HAL_TIMEOUT;
+        }
+    }
+    
+    HWREGH(uart_base + SCI_O_FFCT) |= SCI_FFCT_ABDCLR;
+    HWREGH(uart_base + SCI_O_FFCT) &= ~SCI_FFCT_CDC;
+    
+    // 由鎖定的BRR計算實際波特率
+    hal_uart_baud_result_t* info = &uart_baud_info[uart_id];
+    info->divisor = ((uint32_t)HWREGH(uart_base + SCI_O_HBAUD) << 8) |
+                    (HWREGH(uart_base + SCI_O_LBAUD) & 0xFFU);
+    info->prescaler = 0;
+    info->over8 = false;
+    info->actual_baudrate = DEVICE_LSPCLK_FREQ / (((info->divisor < 1UL) ? 2UL : (info->divisor + 1UL)) * 8UL);
+    info->error_ppm = 0;
+    
+    // 捨棄同步字元
+    (void)hal_uart_flush_rx(uart_id);
+    
+    if (baudrate != NULL) {
+        *baudrate = info->actual_baudrate;
+    }
+    
+    return HAL_OK;
+}
+
 bool hal_uart_is_busy(hal_uart_id_t uart_id)
 {
     if (uart_id >= (sizeof(uart_bases)/sizeof(uart_bases[0]))) {
@@ -232,8 +391,9 @@ bool hal_uart_is_busy(hal_uart_id_t uart_id)
         return false;
     }
     
-    // 檢查發送和接收是否忙碌
-    return (!SCI_isTransmitterEmpty(uart_base));
+    // FIFO中仍有資料或移位暫存器仍在發送
+    return (SCI_getTxFIFOStatus(uart_base) != SCI_FIFO_TX0) ||
+           (!SCI_isTransmitterEmpty(uart_base));
 }
 
 bool hal_uart_data_available(hal_uart_id_t uart_id)
@@ -247,7 +407,7 @@ bool hal_uart_data_available(hal_uart_id_t uart_id)
         return false;
     }
     
-    return SCI_isDataAvailableNonFIFO(uart_base);
+    return (SCI_getRxFIFOStatus(uart_base) != SCI_FIFO_RX0);
 }
 
 hal_status_t hal_uart_flush_rx(hal_uart_id_t uart_id)
@@ -262,8 +422,8 @@ hal_status_t hal_uart_flush_rx(hal_uart_id_t uart_id)
     }
     
     // 讀取所有待處理的接收資料
-    while (SCI_isDataAvailableNonFIFO(uart_base)) {
-        volatile uint16_t dummy = SCI_readCharBlockingFIFO(uart_base);
+    while (SCI_getRxFIFOStatus(uart_base) != SCI_FIFO_RX0) {
+        volatile uint16_t dummy = HWREGH(uart_base + SCI_O_RXBUF);
         (void)dummy;  // 避免編譯器警告
     }
     
@@ -281,14 +441,175 @@ hal_status_t hal_uart_flush_tx(hal_uart_id_t uart_id)
         return HAL_INVALID_PARAM;
     }
     
-    // 等待發送完成
-    while (!SCI_isTransmitterEmpty(uart_base)) {
+    // 等待FIFO與移位暫存器皆發送完成
+    while ((SCI_getTxFIFOStatus(uart_base) != SCI_FIFO_TX0) ||
+           (!SCI_isTransmitterEmpty(uart_base))) {
         // 等待發送緩衝區空
     }
     
     return HAL_OK;
 }
 
+hal_status_t hal_uart_config_frame(hal_uart_id_t uart_id, uint16_t idle_bits, int16_t match_char)
+{
+    if (uart_id >= TI_UART_COUNT || match_char > 0xFF || match_char < HAL_UART_FRAME_NO_MATCH) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    ti_uart_frame_t* frame = &uart_frames[uart_id];
+    if (frame->armed) {
+        return HAL_BUSY;
+    }
+    
+    // 結束字元由軟體比對
+    frame->idle_bits = (idle_bits != 0U) ? idle_bits : HAL_UART_FRAME_IDLE_BITS;
+    frame->match = match_char;
+    
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_receive_frame(hal_uart_id_t uart_id, uint8_t* buffer, uint16_t max_size,
+                                    uint16_t* length, hal_callback_t callback, void* context)
+{
+    if (buffer == NULL || max_size == 0 || length == NULL || uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    uint32_t uart_base = ti_uart_get_base(uart_id);
+    if (uart_base == 0) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    ti_uart_frame_t* frame = &uart_frames[uart_id];
+    
+    // 首次使用時啟動閒置檢查計時器，之後持續執行 (回呼中重新啟動時不需操作計時輪)
+    if (!uart_frame_timer_ready) {
+        (void)hal_timer_setup(&uart_frame_timer, ti_uart_frame_poll, NULL);
+        (void)hal_timer_start(&uart_frame_timer, 1, 1);
+        uart_frame_timer_ready = true;
+    }
+    
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+    
+    if (frame->armed) {
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        return HAL_BUSY;
+    }
+    
+    frame->buffer = buffer;
+    frame->max = max_size;
+    frame->length = length;
+    frame->callback = callback;
+    frame->context = context;
+    frame->count = 0;
+    frame->last_rx_tick = hal_get_tick();
+    frame->armed = true;
+    
+    SCI_setFIFOInterruptLevel(uart_base, SCI_FIFO_TX0, TI_UART_FRAME_FIFO_LEVEL);
+    SCI_clearInterruptStatus(uart_base, SCI_INT_RXFF);
+    SCI_enableInterrupt(uart_base, SCI_INT_RXFF);
+    
+    HAL_PORT_IRQ_RESTORE(irq_state);
+    
+    switch (uart_id) {
+        case TI_UART_A:
+            Interrupt_register(INT_SCIA_RX, &ti_uart_rxa_isr);
+            Interrupt_enable(INT_SCIA_RX);
+            break;
+        case TI_UART_B:
+            Interrupt_register(INT_SCIB_RX, &ti_uart_rxb_isr);
+            Interrupt_enable(INT_SCIB_RX);
+            break;
+#ifdef TI_UART_C
+        case TI_UART_C:
+            Interrupt_register(INT_SCIC_RX, &ti_uart_rxc_isr);
+            Interrupt_enable(INT_SCIC_RX);
+            break;
+#endif
+    }
+    
+    return HAL_OK;
+}
+
+bool hal_uart_frame_pending(hal_uart_id_t uart_id)
+{
+    if (uart_id >= TI_UART_COUNT) {
+        return false;
+    }
+    
+    return uart_frames[uart_id].armed;
+}
+
+hal_status_t hal_uart_abort_frame(hal_uart_id_t uart_id)
+{
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    uint32_t uart_base = ti_uart_get_base(uart_id);
+    if (uart_base == 0) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    SCI_disableInterrupt(uart_base, SCI_INT_RXFF);
+    uart_frames[uart_id].armed = false;
+    
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_get_stats(hal_uart_id_t uart_id, hal_stats_t* stats)
+{
+    if (stats == NULL || uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+#if HAL_STATS_ENABLE
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+    *stats = uart_stats[uart_id];
+    HAL_PORT_IRQ_RESTORE(irq_state);
+    
+    return HAL_OK;
+#else
+    return HAL_ERROR;
+#endif
+}
+
+hal_status_t hal_uart_reset_stats(hal_uart_id_t uart_id)
+{
+    static const hal_stats_t zero = { 0 };
+    
+    if (uart_id >= TI_UART_COUNT) {
+        return HAL_INVALID_PARAM;
+    }
+    
+    hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+    uart_stats[uart_id] = zero;
+    HAL_PORT_IRQ_RESTORE(irq_state);
+    
+    return HAL_OK;
+}
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+static __interrupt void ti_uart_rxa_isr(void)
+{
+    ti_uart_frame_rx_isr(TI_UART_A, INTERRUPT_ACK_GROUP9);
+}
+
+static __interrupt void ti_uart_rxb_isr(void)
+{
+    ti_uart_frame_rx_isr(TI_UART_B, INTERRUPT_ACK_GROUP9);
+}
+
+#ifdef TI_UART_C
+static __interrupt void ti_uart_rxc_isr(void)
+{
+    ti_uart_frame_rx_isr(TI_UART_C, INTERRUPT_ACK_GROUP8);
+}
+#endif
+
 /* ========================================================================== */
 /*                             內部函式實現                                    */
 /* ========================================================================== */
@@ -332,4 +653,138 @@ static uint32_t ti_uart_get_base(hal_uart_id_t uart_id)
     return uart_bases[uart_id];
 }
 
+/**
+ * @brief 讀取一個接收字元並統計FIFO附帶的錯誤旗標
+ */
+static uint8_t ti_uart_read_rx(hal_uart_id_t uart_id, uint32_t uart_base)
+{
+    uint16_t rx = HWREGH(uart_base + SCI_O_RXBUF);
+    hal_stats_t* stats = &uart_stats[uart_id];
+    
+    HAL_STATS_INC(stats, rx_bytes);
+    HAL_STATS_COUNT_IF(stats, framing_errors, (rx & SCI_RXBUF_SCIFFFE) != 0U);
+    HAL_STATS_COUNT_IF(stats, parity_errors, (rx & SCI_RXBUF_SCIFFPE) != 0U);
+    
+    return (uint8_t)(rx & SCI_RXBUF_SAR_M);
+}
+
+/**
+ * @brief 統計並清除RX FIFO溢位
+ */
+static void ti_uart_check_overflow(hal_uart_id_t uart_id, uint32_t uart_base)
+{
+    if (SCI_getOverflowStatus(uart_base)) {
+        HAL_STATS_INC(&uart_stats[uart_id], overruns);
+        SCI_clearOverflowStatus(uart_base);
+    }
+}
+
+/**
+ * @brief 將RX FIFO中的資料搬到訊框 (需在中斷關閉時呼叫)
+ * @return true 訊框已結束 (結束字元或緩衝區已滿)
+ */
+static bool ti_uart_frame_drain(hal_uart_id_t uart_id, uint32_t uart_base)
+{
+    ti_uart_frame_t* frame = &uart_frames[uart_id];
+    uint16_t level = (uint16_t)SCI_getRxFIFOStatus(uart_base);
+    
+    if (level != 0U) {
+        frame->last_rx_tick = hal_get_tick();
+    }
+    
+    while (level > 0U) {
+        uint8_t data = ti_uart_read_rx(uart_id, uart_base);
+        
+        frame->buffer[frame->count] = data;
+        frame->count++;
+        level--;
+        
+        // 結束後剩餘的資料留在FIFO給下一個訊框
+        if ((frame->match != HAL_UART_FRAME_NO_MATCH && data == (uint8_t)frame->match) ||
+            frame->count >= frame->max) {
+            return true;
+        }
+    }
+    
+    return false;
+}
+
+/**
+ * @brief 結束訊框 (需在中斷關閉時呼叫，回呼由呼叫者執行)
+ */
+static void ti_uart_frame_finish(hal_uart_id_t uart_id, uint32_t uart_base)
+{
+    ti_uart_frame_t* frame = &uart_frames[uart_id];
+    
+    SCI_disableInterrupt(uart_base, SCI_INT_RXFF);
+    *frame->length = frame->count;
+    frame->armed = false;
+    HAL_STATS_INC(&uart_stats[uart_id], transfers);
+}
+
+/**
+ * @brief SCI RX FIFO中斷共用處理
+ */
+static void ti_uart_frame_rx_isr(hal_uart_id_t uart_id, uint16_t ack_group)
+{
+    uint32_t uart_base = uart_bases[uart_id];
+    ti_uart_frame_t* frame = &uart_frames[uart_id];
+    
+    if (frame->armed && ti_uart_frame_drain(uart_id, uart_base)) {
+        ti_uart_frame_finish(uart_id, uart_base);
+        if (frame->callback != NULL) {
+            frame->callback(frame->context);
+        }
+    }
+    
+    ti_uart_check_overflow(uart_id, uart_base);
+    SCI_clearInterruptStatus(uart_base, SCI_INT_RXFF);
+    Interrupt_clearACKGroup(ack_group);
+}
+
+/**
+ * @brief 每tick檢查未達FIFO深度的資料與線路閒置
+ */
+static void ti_uart_frame_poll(hal_timer_t* timer, void* context)
+{
+    hal_uart_id_t uart_id;
+    
+    (void)timer;
+    (void)context;
+    
+    for (uart_id = 0; uart_id < TI_UART_COUNT; uart_id++) {
+        ti_uart_frame_t* frame = &uart_frames[uart_id];
+        uint32_t uart_base = uart_bases[uart_id];
+        bool done = false;
+        
+        if (!frame->armed) {
+            continue;
+        }
+        
+        hal_port_irq_state_t irq_state = HAL_PORT_IRQ_SAVE();
+        
+        if (frame->armed) {
+            // 閒置時間換算為tick，無條件進位後再加一個tick的量測誤差
+            uint32_t baud = uart_baud_info[uart_id].actual_baudrate;
+            uint32_t idle_ticks = (baud != 0U) ?
+                ((((uint32_t)frame->idle_bits * 1000UL) + baud - 1UL) / baud + 1UL) : 2UL;
+            
+            done = ti_uart_frame_drain(uart_id, uart_base);
+            if (!done && frame->count > 0U &&
+                (hal_get_tick() - frame->last_rx_tick) >= idle_ticks) {
+                done = true;
+            }
+            if (done) {
+                ti_uart_frame_finish(uart_id, uart_base);
+            }
+        }
+        
+        HAL_PORT_IRQ_RESTORE(irq_state);
+        
+        if (done && frame->callback != NULL) {
+            frame->callback(frame->context);
+        }
+    }
+}
+
 #endif /* PLATFORM_TI_C2000 */
@@ -0,0 +1,66 @@
+/**
+ * @file ti_c2000_work.c
+ * @brief TI C2000系列工作佇列軟體中斷實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "../include/hal_work.h"
+#include "ti_c2000_config.h"
+#include "ti_c2000_common.h"
+
+#if defined(PLATFORM_TI_C2000) && HAL_WORK_USE_SWI
+
+/* ========================================================================== */
+/*                             內部定義                                        */
+/* ========================================================================== */
+
+// DriverLib中斷編號: bit15-8為PIE群組，bit7-0為群組內通道
+#define TI_WORK_SWI_GROUP       ((uint16_t)((TI_C2000_WORK_SWI_INT & 0xFF00U) >> 8U))
+#define TI_WORK_SWI_CHANNEL     ((uint16_t)(TI_C2000_WORK_SWI_INT & 0xFFU))
+#define TI_WORK_SWI_GROUP_MASK  ((uint16_t)(1U << (TI_WORK_SWI_GROUP - 1U)))
+#define TI_WORK_SWI_CH_MASK     ((uint16_t)(1U << (TI_WORK_SWI_CHANNEL - 1U)))
+
+/* ========================================================================== */
+/*                             中斷服務程式                                    */
+/* ========================================================================== */
+
+/**
+ * @brief 工作佇列軟體中斷
+ * 確認PIE後重新開啟中斷，執行工作期間其他PIE群組仍可搶占
+ */
+static __interrupt void ti_c2000_work_swi_isr(void)
+{
+    uint16_t saved_ier = IER;
+
+    // 遮罩自身群組避免重入
+    IER &= (uint16_t)~TI_WORK_SWI_GROUP_MASK;
+    Interrupt_clearACKGroup(TI_WORK_SWI_GROUP_MASK);
+    EINT;
+
+    (void)hal_work_drain(0);
+
+    DINT;
+    IER = saved_ier;
+}
+
+/* ========================================================================== */
+/*                             平台移植介面實現                                */
+/* ========================================================================== */
+
+void hal_work_port_init(void)
+{
+    Interrupt_register(TI_C2000_WORK_SWI_INT, &ti_c2000_work_swi_isr);
+
+    // 使能PIE通道與CPU中斷群組
+    HWREGH(PIECTRL_BASE + PIE_O_IER1 + ((TI_WORK_SWI_GROUP - 1U) * 2U)) |= TI_WORK_SWI_CH_MASK;
+    IER |= TI_WORK_SWI_GROUP_MASK;
+}
+
+void hal_work_port_trigger(void)
+{
+    // 設置PIEIFR旗標以軟體觸發中斷
+    HWREGH(PIECTRL_BASE + PIE_O_IFR1 + ((TI_WORK_SWI_GROUP - 1U) * 2U)) |= TI_WORK_SWI_CH_MASK;
+}
+
+#endif /* PLATFORM_TI_C2000 && HAL_WORK_USE_SWI */
@@ -0,0 +1,128 @@
+/**
+ * @file bench_debounce.c
+ * @brief 位元平行消抖效能量測 (與逐腳位讀取加計數器比較)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以128個輸入 (4個埠) 量測每次取樣的時間。逐腳位版本模擬應用程式
+ * 每個腳位呼叫一次讀取函式並各自計數的作法。
+ * 數值為主機端結果；目標平台上逐腳位版本還要加上每次hal_gpio_read()的
+ * 驅動呼叫成本，實際差距需在實機量測。
+ */
+
+#include "hal_debounce.h"
+#include "hal_gpio.h"
+#include "test_common.h"
+
+#define BENCH_WORDS             4U
+#define BENCH_PINS              (BENCH_WORDS * 32U)
+#define BENCH_SAMPLES           2000000UL
+
+/* ========================================================================== */
+/*                             GPIO替身                                        */
+/* ========================================================================== */
+
+static volatile uint32_t host_ports[BENCH_WORDS];
+
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    return host_ports[port];
+}
+
+/** 逐腳位讀取 (不內聯，模擬一次驅動呼叫) */
+__attribute__((noinline)) static uint8_t read_pin(uint16_t pin)
+{
+    return (uint8_t)((host_ports[pin >> 5] >> (pin & 31U)) & 1U);
+}
+
+/* ========================================================================== */
+/*                             逐腳位消抖                                      */
+/* ========================================================================== */
+
+typedef struct {
+    uint8_t state;
+    uint8_t count;
+} pin_debounce_t;
+
+static pin_debounce_t pins[BENCH_PINS];
+
+static uint32_t per_pin_sample(void)
+{
+    uint32_t toggles = 0;
+    uint16_t i;
+
+    for (i = 0; i < BENCH_PINS; i++) {
+        pin_debounce_t* p = &pins[i];
+        uint8_t raw = read_pin(i);
+
+        if (raw == p->state) {
+            p->count = 3U;
+        } else if (p->count > 0U) {
+            p->count--;
+        } else {
+            p->state = raw;
+            p->count = 3U;
+            toggles++;
+        }
+    }
+
+    return toggles;
+}
+
+/* ========================================================================== */
+/*                             量測                                            */
+/* ========================================================================== */
+
+static uint32_t pattern[256][BENCH_WORDS];
+
+int main(void)
+{
+    HAL_DEBOUNCE_DEFINE(deb, 0, 1, 2, 3);
+    uint32_t seed = 0xB0B0CAFEUL;
+    uint32_t toggles = 0;
+    uint64_t start_ns;
+    uint64_t vertical_ns;
+    uint64_t per_pin_ns;
+    uint32_t t;
+    uint32_t i;
+
+    // 預先產生的彈跳輸入: 約1/8的位元在每次取樣時改變
+    for (t = 0; t < 256U; t++) {
+        for (i = 0; i < BENCH_WORDS; i++) {
+            pattern[t][i] = test_random(&seed) & test_random(&seed) & test_random(&seed);
+        }
+    }
+
+    (void)hal_debounce_init(&deb);
+    start_ns = test_time_ns();
+    for (t = 0; t < BENCH_SAMPLES; t++) {
+        for (i = 0; i < BENCH_WORDS; i++) {
+            host_ports[i] = pattern[t & 255U][i];
+        }
+        if (hal_debounce_sample(&deb)) {
+            toggles++;
+        }
+    }
+    vertical_ns = test_time_ns() - start_ns;
+
+    for (i = 0; i < BENCH_PINS; i++) {
+        pins[i].state = 0;
+        pins[i].count = 3U;
+    }
+    start_ns = test_time_ns();
+    for (t = 0; t < BENCH_SAMPLES; t++) {
+        for (i = 0; i < BENCH_WORDS; i++) {
+            host_ports[i] = pattern[t & 255U][i];
+        }
+        toggles += per_pin_sample();
+    }
+    per_pin_ns = test_time_ns() - start_ns;
+
+    printf("%u 個輸入，%lu 次取樣 (翻轉計數 %u)\n", BENCH_PINS, BENCH_SAMPLES, toggles);
+    printf("位元平行 (hal_debounce_sample) %8.1f ns/取樣\n",
+           (double)vertical_ns / (double)BENCH_SAMPLES);
+    printf("逐腳位讀取與計數               %8.1f ns/取樣\n",
+           (double)per_pin_ns / (double)BENCH_SAMPLES);
+
+    return 0;
+}
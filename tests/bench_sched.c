@@ -0,0 +1,144 @@
+/**
+ * @file bench_sched.c
+ * @brief 協作式排程器效能量測 (事件發送到派送的延遲)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 延遲定義為hal_sched_post()之前到事件處理函式第一行的時間，
+ * 包含位元圖選取最高優先權與事件出列。主機端結果只反映相對成本。
+ */
+
+#include "hal_sched.h"
+#include "test_common.h"
+
+#define BENCH_SAMPLES           200000U
+#define BENCH_EVENT_MEASURE     1U
+#define BENCH_EVENT_FILLER      2U
+
+static uint64_t dispatch_ns;
+
+static void measure_handler(hal_task_t* task, hal_sched_event_t event)
+{
+    (void)task;
+    (void)event;
+    dispatch_ns = test_time_ns();
+}
+
+static void filler_handler(hal_task_t* task, hal_sched_event_t event)
+{
+    (void)task;
+    (void)event;
+}
+
+HAL_SCHED_TASK_DEFINE(top_task, measure_handler, NULL, HAL_SCHED_MAX_PRIORITY - 1, 4);
+HAL_SCHED_TASK_DEFINE(low_task, measure_handler, NULL, 0, 4);
+
+// 其他優先權的任務 (1-30)，用來模擬所有優先權都有就緒事件的情況
+static hal_sched_event_t filler_queues[HAL_SCHED_MAX_PRIORITY - 2][4];
+static hal_task_t filler_tasks[HAL_SCHED_MAX_PRIORITY - 2];
+
+typedef struct {
+    uint64_t min;
+    uint64_t max;
+    uint64_t total;
+} latency_t;
+
+/** 連續兩次讀取時鐘的成本，從每個樣本中扣除 */
+static uint64_t clock_overhead(void)
+{
+    uint64_t best = UINT64_MAX;
+    uint32_t i;
+
+    for (i = 0; i < 1000U; i++) {
+        uint64_t a = test_time_ns();
+        uint64_t b = test_time_ns();
+        if (b - a < best) {
+            best = b - a;
+        }
+    }
+
+    return best;
+}
+
+static void measure(const char* name, hal_task_t* task, bool fill_others, uint64_t overhead)
+{
+    latency_t lat = { UINT64_MAX, 0, 0 };
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < BENCH_SAMPLES; i++) {
+        uint64_t post_ns;
+        uint64_t sample;
+
+        if (fill_others) {
+            for (j = 0; j < HAL_SCHED_MAX_PRIORITY - 2U; j++) {
+                if (filler_tasks[j].count == 0U) {
+                    (void)hal_sched_post(&filler_tasks[j], BENCH_EVENT_FILLER);
+                }
+            }
+        }
+
+        post_ns = test_time_ns();
+        (void)hal_sched_post(task, BENCH_EVENT_MEASURE);
+
+        // 派送直到量測任務執行 (最低優先權時先執行其他任務)
+        dispatch_ns = 0;
+        while (dispatch_ns == 0U) {
+            (void)hal_sched_run_once();
+        }
+
+        sample = dispatch_ns - post_ns;
+        sample = (sample > overhead) ? sample - overhead : 0U;
+        lat.total += sample;
+        if (sample < lat.min) {
+            lat.min = sample;
+        }
+        if (sample > lat.max) {
+            lat.max = sample;
+        }
+    }
+
+    // 清空剩餘事件
+    while (hal_sched_run_once()) {
+    }
+
+    printf("%-40s 最小 %5llu ns  平均 %7.1f ns  最大 %7llu ns\n", name,
+           (unsigned long long)lat.min, (double)lat.total / BENCH_SAMPLES,
+           (unsigned long long)lat.max);
+}
+
+int main(void)
+{
+    uint64_t overhead = clock_overhead();
+    uint64_t start_ns;
+    uint32_t i;
+
+    hal_sched_init();
+    (void)hal_sched_add(&top_task);
+    (void)hal_sched_add(&low_task);
+
+    for (i = 0; i < HAL_SCHED_MAX_PRIORITY - 2U; i++) {
+        filler_tasks[i].handler = filler_handler;
+        filler_tasks[i].queue = filler_queues[i];
+        filler_tasks[i].queue_size = 4;
+        filler_tasks[i].priority = (uint16_t)(i + 1U);
+        (void)hal_sched_add(&filler_tasks[i]);
+    }
+
+    printf("時鐘讀取成本 %llu ns (已扣除)\n", (unsigned long long)overhead);
+
+    measure("最高優先權，無其他就緒任務", &top_task, false, overhead);
+    measure("最高優先權，其他30個任務皆就緒", &top_task, true, overhead);
+    measure("最低優先權，無其他就緒任務", &low_task, false, overhead);
+
+    // 發送+派送的吞吐量 (不含時鐘讀取)
+    start_ns = test_time_ns();
+    for (i = 0; i < BENCH_SAMPLES; i++) {
+        (void)hal_sched_post(&filler_tasks[i % (HAL_SCHED_MAX_PRIORITY - 2U)], BENCH_EVENT_FILLER);
+        (void)hal_sched_run_once();
+    }
+    printf("hal_sched_post + hal_sched_run_once: %.1f ns/事件\n",
+           (double)(test_time_ns() - start_ns) / BENCH_SAMPLES);
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file bench_stm32g4_gpio.c
+ * @brief STM32G4 GPIO驅動每個操作的暫存器存取次數 (LL版與HAL版)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 同一程式分別連結ll/stm32g4_gpio_ll.c與stm32g4_gpio.c (HAL版，HAL_GPIO_*由
+ * model/stm32g4/stm32g4xx_hal_gpio.c依ST原始碼的存取順序提供)，
+ * 在暫存器模型上計數每個操作的GPIO/RCC讀取與寫入次數。
+ * 只計數週邊暫存器的匯流排存取，不含函式呼叫、參數檢查與迴圈的指令週期
+ * (HAL_GPIO_Init逐一掃描16個引腳位置，這部分成本在此看不到)；
+ * Cortex-M4上的實際週期數需在實機以DWT->CYCCNT量測。
+ */
+
+#include "hal_gpio.h"
+#include "stm32g4_model.h"
+#include <stdio.h>
+
+#ifndef BENCH_GPIO_BACKEND
+    #define BENCH_GPIO_BACKEND      "?"
+#endif
+
+#define PORT_C                  2U
+#define BENCH_PIN               ((hal_gpio_pin_t)((PORT_C << 8) | 6U))
+
+/* ========================================================================== */
+/*                             量測項目                                        */
+/* ========================================================================== */
+
+static void op_write(void)
+{
+    (void)hal_gpio_write(BENCH_PIN, HAL_GPIO_HIGH);
+}
+
+static void op_toggle(void)
+{
+    (void)hal_gpio_toggle(BENCH_PIN);
+}
+
+static void op_read(void)
+{
+    (void)hal_gpio_read(BENCH_PIN);
+}
+
+static void op_set_mode(void)
+{
+    (void)hal_gpio_set_mode(BENCH_PIN, HAL_GPIO_MODE_OUTPUT);
+}
+
+static void op_set_pull(void)
+{
+    (void)hal_gpio_set_pull(BENCH_PIN, HAL_GPIO_PULLUP);
+}
+
+static void op_init(void)
+{
+    hal_gpio_config_t config = { BENCH_PIN, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH };
+
+    (void)hal_gpio_init(&config);
+}
+
+static void op_deinit(void)
+{
+    (void)hal_gpio_deinit(BENCH_PIN);
+}
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "hal_gpio_write",    op_write },
+    { "hal_gpio_toggle",   op_toggle },
+    { "hal_gpio_read",     op_read },
+    { "hal_gpio_set_mode", op_set_mode },
+    { "hal_gpio_set_pull", op_set_pull },
+    { "hal_gpio_init",     op_init },
+    { "hal_gpio_deinit",   op_deinit },
+};
+
+/* ========================================================================== */
+/*                             欄位保留檢查                                    */
+/* ========================================================================== */
+
+/** set_mode後上拉是否保留、set_pull後輸出模式是否保留 */
+static void check_preserved(void)
+{
+    uint32_t pupdr;
+    uint32_t moder;
+
+    stm32g4_model_init();
+    (void)hal_gpio_set_pull(BENCH_PIN, HAL_GPIO_PULLUP);
+    (void)hal_gpio_set_mode(BENCH_PIN, HAL_GPIO_MODE_OUTPUT);
+    pupdr = (stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR) >> 12) & 3U;
+
+    (void)hal_gpio_set_pull(BENCH_PIN, HAL_GPIO_NOPULL);
+    moder = (stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER) >> 12) & 3U;
+
+    printf("set_mode保留上拉: %s，set_pull保留輸出模式: %s\n",
+           (pupdr == 1U) ? "是" : "否", (moder == 1U) ? "是" : "否");
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    printf("GPIO後端: %s (主機暫存器模型，非實機週期數)\n", BENCH_GPIO_BACKEND);
+    printf("%-20s %8s %8s %8s %8s\n", "操作", "GPIO讀", "GPIO寫", "RCC存取", "合計");
+
+    for (i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        mmio_region_t* gpio;
+        mmio_region_t* rcc;
+
+        stm32g4_model_init();
+        stm32g4_model_gpio_set(PORT_C, STM32G4_GPIOx_MODER, 0xFFFFDFFFUL);
+        stm32g4_model_counts_clear();
+
+        ops[i].run();
+
+        gpio = stm32g4_model_gpio_region();
+        rcc = stm32g4_model_rcc_region();
+        printf("%-20s %8u %8u %8u %8u\n", ops[i].name,
+               (unsigned)gpio->reads, (unsigned)gpio->writes,
+               (unsigned)(rcc->reads + rcc->writes),
+               (unsigned)(gpio->reads + gpio->writes + rcc->reads + rcc->writes));
+    }
+
+    check_preserved();
+
+    return 0;
+}
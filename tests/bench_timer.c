@@ -0,0 +1,89 @@
+/**
+ * @file bench_timer.c
+ * @brief 軟體計時輪效能量測 (10000個計時器的啟動、停止與每tick處理成本)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 主機端量測只反映演算法的相對成本 (O(1)啟動/停止，處理成本與到期數成正比)，
+ * 目標平台的絕對時間需以hal_get_cycle_count()在實機上量測。
+ */
+
+#include "hal_timer.h"
+#include "test_common.h"
+
+#define BENCH_TIMERS            10000U
+#define BENCH_RUN_TICKS         200000U
+#define BENCH_MAX_DELAY         100000U
+
+static hal_timer_t timers[BENCH_TIMERS];
+static uint32_t next_due[BENCH_TIMERS];
+static uint32_t late_count;
+static uint32_t fire_count;
+
+static void bench_callback(hal_timer_t* timer, void* context)
+{
+    uint32_t index = (uint32_t)(timer - timers);
+    uint32_t now = hal_timer_get_ticks();
+
+    (void)context;
+
+    if (now != next_due[index]) {
+        late_count++;
+    }
+    next_due[index] = now + timer->period;
+    fire_count++;
+}
+
+int main(void)
+{
+    uint32_t seed = 0x2468ACE1UL;
+    uint64_t start_ns;
+    uint64_t elapsed_ns;
+    uint32_t i;
+
+    hal_timer_service_init();
+
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        (void)hal_timer_setup(&timers[i], bench_callback, NULL);
+    }
+
+    // 啟動: 隨機延時分布在計時輪的前三層
+    start_ns = test_time_ns();
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        (void)hal_timer_start(&timers[i], 1U + test_random(&seed) % BENCH_MAX_DELAY, 0);
+    }
+    elapsed_ns = test_time_ns() - start_ns;
+    printf("hal_timer_start  %5u 個計時器: %8.1f ns/次\n",
+           BENCH_TIMERS, (double)elapsed_ns / BENCH_TIMERS);
+
+    // 停止
+    start_ns = test_time_ns();
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        (void)hal_timer_stop(&timers[i]);
+    }
+    elapsed_ns = test_time_ns() - start_ns;
+    printf("hal_timer_stop   %5u 個計時器: %8.1f ns/次\n",
+           BENCH_TIMERS, (double)elapsed_ns / BENCH_TIMERS);
+
+    // 執行: 10000個週期計時器 (週期10~1000 tick) 連續處理
+    for (i = 0; i < BENCH_TIMERS; i++) {
+        uint32_t period = 10U + test_random(&seed) % 991U;
+        uint32_t delay = 1U + test_random(&seed) % period;
+
+        next_due[i] = hal_timer_get_ticks() + delay;
+        (void)hal_timer_start(&timers[i], delay, period);
+    }
+
+    start_ns = test_time_ns();
+    for (i = 0; i < BENCH_RUN_TICKS; i++) {
+        hal_timer_tick();
+        (void)hal_timer_process();
+    }
+    elapsed_ns = test_time_ns() - start_ns;
+
+    printf("hal_timer_process %u tick: %8.1f ns/tick，%u 次到期 (%.1f ns/次到期)，延遲 %u 次\n",
+           BENCH_RUN_TICKS, (double)elapsed_ns / BENCH_RUN_TICKS, fire_count,
+           (double)elapsed_ns / (fire_count ? fire_count : 1U), late_count);
+
+    return (late_count == 0U) ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+/**
+ * @file host_platform.c
+ * @brief 主機端測試用的平台函式替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal.h"
+#include "host_platform.h"
+
+volatile uint32_t host_tick = 0;
+volatile uint32_t host_cycles = 0;
+
+uint32_t hal_get_tick(void)
+{
+    return host_tick;
+}
+
+uint32_t hal_get_cycle_count(void)
+{
+    return host_cycles;
+}
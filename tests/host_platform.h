@@ -0,0 +1,22 @@
+/**
+ * @file host_platform.h
+ * @brief 主機端測試用的平台函式替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 共用模組在主機端只缺少平台層提供的時間基準，
+ * 由測試程式直接設定host_tick與host_cycles控制時間流逝。
+ */
+
+#ifndef HOST_PLATFORM_H
+#define HOST_PLATFORM_H
+
+#include <stdint.h>
+
+/** hal_get_tick()返回的毫秒計數 */
+extern volatile uint32_t host_tick;
+
+/** hal_get_cycle_count()返回的週期計數 */
+extern volatile uint32_t host_cycles;
+
+#endif /* HOST_PLATFORM_H */
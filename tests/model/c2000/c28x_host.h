@@ -0,0 +1,41 @@
+/**
+ * @file c28x_host.h
+ * @brief 以主機gcc編譯C2000平台源檔案時強制包含的相容定義
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以-include c28x_host.h提供C28x編譯器的關鍵字與內建函式，
+ * 並將暫存器位址轉換到mmio.h登錄的模型區域。
+ * 主機端uint16_t/uint32_t指標的步進 (2/4位元組) 對應C2000的1/2個字，
+ * 模型區域以每個位址單位2位元組登錄，驅動中的位址運算結果與目標平台一致。
+ */
+
+#ifndef C28X_HOST_H
+#define C28X_HOST_H
+
+#include <stdint.h>
+
+void* mmio_map(uintptr_t device_addr);
+
+#define __cregister
+#define __interrupt
+#define __asm(text)                     ((void)0)
+
+/** 主機端的INTM狀態 (1 = 禁用) */
+extern volatile uint16_t c28x_host_intm;
+
+static inline uint16_t __disable_interrupts(void)
+{
+    uint16_t previous = c28x_host_intm;
+    c28x_host_intm = 1U;
+    return previous;
+}
+
+static inline void __restore_interrupts(uint16_t state)
+{
+    c28x_host_intm = state;
+}
+
+#define TI_C2000_REG_ADDR(addr)         ((uintptr_t)mmio_map((uintptr_t)(addr)))
+
+#endif /* C28X_HOST_H */
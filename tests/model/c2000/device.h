@@ -0,0 +1,17 @@
+/**
+ * @file device.h
+ * @brief 主機端測試用的C2000Ware device.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef DEVICE_H
+#define DEVICE_H
+
+#include "driverlib.h"
+
+// 與ti_c2000_common.h的F28P55x時脈一致 (120 MHz CPU、60 MHz LSPCLK)
+#define DEVICE_SYSCLK_FREQ      120000000UL
+#define DEVICE_LSPCLK_FREQ      (DEVICE_SYSCLK_FREQ / 2UL)
+
+#endif /* DEVICE_H */
@@ -0,0 +1,280 @@
+/**
+ * @file driverlib.h
+ * @brief 主機端測試用的C2000Ware driverlib.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 提供簡化版驅動用到的暫存器存取巨集，以及DriverLib版UART驅動 (ti_c2000_uart.c)
+ * 用到的SCI/SysCtl/GPIO/Interrupt子集，位址經模型轉換。
+ * SCI與SysCtl函式依C2000Ware的sci.h/sysctl.h以暫存器操作實現，
+ * 讓驅動的存取落在SCI暫存器模型上；Interrupt函式只記錄註冊的處理函式，
+ * 由測試呼叫c2000_host_pie_handler()取得後以一般函式執行。
+ */
+
+#ifndef DRIVERLIB_H
+#define DRIVERLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HWREG(x)        (*(volatile uint32_t*)TI_C2000_REG_ADDR(x))
+#define HWREGH(x)       (*(volatile uint16_t*)TI_C2000_REG_ADDR(x))
+
+// CPU中斷暫存器 (cpu.h)
+extern volatile unsigned int IFR;
+
+#define EALLOW          __asm(" EALLOW")
+#define EDIS            __asm(" EDIS")
+
+/* ========================================================================== */
+/*                             hw_memmap.h                                    */
+/* ========================================================================== */
+
+#define SCIA_BASE       0x00007200UL
+#define SCIB_BASE       0x00007210UL
+#define SCIC_BASE       0x00007220UL
+#define CPUSYS_BASE     0x0005D300UL
+
+/* ========================================================================== */
+/*                             sci.h                                          */
+/* ========================================================================== */
+
+#define SCI_O_CCR               0x0U
+#define SCI_O_CTL1              0x1U
+#define SCI_O_HBAUD             0x2U
+#define SCI_O_LBAUD             0x3U
+#define SCI_O_CTL2              0x4U
+#define SCI_O_RXST              0x5U
+#define SCI_O_RXBUF             0x7U
+#define SCI_O_TXBUF             0x9U
+#define SCI_O_FFTX              0xAU
+#define SCI_O_FFRX              0xBU
+#define SCI_O_FFCT              0xCU
+#define SCI_O_PRI               0xFU
+
+#define SCI_CTL1_RXENA          0x0001U
+#define SCI_CTL1_TXENA          0x0002U
+#define SCI_CTL1_SWRESET        0x0020U
+#define SCI_CTL2_TXEMPTY        0x0040U
+
+#define SCI_RXBUF_SAR_M         0x00FFU
+#define SCI_RXBUF_SCIFFPE       0x4000U
+#define SCI_RXBUF_SCIFFFE       0x8000U
+
+#define SCI_FFTX_TXFFIL_M       0x001FU
+#define SCI_FFTX_TXFFIENA       0x0020U
+#define SCI_FFTX_TXFFINTCLR     0x0040U
+#define SCI_FFTX_TXFFST_S       8U
+#define SCI_FFTX_TXFFST_M       0x1F00U
+#define SCI_FFTX_TXFIFORESET    0x2000U
+#define SCI_FFTX_SCIFFENA       0x4000U
+#define SCI_FFTX_SCIRST         0x8000U
+
+#define SCI_FFRX_RXFFIL_M       0x001FU
+#define SCI_FFRX_RXFFIENA       0x0020U
+#define SCI_FFRX_RXFFINTCLR     0x0040U
+#define SCI_FFRX_RXFFST_S       8U
+#define SCI_FFRX_RXFFST_M       0x1F00U
+#define SCI_FFRX_RXFIFORESET    0x2000U
+#define SCI_FFRX_RXFFOVRCLR     0x4000U
+#define SCI_FFRX_RXFFOVF        0x8000U
+
+#define SCI_FFCT_CDC            0x2000U
+#define SCI_FFCT_ABDCLR         0x4000U
+#define SCI_FFCT_ABD            0x8000U
+
+#define SCI_CONFIG_WLEN_MASK    0x0007U
+#define SCI_CONFIG_WLEN_8       0x0007U
+#define SCI_CONFIG_WLEN_7       0x0006U
+#define SCI_CONFIG_STOP_MASK    0x0080U
+#define SCI_CONFIG_STOP_ONE     0x0000U
+#define SCI_CONFIG_STOP_TWO     0x0080U
+#define SCI_CONFIG_PAR_MASK     0x0060U
+#define SCI_CONFIG_PAR_NONE     0x0000U
+#define SCI_CONFIG_PAR_EVEN     0x0060U
+#define SCI_CONFIG_PAR_ODD      0x0020U
+
+#define SCI_INT_RXFF            0x0002U
+#define SCI_INT_TXFF            0x0004U
+
+typedef enum {
+    SCI_FIFO_TX0 = 0x0000U,
+    SCI_FIFO_TX16 = 0x0010U
+} SCI_TxFIFOLevel;
+
+typedef enum {
+    SCI_FIFO_RX0 = 0x0000U,
+    SCI_FIFO_RX8 = 0x0008U
+} SCI_RxFIFOLevel;
+
+static inline void SCI_setConfig(uint32_t base, uint32_t lspclkHz, uint32_t baud, uint32_t config)
+{
+    uint32_t divider = (lspclkHz / (baud * 8U)) - 1U;
+
+    HWREGH(base + SCI_O_HBAUD) = (uint16_t)((divider & 0xFF00U) >> 8U);
+    HWREGH(base + SCI_O_LBAUD) = (uint16_t)(divider & 0x00FFU);
+    HWREGH(base + SCI_O_CCR) = (uint16_t)((HWREGH(base + SCI_O_CCR) &
+                                           ~(SCI_CONFIG_PAR_MASK | SCI_CONFIG_STOP_MASK |
+                                             SCI_CONFIG_WLEN_MASK)) | config);
+}
+
+static inline void SCI_enableModule(uint32_t base)
+{
+    HWREGH(base + SCI_O_CTL1) |= (SCI_CTL1_TXENA | SCI_CTL1_RXENA | SCI_CTL1_SWRESET);
+}
+
+static inline void SCI_disableModule(uint32_t base)
+{
+    HWREGH(base + SCI_O_CTL1) &= ~(SCI_CTL1_TXENA | SCI_CTL1_RXENA);
+}
+
+static inline void SCI_performSoftwareReset(uint32_t base)
+{
+    HWREGH(base + SCI_O_CTL1) &= ~SCI_CTL1_SWRESET;
+    HWREGH(base + SCI_O_CTL1) |= SCI_CTL1_SWRESET;
+}
+
+static inline void SCI_enableFIFO(uint32_t base)
+{
+    HWREGH(base + SCI_O_FFTX) |= SCI_FFTX_SCIRST;
+    HWREGH(base + SCI_O_FFTX) |= SCI_FFTX_SCIFFENA | SCI_FFTX_TXFIFORESET;
+    HWREGH(base + SCI_O_FFRX) |= SCI_FFRX_RXFIFORESET;
+}
+
+static inline SCI_TxFIFOLevel SCI_getTxFIFOStatus(uint32_t base)
+{
+    return (SCI_TxFIFOLevel)((HWREGH(base + SCI_O_FFTX) & SCI_FFTX_TXFFST_M) >>
+                             SCI_FFTX_TXFFST_S);
+}
+
+static inline SCI_RxFIFOLevel SCI_getRxFIFOStatus(uint32_t base)
+{
+    return (SCI_RxFIFOLevel)((HWREGH(base + SCI_O_FFRX) & SCI_FFRX_RXFFST_M) >>
+                             SCI_FFRX_RXFFST_S);
+}
+
+static inline void SCI_setFIFOInterruptLevel(uint32_t base, SCI_TxFIFOLevel txLevel,
+                                             SCI_RxFIFOLevel rxLevel)
+{
+    HWREGH(base + SCI_O_FFTX) = (uint16_t)((HWREGH(base + SCI_O_FFTX) & ~SCI_FFTX_TXFFIL_M) |
+                                           (uint16_t)txLevel);
+    HWREGH(base + SCI_O_FFRX) = (uint16_t)((HWREGH(base + SCI_O_FFRX) & ~SCI_FFRX_RXFFIL_M) |
+                                           (uint16_t)rxLevel);
+}
+
+static inline bool SCI_isTransmitterEmpty(uint32_t base)
+{
+    return (HWREGH(base + SCI_O_CTL2) & SCI_CTL2_TXEMPTY) == SCI_CTL2_TXEMPTY;
+}
+
+static inline bool SCI_getOverflowStatus(uint32_t base)
+{
+    return (HWREGH(base + SCI_O_FFRX) & SCI_FFRX_RXFFOVF) == SCI_FFRX_RXFFOVF;
+}
+
+static inline void SCI_clearOverflowStatus(uint32_t base)
+{
+    HWREGH(base + SCI_O_FFRX) |= SCI_FFRX_RXFFOVRCLR;
+}
+
+static inline void SCI_enableInterrupt(uint32_t base, uint32_t intFlags)
+{
+    if ((intFlags & SCI_INT_TXFF) != 0U) {
+        HWREGH(base + SCI_O_FFTX) |= SCI_FFTX_TXFFIENA;
+    }
+    if ((intFlags & SCI_INT_RXFF) != 0U) {
+        HWREGH(base + SCI_O_FFRX) |= SCI_FFRX_RXFFIENA;
+    }
+}
+
+static inline void SCI_disableInterrupt(uint32_t base, uint32_t intFlags)
+{
+    if ((intFlags & SCI_INT_TXFF) != 0U) {
+        HWREGH(base + SCI_O_FFTX) &= ~SCI_FFTX_TXFFIENA;
+    }
+    if ((intFlags & SCI_INT_RXFF) != 0U) {
+        HWREGH(base + SCI_O_FFRX) &= ~SCI_FFRX_RXFFIENA;
+    }
+}
+
+static inline void SCI_clearInterruptStatus(uint32_t base, uint32_t intFlags)
+{
+    if ((intFlags & SCI_INT_TXFF) != 0U) {
+        HWREGH(base + SCI_O_FFTX) |= SCI_FFTX_TXFFINTCLR;
+    }
+    if ((intFlags & SCI_INT_RXFF) != 0U) {
+        HWREGH(base + SCI_O_FFRX) |= SCI_FFRX_RXFFINTCLR;
+    }
+}
+
+/* ========================================================================== */
+/*                             sysctl.h                                       */
+/* ========================================================================== */
+
+// 週邊時脈編碼: 位元8-12為位元索引，位元0-4為PCLKCRx索引
+#define SYSCTL_PERIPH_REG_M     0x001FU
+#define SYSCTL_PERIPH_BIT_M     0x1F00U
+#define SYSCTL_PERIPH_BIT_S     8U
+#define SYSCTL_O_PCLKCR0        0x22U
+
+typedef enum {
+    SYSCTL_PERIPH_CLK_SCIA = 0x0007,
+    SYSCTL_PERIPH_CLK_SCIB = 0x0107,
+    SYSCTL_PERIPH_CLK_SCIC = 0x0207
+} SysCtl_PeripheralPCLOCKCR;
+
+static inline void SysCtl_enablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral)
+{
+    uint16_t reg = (uint16_t)peripheral & SYSCTL_PERIPH_REG_M;
+    uint16_t bit = ((uint16_t)peripheral & SYSCTL_PERIPH_BIT_M) >> SYSCTL_PERIPH_BIT_S;
+
+    HWREG(CPUSYS_BASE + SYSCTL_O_PCLKCR0 + (2U * reg)) |= (1UL << bit);
+}
+
+static inline void SysCtl_disablePeripheral(SysCtl_PeripheralPCLOCKCR peripheral)
+{
+    uint16_t reg = (uint16_t)peripheral & SYSCTL_PERIPH_REG_M;
+    uint16_t bit = ((uint16_t)peripheral & SYSCTL_PERIPH_BIT_M) >> SYSCTL_PERIPH_BIT_S;
+
+    HWREG(CPUSYS_BASE + SYSCTL_O_PCLKCR0 + (2U * reg)) &= ~(1UL << bit);
+}
+
+/* ========================================================================== */
+/*                             gpio.h / pin_map.h                             */
+/* ========================================================================== */
+
+// 引腳功能選擇不在模型範圍內，只需編碼值可以傳遞
+#define GPIO_14_SCIB_TX         0x00081C02UL
+#define GPIO_15_SCIB_RX         0x00081E02UL
+#define GPIO_28_SCIA_RX         0x00871801UL
+#define GPIO_29_SCIA_TX         0x00871A01UL
+
+static inline void GPIO_setPinConfig(uint32_t pinConfig)
+{
+    (void)pinConfig;
+}
+
+/* ========================================================================== */
+/*                             interrupt.h / hw_ints.h                        */
+/* ========================================================================== */
+
+// 中斷編號: 位元16-23為PIE向量ID，位元8-15為群組，位元0-7為群組內通道
+#define INT_SCIC_RX             0x005C0805UL
+#define INT_SCIA_RX             0x00600901UL
+#define INT_SCIB_RX             0x00620903UL
+
+#define INTERRUPT_ACK_GROUP8    0x0080U
+#define INTERRUPT_ACK_GROUP9    0x0100U
+
+void Interrupt_register(uint32_t interruptNumber, void (*handler)(void));
+void Interrupt_enable(uint32_t interruptNumber);
+void Interrupt_clearACKGroup(uint16_t group);
+
+/** 取得以Interrupt_register()註冊的處理函式 (未註冊為NULL) */
+void (*c2000_host_pie_handler(uint32_t interruptNumber))(void);
+
+/** Interrupt_clearACKGroup()累計應答的群組位元 */
+extern volatile uint16_t c2000_host_pie_ack;
+
+#endif /* DRIVERLIB_H */
@@ -0,0 +1,527 @@
+/**
+ * @file c2000_model.c
+ * @brief TI C2000週邊暫存器模型實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "c2000_model.h"
+#include "driverlib.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCI_FIFO_DEPTH          16U
+#define SCI_RX_QUEUE            4096U
+
+// SCICTL1
+#define CTL1_SWRESET            0x0020U
+#define CTL1_TXENA              0x0002U
+#define CTL1_RXENA              0x0001U
+// SCICTL2
+#define CTL2_TXRDY              0x0080U
+#define CTL2_TXEMPTY            0x0040U
+// SCIRXST
+#define RXST_RXERROR            0x0080U
+#define RXST_FE                 0x0010U
+#define RXST_PE                 0x0004U
+// SCIFFTX/SCIFFRX
+#define FFTX_SCIRST             0x8000U
+#define FFTX_FFENA              0x4000U
+#define FF_FIFORESET            0x2000U
+#define FF_LEVEL_MASK           0x1F00U
+#define FFRX_OVF                0x8000U
+#define FFRX_OVFCLR             0x4000U
+// SCICCR
+#define CCR_STOP2               0x0080U
+#define CCR_PARENA              0x0020U
+#define CCR_CHAR_MASK           0x0007U
+
+typedef struct {
+    uint16_t data;
+    uint64_t at;
+} sci_rx_event_t;
+
+typedef struct {
+    // 發送
+    uint8_t tx_fifo[SCI_FIFO_DEPTH];
+    uint16_t tx_count;
+    bool shifting;
+    uint8_t shift_data;
+    uint64_t shift_end;
+    c2000_sci_tx_t tx;
+
+    // 接收
+    uint16_t rx_fifo[SCI_FIFO_DEPTH];
+    uint16_t rx_count;
+    bool rx_overflow;
+    uint16_t rxst;
+    sci_rx_event_t rx_queue[SCI_RX_QUEUE];
+    uint32_t rx_head;
+    uint32_t rx_tail;
+} sci_model_t;
+
+static uint64_t model_now;
+static uint32_t model_cpu_hz;
+static uint32_t model_lspclk_hz;
+static mmio_region_t* sci_region;
+static mmio_region_t* cpusys_region;
+static mmio_region_t* gpio_ctrl_region;
+static mmio_region_t* gpio_data_region;
+static sci_model_t sci[C2000_SCI_COUNT];
+static uint32_t gpio_ctrl_write_count[C2000_GPIO_PORT_COUNT][C2000_GPIO_CTRL_STEP / 2U];
+static void (*pie_handlers[256])(void);   // 以PIE向量ID (中斷編號位元16-23) 索引
+
+/* ========================================================================== */
+/*                             SCI模型                                         */
+/* ========================================================================== */
+
+static uint16_t sci_reg(uint16_t module, uint16_t reg)
+{
+    return *mmio_reg16(sci_region, (uint32_t)(module * C2000_SCI_STEP + reg) * 2U);
+}
+
+static void sci_set(uint16_t module, uint16_t reg, uint16_t value)
+{
+    *mmio_reg16(sci_region, (uint32_t)(module * C2000_SCI_STEP + reg) * 2U) = value;
+}
+
+static bool sci_tx_enabled(uint16_t module)
+{
+    uint16_t ctl1 = sci_reg(module, C2000_SCICTL1);
+    uint16_t fftx = sci_reg(module, C2000_SCIFFTX);
+
+    return (ctl1 & (CTL1_SWRESET | CTL1_TXENA)) == (CTL1_SWRESET | CTL1_TXENA) &&
+           (fftx & (FFTX_SCIRST | FFTX_FFENA | FF_FIFORESET)) ==
+               (FFTX_SCIRST | FFTX_FFENA | FF_FIFORESET);
+}
+
+static bool sci_rx_enabled(uint16_t module)
+{
+    uint16_t ctl1 = sci_reg(module, C2000_SCICTL1);
+    uint16_t ffrx = sci_reg(module, C2000_SCIFFRX);
+
+    return (ctl1 & (CTL1_SWRESET | CTL1_RXENA)) == (CTL1_SWRESET | CTL1_RXENA) &&
+           (ffrx & FF_FIFORESET) != 0U;
+}
+
+/* 以下兩個函式在回呼中呼叫，直接讀取暫存器 (區域此時不受保護) */
+
+static uint32_t sci_bit_cycles_unlocked(uint16_t module)
+{
+    uint32_t brr = ((uint32_t)sci_reg(module, C2000_SCIHBAUD) << 8) |
+                   (sci_reg(module, C2000_SCILBAUD) & 0xFFU);
+
+    // BRR = 0時與BRR = 1相同 (LSPCLK/16)
+    return ((brr == 0U) ? 2U : (brr + 1U)) * 8U * (model_cpu_hz / model_lspclk_hz);
+}
+
+static uint32_t sci_char_cycles_unlocked(uint16_t module)
+{
+    uint16_t ccr = sci_reg(module, C2000_SCICCR);
+    uint32_t bits = 1U + (uint32_t)(ccr & CCR_CHAR_MASK) + 1U;     // 起始位元 + 資料位元
+
+    bits += ((ccr & CCR_PARENA) != 0U) ? 1U : 0U;
+    bits += ((ccr & CCR_STOP2) != 0U) ? 2U : 1U;
+
+    return bits * sci_bit_cycles_unlocked(module);
+}
+
+/* 測試端呼叫: 暫時解除保護後讀取 */
+
+uint32_t c2000_model_sci_bit_cycles(uint16_t module)
+{
+    uint32_t cycles;
+
+    mmio_unprotect(sci_region);
+    cycles = sci_bit_cycles_unlocked(module);
+    mmio_protect(sci_region);
+
+    return cycles;
+}
+
+uint32_t c2000_model_sci_char_cycles(uint16_t module)
+{
+    uint32_t cycles;
+
+    mmio_unprotect(sci_region);
+    cycles = sci_char_cycles_unlocked(module);
+    mmio_protect(sci_region);
+
+    return cycles;
+}
+
+/** 從FIFO取出下一個字元開始移位 */
+static void sci_start_char(uint16_t module, uint64_t at)
+{
+    sci_model_t* m = &sci[module];
+
+    if (m->tx.count > 0U && at > m->tx.last_end) {
+        m->tx.gaps++;
+        m->tx.idle_cycles += at - m->tx.last_end;
+    }
+    if (m->tx.count == 0U) {
+        m->tx.first_start = at;
+    }
+
+    m->shift_data = m->tx_fifo[0];
+    memmove(m->tx_fifo, m->tx_fifo + 1, --m->tx_count);
+    m->shifting = true;
+    m->shift_end = at + sci_char_cycles_unlocked(module);
+}
+
+/** 將SCI狀態推進到目前時間 */
+static void sci_update(uint16_t module)
+{
+    sci_model_t* m = &sci[module];
+
+    // 發送: 移位完成時若FIFO中還有字元，立即接著發送
+    while (m->shifting && m->shift_end <= model_now) {
+        if (m->tx.count < sizeof(m->tx.data)) {
+            m->tx.data[m->tx.count] = m->shift_data;
+        }
+        m->tx.count++;
+        m->tx.last_end = m->shift_end;
+        m->shifting = false;
+
+        if (m->tx_count > 0U && sci_tx_enabled(module)) {
+            sci_start_char(module, m->tx.last_end);
+        }
+    }
+    if (!m->shifting && m->tx_count > 0U && sci_tx_enabled(module)) {
+        sci_start_char(module, model_now);
+    }
+
+    // 接收
+    while (m->rx_head != m->rx_tail && m->rx_queue[m->rx_head].at <= model_now) {
+        uint16_t data = m->rx_queue[m->rx_head].data;
+
+        m->rx_head = (m->rx_head + 1U) % SCI_RX_QUEUE;
+        if (!sci_rx_enabled(module)) {
+            continue;
+        }
+        if (m->rx_count >= SCI_FIFO_DEPTH) {
+            m->rx_overflow = true;
+            continue;
+        }
+        m->rx_fifo[m->rx_count++] = data;
+        if ((data & C2000_RX_FE) != 0U) {
+            m->rxst |= RXST_RXERROR | RXST_FE;
+        }
+        if ((data & C2000_RX_PE) != 0U) {
+            m->rxst |= RXST_RXERROR | RXST_PE;
+        }
+    }
+}
+
+/** 依模型狀態更新狀態暫存器 */
+static void sci_refresh(uint16_t module)
+{
+    sci_model_t* m = &sci[module];
+    uint16_t ctl2 = sci_reg(module, C2000_SCICTL2) & (uint16_t)~(CTL2_TXRDY | CTL2_TXEMPTY);
+
+    if (m->tx_count < SCI_FIFO_DEPTH) {
+        ctl2 |= CTL2_TXRDY;
+    }
+    if (m->tx_count == 0U && !m->shifting) {
+        ctl2 |= CTL2_TXEMPTY;
+    }
+    sci_set(module, C2000_SCICTL2, ctl2);
+
+    sci_set(module, C2000_SCIFFTX, (uint16_t)((sci_reg(module, C2000_SCIFFTX) & ~FF_LEVEL_MASK) |
+                                              (m->tx_count << 8)));
+    sci_set(module, C2000_SCIFFRX, (uint16_t)((sci_reg(module, C2000_SCIFFRX) &
+                                               ~(FF_LEVEL_MASK | FFRX_OVF)) |
+                                              (m->rx_count << 8) |
+                                              (m->rx_overflow ? FFRX_OVF : 0U)));
+    sci_set(module, C2000_SCIRXST, m->rxst);
+    sci_set(module, C2000_SCIRXBUF, (m->rx_count > 0U) ? m->rx_fifo[0] : 0U);
+}
+
+static void sci_update_all(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < C2000_SCI_COUNT; i++) {
+        sci_update(i);
+    }
+}
+
+static void sci_before(void* context, uint32_t offset, bool write)
+{
+    uint16_t module = (uint16_t)(offset / 2U / C2000_SCI_STEP);
+
+    (void)context;
+    (void)write;
+
+    model_now += C2000_MODEL_ACCESS_CYCLES;
+    sci_update_all();
+    if (module < C2000_SCI_COUNT) {
+        sci_refresh(module);
+    }
+}
+
+static void sci_after(void* context, uint32_t offset, bool write)
+{
+    uint16_t module = (uint16_t)(offset / 2U / C2000_SCI_STEP);
+    uint16_t reg = (uint16_t)((offset / 2U) % C2000_SCI_STEP);
+    sci_model_t* m;
+    uint16_t value;
+
+    (void)context;
+
+    if (module >= C2000_SCI_COUNT) {
+        return;
+    }
+    m = &sci[module];
+    value = sci_reg(module, reg);
+
+    if (!write) {
+        if (reg == C2000_SCIRXBUF && m->rx_count > 0U) {
+            memmove(m->rx_fifo, m->rx_fifo + 1, (size_t)(--m->rx_count) * sizeof(m->rx_fifo[0]));
+        }
+    } else {
+        switch (reg) {
+        case C2000_SCITXBUF:
+            if (m->tx_count >= SCI_FIFO_DEPTH) {
+                m->tx.overruns++;
+            } else {
+                m->tx_fifo[m->tx_count++] = (uint8_t)value;
+            }
+            break;
+        case C2000_SCICTL1:
+            // 軟體重設清除錯誤旗標並中斷正在移位的字元，FIFO內容保留
+            if ((value & CTL1_SWRESET) == 0U) {
+                m->rxst = 0;
+                if (m->shifting) {
+                    m->shifting = false;
+                    m->tx.aborted++;
+                }
+            }
+            break;
+        case C2000_SCIFFTX:
+            if ((value & FF_FIFORESET) == 0U) {
+                m->tx_count = 0;
+            }
+            break;
+        case C2000_SCIFFRX:
+            if ((value & FFRX_OVFCLR) != 0U) {
+                m->rx_overflow = false;
+                sci_set(module, reg, (uint16_t)(value & ~FFRX_OVFCLR));
+            }
+            if ((value & FF_FIFORESET) == 0U) {
+                m->rx_count = 0;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    sci_update(module);
+    sci_refresh(module);
+}
+
+/* ========================================================================== */
+/*                             GPIO模型                                        */
+/* ========================================================================== */
+
+static void gpio_ctrl_after(void* context, uint32_t offset, bool write)
+{
+    uint32_t word = offset / 2U;
+
+    (void)context;
+
+    if (write) {
+        gpio_ctrl_write_count[word / C2000_GPIO_CTRL_STEP][(word % C2000_GPIO_CTRL_STEP) / 2U]++;
+    }
+}
+
+static void gpio_data_after(void* context, uint32_t offset, bool write)
+{
+    uint32_t word = offset / 2U;
+    uint32_t port = word / C2000_GPIO_DATA_STEP;
+    uint32_t reg = (word % C2000_GPIO_DATA_STEP) & ~1U;
+    volatile uint32_t* dat = mmio_reg32(gpio_data_region, port * C2000_GPIO_DATA_STEP * 2U);
+    volatile uint32_t* target = mmio_reg32(gpio_data_region, (port * C2000_GPIO_DATA_STEP + reg) * 2U);
+    uint32_t value = *target;
+
+    (void)context;
+
+    if (!write || reg == C2000_GPxDAT) {
+        return;
+    }
+
+    if (reg == C2000_GPxSET) {
+        *dat |= value;
+    } else if (reg == C2000_GPxCLEAR) {
+        *dat &= ~value;
+    } else {
+        *dat ^= value;
+    }
+    *target = 0;
+}
+
+/* ========================================================================== */
+/*                             介面實現                                        */
+/* ========================================================================== */
+
+void c2000_model_init(uint32_t cpu_hz, uint32_t lspclk_hz)
+{
+    mmio_reset();
+    memset(sci, 0, sizeof(sci));
+    model_now = 0;
+    model_cpu_hz = cpu_hz;
+    model_lspclk_hz = lspclk_hz;
+    memset(pie_handlers, 0, sizeof(pie_handlers));
+    c2000_host_pie_ack = 0;
+
+    sci_region = mmio_add("SCI", C2000_SCIA_BASE, C2000_SCI_COUNT * C2000_SCI_STEP, 2U,
+                          true, sci_before, sci_after, NULL);
+    cpusys_region = mmio_add("CpuSysRegs", C2000_CPUSYS_BASE, 0x100U, 2U,
+                             false, NULL, NULL, NULL);
+    gpio_ctrl_region = mmio_add("GpioCtrlRegs", C2000_GPIO_CTRL_BASE,
+                                C2000_GPIO_PORT_COUNT * C2000_GPIO_CTRL_STEP, 2U,
+                                true, NULL, gpio_ctrl_after, NULL);
+    gpio_data_region = mmio_add("GpioDataRegs", C2000_GPIO_DATA_BASE,
+                                C2000_GPIO_PORT_COUNT * C2000_GPIO_DATA_STEP, 2U,
+                                true, NULL, gpio_data_after, NULL);
+    c2000_model_gpio_ctrl_writes_clear();
+}
+
+uint64_t c2000_model_now(void)
+{
+    return model_now;
+}
+
+void c2000_model_advance(uint64_t cycles)
+{
+    model_now += cycles;
+
+    // 在回呼之外更新模型，需暫時解除保護，否則讀取暫存器會再次觸發陷阱
+    mmio_unprotect(sci_region);
+    sci_update_all();
+    mmio_protect(sci_region);
+}
+
+mmio_region_t* c2000_model_sci_region(void)
+{
+    return sci_region;
+}
+
+c2000_sci_tx_t* c2000_model_sci_tx(uint16_t module)
+{
+    return &sci[module].tx;
+}
+
+void c2000_model_sci_tx_clear(uint16_t module)
+{
+    memset(&sci[module].tx, 0, sizeof(sci[module].tx));
+}
+
+void c2000_model_sci_rx_at(uint16_t module, uint8_t data, uint16_t flags, uint64_t at)
+{
+    sci_model_t* m = &sci[module];
+    uint32_t next = (m->rx_tail + 1U) % SCI_RX_QUEUE;
+
+    if (next == m->rx_head) {
+        fprintf(stderr, "c2000_model: RX queue full\n");
+        abort();
+    }
+    m->rx_queue[m->rx_tail].data = (uint16_t)(data | flags);
+    m->rx_queue[m->rx_tail].at = at;
+    m->rx_tail = next;
+}
+
+uint32_t c2000_model_sci_rx_pending(uint16_t module)
+{
+    sci_model_t* m = &sci[module];
+
+    return (m->rx_tail + SCI_RX_QUEUE - m->rx_head) % SCI_RX_QUEUE;
+}
+
+mmio_region_t* c2000_model_cpusys_region(void)
+{
+    return cpusys_region;
+}
+
+mmio_region_t* c2000_model_gpio_ctrl_region(void)
+{
+    return gpio_ctrl_region;
+}
+
+mmio_region_t* c2000_model_gpio_data_region(void)
+{
+    return gpio_data_region;
+}
+
+uint32_t c2000_model_gpio_ctrl(uint16_t port, uint16_t reg)
+{
+    return mmio_peek32(gpio_ctrl_region, (port * C2000_GPIO_CTRL_STEP + reg) * 2U);
+}
+
+uint32_t c2000_model_gpio_data(uint16_t port, uint16_t reg)
+{
+    return mmio_peek32(gpio_data_region, (port * C2000_GPIO_DATA_STEP + reg) * 2U);
+}
+
+void c2000_model_gpio_ctrl_set(uint16_t port, uint16_t reg, uint32_t value)
+{
+    mmio_poke32(gpio_ctrl_region, (port * C2000_GPIO_CTRL_STEP + reg) * 2U, value);
+}
+
+void c2000_model_gpio_set_input(uint16_t port, uint32_t mask, uint32_t levels)
+{
+    uint32_t inputs = mask & ~c2000_model_gpio_ctrl(port, C2000_GPxDIR);
+    uint32_t dat = c2000_model_gpio_data(port, C2000_GPxDAT);
+
+    mmio_poke32(gpio_data_region, port * C2000_GPIO_DATA_STEP * 2U,
+                (dat & ~inputs) | (levels & inputs));
+}
+
+uint32_t c2000_model_gpio_ctrl_writes(uint16_t port, uint16_t reg)
+{
+    return gpio_ctrl_write_count[port][reg / 2U];
+}
+
+void c2000_model_gpio_ctrl_writes_clear(void)
+{
+    memset(gpio_ctrl_write_count, 0, sizeof(gpio_ctrl_write_count));
+}
+
+/* ========================================================================== */
+/*                             平台函式替身                                    */
+/* ========================================================================== */
+
+volatile uint16_t c28x_host_intm = 0;
+volatile unsigned int IER = 0;
+volatile unsigned int IFR = 0;
+volatile uint16_t c2000_host_pie_ack = 0;
+
+void Interrupt_register(uint32_t interruptNumber, void (*handler)(void))
+{
+    pie_handlers[(interruptNumber >> 16) & 0xFFU] = handler;
+}
+
+void Interrupt_enable(uint32_t interruptNumber)
+{
+    (void)interruptNumber;
+}
+
+void Interrupt_clearACKGroup(uint16_t group)
+{
+    c2000_host_pie_ack |= group;
+}
+
+void (*c2000_host_pie_handler(uint32_t interruptNumber))(void)
+{
+    return pie_handlers[(interruptNumber >> 16) & 0xFFU];
+}
+
+/** 自由運行的週期計數 (CPU Timer2)，每次讀取代表一次輪詢的成本 */
+uint32_t hal_get_cycle_count(void)
+{
+    c2000_model_advance(C2000_MODEL_POLL_CYCLES);
+    return (uint32_t)model_now;
+}
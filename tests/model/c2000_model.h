@@ -0,0 +1,148 @@
+/**
+ * @file c2000_model.h
+ * @brief TI C2000週邊暫存器模型 (SCI、GPIO、系統控制)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 暫存器位移與位元依TRM，與驅動的定義分開撰寫，位址或位元錯誤會在測試中顯現。
+ * 模型以CPU週期為時間單位: 每次攔截的暫存器存取前進C2000_MODEL_ACCESS_CYCLES，
+ * 每次hal_get_cycle_count()前進C2000_MODEL_POLL_CYCLES。
+ */
+
+#ifndef C2000_MODEL_H
+#define C2000_MODEL_H
+
+#include "mmio.h"
+
+/* ========================================================================== */
+/*                             裝置位址 (字位址)                               */
+/* ========================================================================== */
+
+#define C2000_SCIA_BASE             0x00007200UL
+#define C2000_SCI_STEP              0x10UL
+#define C2000_SCI_COUNT             3U
+#define C2000_GPIO_CTRL_BASE        0x00007C00UL
+#define C2000_GPIO_DATA_BASE        0x00007F00UL
+#define C2000_CPUSYS_BASE           0x0005D300UL
+#define C2000_PCLKCR7               (C2000_CPUSYS_BASE + 0x30UL)
+#define C2000_GPIO_PORT_COUNT       8U          // 埠A-H
+#define C2000_GPIO_CTRL_STEP        0x40UL      // 每埠控制暫存器間距 (字)
+#define C2000_GPIO_DATA_STEP        0x8UL       // 每埠資料暫存器間距 (字)
+
+// SCI暫存器 (字位移)
+#define C2000_SCICCR                0x0U
+#define C2000_SCICTL1               0x1U
+#define C2000_SCIHBAUD              0x2U
+#define C2000_SCILBAUD              0x3U
+#define C2000_SCICTL2               0x4U
+#define C2000_SCIRXST               0x5U
+#define C2000_SCIRXBUF              0x7U
+#define C2000_SCITXBUF              0x9U
+#define C2000_SCIFFTX               0xAU
+#define C2000_SCIFFRX               0xBU
+#define C2000_SCIFFCT               0xCU
+#define C2000_SCIPRI                0xFU
+
+// GPIO控制暫存器 (字位移，32位元暫存器)
+#define C2000_GPxQSEL1              0x02U
+#define C2000_GPxQSEL2              0x04U
+#define C2000_GPxMUX1               0x06U
+#define C2000_GPxMUX2               0x08U
+#define C2000_GPxDIR                0x0AU
+#define C2000_GPxPUD                0x0CU
+#define C2000_GPxINV                0x10U
+#define C2000_GPxODR                0x12U
+#define C2000_GPxGMUX1              0x20U
+#define C2000_GPxGMUX2              0x22U
+
+// GPIO資料暫存器 (字位移，32位元暫存器)
+#define C2000_GPxDAT                0x0U
+#define C2000_GPxSET                0x2U
+#define C2000_GPxCLEAR              0x4U
+#define C2000_GPxTOGGLE             0x6U
+
+// 接收字元的錯誤旗標 (SCIRXBUF.SCIFFFE/SCIFFPE)
+#define C2000_RX_FE                 0x8000U
+#define C2000_RX_PE                 0x4000U
+
+#define C2000_MODEL_ACCESS_CYCLES   4U
+#define C2000_MODEL_POLL_CYCLES     8U
+
+/* ========================================================================== */
+/*                             模型狀態                                        */
+/* ========================================================================== */
+
+/** SCI發送端的觀測結果 */
+typedef struct {
+    uint8_t data[4096];
+    uint32_t count;                 // 已從線路送出的字元數
+    uint32_t gaps;                  // 字元之間出現空檔的次數
+    uint64_t idle_cycles;           // 字元之間的空檔總長 (CPU週期)
+    uint64_t first_start;           // 第一個字元開始發送的時間
+    uint64_t last_end;              // 最後一個字元發送完成的時間
+    uint32_t overruns;              // FIFO已滿時寫入TXBUF的次數
+    uint32_t aborted;               // 軟體重設中斷的字元數
+} c2000_sci_tx_t;
+
+/**
+ * @brief 建立模型區域
+ * SCI與GPIO攔截存取，系統控制為一般記憶體。
+ * GPIO控制暫存器全部為0 (GPIO功能、輸入、上拉使能)，GPxPUD測試需自行設定
+
+ * @param cpu_hz CPU時脈
+ * @param lspclk_hz SCI使用的低速週邊時脈
+ */
+void c2000_model_init(uint32_t cpu_hz, uint32_t lspclk_hz);
+
+/** 目前的模型時間 (CPU週期) */
+uint64_t c2000_model_now(void);
+
+/** 讓模型時間前進 */
+void c2000_model_advance(uint64_t cycles);
+
+/** SCI模組的暫存器區域與發送觀測 */
+mmio_region_t* c2000_model_sci_region(void);
+c2000_sci_tx_t* c2000_model_sci_tx(uint16_t module);
+void c2000_model_sci_tx_clear(uint16_t module);
+
+/** 目前設定下一個位元/一個字元的CPU週期數 */
+uint32_t c2000_model_sci_bit_cycles(uint16_t module);
+uint32_t c2000_model_sci_char_cycles(uint16_t module);
+
+/**
+ * @brief 安排線路上接收的字元
+ * @param module SCI模組
+ * @param data 字元
+ * @param flags C2000_RX_FE/C2000_RX_PE
+ * @param at 字元接收完成的模型時間
+ */
+void c2000_model_sci_rx_at(uint16_t module, uint8_t data, uint16_t flags, uint64_t at);
+
+/** 尚未到達的接收字元數 */
+uint32_t c2000_model_sci_rx_pending(uint16_t module);
+
+/** 系統控制區域 (一般記憶體) */
+mmio_region_t* c2000_model_cpusys_region(void);
+
+/**
+ * GPIO區域: GPxSET/GPxCLEAR/GPxTOGGLE的寫入作用在GPxDAT，讀取為0。
+ * GPxDAT為輸出鎖存器與引腳讀值共用，測試以c2000_model_gpio_set_input()模擬輸入
+ */
+mmio_region_t* c2000_model_gpio_ctrl_region(void);
+mmio_region_t* c2000_model_gpio_data_region(void);
+
+/** 讀取GPIO暫存器 (port: 0 = 埠A，reg: C2000_GPx*字位移) */
+uint32_t c2000_model_gpio_ctrl(uint16_t port, uint16_t reg);
+uint32_t c2000_model_gpio_data(uint16_t port, uint16_t reg);
+
+/** 設定GPIO控制暫存器 (模擬重設後的非零值) */
+void c2000_model_gpio_ctrl_set(uint16_t port, uint16_t reg, uint32_t value);
+
+/** 以外部電位驅動輸入引腳 (只改變GPxDIR為輸入的位元) */
+void c2000_model_gpio_set_input(uint16_t port, uint32_t mask, uint32_t levels);
+
+/** 從上次清除後GPIO控制暫存器被寫入的次數 (讀改寫計為一次) */
+uint32_t c2000_model_gpio_ctrl_writes(uint16_t port, uint16_t reg);
+void c2000_model_gpio_ctrl_writes_clear(void);
+
+#endif /* C2000_MODEL_H */
@@ -0,0 +1,286 @@
+/**
+ * @file mmio.c
+ * @brief 主機端週邊暫存器模型框架 (x86-64 Linux)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+#include "mmio.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#define MMIO_MAX_REGIONS        16U
+#define MMIO_PF_WRITE           0x2UL       // 頁錯誤碼: 寫入存取
+#define MMIO_EFLAGS_TF          0x100UL     // 單步旗標
+
+static mmio_region_t regions[MMIO_MAX_REGIONS];
+static uint32_t region_count;
+static bool handlers_installed;
+
+// 正在單步執行的存取
+static mmio_region_t* pending_region;
+static uint32_t pending_offset;
+static bool pending_write;
+
+/* ========================================================================== */
+/*                             內部函式                                        */
+/* ========================================================================== */
+
+static mmio_region_t* find_host(const void* addr)
+{
+    const uint8_t* p = (const uint8_t*)addr;
+    uint32_t i;
+
+    for (i = 0; i < region_count; i++) {
+        if (p >= regions[i].host && p < regions[i].host + regions[i].size) {
+            return &regions[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void protect(mmio_region_t* region, int prot)
+{
+    if (mprotect(region->host, region->size, prot) != 0) {
+        perror("mprotect");
+        abort();
+    }
+}
+
+static void on_segv(int sig, siginfo_t* info, void* ucontext)
+{
+    ucontext_t* uc = (ucontext_t*)ucontext;
+    mmio_region_t* region = find_host(info->si_addr);
+
+    if (region == NULL || !region->trapped || pending_region != NULL) {
+        // 不是模型區域: 恢復預設處理，重新執行時正常中止
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    pending_region = region;
+    pending_offset = (uint32_t)((uint8_t*)info->si_addr - region->host);
+    pending_write = (uc->uc_mcontext.gregs[REG_ERR] & MMIO_PF_WRITE) != 0;
+
+    protect(region, PROT_READ | PROT_WRITE);
+    if (region->before != NULL) {
+        region->before(region->context, pending_offset, pending_write);
+    }
+
+    uc->uc_mcontext.gregs[REG_EFL] |= MMIO_EFLAGS_TF;
+}
+
+static void on_trap(int sig, siginfo_t* info, void* ucontext)
+{
+    ucontext_t* uc = (ucontext_t*)ucontext;
+    mmio_region_t* region = pending_region;
+
+    (void)info;
+
+    if (region == NULL) {
+        signal(sig, SIG_DFL);
+        return;
+    }
+
+    if (pending_write) {
+        region->writes++;
+    } else {
+        region->reads++;
+    }
+    if (region->after != NULL) {
+        region->after(region->context, pending_offset, pending_write);
+    }
+
+    pending_region = NULL;
+    protect(region, PROT_NONE);
+    uc->uc_mcontext.gregs[REG_EFL] &= ~MMIO_EFLAGS_TF;
+}
+
+static void install_handlers(void)
+{
+    struct sigaction sa;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_flags = SA_SIGINFO;
+    sa.sa_sigaction = on_segv;
+    sigaction(SIGSEGV, &sa, NULL);
+    sa.sa_sigaction = on_trap;
+    sigaction(SIGTRAP, &sa, NULL);
+    handlers_installed = true;
+}
+
+/**
+ * @brief 建立區域並配置主機記憶體
+ * @param fixed 非NULL時要求主機位址等於此位址
+ */
+static mmio_region_t* region_create(const char* name, uint32_t device_base, uint32_t units,
+                                    uint32_t unit_bytes, bool trapped, mmio_hook_t before,
+                                    mmio_hook_t after, void* context, void* fixed)
+{
+    uint32_t page = (uint32_t)sysconf(_SC_PAGESIZE);
+    mmio_region_t* region;
+    void* host;
+
+    if (region_count >= MMIO_MAX_REGIONS) {
+        fprintf(stderr, "mmio: too many regions\n");
+        abort();
+    }
+    if (!handlers_installed) {
+        install_handlers();
+    }
+
+    region = &regions[region_count];
+    memset(region, 0, sizeof(*region));
+    region->name = name;
+    region->size = ((units * unit_bytes) + page - 1U) / page * page;
+    region->device_base = device_base;
+    region->units = units;
+    region->unit_bytes = unit_bytes;
+    region->trapped = trapped;
+    region->before = before;
+    region->after = after;
+    region->context = context;
+
+    host = mmap(fixed, region->size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | ((fixed != NULL) ? MAP_FIXED_NOREPLACE : 0),
+                -1, 0);
+    if (host == MAP_FAILED) {
+        perror("mmap");
+        abort();
+    }
+    if (fixed != NULL && host != fixed) {
+        // 舊核心不支援MAP_FIXED_NOREPLACE時會當作提示位址
+        fprintf(stderr, "mmio: cannot map %s at 0x%08lX\n", name, (unsigned long)device_base);
+        abort();
+    }
+    region->host = (uint8_t*)host;
+    if (trapped) {
+        protect(region, PROT_NONE);
+    }
+
+    region_count++;
+    return region;
+}
+
+/* ========================================================================== */
+/*                             介面實現                                        */
+/* ========================================================================== */
+
+mmio_region_t* mmio_add(const char* name, uint32_t device_base, uint32_t units,
+                        uint32_t unit_bytes, bool trapped,
+                        mmio_hook_t before, mmio_hook_t after, void* context)
+{
+    return region_create(name, device_base, units, unit_bytes, trapped,
+                         before, after, context, NULL);
+}
+
+mmio_region_t* mmio_add_fixed(const char* name, uint32_t device_base, uint32_t size,
+                              bool trapped, mmio_hook_t before, mmio_hook_t after,
+                              void* context)
+{
+    return region_create(name, device_base, size, 1U, trapped,
+                         before, after, context, (void*)(uintptr_t)device_base);
+}
+
+void mmio_reset(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < region_count; i++) {
+        munmap(regions[i].host, regions[i].size);
+    }
+    region_count = 0;
+}
+
+void* mmio_map(uintptr_t device_addr)
+{
+    uint32_t i;
+
+    for (i = 0; i < region_count; i++) {
+        mmio_region_t* r = &regions[i];
+
+        // 以登錄的單位數判斷，頁對齊補足的部分可能與下一個區域的位址重疊
+        if (device_addr >= r->device_base && device_addr < r->device_base + r->units) {
+            return r->host + (device_addr - r->device_base) * r->unit_bytes;
+        }
+    }
+
+    fprintf(stderr, "mmio: access to unmapped device address 0x%08lX\n",
+            (unsigned long)device_addr);
+    abort();
+}
+
+void mmio_unprotect(mmio_region_t* region)
+{
+    if (region->trapped) {
+        protect(region, PROT_READ | PROT_WRITE);
+    }
+}
+
+void mmio_protect(mmio_region_t* region)
+{
+    if (region->trapped) {
+        protect(region, PROT_NONE);
+    }
+}
+
+uint16_t mmio_peek16(mmio_region_t* region, uint32_t offset)
+{
+    uint16_t value;
+
+    if (region->trapped) {
+        protect(region, PROT_READ);
+    }
+    value = *mmio_reg16(region, offset);
+    if (region->trapped) {
+        protect(region, PROT_NONE);
+    }
+
+    return value;
+}
+
+uint32_t mmio_peek32(mmio_region_t* region, uint32_t offset)
+{
+    uint32_t value;
+
+    if (region->trapped) {
+        protect(region, PROT_READ);
+    }
+    value = *mmio_reg32(region, offset);
+    if (region->trapped) {
+        protect(region, PROT_NONE);
+    }
+
+    return value;
+}
+
+void mmio_poke16(mmio_region_t* region, uint32_t offset, uint16_t value)
+{
+    if (region->trapped) {
+        protect(region, PROT_READ | PROT_WRITE);
+    }
+    *mmio_reg16(region, offset) = value;
+    if (region->trapped) {
+        protect(region, PROT_NONE);
+    }
+}
+
+void mmio_poke32(mmio_region_t* region, uint32_t offset, uint32_t value)
+{
+    if (region->trapped) {
+        protect(region, PROT_READ | PROT_WRITE);
+    }
+    *mmio_reg32(region, offset) = value;
+    if (region->trapped) {
+        protect(region, PROT_NONE);
+    }
+}
@@ -0,0 +1,92 @@
+/**
+ * @file mmio.h
+ * @brief 主機端週邊暫存器模型框架
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 平台驅動以volatile指標直接存取暫存器，主機端無法攔截一般的記憶體存取。
+ * 模型區域以mprotect()設為不可存取，每次存取觸發SIGSEGV:
+ * 先呼叫before回呼 (更新狀態暫存器)，單步執行該指令後再呼叫after回呼
+ * (處理寫入或讀取的副作用)，最後恢復保護。驅動原始碼不需任何修改。
+ *
+ * 裝置位址經mmio_map()轉換為主機位址 (平台標頭檔的位址轉換巨集使用)，
+ * 存取未登錄的位址會直接中止並列出該位址。
+ * 週邊指標為常數運算式的平台 (STM32的GPIOA等) 以mmio_add_fixed()
+ * 將區域放在與裝置位址相同的主機位址，不需位址轉換。
+ * 只支援x86-64 Linux (使用頁錯誤碼與TF單步旗標)。
+ */
+
+#ifndef MMIO_H
+#define MMIO_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** 存取回呼 (offset為相對區域起點的位元組偏移) */
+typedef void (*mmio_hook_t)(void* context, uint32_t offset, bool write);
+
+/** 模型區域 */
+typedef struct {
+    const char* name;
+    uint8_t* host;              // 主機記憶體 (頁對齊)
+    uint32_t size;              // 位元組數 (頁對齊)
+    uint32_t device_base;       // 裝置位址
+    uint32_t units;             // 裝置位址單位數 (位址轉換只涵蓋此範圍)
+    uint32_t unit_bytes;        // 每個裝置位址單位的位元組數 (C2000: 2，STM32: 1)
+    bool trapped;               // 是否攔截存取
+    mmio_hook_t before;
+    mmio_hook_t after;
+    void* context;
+    uint32_t reads;             // 攔截到的讀取次數
+    uint32_t writes;            // 攔截到的寫入次數 (讀改寫指令計為寫入)
+} mmio_region_t;
+
+/**
+ * @brief 登錄模型區域
+ * @param name 區域名稱 (錯誤訊息用)
+ * @param device_base 裝置位址
+ * @param units 裝置位址單位數
+ * @param unit_bytes 每個位址單位的位元組數
+ * @param trapped true表示攔截每次存取並呼叫回呼，false為一般記憶體
+ * @return 區域指標 (內容初始為0)
+ */
+mmio_region_t* mmio_add(const char* name, uint32_t device_base, uint32_t units,
+                        uint32_t unit_bytes, bool trapped,
+                        mmio_hook_t before, mmio_hook_t after, void* context);
+
+/**
+ * @brief 在與裝置位址相同的主機位址登錄模型區域 (每個位址單位1位元組)
+ * 裝置位址需頁對齊，且該主機位址範圍未被使用，否則中止程式
+ */
+mmio_region_t* mmio_add_fixed(const char* name, uint32_t device_base, uint32_t size,
+                              bool trapped, mmio_hook_t before, mmio_hook_t after,
+                              void* context);
+
+/** 移除所有區域 */
+void mmio_reset(void);
+
+/** 裝置位址轉換為主機位址 (未登錄的位址中止程式) */
+void* mmio_map(uintptr_t device_addr);
+
+/** 測試端直接讀寫模型記憶體 (不觸發回呼) */
+uint16_t mmio_peek16(mmio_region_t* region, uint32_t offset);
+uint32_t mmio_peek32(mmio_region_t* region, uint32_t offset);
+void mmio_poke16(mmio_region_t* region, uint32_t offset, uint16_t value);
+void mmio_poke32(mmio_region_t* region, uint32_t offset, uint32_t value);
+
+/** 測試端暫時解除/恢復保護，期間可用mmio_reg16/32直接存取 (不可在回呼中呼叫) */
+void mmio_unprotect(mmio_region_t* region);
+void mmio_protect(mmio_region_t* region);
+
+/** 回呼中存取模型記憶體 (區域在回呼期間不受保護) */
+static inline volatile uint16_t* mmio_reg16(mmio_region_t* region, uint32_t offset)
+{
+    return (volatile uint16_t*)(region->host + offset);
+}
+
+static inline volatile uint32_t* mmio_reg32(mmio_region_t* region, uint32_t offset)
+{
+    return (volatile uint32_t*)(region->host + offset);
+}
+
+#endif /* MMIO_H */
@@ -0,0 +1,282 @@
+/**
+ * @file stm32g4xx.h
+ * @brief 主機端測試用的CMSIS stm32g4xx.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 週邊基底位址與裝置相同，模型區域以mmio_add_fixed()放在相同的主機位址，
+ * GPIOA等保持常數運算式，驅動中的靜態指標表可直接使用。
+ * Cortex-M核心暫存器 (PRIMASK、BASEPRI、NVIC使能與優先權) 以變數模擬，定義在stm32g4_model.c。
+ */
+
+#ifndef STM32G4XX_H
+#define STM32G4XX_H
+
+#include <stdint.h>
+
+#define __IO                            volatile
+
+/* ========================================================================== */
+/*                             暫存器存取巨集                                  */
+/* ========================================================================== */
+
+#define SET_BIT(REG, BIT)               ((REG) |= (BIT))
+#define CLEAR_BIT(REG, BIT)             ((REG) &= ~(BIT))
+#define READ_BIT(REG, BIT)              ((REG) & (BIT))
+#define WRITE_REG(REG, VAL)             ((REG) = (VAL))
+#define READ_REG(REG)                   ((REG))
+#define MODIFY_REG(REG, CLEARMASK, SETMASK) \
+    WRITE_REG((REG), (((READ_REG(REG)) & (~(CLEARMASK))) | (SETMASK)))
+
+/* ========================================================================== */
+/*                             週邊暫存器 (stm32g474xx.h)                      */
+/* ========================================================================== */
+
+typedef struct {
+    __IO uint32_t MODER;        // 0x00
+    __IO uint32_t OTYPER;       // 0x04
+    __IO uint32_t OSPEEDR;      // 0x08
+    __IO uint32_t PUPDR;        // 0x0C
+    __IO uint32_t IDR;          // 0x10
+    __IO uint32_t ODR;          // 0x14
+    __IO uint32_t BSRR;         // 0x18
+    __IO uint32_t LCKR;         // 0x1C
+    __IO uint32_t AFR[2];       // 0x20
+    __IO uint32_t BRR;          // 0x28
+} GPIO_TypeDef;
+
+/** 只列出到APB2ENR為止的欄位 */
+typedef struct {
+    __IO uint32_t RESERVED[18];
+    __IO uint32_t AHB1ENR;      // 0x48
+    __IO uint32_t AHB2ENR;      // 0x4C
+    __IO uint32_t AHB3ENR;      // 0x50
+    __IO uint32_t RESERVED1;    // 0x54
+    __IO uint32_t APB1ENR1;     // 0x58
+    __IO uint32_t APB1ENR2;     // 0x5C
+    __IO uint32_t APB2ENR;      // 0x60
+} RCC_TypeDef;
+
+typedef struct {
+    __IO uint32_t CR1;          // 0x00
+    __IO uint32_t CR2;          // 0x04
+    __IO uint32_t CR3;          // 0x08
+    __IO uint32_t BRR;          // 0x0C
+    __IO uint32_t GTPR;         // 0x10
+    __IO uint32_t RTOR;         // 0x14
+    __IO uint32_t RQR;          // 0x18
+    __IO uint32_t ISR;          // 0x1C
+    __IO uint32_t ICR;          // 0x20
+    __IO uint32_t RDR;          // 0x24
+    __IO uint32_t TDR;          // 0x28
+    __IO uint32_t PRESC;        // 0x2C
+} USART_TypeDef;
+
+#define RCC_BASE                        0x40021000UL
+#define USART2_BASE                     0x40004400UL
+#define USART3_BASE                     0x40004800UL
+#define UART4_BASE                      0x40004C00UL
+#define UART5_BASE                      0x40005000UL
+#define USART1_BASE                     0x40013800UL
+#define GPIOA_BASE                      0x48000000UL
+#define GPIOB_BASE                      0x48000400UL
+#define GPIOC_BASE                      0x48000800UL
+#define GPIOD_BASE                      0x48000C00UL
+#define GPIOE_BASE                      0x48001000UL
+#define GPIOF_BASE                      0x48001400UL
+#define GPIOG_BASE                      0x48001800UL
+
+#define RCC                             ((RCC_TypeDef*)RCC_BASE)
+#define GPIOA                           ((GPIO_TypeDef*)GPIOA_BASE)
+#define GPIOB                           ((GPIO_TypeDef*)GPIOB_BASE)
+#define GPIOC                           ((GPIO_TypeDef*)GPIOC_BASE)
+#define GPIOD                           ((GPIO_TypeDef*)GPIOD_BASE)
+#define GPIOE                           ((GPIO_TypeDef*)GPIOE_BASE)
+#define GPIOF                           ((GPIO_TypeDef*)GPIOF_BASE)
+#define GPIOG                           ((GPIO_TypeDef*)GPIOG_BASE)
+#define USART1                          ((USART_TypeDef*)USART1_BASE)
+#define USART2                          ((USART_TypeDef*)USART2_BASE)
+#define USART3                          ((USART_TypeDef*)USART3_BASE)
+#define UART4                           ((USART_TypeDef*)UART4_BASE)
+#define UART5                           ((USART_TypeDef*)UART5_BASE)
+
+#define RCC_AHB2ENR_GPIOAEN             (1UL << 0)
+#define RCC_AHB2ENR_GPIOBEN             (1UL << 1)
+#define RCC_AHB2ENR_GPIOCEN             (1UL << 2)
+#define RCC_AHB2ENR_GPIODEN             (1UL << 3)
+#define RCC_AHB2ENR_GPIOEEN             (1UL << 4)
+#define RCC_AHB2ENR_GPIOFEN             (1UL << 5)
+#define RCC_AHB2ENR_GPIOGEN             (1UL << 6)
+#define RCC_APB1ENR1_USART2EN           (1UL << 17)
+#define RCC_APB1ENR1_USART3EN           (1UL << 18)
+#define RCC_APB1ENR1_UART4EN            (1UL << 19)
+#define RCC_APB1ENR1_UART5EN            (1UL << 20)
+#define RCC_APB2ENR_USART1EN            (1UL << 14)
+
+// USART暫存器位元 (只列出驅動與LL替身用到的欄位)
+#define USART_CR1_UE                    (1UL << 0)
+#define USART_CR1_RE                    (1UL << 2)
+#define USART_CR1_TE                    (1UL << 3)
+#define USART_CR1_PEIE                  (1UL << 8)
+#define USART_CR1_PS                    (1UL << 9)
+#define USART_CR1_PCE                   (1UL << 10)
+#define USART_CR1_M0                    (1UL << 12)
+#define USART_CR1_CMIE                  (1UL << 14)
+#define USART_CR1_OVER8                 (1UL << 15)
+#define USART_CR1_RTOIE                 (1UL << 26)
+#define USART_CR1_M1                    (1UL << 28)
+#define USART_CR1_FIFOEN                (1UL << 29)
+#define USART_CR1_M                     (USART_CR1_M0 | USART_CR1_M1)
+
+#define USART_CR2_ADDM7                 (1UL << 4)
+#define USART_CR2_LBDIE                 (1UL << 6)
+#define USART_CR2_CLKEN                 (1UL << 11)
+#define USART_CR2_STOP_Pos              12U
+#define USART_CR2_STOP                  (3UL << USART_CR2_STOP_Pos)
+#define USART_CR2_LINEN                 (1UL << 14)
+#define USART_CR2_ABREN                 (1UL << 20)
+#define USART_CR2_ABRMODE               (3UL << 21)
+#define USART_CR2_RTOEN                 (1UL << 23)
+#define USART_CR2_ADD_Pos               24U
+#define USART_CR2_ADD                   (0xFFUL << USART_CR2_ADD_Pos)
+
+#define USART_CR3_EIE                   (1UL << 0)
+#define USART_CR3_IREN                  (1UL << 1)
+#define USART_CR3_HDSEL                 (1UL << 3)
+#define USART_CR3_SCEN                  (1UL << 5)
+#define USART_CR3_RTSE                  (1UL << 8)
+#define USART_CR3_CTSE                  (1UL << 9)
+#define USART_CR3_TXFTIE                (1UL << 23)
+#define USART_CR3_RXFTCFG               (7UL << 25)
+#define USART_CR3_RXFTIE                (1UL << 28)
+#define USART_CR3_TXFTCFG               (7UL << 29)
+
+#define USART_RTOR_RTO                  0x00FFFFFFUL
+#define USART_RQR_RXFRQ                 (1UL << 3)
+
+#define USART_ISR_PE                    (1UL << 0)
+#define USART_ISR_FE                    (1UL << 1)
+#define USART_ISR_NE                    (1UL << 2)
+#define USART_ISR_ORE                   (1UL << 3)
+#define USART_ISR_RXNE_RXFNE            (1UL << 5)
+#define USART_ISR_TC                    (1UL << 6)
+#define USART_ISR_TXE_TXFNF             (1UL << 7)
+#define USART_ISR_RTOF                  (1UL << 11)
+#define USART_ISR_ABRE                  (1UL << 14)
+#define USART_ISR_ABRF                  (1UL << 15)
+#define USART_ISR_CMF                   (1UL << 17)
+#define USART_ISR_TEACK                 (1UL << 21)
+#define USART_ISR_REACK                 (1UL << 22)
+
+#define USART_ICR_PECF                  (1UL << 0)
+#define USART_ICR_FECF                  (1UL << 1)
+#define USART_ICR_NECF                  (1UL << 2)
+#define USART_ICR_ORECF                 (1UL << 3)
+#define USART_ICR_RTOCF                 (1UL << 11)
+#define USART_ICR_CMCF                  (1UL << 17)
+
+#define USART_PRESC_PRESCALER           0x0000000FUL
+
+/** 中斷編號 (stm32g474xx.h，只列出驅動用到的) */
+typedef enum {
+    USART1_IRQn = 37,
+    USART2_IRQn = 38,
+    USART3_IRQn = 39,
+    UART4_IRQn = 52,
+    UART5_IRQn = 53
+} IRQn_Type;
+
+/* ========================================================================== */
+/*                             Cortex-M4核心 (core_cm4.h、cmsis_gcc.h)         */
+/* ========================================================================== */
+
+#define __NVIC_PRIO_BITS                4U
+
+extern volatile uint32_t cortexm_host_primask;
+extern volatile uint32_t cortexm_host_basepri;
+
+static inline uint32_t __get_PRIMASK(void)
+{
+    return cortexm_host_primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+    cortexm_host_primask = primask & 1U;
+}
+
+static inline void __disable_irq(void)
+{
+    cortexm_host_primask = 1U;
+}
+
+static inline void __enable_irq(void)
+{
+    cortexm_host_primask = 0U;
+}
+
+static inline uint32_t __get_BASEPRI(void)
+{
+    return cortexm_host_basepri;
+}
+
+static inline void __set_BASEPRI(uint32_t basepri)
+{
+    cortexm_host_basepri = basepri & 0xFFU;
+}
+
+/** 只在新值會提高遮罩範圍時寫入 (BASEPRI_MAX) */
+static inline void __set_BASEPRI_MAX(uint32_t basepri)
+{
+    basepri &= 0xFFU;
+    if (basepri != 0U && (cortexm_host_basepri == 0U || basepri < cortexm_host_basepri)) {
+        cortexm_host_basepri = basepri;
+    }
+}
+
+/** NVIC使能位元與優先權 (8位元欄位，只用高__NVIC_PRIO_BITS位元) */
+extern volatile uint32_t cortexm_host_nvic_iser[8];
+extern volatile uint8_t cortexm_host_nvic_ip[256];
+
+static inline void NVIC_EnableIRQ(IRQn_Type irqn)
+{
+    cortexm_host_nvic_iser[(uint32_t)irqn >> 5] |= (1UL << ((uint32_t)irqn & 0x1FU));
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type irqn)
+{
+    cortexm_host_nvic_iser[(uint32_t)irqn >> 5] &= ~(1UL << ((uint32_t)irqn & 0x1FU));
+}
+
+static inline uint32_t NVIC_GetEnableIRQ(IRQn_Type irqn)
+{
+    return (cortexm_host_nvic_iser[(uint32_t)irqn >> 5] >> ((uint32_t)irqn & 0x1FU)) & 1U;
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irqn, uint32_t priority)
+{
+    cortexm_host_nvic_ip[(uint32_t)irqn] = (uint8_t)((priority << (8U - __NVIC_PRIO_BITS)) & 0xFFU);
+}
+
+/** 主機端為單執行緒，獨佔存取一定成功 */
+static inline uint32_t __LDREXW(volatile uint32_t* addr)
+{
+    return *addr;
+}
+
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t* addr)
+{
+    *addr = value;
+    return 0U;
+}
+
+static inline void __CLREX(void)
+{
+}
+
+static inline void __DMB(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+#endif /* STM32G4XX_H */
@@ -0,0 +1,98 @@
+/**
+ * @file stm32g4xx_hal.h
+ * @brief 主機端測試用的STM32CubeG4 stm32g4xx_hal.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 只提供GPIO驅動 (LL版與HAL版) 與UART驅動用到的HAL型別與函式，
+ * 暫存器結構與核心函式在stm32g4xx.h。
+ */
+
+#ifndef STM32G4XX_HAL_H
+#define STM32G4XX_HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "stm32g4xx.h"
+
+#define UNUSED(x)                       ((void)(x))
+
+/* ========================================================================== */
+/*                             HAL驅動 (stm32g4xx_hal_def.h、_rcc.h、_gpio.h) */
+/* ========================================================================== */
+
+/**
+ * ST的HAL_StatusTypeDef列舉值 (HAL_OK等) 與hal_status_t同名，
+ * 受測驅動只在函式宣告中使用此型別，這裡以整數代替
+ */
+typedef int HAL_StatusTypeDef;
+
+#define GPIO_RCC_CLK_ENABLE(bit)        do {                        \
+        __IO uint32_t tmpreg;                                       \
+        SET_BIT(RCC->AHB2ENR, (bit));                               \
+        tmpreg = READ_BIT(RCC->AHB2ENR, (bit));                     \
+        UNUSED(tmpreg);                                             \
+    } while (0)
+
+#define __HAL_RCC_GPIOA_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOAEN)
+#define __HAL_RCC_GPIOB_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOBEN)
+#define __HAL_RCC_GPIOC_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOCEN)
+#define __HAL_RCC_GPIOD_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIODEN)
+#define __HAL_RCC_GPIOE_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOEEN)
+#define __HAL_RCC_GPIOF_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOFEN)
+#define __HAL_RCC_GPIOG_CLK_ENABLE()    GPIO_RCC_CLK_ENABLE(RCC_AHB2ENR_GPIOGEN)
+
+#define APB_RCC_CLK_ENABLE(reg, bit)    do {                        \
+        __IO uint32_t tmpreg;                                       \
+        SET_BIT(RCC->reg, (bit));                                   \
+        tmpreg = READ_BIT(RCC->reg, (bit));                         \
+        UNUSED(tmpreg);                                             \
+    } while (0)
+
+#define __HAL_RCC_USART1_CLK_ENABLE()   APB_RCC_CLK_ENABLE(APB2ENR, RCC_APB2ENR_USART1EN)
+#define __HAL_RCC_USART2_CLK_ENABLE()   APB_RCC_CLK_ENABLE(APB1ENR1, RCC_APB1ENR1_USART2EN)
+#define __HAL_RCC_USART3_CLK_ENABLE()   APB_RCC_CLK_ENABLE(APB1ENR1, RCC_APB1ENR1_USART3EN)
+#define __HAL_RCC_UART4_CLK_ENABLE()    APB_RCC_CLK_ENABLE(APB1ENR1, RCC_APB1ENR1_UART4EN)
+#define __HAL_RCC_UART5_CLK_ENABLE()    APB_RCC_CLK_ENABLE(APB1ENR1, RCC_APB1ENR1_UART5EN)
+
+/** APB時鐘 (由stm32g4_model.c提供，預設170 MHz) */
+uint32_t HAL_RCC_GetPCLK1Freq(void);
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
+typedef struct {
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Pull;
+    uint32_t Speed;
+    uint32_t Alternate;
+} GPIO_InitTypeDef;
+
+typedef enum {
+    GPIO_PIN_RESET = 0U,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+#define GPIO_MODE_INPUT                 0x00000000UL
+#define GPIO_MODE_OUTPUT_PP             0x00000001UL
+#define GPIO_MODE_OUTPUT_OD             0x00000011UL
+#define GPIO_MODE_AF_PP                 0x00000002UL
+#define GPIO_MODE_AF_OD                 0x00000012UL
+#define GPIO_MODE_ANALOG                0x00000003UL
+
+#define GPIO_NOPULL                     0x00000000UL
+#define GPIO_PULLUP                     0x00000001UL
+#define GPIO_PULLDOWN                   0x00000002UL
+
+#define GPIO_SPEED_FREQ_LOW             0x00000000UL
+#define GPIO_SPEED_FREQ_MEDIUM          0x00000001UL
+#define GPIO_SPEED_FREQ_HIGH            0x00000002UL
+#define GPIO_SPEED_FREQ_VERY_HIGH       0x00000003UL
+
+/** 替身實現位於stm32g4xx_hal_gpio.c，暫存器存取順序依ST原始碼 */
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init);
+void HAL_GPIO_DeInit(GPIO_TypeDef* GPIOx, uint32_t GPIO_Pin);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+
+#endif /* STM32G4XX_HAL_H */
@@ -0,0 +1,111 @@
+/**
+ * @file stm32g4xx_hal_gpio.c
+ * @brief 主機端測試用的STM32CubeG4 HAL GPIO替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 暫存器讀寫的順序與次數依STM32CubeG4 HAL (stm32g4xx_hal_gpio.c) 原始碼，
+ * 用來在暫存器模型上比較HAL版與LL版GPIO驅動的存取次數。
+ * 省略EXTI/SYSCFG設定 (受測驅動不使用中斷模式) 與參數檢查。
+ */
+
+#include "stm32g4xx_hal.h"
+
+#define GPIO_NUMBER             16U
+#define GPIO_MODE               0x00000003UL
+#define GPIO_OUTPUT_TYPE        0x00000010UL
+#define GPIO_OUTPUT_TYPE_POS    4U
+#define MODE_OUTPUT             0x00000001UL
+#define MODE_AF                 0x00000002UL
+#define MODE_ANALOG             0x00000003UL
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init)
+{
+    uint32_t position = 0;
+    uint32_t iocurrent;
+    uint32_t temp;
+
+    while (((GPIO_Init->Pin) >> position) != 0U) {
+        iocurrent = (GPIO_Init->Pin) & (1UL << position);
+
+        if (iocurrent != 0U) {
+            // 輸出與複用模式: 速度與輸出類型
+            if (((GPIO_Init->Mode & GPIO_MODE) == MODE_OUTPUT) ||
+                ((GPIO_Init->Mode & GPIO_MODE) == MODE_AF)) {
+                temp = GPIOx->OSPEEDR;
+                temp &= ~(3UL << (position * 2U));
+                temp |= (GPIO_Init->Speed << (position * 2U));
+                GPIOx->OSPEEDR = temp;
+
+                temp = GPIOx->OTYPER;
+                temp &= ~(1UL << position);
+                temp |= (((GPIO_Init->Mode & GPIO_OUTPUT_TYPE) >> GPIO_OUTPUT_TYPE_POS) << position);
+                GPIOx->OTYPER = temp;
+            }
+
+            // 類比模式以外: 上拉/下拉
+            if ((GPIO_Init->Mode & GPIO_MODE) != MODE_ANALOG) {
+                temp = GPIOx->PUPDR;
+                temp &= ~(3UL << (position * 2U));
+                temp |= ((GPIO_Init->Pull) << (position * 2U));
+                GPIOx->PUPDR = temp;
+            }
+
+            // 複用模式: 複用功能選擇
+            if ((GPIO_Init->Mode & GPIO_MODE) == MODE_AF) {
+                temp = GPIOx->AFR[position >> 3U];
+                temp &= ~(0xFUL << ((position & 0x07U) * 4U));
+                temp |= ((GPIO_Init->Alternate) << ((position & 0x07U) * 4U));
+                GPIOx->AFR[position >> 3U] = temp;
+            }
+
+            temp = GPIOx->MODER;
+            temp &= ~(3UL << (position * 2U));
+            temp |= ((GPIO_Init->Mode & GPIO_MODE) << (position * 2U));
+            GPIOx->MODER = temp;
+        }
+
+        position++;
+    }
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef* GPIOx, uint32_t GPIO_Pin)
+{
+    uint32_t position = 0;
+    uint32_t iocurrent;
+
+    while ((GPIO_Pin >> position) != 0U) {
+        iocurrent = GPIO_Pin & (1UL << position);
+
+        if (iocurrent != 0U) {
+            GPIOx->MODER |= (3UL << (position * 2U));
+            GPIOx->AFR[position >> 3U] &= ~(0xFUL << ((position & 0x07U) * 4U));
+            GPIOx->OSPEEDR &= ~(3UL << (position * 2U));
+            GPIOx->OTYPER &= ~(1UL << position);
+            GPIOx->PUPDR &= ~(3UL << (position * 2U));
+        }
+
+        position++;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+    return ((GPIOx->IDR & GPIO_Pin) != 0U) ? GPIO_PIN_SET : GPIO_PIN_RESET;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+    if (PinState != GPIO_PIN_RESET) {
+        GPIOx->BSRR = (uint32_t)GPIO_Pin;
+    } else {
+        GPIOx->BRR = (uint32_t)GPIO_Pin;
+    }
+}
+
+void HAL_GPIO_TogglePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+    uint32_t odr = GPIOx->ODR;
+
+    GPIOx->BSRR = ((odr & GPIO_Pin) << GPIO_NUMBER) | (~odr & GPIO_Pin);
+}
@@ -0,0 +1,59 @@
+/**
+ * @file stm32g4xx_ll_gpio.h
+ * @brief 主機端測試用的STM32CubeG4 stm32g4xx_ll_gpio.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 只提供UART驅動配置引腳用到的LL_GPIO_Init()，暫存器寫入依ST原始碼的欄位。
+ */
+
+#ifndef STM32G4XX_LL_GPIO_H
+#define STM32G4XX_LL_GPIO_H
+
+#include "stm32g4xx_hal.h"
+
+#define LL_GPIO_PIN_2                   (1UL << 2)
+#define LL_GPIO_PIN_3                   (1UL << 3)
+#define LL_GPIO_PIN_9                   (1UL << 9)
+#define LL_GPIO_PIN_10                  (1UL << 10)
+#define LL_GPIO_PIN_11                  (1UL << 11)
+#define LL_GPIO_PIN_12                  (1UL << 12)
+
+#define LL_GPIO_MODE_ALTERNATE          0x2UL
+#define LL_GPIO_SPEED_FREQ_HIGH         0x2UL
+#define LL_GPIO_OUTPUT_PUSHPULL         0x0UL
+#define LL_GPIO_PULL_UP                 0x1UL
+#define LL_GPIO_AF_5                    0x5UL
+#define LL_GPIO_AF_7                    0x7UL
+
+typedef struct {
+    uint32_t Pin;
+    uint32_t Mode;
+    uint32_t Speed;
+    uint32_t OutputType;
+    uint32_t Pull;
+    uint32_t Alternate;
+} LL_GPIO_InitTypeDef;
+
+static inline int LL_GPIO_Init(GPIO_TypeDef* GPIOx, LL_GPIO_InitTypeDef* init)
+{
+    uint32_t pin;
+
+    for (pin = 0; pin < 16U; pin++) {
+        uint32_t shift2 = pin * 2U;
+        uint32_t shift4 = (pin & 7U) * 4U;
+
+        if ((init->Pin & (1UL << pin)) == 0U) {
+            continue;
+        }
+        MODIFY_REG(GPIOx->OSPEEDR, 3UL << shift2, init->Speed << shift2);
+        MODIFY_REG(GPIOx->OTYPER, 1UL << pin, init->OutputType << pin);
+        MODIFY_REG(GPIOx->PUPDR, 3UL << shift2, init->Pull << shift2);
+        MODIFY_REG(GPIOx->AFR[pin >> 3], 0xFUL << shift4, init->Alternate << shift4);
+        MODIFY_REG(GPIOx->MODER, 3UL << shift2, init->Mode << shift2);
+    }
+
+    return 0;
+}
+
+#endif /* STM32G4XX_LL_GPIO_H */
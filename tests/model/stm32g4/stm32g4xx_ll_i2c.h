@@ -0,0 +1,13 @@
+/**
+ * @file stm32g4xx_ll_i2c.h
+ * @brief 主機端測試用的STM32CubeG4 LL標頭檔替身 (內容在stm32g4xx_hal.h)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#ifndef STM32G4XX_LL_I2C_H
+#define STM32G4XX_LL_I2C_H
+
+#include "stm32g4xx_hal.h"
+
+#endif /* STM32G4XX_LL_I2C_H */
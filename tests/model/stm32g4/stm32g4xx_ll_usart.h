@@ -0,0 +1,189 @@
+/**
+ * @file stm32g4xx_ll_usart.h
+ * @brief 主機端測試用的STM32CubeG4 stm32g4xx_ll_usart.h替身
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 只提供UART驅動用到的LL函式，暫存器操作與ST原始碼相同 (皆為單一暫存器的讀改寫)，
+ * 驅動的存取順序在USART模型上與目標平台一致。
+ */
+
+#ifndef STM32G4XX_LL_USART_H
+#define STM32G4XX_LL_USART_H
+
+#include "stm32g4xx_hal.h"
+
+#define LL_USART_DATAWIDTH_7B                   USART_CR1_M1
+#define LL_USART_DATAWIDTH_8B                   0x00000000UL
+#define LL_USART_DATAWIDTH_9B                   USART_CR1_M0
+#define LL_USART_PARITY_NONE                    0x00000000UL
+#define LL_USART_PARITY_EVEN                    USART_CR1_PCE
+#define LL_USART_PARITY_ODD                     (USART_CR1_PCE | USART_CR1_PS)
+#define LL_USART_STOPBITS_1                     0x00000000UL
+#define LL_USART_STOPBITS_2                     (2UL << 12)
+#define LL_USART_DIRECTION_TX_RX                (USART_CR1_TE | USART_CR1_RE)
+#define LL_USART_HWCONTROL_NONE                 0x00000000UL
+#define LL_USART_OVERSAMPLING_16                0x00000000UL
+#define LL_USART_OVERSAMPLING_8                 USART_CR1_OVER8
+#define LL_USART_FIFOTHRESHOLD_1_2              0x00000002UL
+#define LL_USART_AUTOBAUD_DETECT_ON_55_FRAME    USART_CR2_ABRMODE
+
+static inline void LL_USART_Enable(USART_TypeDef* USARTx)
+{
+    SET_BIT(USARTx->CR1, USART_CR1_UE);
+}
+
+static inline void LL_USART_Disable(USART_TypeDef* USARTx)
+{
+    CLEAR_BIT(USARTx->CR1, USART_CR1_UE);
+}
+
+static inline void LL_USART_EnableFIFO(USART_TypeDef* USARTx)
+{
+    SET_BIT(USARTx->CR1, USART_CR1_FIFOEN);
+}
+
+static inline void LL_USART_SetRXFIFOThreshold(USART_TypeDef* USARTx, uint32_t threshold)
+{
+    MODIFY_REG(USARTx->CR3, USART_CR3_RXFTCFG, threshold << 25);
+}
+
+static inline void LL_USART_SetDataWidth(USART_TypeDef* USARTx, uint32_t width)
+{
+    MODIFY_REG(USARTx->CR1, USART_CR1_M, width);
+}
+
+static inline void LL_USART_SetParity(USART_TypeDef* USARTx, uint32_t parity)
+{
+    MODIFY_REG(USARTx->CR1, USART_CR1_PS | USART_CR1_PCE, parity);
+}
+
+static inline void LL_USART_SetStopBitsLength(USART_TypeDef* USARTx, uint32_t stopbits)
+{
+    MODIFY_REG(USARTx->CR2, USART_CR2_STOP, stopbits);
+}
+
+static inline void LL_USART_SetTransferDirection(USART_TypeDef* USARTx, uint32_t direction)
+{
+    MODIFY_REG(USARTx->CR1, USART_CR1_RE | USART_CR1_TE, direction);
+}
+
+static inline void LL_USART_SetHWFlowCtrl(USART_TypeDef* USARTx, uint32_t flow)
+{
+    MODIFY_REG(USARTx->CR3, USART_CR3_RTSE | USART_CR3_CTSE, flow);
+}
+
+static inline void LL_USART_ConfigAsyncMode(USART_TypeDef* USARTx)
+{
+    CLEAR_BIT(USARTx->CR2, USART_CR2_LINEN | USART_CR2_CLKEN);
+    CLEAR_BIT(USARTx->CR3, USART_CR3_SCEN | USART_CR3_IREN | USART_CR3_HDSEL);
+}
+
+static inline void LL_USART_SetPrescaler(USART_TypeDef* USARTx, uint32_t prescaler)
+{
+    MODIFY_REG(USARTx->PRESC, USART_PRESC_PRESCALER, prescaler);
+}
+
+static inline void LL_USART_SetOverSampling(USART_TypeDef* USARTx, uint32_t oversampling)
+{
+    MODIFY_REG(USARTx->CR1, USART_CR1_OVER8, oversampling);
+}
+
+static inline void LL_USART_SetRxTimeout(USART_TypeDef* USARTx, uint32_t timeout)
+{
+    MODIFY_REG(USARTx->RTOR, USART_RTOR_RTO, timeout);
+}
+
+static inline void LL_USART_EnableRxTimeout(USART_TypeDef* USARTx)
+{
+    SET_BIT(USARTx->CR2, USART_CR2_RTOEN);
+}
+
+static inline void LL_USART_SetAutoBaudRateMode(USART_TypeDef* USARTx, uint32_t mode)
+{
+    MODIFY_REG(USARTx->CR2, USART_CR2_ABRMODE, mode);
+}
+
+static inline void LL_USART_EnableAutoBaudRate(USART_TypeDef* USARTx)
+{
+    SET_BIT(USARTx->CR2, USART_CR2_ABREN);
+}
+
+static inline void LL_USART_DisableAutoBaudRate(USART_TypeDef* USARTx)
+{
+    CLEAR_BIT(USARTx->CR2, USART_CR2_ABREN);
+}
+
+static inline void LL_USART_RequestRxDataFlush(USART_TypeDef* USARTx)
+{
+    SET_BIT(USARTx->RQR, USART_RQR_RXFRQ);
+}
+
+static inline void LL_USART_TransmitData8(USART_TypeDef* USARTx, uint8_t value)
+{
+    USARTx->TDR = value;
+}
+
+static inline uint8_t LL_USART_ReceiveData8(USART_TypeDef* USARTx)
+{
+    return (uint8_t)(READ_BIT(USARTx->RDR, 0x1FFUL) & 0xFFU);
+}
+
+/* ========================================================================== */
+/*                             中斷使能                                        */
+/* ========================================================================== */
+
+#define LL_USART_IT_FUNCS(name, reg, bit)                                   \
+    static inline void LL_USART_EnableIT_##name(USART_TypeDef* USARTx)      \
+    {                                                                       \
+        SET_BIT(USARTx->reg, bit);                                          \
+    }                                                                       \
+    static inline void LL_USART_DisableIT_##name(USART_TypeDef* USARTx)     \
+    {                                                                       \
+        CLEAR_BIT(USARTx->reg, bit);                                        \
+    }
+
+LL_USART_IT_FUNCS(PE, CR1, USART_CR1_PEIE)
+LL_USART_IT_FUNCS(CM, CR1, USART_CR1_CMIE)
+LL_USART_IT_FUNCS(RTO, CR1, USART_CR1_RTOIE)
+LL_USART_IT_FUNCS(ERROR, CR3, USART_CR3_EIE)
+LL_USART_IT_FUNCS(RXFT, CR3, USART_CR3_RXFTIE)
+
+/* ========================================================================== */
+/*                             狀態旗標                                        */
+/* ========================================================================== */
+
+#define LL_USART_FLAG_FUNC(name, bit)                                       \
+    static inline uint32_t LL_USART_IsActiveFlag_##name(USART_TypeDef* USARTx) \
+    {                                                                       \
+        return (READ_BIT(USARTx->ISR, bit) == (bit)) ? 1UL : 0UL;           \
+    }
+
+#define LL_USART_CLEAR_FUNC(name, bit)                                      \
+    static inline void LL_USART_ClearFlag_##name(USART_TypeDef* USARTx)     \
+    {                                                                       \
+        WRITE_REG(USARTx->ICR, bit);                                        \
+    }
+
+LL_USART_FLAG_FUNC(PE, USART_ISR_PE)
+LL_USART_FLAG_FUNC(FE, USART_ISR_FE)
+LL_USART_FLAG_FUNC(NE, USART_ISR_NE)
+LL_USART_FLAG_FUNC(ORE, USART_ISR_ORE)
+LL_USART_FLAG_FUNC(RXNE_RXFNE, USART_ISR_RXNE_RXFNE)
+LL_USART_FLAG_FUNC(TC, USART_ISR_TC)
+LL_USART_FLAG_FUNC(TXE_TXFNF, USART_ISR_TXE_TXFNF)
+LL_USART_FLAG_FUNC(RTO, USART_ISR_RTOF)
+LL_USART_FLAG_FUNC(ABRE, USART_ISR_ABRE)
+LL_USART_FLAG_FUNC(ABR, USART_ISR_ABRF)
+LL_USART_FLAG_FUNC(CM, USART_ISR_CMF)
+LL_USART_FLAG_FUNC(TEACK, USART_ISR_TEACK)
+LL_USART_FLAG_FUNC(REACK, USART_ISR_REACK)
+
+LL_USART_CLEAR_FUNC(PE, USART_ICR_PECF)
+LL_USART_CLEAR_FUNC(FE, USART_ICR_FECF)
+LL_USART_CLEAR_FUNC(NE, USART_ICR_NECF)
+LL_USART_CLEAR_FUNC(ORE, USART_ICR_ORECF)
+LL_USART_CLEAR_FUNC(RTO, USART_ICR_RTOCF)
+LL_USART_CLEAR_FUNC(CM, USART_ICR_CMCF)
+
+#endif /* STM32G4XX_LL_USART_H */
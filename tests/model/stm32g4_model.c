@@ -0,0 +1,533 @@
+/**
+ * @file stm32g4_model.c
+ * @brief STM32G4週邊暫存器模型實現
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "stm32g4_model.h"
+#include "stm32g4xx.h"
+#include "stm32g4xx_hal.h"
+#include <string.h>
+
+// 重設值 (RM0440: GPIOA的PA13/14/15與GPIOB的PB3/4為除錯引腳)
+#define MODER_RESET             0xFFFFFFFFUL
+#define MODER_RESET_A           0xABFFFFFFUL
+#define MODER_RESET_B           0xFFFFFEBFUL
+#define PUPDR_RESET_A           0x64000000UL
+#define PUPDR_RESET_B           0x00000100UL
+#define OSPEEDR_RESET_A         0x0C000000UL
+
+#define USART_FIFO_DEPTH        8U
+
+// 由模型維護的ISR位元 (其餘位元每次存取前重新計算)
+#define USART_ISR_STICKY        (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE | USART_ISR_ORE | \
+                                 USART_ISR_RTOF | USART_ISR_CMF | USART_ISR_ABRF | USART_ISR_ABRE)
+
+typedef struct {
+    uint8_t tx_fifo[USART_FIFO_DEPTH];
+    uint32_t tx_count;
+    bool shifting;
+    uint8_t shift_data;
+    uint64_t shift_end;
+    stm32g4_usart_tx_t tx;
+
+    uint8_t rx_fifo[USART_FIFO_DEPTH];
+    uint32_t rx_count;
+
+    uint32_t sticky;                // USART_ISR_STICKY中目前設置的位元
+    uint32_t cr1;                   // 上一次看到的CR1 (偵測UE變化)
+    uint64_t ack_at;                // TEACK/REACK設置時間
+    bool abr_pending;
+    uint64_t abr_at;
+    bool abr_armed;                 // 測試已安排自動波特率結果
+    uint32_t abr_brr;
+    bool abr_error;
+} usart_model_t;
+
+static mmio_region_t* gpio_region;
+static mmio_region_t* rcc_region;
+static mmio_region_t* usart_region;
+
+static usart_model_t usart[STM32G4_USART_COUNT];
+static uint64_t model_now;
+
+static uint32_t gpio_input[STM32G4_GPIO_PORTS];
+static uint32_t gpio_read_count[STM32G4_GPIO_PORTS][STM32G4_GPIO_REG_COUNT];
+static uint32_t gpio_write_count[STM32G4_GPIO_PORTS][STM32G4_GPIO_REG_COUNT];
+
+// Cortex-M核心暫存器 (stm32g4/stm32g4xx.h的__get_PRIMASK()等使用)
+volatile uint32_t cortexm_host_primask = 0;
+volatile uint32_t cortexm_host_basepri = 0;
+volatile uint32_t cortexm_host_nvic_iser[8];
+volatile uint8_t cortexm_host_nvic_ip[256];
+
+/* ========================================================================== */
+/*                             GPIO模型                                        */
+/* ========================================================================== */
+
+static volatile uint32_t* gpio_reg(uint32_t port, uint32_t reg)
+{
+    return mmio_reg32(gpio_region, port * STM32G4_GPIO_STEP + reg);
+}
+
+/** IDR: 輸出模式的引腳讀回ODR，其他引腳讀外部電平 */
+static void gpio_update_idr(uint32_t port)
+{
+    uint32_t moder = *gpio_reg(port, STM32G4_GPIOx_MODER);
+    uint32_t outputs = 0;
+    uint32_t pin;
+
+    for (pin = 0; pin < 16U; pin++) {
+        if (((moder >> (pin * 2U)) & 3U) == 1U) {
+            outputs |= (1UL << pin);
+        }
+    }
+
+    *gpio_reg(port, STM32G4_GPIOx_IDR) = ((*gpio_reg(port, STM32G4_GPIOx_ODR) & outputs) |
+                                          (gpio_input[port] & ~outputs)) & 0xFFFFU;
+}
+
+static void gpio_after(void* context, uint32_t offset, bool write)
+{
+    uint32_t port = offset / STM32G4_GPIO_STEP;
+    uint32_t reg = (offset % STM32G4_GPIO_STEP) & ~3U;
+    volatile uint32_t* odr;
+    uint32_t value;
+
+    (void)context;
+
+    if (port >= STM32G4_GPIO_PORTS || reg / 4U >= STM32G4_GPIO_REG_COUNT) {
+        return;
+    }
+
+    if (!write) {
+        gpio_read_count[port][reg / 4U]++;
+        return;
+    }
+    gpio_write_count[port][reg / 4U]++;
+
+    odr = gpio_reg(port, STM32G4_GPIOx_ODR);
+    value = *gpio_reg(port, reg);
+
+    switch (reg) {
+        case STM32G4_GPIOx_BSRR:
+            // 同時設定與清除時設定優先
+            *odr = ((*odr & ~(value >> 16)) | value) & 0xFFFFU;
+            *gpio_reg(port, reg) = 0;
+            break;
+        case STM32G4_GPIOx_BRR:
+            *odr &= ~(value & 0xFFFFU);
+            *gpio_reg(port, reg) = 0;
+            break;
+        default:
+            break;
+    }
+
+    // IDR為唯讀，寫入後也由ODR與外部電平重新計算
+    gpio_update_idr(port);
+}
+
+/* ========================================================================== */
+/*                             USART模型                                       */
+/* ========================================================================== */
+
+static volatile uint32_t* usart_reg(uint16_t index, uint32_t reg)
+{
+    return mmio_reg32(usart_region, (index + 1U) * STM32G4_USART_STEP + reg);
+}
+
+/** 依BRR/PRESC/OVER8與CR1/CR2的字框格式計算一個字元的CPU週期數 */
+static uint32_t usart_char_cycles_unlocked(uint16_t index)
+{
+    static const uint32_t presc_div[12] = { 1, 2, 4, 6, 8, 10, 12, 16, 32, 64, 128, 256 };
+    uint32_t cr1 = *usart_reg(index, STM32G4_USARTx_CR1);
+    uint32_t cr2 = *usart_reg(index, STM32G4_USARTx_CR2);
+    uint32_t presc = *usart_reg(index, STM32G4_USARTx_PRESC) & 0xFU;
+    uint32_t brr = *usart_reg(index, STM32G4_USARTx_BRR) & 0xFFFFU;
+    uint32_t usartdiv;
+    uint32_t bit_cycles;
+    uint32_t bits;
+
+    if ((cr1 & USART_CR1_OVER8) != 0U) {
+        usartdiv = (brr & 0xFFF0U) | ((brr & 0x7U) << 1);
+        bit_cycles = usartdiv / 2U;
+    } else {
+        bit_cycles = brr;
+    }
+    bit_cycles *= presc_div[presc < 12U ? presc : 11U];
+    if (bit_cycles == 0U) {
+        bit_cycles = 1U;
+    }
+
+    // 起始位 + 資料 (含同位，M1:M0 = 00: 8，01: 9，10: 7) + 停止位
+    bits = ((cr1 & USART_CR1_M0) != 0U) ? 9U : ((cr1 & USART_CR1_M1) != 0U) ? 7U : 8U;
+    bits += 1U + ((((cr2 & USART_CR2_STOP) >> USART_CR2_STOP_Pos) == 2U) ? 2U : 1U);
+
+    return bits * bit_cycles;
+}
+
+static bool usart_enabled(uint16_t index, uint32_t bit)
+{
+    uint32_t cr1 = *usart_reg(index, STM32G4_USARTx_CR1);
+
+    return ((cr1 & USART_CR1_UE) != 0U) && ((cr1 & bit) != 0U);
+}
+
+/** 從FIFO取出下一個字元開始移位 */
+static void usart_start_char(uint16_t index, uint64_t at)
+{
+    usart_model_t* m = &usart[index];
+
+    if (m->tx.count > 0U && at > m->tx.last_end) {
+        m->tx.gaps++;
+    }
+
+    m->shift_data = m->tx_fifo[0];
+    memmove(m->tx_fifo, m->tx_fifo + 1, --m->tx_count);
+    m->shifting = true;
+    m->shift_end = at + usart_char_cycles_unlocked(index);
+}
+
+/** UE清除: 狀態旗標與進行中的傳輸全部捨棄 (RM0440 37.8.1) */
+static void usart_disable(uint16_t index)
+{
+    usart_model_t* m = &usart[index];
+
+    m->sticky = 0;
+    m->tx_count = 0;
+    m->shifting = false;
+    m->rx_count = 0;
+    m->abr_pending = false;
+}
+
+/** 將USART狀態推進到目前時間並重新計算ISR */
+static void usart_update(uint16_t index)
+{
+    usart_model_t* m = &usart[index];
+    uint32_t cr1 = *usart_reg(index, STM32G4_USARTx_CR1);
+    uint32_t isr;
+
+    while (m->shifting && m->shift_end <= model_now) {
+        if (m->tx.count < sizeof(m->tx.data)) {
+            m->tx.data[m->tx.count] = m->shift_data;
+        }
+        m->tx.count++;
+        m->tx.last_end = m->shift_end;
+        m->shifting = false;
+
+        if (m->tx_count > 0U) {
+            usart_start_char(index, m->tx.last_end);
+        }
+    }
+    if (!m->shifting && m->tx_count > 0U && usart_enabled(index, USART_CR1_TE)) {
+        usart_start_char(index, model_now);
+    }
+
+    if (m->abr_pending && m->abr_at <= model_now) {
+        m->abr_pending = false;
+        *usart_reg(index, STM32G4_USARTx_BRR) = m->abr_brr;
+        m->sticky |= USART_ISR_ABRF | (m->abr_error ? USART_ISR_ABRE : 0U);
+    }
+
+    isr = m->sticky;
+    if ((cr1 & USART_CR1_UE) != 0U) {
+        if (m->rx_count > 0U) {
+            isr |= USART_ISR_RXNE_RXFNE;
+        }
+        if (m->tx_count < USART_FIFO_DEPTH) {
+            isr |= USART_ISR_TXE_TXFNF;
+        }
+        if (m->tx_count == 0U && !m->shifting) {
+            isr |= USART_ISR_TC;
+        }
+        if (m->ack_at <= model_now) {
+            isr |= ((cr1 & USART_CR1_TE) != 0U ? USART_ISR_TEACK : 0U) |
+                   ((cr1 & USART_CR1_RE) != 0U ? USART_ISR_REACK : 0U);
+        }
+    }
+    *usart_reg(index, STM32G4_USARTx_ISR) = isr;
+    *usart_reg(index, STM32G4_USARTx_RDR) = (m->rx_count > 0U) ? m->rx_fifo[0] : 0U;
+}
+
+static void usart_update_all(void)
+{
+    uint16_t index;
+
+    for (index = 0; index < STM32G4_USART_COUNT; index++) {
+        usart_update(index);
+    }
+}
+
+static void usart_before(void* context, uint32_t offset, bool write)
+{
+    (void)context;
+    (void)offset;
+    (void)write;
+
+    model_now += STM32G4_MODEL_ACCESS_CYCLES;
+    usart_update_all();
+}
+
+static void usart_after(void* context, uint32_t offset, bool write)
+{
+    uint32_t index = offset / STM32G4_USART_STEP;
+    uint32_t reg = offset % STM32G4_USART_STEP;
+    usart_model_t* m;
+    uint32_t value;
+
+    (void)context;
+
+    // 0x40004000-0x400043FF不屬於USART (RTC等)
+    if (index == 0U || index > STM32G4_USART_COUNT) {
+        return;
+    }
+    index--;
+    m = &usart[index];
+    value = *usart_reg((uint16_t)index, reg);
+
+    if (!write) {
+        if (reg == STM32G4_USARTx_RDR && m->rx_count > 0U) {
+            memmove(m->rx_fifo, m->rx_fifo + 1, --m->rx_count);
+        }
+        usart_update((uint16_t)index);
+        return;
+    }
+
+    switch (reg) {
+        case STM32G4_USARTx_CR1:
+            if ((value & USART_CR1_UE) != 0U && (m->cr1 & USART_CR1_UE) == 0U) {
+                m->ack_at = model_now + STM32G4_MODEL_ACK_CYCLES;
+                if ((*usart_reg((uint16_t)index, STM32G4_USARTx_CR2) & USART_CR2_ABREN) != 0U &&
+                    m->abr_armed) {
+                    m->abr_armed = false;
+                    m->abr_pending = true;
+                    m->abr_at = model_now + STM32G4_MODEL_ABR_CYCLES;
+                }
+            } else if ((value & USART_CR1_UE) == 0U) {
+                usart_disable((uint16_t)index);
+            }
+            m->cr1 = value;
+            break;
+        case STM32G4_USARTx_TDR:
+            if (!usart_enabled((uint16_t)index, USART_CR1_TE)) {
+                break;
+            }
+            if (m->tx_count < USART_FIFO_DEPTH) {
+                m->tx_fifo[m->tx_count++] = (uint8_t)value;
+            } else {
+                m->tx.overruns++;
+            }
+            break;
+        case STM32G4_USARTx_ICR:
+            m->sticky &= ~(value & (USART_ICR_PECF | USART_ICR_FECF | USART_ICR_NECF |
+                                    USART_ICR_ORECF | USART_ICR_RTOCF | USART_ICR_CMCF));
+            *usart_reg((uint16_t)index, reg) = 0;
+            break;
+        case STM32G4_USARTx_RQR:
+            if ((value & USART_RQR_RXFRQ) != 0U) {
+                m->rx_count = 0;
+            }
+            *usart_reg((uint16_t)index, reg) = 0;
+            break;
+        default:
+            break;
+    }
+
+    usart_update((uint16_t)index);
+}
+
+/* ========================================================================== */
+/*                             介面實現                                        */
+/* ========================================================================== */
+
+void stm32g4_model_init(void)
+{
+    uint16_t port;
+
+    mmio_reset();
+    memset(gpio_input, 0, sizeof(gpio_input));
+    memset(usart, 0, sizeof(usart));
+    memset((void*)cortexm_host_nvic_iser, 0, sizeof(cortexm_host_nvic_iser));
+    memset((void*)cortexm_host_nvic_ip, 0, sizeof(cortexm_host_nvic_ip));
+    model_now = 0;
+
+    gpio_region = mmio_add_fixed("GPIO", STM32G4_GPIO_BASE,
+                                 STM32G4_GPIO_PORTS * STM32G4_GPIO_STEP,
+                                 true, NULL, gpio_after, NULL);
+    rcc_region = mmio_add_fixed("RCC", STM32G4_RCC_BASE, 0x400U, true, NULL, NULL, NULL);
+    usart_region = mmio_add_fixed("USART", STM32G4_USART_PAGE,
+                                  (STM32G4_USART_COUNT + 1U) * STM32G4_USART_STEP,
+                                  true, usart_before, usart_after, NULL);
+
+    for (port = 0; port < STM32G4_GPIO_PORTS; port++) {
+        stm32g4_model_gpio_set(port, STM32G4_GPIOx_MODER, MODER_RESET);
+    }
+    stm32g4_model_gpio_set(0, STM32G4_GPIOx_MODER, MODER_RESET_A);
+    stm32g4_model_gpio_set(0, STM32G4_GPIOx_PUPDR, PUPDR_RESET_A);
+    stm32g4_model_gpio_set(0, STM32G4_GPIOx_OSPEEDR, OSPEEDR_RESET_A);
+    stm32g4_model_gpio_set(1, STM32G4_GPIOx_MODER, MODER_RESET_B);
+    stm32g4_model_gpio_set(1, STM32G4_GPIOx_PUPDR, PUPDR_RESET_B);
+
+    stm32g4_model_counts_clear();
+}
+
+mmio_region_t* stm32g4_model_gpio_region(void)
+{
+    return gpio_region;
+}
+
+mmio_region_t* stm32g4_model_rcc_region(void)
+{
+    return rcc_region;
+}
+
+uint32_t stm32g4_model_gpio(uint16_t port, uint16_t reg)
+{
+    return mmio_peek32(gpio_region, port * STM32G4_GPIO_STEP + reg);
+}
+
+void stm32g4_model_gpio_set(uint16_t port, uint16_t reg, uint32_t value)
+{
+    mmio_poke32(gpio_region, port * STM32G4_GPIO_STEP + reg, value);
+
+    mmio_unprotect(gpio_region);
+    gpio_update_idr(port);
+    mmio_protect(gpio_region);
+}
+
+void stm32g4_model_gpio_set_input(uint16_t port, uint32_t mask, uint32_t levels)
+{
+    gpio_input[port] = (gpio_input[port] & ~mask) | (levels & mask);
+
+    mmio_unprotect(gpio_region);
+    gpio_update_idr(port);
+    mmio_protect(gpio_region);
+}
+
+uint32_t stm32g4_model_gpio_reads(uint16_t port, uint16_t reg)
+{
+    return gpio_read_count[port][reg / 4U];
+}
+
+uint32_t stm32g4_model_gpio_writes(uint16_t port, uint16_t reg)
+{
+    return gpio_write_count[port][reg / 4U];
+}
+
+void stm32g4_model_counts_clear(void)
+{
+    memset(gpio_read_count, 0, sizeof(gpio_read_count));
+    memset(gpio_write_count, 0, sizeof(gpio_write_count));
+    gpio_region->reads = 0;
+    gpio_region->writes = 0;
+    rcc_region->reads = 0;
+    rcc_region->writes = 0;
+}
+
+uint64_t stm32g4_model_now(void)
+{
+    return model_now;
+}
+
+void stm32g4_model_advance(uint64_t cycles)
+{
+    model_now += cycles;
+
+    // 在回呼之外更新模型，需暫時解除保護，否則讀取暫存器會再次觸發陷阱
+    mmio_unprotect(usart_region);
+    usart_update_all();
+    mmio_protect(usart_region);
+}
+
+mmio_region_t* stm32g4_model_usart_region(void)
+{
+    return usart_region;
+}
+
+uint32_t stm32g4_model_usart(uint16_t usart_index, uint16_t reg)
+{
+    return mmio_peek32(usart_region, (usart_index + 1U) * STM32G4_USART_STEP + reg);
+}
+
+stm32g4_usart_tx_t* stm32g4_model_usart_tx(uint16_t usart_index)
+{
+    return &usart[usart_index].tx;
+}
+
+uint32_t stm32g4_model_usart_char_cycles(uint16_t usart_index)
+{
+    uint32_t cycles;
+
+    mmio_unprotect(usart_region);
+    cycles = usart_char_cycles_unlocked(usart_index);
+    mmio_protect(usart_region);
+
+    return cycles;
+}
+
+void stm32g4_model_usart_rx(uint16_t usart_index, uint8_t data, uint32_t errors)
+{
+    usart_model_t* m = &usart[usart_index];
+
+    mmio_unprotect(usart_region);
+    if (usart_enabled(usart_index, USART_CR1_RE)) {
+        if (m->rx_count < USART_FIFO_DEPTH) {
+            m->rx_fifo[m->rx_count++] = data;
+            m->sticky |= errors & (USART_ISR_PE | USART_ISR_FE | USART_ISR_NE);
+            // 非靜音模式下整個字元與ADD[7:0]比較 (ADDM7不影響)
+            if (data == (*usart_reg(usart_index, STM32G4_USARTx_CR2) >> USART_CR2_ADD_Pos)) {
+                m->sticky |= USART_ISR_CMF;
+            }
+        } else {
+            m->sticky |= USART_ISR_ORE;
+        }
+    }
+    usart_update(usart_index);
+    mmio_protect(usart_region);
+}
+
+void stm32g4_model_usart_idle(uint16_t usart_index)
+{
+    mmio_unprotect(usart_region);
+    if ((*usart_reg(usart_index, STM32G4_USARTx_CR2) & USART_CR2_RTOEN) != 0U) {
+        usart[usart_index].sticky |= USART_ISR_RTOF;
+    }
+    usart_update(usart_index);
+    mmio_protect(usart_region);
+}
+
+void stm32g4_model_usart_autobaud(uint16_t usart_index, uint32_t brr, bool error)
+{
+    usart[usart_index].abr_armed = true;
+    usart[usart_index].abr_brr = brr;
+    usart[usart_index].abr_error = error;
+}
+
+bool stm32g4_model_usart_ready(uint16_t usart_index)
+{
+    uint32_t isr = stm32g4_model_usart(usart_index, STM32G4_USARTx_ISR);
+
+    return (isr & (USART_ISR_TEACK | USART_ISR_REACK)) == (USART_ISR_TEACK | USART_ISR_REACK);
+}
+
+/* ========================================================================== */
+/*                             平台替身                                        */
+/* ========================================================================== */
+
+uint32_t HAL_RCC_GetPCLK1Freq(void)
+{
+    return STM32G4_MODEL_CPU_HZ;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void)
+{
+    return STM32G4_MODEL_CPU_HZ;
+}
+
+/** 自由運行的週期計數 (DWT CYCCNT)，每次讀取代表一次輪詢的成本 */
+uint32_t hal_get_cycle_count(void)
+{
+    stm32g4_model_advance(STM32G4_MODEL_POLL_CYCLES);
+    return (uint32_t)model_now;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file stm32g4_model.h
+ * @brief STM32G4週邊暫存器模型 (GPIO、RCC、USART) 與核心遮罩暫存器
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 暫存器位移依RM0440，與驅動及替身標頭檔的定義分開撰寫。
+ * GPIO與RCC區域放在與裝置相同的位址 (mmio_add_fixed)，每次存取都被攔截並
+ * 依埠與暫存器計數，用來比較不同GPIO後端每個操作的匯流排存取次數。
+ * 主機以-O0編譯受測驅動，volatile的讀改寫保持為分開的讀取與寫入指令，
+ * 與Cortex-M的LDR/STR相同。
+ * PRIMASK/BASEPRI與NVIC為一般變數 (cortexm_host_*)，不需模型區域。
+ *
+ * USART區域涵蓋USART2、USART3與UART4 (同一頁)，以CPU週期計算線路時間:
+ * 每次暫存器存取前進STM32G4_MODEL_ACCESS_CYCLES，APB時鐘等於CPU時鐘。
+ * 發送FIFO依BRR/PRESC/OVER8與字框格式移出；接收由測試直接放入8級FIFO，
+ * 與ADD[7:0]相同的字元設置CMF (非靜音模式的字元比對)。
+ */
+
+#ifndef STM32G4_MODEL_H
+#define STM32G4_MODEL_H
+
+#include "mmio.h"
+
+/* ========================================================================== */
+/*                             裝置位址                                        */
+/* ========================================================================== */
+
+#define STM32G4_GPIO_BASE           0x48000000UL
+#define STM32G4_GPIO_STEP           0x400UL
+#define STM32G4_GPIO_PORTS          7U          // GPIOA-GPIOG
+#define STM32G4_RCC_BASE            0x40021000UL
+#define STM32G4_RCC_AHB2ENR         0x4CU
+
+// GPIO暫存器 (位元組位移)
+#define STM32G4_GPIOx_MODER         0x00U
+#define STM32G4_GPIOx_OTYPER        0x04U
+#define STM32G4_GPIOx_OSPEEDR       0x08U
+#define STM32G4_GPIOx_PUPDR         0x0CU
+#define STM32G4_GPIOx_IDR           0x10U
+#define STM32G4_GPIOx_ODR           0x14U
+#define STM32G4_GPIOx_BSRR          0x18U
+#define STM32G4_GPIOx_LCKR          0x1CU
+#define STM32G4_GPIOx_AFRL          0x20U
+#define STM32G4_GPIOx_AFRH          0x24U
+#define STM32G4_GPIOx_BRR           0x28U
+#define STM32G4_GPIO_REG_COUNT      11U
+
+#define STM32G4_USART_PAGE          0x40004000UL
+#define STM32G4_USART_STEP          0x400UL
+#define STM32G4_USART_COUNT         3U          // 0 = USART2，1 = USART3，2 = UART4
+#define STM32G4_USART2              0U
+
+// USART暫存器 (位元組位移)
+#define STM32G4_USARTx_CR1          0x00U
+#define STM32G4_USARTx_CR2          0x04U
+#define STM32G4_USARTx_CR3          0x08U
+#define STM32G4_USARTx_BRR          0x0CU
+#define STM32G4_USARTx_RTOR         0x14U
+#define STM32G4_USARTx_RQR          0x18U
+#define STM32G4_USARTx_ISR          0x1CU
+#define STM32G4_USARTx_ICR          0x20U
+#define STM32G4_USARTx_RDR          0x24U
+#define STM32G4_USARTx_TDR          0x28U
+#define STM32G4_USARTx_PRESC        0x2CU
+
+#define STM32G4_MODEL_CPU_HZ        170000000UL
+#define STM32G4_MODEL_ACCESS_CYCLES 4U          // 每次USART暫存器存取 (APB)
+#define STM32G4_MODEL_POLL_CYCLES   8U          // 每次hal_get_cycle_count()輪詢
+#define STM32G4_MODEL_ACK_CYCLES    64U         // UE設置到TEACK/REACK
+#define STM32G4_MODEL_ABR_CYCLES    20000U      // UE設置 (ABREN) 到自動波特率完成
+
+/** USART發送觀測 */
+typedef struct {
+    uint8_t data[4096];             // 發送的字元 (前4096個)
+    uint32_t count;                 // 發送完成的字元數
+    uint32_t gaps;                  // 字元之間出現空檔的次數
+    uint32_t overruns;              // FIFO已滿時寫入TDR的次數
+    uint64_t last_end;              // 最後一個字元發送完成的時間
+} stm32g4_usart_tx_t;
+
+/* ========================================================================== */
+/*                             模型介面                                        */
+/* ========================================================================== */
+
+/**
+ * @brief 建立模型區域，GPIO暫存器設為重設值 (MODER類比模式，GPIOA/B除錯引腳除外)
+ */
+void stm32g4_model_init(void);
+
+mmio_region_t* stm32g4_model_gpio_region(void);
+mmio_region_t* stm32g4_model_rcc_region(void);
+
+/** 測試端直接讀寫GPIO暫存器 (不計數) */
+uint32_t stm32g4_model_gpio(uint16_t port, uint16_t reg);
+void stm32g4_model_gpio_set(uint16_t port, uint16_t reg, uint32_t value);
+
+/** 設定外部輸入電平，非輸出模式的引腳由IDR讀到此值 */
+void stm32g4_model_gpio_set_input(uint16_t port, uint32_t mask, uint32_t levels);
+
+/** 各暫存器被驅動讀取/寫入的次數 */
+uint32_t stm32g4_model_gpio_reads(uint16_t port, uint16_t reg);
+uint32_t stm32g4_model_gpio_writes(uint16_t port, uint16_t reg);
+
+/** 清除所有存取計數 (含RCC區域) */
+void stm32g4_model_counts_clear(void);
+
+/** 模型時間 (CPU週期) */
+uint64_t stm32g4_model_now(void);
+void stm32g4_model_advance(uint64_t cycles);
+
+mmio_region_t* stm32g4_model_usart_region(void);
+
+/** 讀取USART暫存器 (usart: STM32G4_USART2等，reg: STM32G4_USARTx_*) */
+uint32_t stm32g4_model_usart(uint16_t usart, uint16_t reg);
+
+/** 發送觀測與目前設定下一個字元的CPU週期數 */
+stm32g4_usart_tx_t* stm32g4_model_usart_tx(uint16_t usart);
+uint32_t stm32g4_model_usart_char_cycles(uint16_t usart);
+
+/**
+ * @brief 接收一個字元 (立即進入RX FIFO)
+ * @param errors USART_ISR_FE/USART_ISR_PE/USART_ISR_NE
+ * @note FIFO已滿時設置ORE並捨棄；UE或RE未設置時捨棄
+ */
+void stm32g4_model_usart_rx(uint16_t usart, uint8_t data, uint32_t errors);
+
+/** 線路閒置滿RTOR (RTOEN設置時設置RTOF) */
+void stm32g4_model_usart_idle(uint16_t usart);
+
+/** 安排下一次ABREN使能後的自動波特率結果 (STM32G4_MODEL_ABR_CYCLES後完成) */
+void stm32g4_model_usart_autobaud(uint16_t usart, uint32_t brr, bool error);
+
+/** 發送與接收器皆已就緒 (TEACK與REACK) */
+bool stm32g4_model_usart_ready(uint16_t usart);
+
+#endif /* STM32G4_MODEL_H */
@@ -0,0 +1,358 @@
+/**
+ * @file test_c2000_gpio.c
+ * @brief C2000簡化版GPIO驅動 (引腳操作、模式/上拉設定、批次配置) 在GPIO暫存器模型上的測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 驅動原始碼 (simple/ti_c2000_gpio_simple.c、ti_c2000_gpio_table.c) 以主機gcc編譯，
+ * GPIO控制與資料暫存器由model/c2000_model.c模擬。
+ */
+
+#include "hal_gpio.h"
+#include "c2000_model.h"
+#include "test_common.h"
+
+#define CPU_HZ                  120000000UL
+#define LSPCLK_HZ               60000000UL
+#define PORT_A                  0U
+#define PORT_B                  1U
+#define PORT_F                  5U
+
+/** 模型重設，控制暫存器設為重設值 (上拉禁用) 並在MUX/GMUX/QSEL放入非零值 */
+static void gpio_setup(void)
+{
+    uint16_t port;
+
+    c2000_model_init(CPU_HZ, LSPCLK_HZ);
+    for (port = 0; port < 6U; port++) {
+        c2000_model_gpio_ctrl_set(port, C2000_GPxPUD, 0xFFFFFFFFUL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxMUX1, 0x55555555UL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxMUX2, 0x55555555UL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxGMUX1, 0x55555555UL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxGMUX2, 0x55555555UL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxQSEL1, 0xFFFFFFFFUL);
+        c2000_model_gpio_ctrl_set(port, C2000_GPxQSEL2, 0xFFFFFFFFUL);
+    }
+    c2000_model_gpio_ctrl_writes_clear();
+}
+
+static hal_gpio_config_t gpio_config(hal_gpio_pin_t pin, hal_gpio_mode_t mode,
+                                     hal_gpio_pull_t pull, hal_gpio_state_t initial)
+{
+    hal_gpio_config_t config;
+
+    config.pin = pin;
+    config.mode = mode;
+    config.pull = pull;
+    config.initial_state = initial;
+    return config;
+}
+
+/* ========================================================================== */
+/*                             批次配置                                        */
+/* ========================================================================== */
+
+/** 跨埠的配置表: 方向、上拉、GPIO功能與初始輸出值 */
+static void test_table_configures_ports(void)
+{
+    hal_gpio_config_t table[5];
+
+    gpio_setup();
+    table[0] = gpio_config(0, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+    table[1] = gpio_config(17, HAL_GPIO_MODE_INPUT, HAL_GPIO_PULLUP, HAL_GPIO_LOW);
+    table[2] = gpio_config(34, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_LOW);
+    table[3] = gpio_config(40, HAL_GPIO_MODE_ALTERNATE, HAL_GPIO_PULLUP, HAL_GPIO_LOW);
+    table[4] = gpio_config(168, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 5), HAL_OK);
+
+    // 埠A: GPIO0輸出高、GPIO17輸入上拉
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxDIR), 0x00000001UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxPUD), (uint32_t)~(1UL << 17));
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxMUX1), 0x55555554UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxGMUX1), 0x55555554UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxMUX2), 0x55555551UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxQSEL2), 0xFFFFFFF3UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_A, C2000_GPxDAT), 0x00000001UL);
+
+    // 埠B: GPIO34輸出低，GPIO40複用只設定上拉、不改變功能選擇
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxDIR), 1UL << 2);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxPUD), (uint32_t)~(1UL << 8));
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxMUX1), 0x55555545UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), 0);
+
+    // 埠F: GPIO168 (位元8)
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_F, C2000_GPxDIR), 1UL << 8);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_F, C2000_GPxDAT), 1UL << 8);
+
+    // 未使用的埠沒有被寫入
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(2, C2000_GPxDIR), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(3, C2000_GPxPUD), 0);
+}
+
+/** 重複的引腳以最後一項為準，先前累積的位元不會殘留 */
+static void test_table_duplicate_last_wins(void)
+{
+    hal_gpio_config_t table[4];
+
+    gpio_setup();
+    table[0] = gpio_config(5, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_PULLUP, HAL_GPIO_LOW);
+    table[1] = gpio_config(6, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+    table[2] = gpio_config(5, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+    table[3] = gpio_config(6, HAL_GPIO_MODE_INPUT, HAL_GPIO_PULLUP, HAL_GPIO_LOW);
+
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 4), HAL_OK);
+
+    // GPIO5: 輸出高、無上拉 (不是先前的低電位與上拉)
+    // GPIO6: 輸入、上拉，沒有寫入輸出鎖存器
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxDIR), 1UL << 5);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxPUD), (uint32_t)~(1UL << 6));
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_A, C2000_GPxDAT), 1UL << 5);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxQSEL1), (uint32_t)~(3UL << 12));
+}
+
+/** 任一引腳無效時返回錯誤，不寫入任何暫存器 */
+static void test_table_invalid_pin(void)
+{
+    hal_gpio_config_t table[2];
+
+    gpio_setup();
+    table[0] = gpio_config(3, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+    table[1] = gpio_config(169, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 2), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_init_table(NULL, 1), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(PORT_A, C2000_GPxDIR), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxDIR), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_A, C2000_GPxDAT), 0);
+}
+
+/** 整個埠32個引腳: 每個控制暫存器只寫入一次 */
+static void test_table_one_write_per_register(void)
+{
+    static const uint16_t regs[] = {
+        C2000_GPxQSEL1, C2000_GPxQSEL2, C2000_GPxMUX1, C2000_GPxMUX2, C2000_GPxDIR,
+        C2000_GPxPUD, C2000_GPxINV, C2000_GPxODR, C2000_GPxGMUX1, C2000_GPxGMUX2
+    };
+    hal_gpio_config_t table[32];
+    uint32_t i;
+
+    gpio_setup();
+    for (i = 0; i < 32U; i++) {
+        table[i] = gpio_config((hal_gpio_pin_t)(32U + i),
+                               ((i & 1U) != 0U) ? HAL_GPIO_MODE_OUTPUT : HAL_GPIO_MODE_INPUT,
+                               HAL_GPIO_PULLUP, ((i & 2U) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW);
+    }
+
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 32), HAL_OK);
+
+    for (i = 0; i < sizeof(regs) / sizeof(regs[0]); i++) {
+        TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(PORT_B, regs[i]), 1);
+    }
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxDIR), 0xAAAAAAAAUL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxPUD), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxMUX1), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxGMUX2), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), 0x88888888UL);
+}
+
+/** 單一引腳的hal_gpio_init()與只有一項的配置表結果相同 */
+static void test_init_matches_table(void)
+{
+    hal_gpio_config_t config = gpio_config(45, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_PULLUP,
+                                           HAL_GPIO_HIGH);
+    uint32_t dir;
+    uint32_t pud;
+    uint32_t mux;
+    uint32_t dat;
+
+    gpio_setup();
+    TEST_ASSERT_EQ(hal_gpio_init_table(&config, 1), HAL_OK);
+    dir = c2000_model_gpio_ctrl(PORT_B, C2000_GPxDIR);
+    pud = c2000_model_gpio_ctrl(PORT_B, C2000_GPxPUD);
+    mux = c2000_model_gpio_ctrl(PORT_B, C2000_GPxMUX1);
+    dat = c2000_model_gpio_data(PORT_B, C2000_GPxDAT);
+
+    gpio_setup();
+    TEST_ASSERT_EQ(hal_gpio_init(&config), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxDIR), dir);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxPUD), pud);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_B, C2000_GPxMUX1), mux);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), dat);
+    TEST_ASSERT_EQ(dat, 1UL << 13);
+}
+
+/* ========================================================================== */
+/*                             單一引腳操作                                    */
+/* ========================================================================== */
+
+/** 寫入與翻轉都是單一資料暫存器寫入，且不影響同埠其他引腳 */
+static void test_write_toggle_single_store(void)
+{
+    mmio_region_t* data = c2000_model_gpio_data_region();
+
+    gpio_setup();
+    c2000_model_gpio_ctrl_set(PORT_B, C2000_GPxDIR, 0xFFFFFFFFUL);
+    TEST_ASSERT_EQ(hal_gpio_write(33, HAL_GPIO_HIGH), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_write(63, HAL_GPIO_HIGH), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), (1UL << 1) | (1UL << 31));
+
+    data->reads = 0;
+    data->writes = 0;
+    TEST_ASSERT_EQ(hal_gpio_write(33, HAL_GPIO_LOW), HAL_OK);
+    TEST_ASSERT_EQ(data->writes, 1);
+    TEST_ASSERT_EQ(data->reads, 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), 1UL << 31);
+
+    TEST_ASSERT_EQ(hal_gpio_toggle(63), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_toggle(40), HAL_OK);
+    TEST_ASSERT_EQ(data->writes, 3);
+    TEST_ASSERT_EQ(data->reads, 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxDAT), 1UL << 8);
+
+    // SET/CLEAR/TOGGLE讀回為0，其他埠不受影響
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_B, C2000_GPxTOGGLE), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_A, C2000_GPxDAT), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_F, C2000_GPxDAT), 0);
+}
+
+/** 隨機寫入/翻轉序列與軟體參考值比對 */
+static void test_write_toggle_random(void)
+{
+    uint32_t expected[6] = { 0 };
+    uint32_t seed = 0x1234567U;
+    uint32_t i;
+    uint16_t port;
+
+    gpio_setup();
+    for (port = 0; port < 6U; port++) {
+        c2000_model_gpio_ctrl_set(port, C2000_GPxDIR, 0xFFFFFFFFUL);
+    }
+
+    for (i = 0; i < 20000U; i++) {
+        uint32_t r = test_random(&seed);
+        hal_gpio_pin_t pin = (hal_gpio_pin_t)(r % 169U);
+        uint32_t bit = 1UL << (pin & 31U);
+
+        switch ((r >> 16) % 3U) {
+            case 0:
+                TEST_ASSERT_EQ(hal_gpio_write(pin, HAL_GPIO_HIGH), HAL_OK);
+                expected[pin >> 5] |= bit;
+                break;
+            case 1:
+                TEST_ASSERT_EQ(hal_gpio_write(pin, HAL_GPIO_LOW), HAL_OK);
+                expected[pin >> 5] &= ~bit;
+                break;
+            default:
+                TEST_ASSERT_EQ(hal_gpio_toggle(pin), HAL_OK);
+                expected[pin >> 5] ^= bit;
+                break;
+        }
+        TEST_ASSERT_EQ(hal_gpio_read(pin),
+                       ((expected[pin >> 5] & bit) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW);
+    }
+
+    for (port = 0; port < 6U; port++) {
+        TEST_ASSERT_EQ(hal_gpio_read_port(port), expected[port]);
+    }
+}
+
+/** 輸入引腳讀取外部電平，輸出引腳讀取鎖存值 */
+static void test_read_inputs(void)
+{
+    hal_gpio_config_t config = gpio_config(70, HAL_GPIO_MODE_INPUT, HAL_GPIO_PULLUP,
+                                           HAL_GPIO_LOW);
+
+    gpio_setup();
+    TEST_ASSERT_EQ(hal_gpio_init(&config), HAL_OK);
+    c2000_model_gpio_set_input(2, 1UL << 6, 1UL << 6);
+    TEST_ASSERT_EQ(hal_gpio_read(70), HAL_GPIO_HIGH);
+    TEST_ASSERT_EQ(hal_gpio_read_port(2), 1UL << 6);
+
+    c2000_model_gpio_set_input(2, 1UL << 6, 0);
+    TEST_ASSERT_EQ(hal_gpio_read(70), HAL_GPIO_LOW);
+    TEST_ASSERT_EQ(hal_gpio_read_port(2), 0);
+}
+
+/** 模式與上拉設定只改變該引腳的欄位 */
+static void test_set_mode_and_pull(void)
+{
+    gpio_setup();
+
+    TEST_ASSERT_EQ(hal_gpio_set_mode(20, HAL_GPIO_MODE_OUTPUT), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxDIR), 1UL << 20);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxMUX2), (uint32_t)~(3UL << 8) & 0x55555555UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxGMUX2), (uint32_t)~(3UL << 8) & 0x55555555UL);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxMUX1), 0x55555555UL);
+
+    // 複用模式保留功能選擇，只切換為輸入方向
+    TEST_ASSERT_EQ(hal_gpio_set_mode(21, HAL_GPIO_MODE_ALTERNATE), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxMUX2), (uint32_t)~(3UL << 8) & 0x55555555UL);
+    TEST_ASSERT_EQ(hal_gpio_set_mode(20, HAL_GPIO_MODE_INPUT), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxDIR), 0);
+
+    TEST_ASSERT_EQ(hal_gpio_set_pull(20, HAL_GPIO_PULLUP), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxPUD), (uint32_t)~(1UL << 20));
+    TEST_ASSERT_EQ(hal_gpio_set_pull(20, HAL_GPIO_NOPULL), HAL_OK);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxPUD), 0xFFFFFFFFUL);
+}
+
+/** C2000沒有下拉電阻: 所有配置介面返回HAL_NOT_SUPPORTED且不修改暫存器 */
+static void test_pulldown_not_supported(void)
+{
+    hal_gpio_config_t table[2];
+
+    gpio_setup();
+    c2000_model_gpio_ctrl_set(PORT_A, C2000_GPxPUD, 0xFFFFFFFEUL);
+    c2000_model_gpio_ctrl_writes_clear();
+
+    TEST_ASSERT_EQ(hal_gpio_set_pull(0, HAL_GPIO_PULLDOWN), HAL_NOT_SUPPORTED);
+
+    table[0] = gpio_config(0, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_PULLDOWN, HAL_GPIO_HIGH);
+    TEST_ASSERT_EQ(hal_gpio_init(&table[0]), HAL_NOT_SUPPORTED);
+
+    table[0] = gpio_config(3, HAL_GPIO_MODE_OUTPUT, HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+    table[1] = gpio_config(0, HAL_GPIO_MODE_INPUT, HAL_GPIO_PULLDOWN, HAL_GPIO_LOW);
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 2), HAL_NOT_SUPPORTED);
+
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(PORT_A, C2000_GPxPUD), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl_writes(PORT_A, C2000_GPxDIR), 0);
+    TEST_ASSERT_EQ(c2000_model_gpio_ctrl(PORT_A, C2000_GPxPUD), 0xFFFFFFFEUL);
+    TEST_ASSERT_EQ(c2000_model_gpio_data(PORT_A, C2000_GPxDAT), 0);
+}
+
+/** 超出範圍的引腳與埠不存取暫存器 */
+static void test_invalid_pin_ops(void)
+{
+    mmio_region_t* data = c2000_model_gpio_data_region();
+
+    gpio_setup();
+    data->reads = 0;
+    data->writes = 0;
+
+    TEST_ASSERT_EQ(hal_gpio_write(169, HAL_GPIO_HIGH), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_toggle(200), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_read(169), HAL_GPIO_LOW);
+    TEST_ASSERT_EQ(hal_gpio_read_port(8), 0);
+    TEST_ASSERT_EQ(hal_gpio_set_mode(169, HAL_GPIO_MODE_OUTPUT), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_set_pull(169, HAL_GPIO_PULLUP), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(data->reads, 0);
+    TEST_ASSERT_EQ(data->writes, 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_table_configures_ports);
+    TEST_RUN(test_table_duplicate_last_wins);
+    TEST_RUN(test_table_invalid_pin);
+    TEST_RUN(test_table_one_write_per_register);
+    TEST_RUN(test_init_matches_table);
+    TEST_RUN(test_write_toggle_single_store);
+    TEST_RUN(test_write_toggle_random);
+    TEST_RUN(test_read_inputs);
+    TEST_RUN(test_set_mode_and_pull);
+    TEST_RUN(test_pulldown_not_supported);
+    TEST_RUN(test_invalid_pin_ops);
+
+    return TEST_REPORT();
+}
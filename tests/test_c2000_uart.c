@@ -0,0 +1,252 @@
+/**
+ * @file test_c2000_uart.c
+ * @brief C2000簡化版UART驅動在SCI暫存器模型上的測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 驅動原始碼 (simple/ti_c2000_uart_simple.c) 以主機gcc編譯，暫存器存取由
+ * model/c2000_model.c模擬，線路時間以CPU週期計算 (F28P55x: 120 MHz CPU、60 MHz LSPCLK)。
+ */
+
+#include "hal_uart.h"
+#include "c2000_model.h"
+#include "test_common.h"
+#include <string.h>
+
+#define CPU_HZ                  120000000UL
+#define LSPCLK_HZ               60000000UL
+#define SCIA                    0U
+#define FAST_BAUD               3750000UL   // BRR = 1，每字元320個CPU週期
+
+static uint8_t pattern[1024];
+static uint8_t received[1024];
+
+static void uart_setup(uint32_t baudrate)
+{
+    hal_uart_config_t config = {
+        baudrate, HAL_UART_DATABITS_8, HAL_UART_STOPBITS_1, HAL_UART_PARITY_NONE
+    };
+    uint32_t i;
+
+    c2000_model_init(CPU_HZ, LSPCLK_HZ);
+    TEST_ASSERT_EQ(hal_uart_init(SCIA, &config), HAL_OK);
+    (void)hal_uart_reset_stats(SCIA);
+
+    for (i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = (uint8_t)(i * 7U + 3U);
+    }
+}
+
+/* ========================================================================== */
+/*                             發送: FIFO批次寫入                              */
+/* ========================================================================== */
+
+/** 1000個字元連續發送，字元之間沒有任何空檔，總時間等於線路速率 */
+static void test_tx_full_line_rate(void)
+{
+    c2000_sci_tx_t* tx;
+    uint32_t char_cycles;
+
+    uart_setup(FAST_BAUD);
+    tx = c2000_model_sci_tx(SCIA);
+    char_cycles = c2000_model_sci_char_cycles(SCIA);
+    TEST_ASSERT_EQ(char_cycles, 10U * 16U * 2U);
+
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern, 1000, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_flush_tx(SCIA), HAL_OK);
+
+    TEST_ASSERT_EQ(tx->count, 1000);
+    TEST_ASSERT(memcmp(tx->data, pattern, 1000) == 0);
+    TEST_ASSERT_EQ(tx->overruns, 0);
+    TEST_ASSERT_EQ(tx->gaps, 0);
+    TEST_ASSERT_EQ(tx->idle_cycles, 0);
+    TEST_ASSERT_EQ(tx->last_end - tx->first_start, 1000ULL * char_cycles);
+    TEST_ASSERT(!hal_uart_is_busy(SCIA));
+}
+
+/** 兩次hal_uart_transmit()之間也沒有空檔 (第二個訊框接在FIFO剩餘資料之後) */
+static void test_tx_back_to_back_frames(void)
+{
+    c2000_sci_tx_t* tx;
+
+    uart_setup(FAST_BAUD);
+    tx = c2000_model_sci_tx(SCIA);
+
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern, 200, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern + 200, 300, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern + 500, 1, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_flush_tx(SCIA), HAL_OK);
+
+    TEST_ASSERT_EQ(tx->count, 501);
+    TEST_ASSERT(memcmp(tx->data, pattern, 501) == 0);
+    TEST_ASSERT_EQ(tx->gaps, 0);
+}
+
+/** 115200 bps下同樣沒有空檔 */
+static void test_tx_115200(void)
+{
+    c2000_sci_tx_t* tx;
+
+    uart_setup(115200UL);
+    tx = c2000_model_sci_tx(SCIA);
+
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern, 48, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_flush_tx(SCIA), HAL_OK);
+
+    TEST_ASSERT_EQ(tx->count, 48);
+    TEST_ASSERT_EQ(tx->gaps, 0);
+}
+
+/**
+ * 對照組: 每個字元前等待TXEMPTY (移位暫存器清空) 的寫法每個字元都有空檔，
+ * 確認模型確實能量到空檔
+ */
+static void test_model_detects_per_byte_polling(void)
+{
+    volatile uint16_t* regs;
+    c2000_sci_tx_t* tx;
+    uint32_t i;
+
+    uart_setup(FAST_BAUD);
+    tx = c2000_model_sci_tx(SCIA);
+    regs = (volatile uint16_t*)mmio_map(C2000_SCIA_BASE);
+
+    for (i = 0; i < 20U; i++) {
+        while ((regs[C2000_SCICTL2] & 0x0040U) == 0U) {
+        }
+        regs[C2000_SCITXBUF] = pattern[i];
+    }
+    TEST_ASSERT_EQ(hal_uart_flush_tx(SCIA), HAL_OK);
+
+    TEST_ASSERT_EQ(tx->count, 20);
+    TEST_ASSERT_EQ(tx->gaps, 19);
+    TEST_ASSERT(tx->idle_cycles >= 19U * C2000_MODEL_ACCESS_CYCLES);
+}
+
+/* ========================================================================== */
+/*                             接收: FIFO批次讀取                              */
+/* ========================================================================== */
+
+/** 以線路速率連續到達的1000個字元全部收到，FIFO不溢位 */
+static void test_rx_full_line_rate(void)
+{
+    uint32_t char_cycles;
+    uint64_t start;
+    uint32_t i;
+    hal_stats_t stats;
+
+    uart_setup(FAST_BAUD);
+    char_cycles = c2000_model_sci_char_cycles(SCIA);
+    start = c2000_model_now();
+
+    for (i = 0; i < 1000U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], 0, start + (uint64_t)(i + 1U) * char_cycles);
+    }
+
+    memset(received, 0, sizeof(received));
+    TEST_ASSERT_EQ(hal_uart_receive(SCIA, received, 1000, 100), HAL_OK);
+    TEST_ASSERT(memcmp(received, pattern, 1000) == 0);
+    TEST_ASSERT_EQ(c2000_model_sci_rx_pending(SCIA), 0);
+
+    if (hal_uart_get_stats(SCIA, &stats) == HAL_OK) {
+        TEST_ASSERT_EQ(stats.rx_bytes, 1000);
+        TEST_ASSERT_EQ(stats.overruns, 0);
+    }
+}
+
+/* ========================================================================== */
+/*                             超時與時鐘                                      */
+/* ========================================================================== */
+
+/** 超時前收到的部分字元計入rx_bytes */
+static void test_rx_timeout_counts_partial(void)
+{
+    uint64_t start;
+    uint32_t i;
+    hal_stats_t stats;
+
+    uart_setup(FAST_BAUD);
+    start = c2000_model_now();
+    for (i = 0; i < 3U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], 0,
+                              start + (uint64_t)(i + 1U) * c2000_model_sci_char_cycles(SCIA));
+    }
+
+    memset(received, 0, sizeof(received));
+    TEST_ASSERT_EQ(hal_uart_receive(SCIA, received, 10, 1), HAL_TIMEOUT);
+    TEST_ASSERT(memcmp(received, pattern, 3) == 0);
+
+    if (hal_uart_get_stats(SCIA, &stats) == HAL_OK) {
+        TEST_ASSERT_EQ(stats.rx_bytes, 3);
+        TEST_ASSERT_EQ(stats.timeouts, 1);
+        TEST_ASSERT_EQ(stats.transfers, 0);
+    }
+}
+
+/** 滿timeout毫秒即返回，不多等一毫秒 */
+static void test_timeout_duration(void)
+{
+    const uint64_t cycles_per_ms = CPU_HZ / 1000U;
+    uint8_t ch;
+    uint64_t start;
+    uint64_t elapsed;
+
+    uart_setup(FAST_BAUD);
+    start = c2000_model_now();
+    TEST_ASSERT_EQ(hal_uart_getchar(SCIA, &ch, 2), HAL_TIMEOUT);
+    elapsed = c2000_model_now() - start;
+
+    TEST_ASSERT(elapsed >= 2U * cycles_per_ms);
+    TEST_ASSERT(elapsed < 2U * cycles_per_ms + cycles_per_ms / 10U);
+}
+
+/** 初始化在CpuSysRegs.PCLKCR7 (0x5D330) 使能SCI時鐘，反初始化關閉 */
+static void test_init_enables_sci_clock(void)
+{
+    mmio_region_t* cpusys;
+    const uint32_t pclkcr7 = (uint32_t)(C2000_PCLKCR7 - C2000_CPUSYS_BASE) * 2U;
+
+    uart_setup(FAST_BAUD);
+    cpusys = c2000_model_cpusys_region();
+    TEST_ASSERT_EQ(mmio_peek32(cpusys, pclkcr7), 1UL << SCIA);
+
+    TEST_ASSERT_EQ(hal_uart_deinit(SCIA), HAL_OK);
+    TEST_ASSERT_EQ(mmio_peek32(cpusys, pclkcr7), 0);
+}
+
+/** SCIPRI只設置SOFT (位元3)，FREE (位元4) 保持0，除錯暫停時完成目前字元後停止 */
+static void test_init_sci_priority(void)
+{
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(mmio_peek16(c2000_model_sci_region(), C2000_SCIPRI * 2U), 0x0008U);
+}
+
+/** 輪詢實現沒有RX中斷，訊框介面明確回報不支援 */
+static void test_frame_not_supported(void)
+{
+    uint8_t frame[8];
+    uint16_t length = 0;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_config_frame(SCIA, 0, '\n'), HAL_NOT_SUPPORTED);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(SCIA, frame, sizeof(frame), &length, NULL, NULL),
+                   HAL_NOT_SUPPORTED);
+    TEST_ASSERT(!hal_uart_frame_pending(SCIA));
+    TEST_ASSERT_EQ(hal_uart_abort_frame(SCIA), HAL_NOT_SUPPORTED);
+}
+
+int main(void)
+{
+    TEST_RUN(test_tx_full_line_rate);
+    TEST_RUN(test_tx_back_to_back_frames);
+    TEST_RUN(test_tx_115200);
+    TEST_RUN(test_model_detects_per_byte_polling);
+    TEST_RUN(test_rx_full_line_rate);
+    TEST_RUN(test_rx_timeout_counts_partial);
+    TEST_RUN(test_timeout_duration);
+    TEST_RUN(test_init_enables_sci_clock);
+    TEST_RUN(test_init_sci_priority);
+    TEST_RUN(test_frame_not_supported);
+
+    return TEST_REPORT();
+}
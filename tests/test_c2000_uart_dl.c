@@ -0,0 +1,286 @@
+/**
+ * @file test_c2000_uart_dl.c
+ * @brief C2000 DriverLib版UART驅動在SCI暫存器模型上的測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 驅動原始碼 (ti_c2000_uart.c) 以主機gcc編譯，model/c2000/driverlib.h以暫存器操作
+ * 提供它用到的SCI/SysCtl函式，存取落在model/c2000_model.c的SCI模型上。
+ * RX FIFO中斷由測試在FIFO達到觸發深度後直接呼叫註冊的處理函式。
+ */
+
+#include "hal.h"
+#include "hal_timer.h"
+#include "hal_uart.h"
+#include "c2000_model.h"
+#include "driverlib.h"
+#include "test_common.h"
+#include <string.h>
+
+#define CPU_HZ                  120000000UL
+#define LSPCLK_HZ               60000000UL
+#define CYCLES_PER_MS           (CPU_HZ / 1000UL)
+#define SCIA                    0U
+#define FAST_BAUD               3750000UL   // BRR = 1，每字元320個CPU週期
+
+static uint8_t pattern[1024];
+static uint8_t received[1024];
+static uint32_t frame_done_count;
+
+/** 系統tick由模型時間換算，每次讀取計為一次輪詢 */
+uint32_t hal_get_tick(void)
+{
+    (void)hal_get_cycle_count();
+    return (uint32_t)(c2000_model_now() / CYCLES_PER_MS);
+}
+
+static void uart_setup(uint32_t baudrate)
+{
+    hal_uart_config_t config = {
+        baudrate, HAL_UART_DATABITS_8, HAL_UART_STOPBITS_1, HAL_UART_PARITY_NONE
+    };
+    uint32_t i;
+
+    c2000_model_init(CPU_HZ, LSPCLK_HZ);
+    TEST_ASSERT_EQ(hal_uart_init(SCIA, &config), HAL_OK);
+    (void)hal_uart_reset_stats(SCIA);
+    frame_done_count = 0;
+
+    for (i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = (uint8_t)(i * 7U + 3U);
+    }
+}
+
+/** 讓模型時間前進ms毫秒，每毫秒執行一次系統tick與計時器處理 */
+static void run_ms(uint32_t ms)
+{
+    while (ms-- > 0U) {
+        c2000_model_advance(CYCLES_PER_MS);
+        hal_timer_tick();
+        (void)hal_timer_process();
+    }
+}
+
+static void frame_done(void* context)
+{
+    (void)context;
+    frame_done_count++;
+}
+
+/* ========================================================================== */
+/*                             初始化                                          */
+/* ========================================================================== */
+
+/** 初始化以四捨五入的BRR覆寫SCI_setConfig的截斷結果，並使能SCI時鐘 */
+static void test_init_rounds_divisor(void)
+{
+    mmio_region_t* sci;
+    mmio_region_t* cpusys;
+    const uint32_t pclkcr7 = (uint32_t)(C2000_PCLKCR7 - C2000_CPUSYS_BASE) * 2U;
+    hal_uart_baud_result_t baud;
+
+    // 60 MHz / (8 * 230400) = 32.55: 截斷得BRR 31 (+1.7%)，最接近為BRR 32 (-1.4%)
+    uart_setup(230400UL);
+    sci = c2000_model_sci_region();
+    TEST_ASSERT_EQ(hal_uart_get_baud_info(SCIA, &baud), HAL_OK);
+    TEST_ASSERT_EQ(baud.divisor, 32);
+    TEST_ASSERT_EQ(mmio_peek16(sci, C2000_SCIHBAUD * 2U), 0);
+    TEST_ASSERT_EQ(mmio_peek16(sci, C2000_SCILBAUD * 2U), 32);
+
+    cpusys = c2000_model_cpusys_region();
+    TEST_ASSERT_EQ(mmio_peek32(cpusys, pclkcr7), 1UL << SCIA);
+    TEST_ASSERT_EQ(hal_uart_deinit(SCIA), HAL_OK);
+    TEST_ASSERT_EQ(mmio_peek32(cpusys, pclkcr7), 0);
+}
+
+/* ========================================================================== */
+/*                             輪詢傳輸                                        */
+/* ========================================================================== */
+
+/** 1000個字元依FIFO空間批次寫入，字元之間沒有空檔 */
+static void test_tx_full_line_rate(void)
+{
+    c2000_sci_tx_t* tx;
+    hal_stats_t stats;
+
+    uart_setup(FAST_BAUD);
+    tx = c2000_model_sci_tx(SCIA);
+
+    TEST_ASSERT_EQ(hal_uart_transmit(SCIA, pattern, 1000, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_flush_tx(SCIA), HAL_OK);
+    TEST_ASSERT(!hal_uart_is_busy(SCIA));
+
+    TEST_ASSERT_EQ(tx->count, 1000);
+    TEST_ASSERT(memcmp(tx->data, pattern, 1000) == 0);
+    TEST_ASSERT_EQ(tx->overruns, 0);
+    TEST_ASSERT_EQ(tx->gaps, 0);
+
+    if (hal_uart_get_stats(SCIA, &stats) == HAL_OK) {
+        TEST_ASSERT_EQ(stats.tx_bytes, 1000);
+        TEST_ASSERT_EQ(stats.transfers, 1);
+    }
+}
+
+/** 以線路速率到達的1000個字元全部收到，錯誤旗標計入統計 */
+static void test_rx_full_line_rate(void)
+{
+    uint32_t char_cycles;
+    uint64_t start;
+    uint32_t i;
+    hal_stats_t stats;
+
+    uart_setup(FAST_BAUD);
+    char_cycles = c2000_model_sci_char_cycles(SCIA);
+    start = c2000_model_now();
+
+    for (i = 0; i < 1000U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], (i == 500U) ? C2000_RX_FE : 0U,
+                              start + (uint64_t)(i + 1U) * char_cycles);
+    }
+
+    memset(received, 0, sizeof(received));
+    TEST_ASSERT_EQ(hal_uart_receive(SCIA, received, 1000, 100), HAL_OK);
+    TEST_ASSERT(memcmp(received, pattern, 1000) == 0);
+    TEST_ASSERT(!hal_uart_data_available(SCIA));
+
+    if (hal_uart_get_stats(SCIA, &stats) == HAL_OK) {
+        TEST_ASSERT_EQ(stats.rx_bytes, 1000);
+        TEST_ASSERT_EQ(stats.framing_errors, 1);
+        TEST_ASSERT_EQ(stats.overruns, 0);
+    }
+}
+
+/** 無資料時於超時後返回，FIFO溢位計入統計並清除 */
+static void test_rx_timeout_and_overflow(void)
+{
+    uint64_t start;
+    uint32_t i;
+    uint8_t ch;
+    hal_stats_t stats;
+
+    uart_setup(FAST_BAUD);
+    start = c2000_model_now();
+    TEST_ASSERT_EQ(hal_uart_getchar(SCIA, &ch, 2), HAL_TIMEOUT);
+    TEST_ASSERT(c2000_model_now() - start >= 2U * CYCLES_PER_MS);
+
+    // 20個字元到達時無人讀取，FIFO (16) 溢位
+    start = c2000_model_now();
+    for (i = 0; i < 20U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], 0,
+                              start + (uint64_t)(i + 1U) * c2000_model_sci_char_cycles(SCIA));
+    }
+    c2000_model_advance(21U * c2000_model_sci_char_cycles(SCIA));
+
+    TEST_ASSERT_EQ(hal_uart_receive(SCIA, received, 16, 10), HAL_OK);
+    TEST_ASSERT(memcmp(received, pattern, 16) == 0);
+
+    if (hal_uart_get_stats(SCIA, &stats) == HAL_OK) {
+        TEST_ASSERT_EQ(stats.overruns, 1);
+        TEST_ASSERT_EQ(stats.timeouts, 1);
+    }
+}
+
+/* ========================================================================== */
+/*                             訊框接收                                        */
+/* ========================================================================== */
+
+/** 未達FIFO觸發深度的短訊框由每tick的閒置檢查結束 */
+static void test_frame_idle_gap(void)
+{
+    uint16_t length = 0;
+    uint64_t start;
+    uint32_t i;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(SCIA, received, sizeof(received), &length,
+                                          frame_done, NULL), HAL_OK);
+    TEST_ASSERT(hal_uart_frame_pending(SCIA));
+    TEST_ASSERT(c2000_host_pie_handler(INT_SCIA_RX) != NULL);
+
+    start = c2000_model_now();
+    for (i = 0; i < 5U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], 0,
+                              start + (uint64_t)(i + 1U) * c2000_model_sci_char_cycles(SCIA));
+    }
+
+    // 第一個tick取出資料，之後線路閒置滿idle_ticks才結束
+    run_ms(1);
+    TEST_ASSERT(hal_uart_frame_pending(SCIA));
+    run_ms(3);
+    TEST_ASSERT(!hal_uart_frame_pending(SCIA));
+    TEST_ASSERT_EQ(frame_done_count, 1);
+    TEST_ASSERT_EQ(length, 5);
+    TEST_ASSERT(memcmp(received, pattern, 5) == 0);
+}
+
+/** FIFO中斷在結束字元處結束訊框，之後的資料留在FIFO */
+static void test_frame_match_in_isr(void)
+{
+    void (*isr)(void);
+    uint16_t length = 0;
+    uint64_t start;
+    uint32_t i;
+    uint8_t rest[4];
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_config_frame(SCIA, 0, pattern[5]), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(SCIA, received, sizeof(received), &length,
+                                          frame_done, NULL), HAL_OK);
+    isr = c2000_host_pie_handler(INT_SCIA_RX);
+    TEST_ASSERT(isr != NULL);
+
+    start = c2000_model_now();
+    for (i = 0; i < 8U; i++) {
+        c2000_model_sci_rx_at(SCIA, pattern[i], 0,
+                              start + (uint64_t)(i + 1U) * c2000_model_sci_char_cycles(SCIA));
+    }
+    c2000_model_advance(9U * c2000_model_sci_char_cycles(SCIA));
+    isr();
+
+    TEST_ASSERT(!hal_uart_frame_pending(SCIA));
+    TEST_ASSERT_EQ(frame_done_count, 1);
+    TEST_ASSERT_EQ(length, 6);
+    TEST_ASSERT(memcmp(received, pattern, 6) == 0);
+    TEST_ASSERT_EQ(c2000_host_pie_ack, INTERRUPT_ACK_GROUP9);
+
+    TEST_ASSERT_EQ(hal_uart_receive(SCIA, rest, 2, 10), HAL_OK);
+    TEST_ASSERT(memcmp(rest, pattern + 6, 2) == 0);
+
+    // 恢復預設 (無結束字元)
+    TEST_ASSERT_EQ(hal_uart_config_frame(SCIA, 0, HAL_UART_FRAME_NO_MATCH), HAL_OK);
+}
+
+/** 中止後不再結束訊框 */
+static void test_frame_abort(void)
+{
+    uint16_t length = 0;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(SCIA, received, sizeof(received), &length,
+                                          frame_done, NULL), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(SCIA, received, sizeof(received), &length,
+                                          frame_done, NULL), HAL_BUSY);
+    TEST_ASSERT_EQ(hal_uart_abort_frame(SCIA), HAL_OK);
+    TEST_ASSERT(!hal_uart_frame_pending(SCIA));
+
+    c2000_model_sci_rx_at(SCIA, 0x55, 0, c2000_model_now() + c2000_model_sci_char_cycles(SCIA));
+    run_ms(5);
+    TEST_ASSERT_EQ(frame_done_count, 0);
+    TEST_ASSERT_EQ(length, 0);
+}
+
+int main(void)
+{
+    // 驅動的閒置檢查計時器在首次接收訊框時建立，服務只初始化一次
+    hal_timer_service_init();
+
+    TEST_RUN(test_init_rounds_divisor);
+    TEST_RUN(test_tx_full_line_rate);
+    TEST_RUN(test_rx_full_line_rate);
+    TEST_RUN(test_rx_timeout_and_overflow);
+    TEST_RUN(test_frame_idle_gap);
+    TEST_RUN(test_frame_match_in_isr);
+    TEST_RUN(test_frame_abort);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,91 @@
+/**
+ * @file test_common.h
+ * @brief 主機端單元測試與效能量測輔助巨集
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 每個測試程式為獨立的執行檔，以TEST_RUN()執行各測試函式，
+ * main()最後返回TEST_REPORT()，有任何檢查失敗時返回1。
+ */
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/* ========================================================================== */
+/*                             檢查巨集                                        */
+/* ========================================================================== */
+
+// 量測程式只使用計時輔助函式，不引用檢查計數
+#if defined(__GNUC__)
+    #define TEST_UNUSED __attribute__((unused))
+#else
+    #define TEST_UNUSED
+#endif
+
+static unsigned long test_checks TEST_UNUSED = 0;
+static unsigned long test_failures TEST_UNUSED = 0;
+
+/** 條件成立 */
+#define TEST_ASSERT(cond)                                                       \
+    do {                                                                        \
+        test_checks++;                                                          \
+        if (!(cond)) {                                                          \
+            test_failures++;                                                    \
+            printf("  ❌ %s:%d: %s\n", __FILE__, __LINE__, #cond);              \
+        }                                                                       \
+    } while (0)
+
+/** 兩個整數相等 (失敗時列出兩者的值) */
+#define TEST_ASSERT_EQ(actual, expected)                                        \
+    do {                                                                        \
+        unsigned long long test_a = (unsigned long long)(actual);               \
+        unsigned long long test_e = (unsigned long long)(expected);             \
+        test_checks++;                                                          \
+        if (test_a != test_e) {                                                 \
+            test_failures++;                                                    \
+            printf("  ❌ %s:%d: %s = 0x%llX，預期 %s = 0x%llX\n",                \
+                   __FILE__, __LINE__, #actual, test_a, #expected, test_e);     \
+        }                                                                       \
+    } while (0)
+
+/** 執行一個測試函式 */
+#define TEST_RUN(fn)                                                            \
+    do {                                                                        \
+        unsigned long test_before = test_failures;                              \
+        fn();                                                                   \
+        printf("%s %s\n", (test_failures == test_before) ? "✅" : "❌", #fn);   \
+    } while (0)
+
+/** 輸出結果並返回程式結束碼 */
+#define TEST_REPORT()                                                           \
+    (printf("=== %s: %lu 項檢查，%lu 項失敗 ===\n", __FILE__,                   \
+            test_checks, test_failures), (test_failures == 0) ? 0 : 1)
+
+/* ========================================================================== */
+/*                             量測輔助函式                                    */
+/* ========================================================================== */
+
+/** 單調時鐘 (奈秒) */
+static inline uint64_t test_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/** 可重現的虛擬亂數 (xorshift32) */
+static inline uint32_t test_random(uint32_t* state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+#endif /* TEST_COMMON_H */
@@ -0,0 +1,416 @@
+/**
+ * @file test_cpu_load.c
+ * @brief CPU負載量測單元測試 (閒置/中斷扣除、巢狀中斷、計數器迴繞、視窗滑動、延遲結算)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以host_cycles控制hal_get_cycle_count()，時間只在測試呼叫之間前進。
+ */
+
+#include "hal_cpu_load.h"
+#include "host_platform.h"
+#include "test_common.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                             測試輔助                                        */
+/* ========================================================================== */
+
+#define SLOT                    1000U
+#define ISR_A                   0U
+#define ISR_B                   1U
+
+/** 從指定的週期計數開始量測，初始為忙碌 */
+static void start_at(uint32_t cycles)
+{
+    host_cycles = cycles;
+    hal_cpu_load_idle_exit();
+    TEST_ASSERT_EQ(hal_cpu_load_init(SLOT), HAL_OK);
+}
+
+static void advance(uint32_t cycles)
+{
+    host_cycles += cycles;
+}
+
+/** 執行一次不巢狀的中斷 */
+static void isr_run(uint16_t isr_id, uint32_t cycles)
+{
+    hal_cpu_load_stamp_t stamp;
+
+    hal_cpu_load_isr_enter(&stamp);
+    advance(cycles);
+    hal_cpu_load_isr_exit(isr_id, &stamp);
+}
+
+static hal_cpu_load_stats_t load_get(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    TEST_ASSERT_EQ(hal_cpu_load_get(&stats), HAL_OK);
+    return stats;
+}
+
+static hal_cpu_load_isr_stats_t isr_get(uint16_t isr_id)
+{
+    hal_cpu_load_isr_stats_t stats;
+
+    TEST_ASSERT_EQ(hal_cpu_load_get_isr(isr_id, &stats), HAL_OK);
+    return stats;
+}
+
+/* ========================================================================== */
+/*                             負載計算                                        */
+/* ========================================================================== */
+
+/** 閒置與忙碌各一個區段: 平均50%，峰值100% */
+static void test_idle_and_busy_slots(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    start_at(0);
+    hal_cpu_load_idle_enter();
+    advance(SLOT);
+    hal_cpu_load_idle_enter();
+    hal_cpu_load_idle_exit();
+
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 1);
+    TEST_ASSERT_EQ(stats.load, 0);
+
+    advance(SLOT);
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 2);
+    TEST_ASSERT_EQ(stats.load, 5000);
+    TEST_ASSERT_EQ(stats.peak, HAL_CPU_LOAD_FULL);
+    TEST_ASSERT_EQ(stats.isr_load, 0);
+    TEST_ASSERT_EQ(stats.window_cycles, 2U * SLOT);
+}
+
+/** 區段未到期時查詢不產生區段 */
+static void test_no_slot_before_period(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    start_at(0);
+    advance(SLOT - 1U);
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 0);
+    TEST_ASSERT_EQ(stats.load, 0);
+    TEST_ASSERT_EQ(stats.window_cycles, 0);
+
+    advance(1);
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 1);
+    TEST_ASSERT_EQ(stats.load, HAL_CPU_LOAD_FULL);
+}
+
+/** 閒置期間進入的中斷從閒置中扣除並計入負載 */
+static void test_isr_during_idle(void)
+{
+    hal_cpu_load_stats_t stats;
+    hal_cpu_load_isr_stats_t isr;
+
+    start_at(0);
+    hal_cpu_load_idle_enter();
+    advance(300);
+    isr_run(ISR_A, 200);
+    advance(500);
+    hal_cpu_load_idle_enter();
+
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 1);
+    TEST_ASSERT_EQ(stats.load, 2000);
+    TEST_ASSERT_EQ(stats.isr_load, 2000);
+
+    isr = isr_get(ISR_A);
+    TEST_ASSERT_EQ(isr.count, 1);
+    TEST_ASSERT_EQ(isr.total_cycles, 200);
+    TEST_ASSERT_EQ(isr.max_cycles, 200);
+    TEST_ASSERT_EQ(isr.load, 2000);
+}
+
+/** 巢狀中斷的時間只計入內層，外層扣除 */
+static void test_nested_isr(void)
+{
+    hal_cpu_load_stamp_t outer;
+    hal_cpu_load_stamp_t inner;
+    hal_cpu_load_isr_stats_t a;
+    hal_cpu_load_isr_stats_t b;
+
+    start_at(0);
+    hal_cpu_load_idle_enter();
+
+    hal_cpu_load_isr_enter(&outer);
+    advance(100);
+    hal_cpu_load_isr_enter(&inner);
+    advance(50);
+    hal_cpu_load_isr_exit(ISR_B, &inner);
+    advance(30);
+    hal_cpu_load_isr_exit(ISR_A, &outer);
+
+    advance(SLOT - 180U);
+    hal_cpu_load_idle_enter();
+
+    a = isr_get(ISR_A);
+    b = isr_get(ISR_B);
+    TEST_ASSERT_EQ(a.total_cycles, 130);
+    TEST_ASSERT_EQ(b.total_cycles, 50);
+    TEST_ASSERT_EQ(a.load, 1300);
+    TEST_ASSERT_EQ(b.load, 500);
+    TEST_ASSERT_EQ(load_get().load, 1800);
+    TEST_ASSERT_EQ(load_get().isr_load, 1800);
+}
+
+/** 單次最長時間與超出範圍的識別碼 */
+static void test_isr_max_and_unknown_id(void)
+{
+    hal_cpu_load_isr_stats_t isr;
+
+    start_at(0);
+    hal_cpu_load_idle_enter();
+    isr_run(ISR_A, 10);
+    isr_run(ISR_A, 40);
+    isr_run(ISR_A, 20);
+    isr_run(HAL_CPU_LOAD_MAX_ISRS, 30);
+    advance(SLOT - 100U);
+    hal_cpu_load_idle_enter();
+
+    isr = isr_get(ISR_A);
+    TEST_ASSERT_EQ(isr.count, 3);
+    TEST_ASSERT_EQ(isr.total_cycles, 70);
+    TEST_ASSERT_EQ(isr.max_cycles, 40);
+
+    // 未個別統計的中斷仍計入整體中斷時間
+    TEST_ASSERT_EQ(load_get().isr_load, 1000);
+}
+
+/** 週期計數器在區段與中斷中迴繞 */
+static void test_counter_wrap(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    start_at(0xFFFFFF00UL);
+    hal_cpu_load_idle_enter();
+    advance(0xF0);
+    isr_run(ISR_A, 0x20);
+    advance(SLOT - 0x110U);
+    hal_cpu_load_idle_enter();
+
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 1);
+    TEST_ASSERT_EQ(stats.window_cycles, SLOT);
+    TEST_ASSERT_EQ(stats.load, (0x20U * HAL_CPU_LOAD_FULL) / SLOT);
+    TEST_ASSERT_EQ(isr_get(ISR_A).total_cycles, 0x20);
+}
+
+/** 視窗只保留最近HAL_CPU_LOAD_WINDOW_SLOTS個區段 */
+static void test_window_slides(void)
+{
+    hal_cpu_load_stats_t stats;
+    uint32_t i;
+
+    start_at(0);
+    for (i = 0; i < HAL_CPU_LOAD_WINDOW_SLOTS; i++) {
+        advance(SLOT);
+        (void)load_get();
+    }
+
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, HAL_CPU_LOAD_WINDOW_SLOTS);
+    TEST_ASSERT_EQ(stats.load, HAL_CPU_LOAD_FULL);
+
+    // 之後全部閒置: 忙碌的區段逐一離開視窗
+    hal_cpu_load_idle_enter();
+    for (i = 1; i <= HAL_CPU_LOAD_WINDOW_SLOTS; i++) {
+        advance(SLOT);
+        hal_cpu_load_idle_enter();
+        stats = load_get();
+        TEST_ASSERT_EQ(stats.load, (HAL_CPU_LOAD_WINDOW_SLOTS - i) * HAL_CPU_LOAD_FULL /
+                                   HAL_CPU_LOAD_WINDOW_SLOTS);
+    }
+
+    // 峰值保留到重設
+    TEST_ASSERT_EQ(stats.peak, HAL_CPU_LOAD_FULL);
+    hal_cpu_load_reset();
+    TEST_ASSERT_EQ(load_get().peak, 0);
+    TEST_ASSERT_EQ(load_get().slots, 0);
+}
+
+/* ========================================================================== */
+/*                             延遲結算                                        */
+/* ========================================================================== */
+
+/** 晚了數個區段才結算: 經過的時間切成同樣數量的區段 */
+static void test_late_roll_split(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    start_at(0);
+    advance(250);
+    isr_run(ISR_A, 250);
+    hal_cpu_load_idle_enter();
+    advance(3500);
+    hal_cpu_load_idle_enter();
+
+    // 4個區段，各分得1/4的忙碌與中斷時間 (不會出現單一區段50%的峰值)
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 4);
+    TEST_ASSERT_EQ(stats.window_cycles, 4U * SLOT);
+    TEST_ASSERT_EQ(stats.load, 1250);
+    TEST_ASSERT_EQ(stats.isr_load, 625);
+    TEST_ASSERT_EQ(stats.peak, 1250);
+    TEST_ASSERT_EQ(isr_get(ISR_A).load, 625);
+    TEST_ASSERT_EQ(isr_get(ISR_A).total_cycles, 250);
+
+    // 不足一個區段長度的餘數併入最後一個區段
+    start_at(0);
+    advance(4500);
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, 4);
+    TEST_ASSERT_EQ(stats.window_cycles, 4500);
+    TEST_ASSERT_EQ(stats.load, HAL_CPU_LOAD_FULL);
+}
+
+/** 延遲超過整個視窗: 只保留最後HAL_CPU_LOAD_WINDOW_SLOTS個區段 */
+static void test_late_roll_beyond_window(void)
+{
+    hal_cpu_load_stats_t stats;
+
+    start_at(0);
+    advance(500);
+    hal_cpu_load_idle_enter();
+    advance(19800);
+    hal_cpu_load_idle_enter();
+
+    stats = load_get();
+    TEST_ASSERT_EQ(stats.slots, HAL_CPU_LOAD_WINDOW_SLOTS);
+    TEST_ASSERT_EQ(stats.window_cycles, HAL_CPU_LOAD_WINDOW_SLOTS * SLOT + 300U);
+
+    // 500週期的忙碌依長度分配到20個區段，視窗內為12000週期之後的份額
+    TEST_ASSERT_EQ(stats.load, ((500U - (500U * 12000U) / 20300U) * HAL_CPU_LOAD_FULL) /
+                               stats.window_cycles);
+    TEST_ASSERT(stats.load > 0U);
+}
+
+/* ========================================================================== */
+/*                             隨機比對                                        */
+/* ========================================================================== */
+
+#define RANDOM_CYCLES           400000U
+
+static uint8_t timeline_busy[RANDOM_CYCLES + SLOT];
+
+/** 隨機的閒置、忙碌與中斷序列，視窗負載與逐週期的參考時間軸比對 */
+static void test_random_against_timeline(void)
+{
+    uint32_t seed = 0x2468ACEU;
+    uint32_t slot_start = 0;
+    uint32_t ends[HAL_CPU_LOAD_WINDOW_SLOTS + 1U];
+    uint32_t rolls = 0;
+    bool idle = false;
+
+    memset(timeline_busy, 0, sizeof(timeline_busy));
+    start_at(0);
+
+    while (host_cycles < RANDOM_CYCLES) {
+        uint32_t r = test_random(&seed);
+        uint32_t len = 1U + ((r >> 8) % 300U);
+        uint32_t t;
+
+        // 每個區段到期就以查詢結算，區段邊界與參考一致且不會延遲超過一個區段
+        if (host_cycles - slot_start >= SLOT) {
+            (void)load_get();
+            slot_start = host_cycles;
+            ends[rolls % (HAL_CPU_LOAD_WINDOW_SLOTS + 1U)] = host_cycles;
+            rolls++;
+        }
+
+        switch (r % 4U) {
+            case 0:
+                hal_cpu_load_idle_enter();
+                idle = true;
+                break;
+            case 1:
+                hal_cpu_load_idle_exit();
+                idle = false;
+                break;
+            case 2:
+                isr_run((uint16_t)(r >> 20) % 3U, len);
+                for (t = host_cycles - len; t < host_cycles; t++) {
+                    timeline_busy[t] = 1U;
+                }
+                continue;
+            default:
+                break;
+        }
+
+        for (t = host_cycles; t < host_cycles + len; t++) {
+            timeline_busy[t] = idle ? 0U : 1U;
+        }
+        advance(len);
+    }
+
+    if (host_cycles - slot_start >= SLOT) {
+        ends[rolls % (HAL_CPU_LOAD_WINDOW_SLOTS + 1U)] = host_cycles;
+        rolls++;
+    }
+
+    TEST_ASSERT(rolls > HAL_CPU_LOAD_WINDOW_SLOTS);
+    {
+        hal_cpu_load_stats_t stats = load_get();
+        uint32_t last = ends[(rolls - 1U) % (HAL_CPU_LOAD_WINDOW_SLOTS + 1U)];
+        uint32_t first = ends[rolls % (HAL_CPU_LOAD_WINDOW_SLOTS + 1U)];
+        uint64_t busy = 0;
+        uint32_t t;
+
+        for (t = first; t < last; t++) {
+            busy += timeline_busy[t];
+        }
+
+        TEST_ASSERT_EQ(stats.window_cycles, last - first);
+        TEST_ASSERT_EQ(stats.load, (uint32_t)((busy * HAL_CPU_LOAD_FULL) / (last - first)));
+    }
+}
+
+/* ========================================================================== */
+/*                             參數檢查                                        */
+/* ========================================================================== */
+
+static void test_invalid_params(void)
+{
+    hal_cpu_load_stats_t stats;
+    hal_cpu_load_isr_stats_t isr;
+
+    TEST_ASSERT_EQ(hal_cpu_load_init(0), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_cpu_load_init(0x80000000UL), HAL_INVALID_PARAM);
+
+    start_at(0);
+    TEST_ASSERT_EQ(hal_cpu_load_get(NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_cpu_load_get_isr(ISR_A, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_cpu_load_get_isr(HAL_CPU_LOAD_MAX_ISRS, &isr), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_cpu_load_get(&stats), HAL_OK);
+}
+
+int main(void)
+{
+    // 尚未初始化
+    {
+        hal_cpu_load_stats_t stats;
+        TEST_ASSERT_EQ(hal_cpu_load_get(&stats), HAL_ERROR);
+    }
+
+    TEST_RUN(test_idle_and_busy_slots);
+    TEST_RUN(test_no_slot_before_period);
+    TEST_RUN(test_isr_during_idle);
+    TEST_RUN(test_nested_isr);
+    TEST_RUN(test_isr_max_and_unknown_id);
+    TEST_RUN(test_counter_wrap);
+    TEST_RUN(test_window_slides);
+    TEST_RUN(test_late_roll_split);
+    TEST_RUN(test_late_roll_beyond_window);
+    TEST_RUN(test_random_against_timeline);
+    TEST_RUN(test_invalid_params);
+
+    return TEST_REPORT();
+}
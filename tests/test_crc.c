@@ -0,0 +1,170 @@
+/**
+ * @file test_crc.c
+ * @brief CRC計算單元測試 (標準檢查值、查表與逐位元一致、分段累加、參數檢查)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_crc.h"
+#include "test_common.h"
+
+/* ========================================================================== */
+/*                             測試資料                                        */
+/* ========================================================================== */
+
+typedef struct {
+    const char* name;
+    hal_crc_config_t config;
+    uint32_t check;                 // "123456789"的CRC (Rocksoft模型的check值)
+} crc_case_t;
+
+static const crc_case_t cases[] = {
+    { "CRC-8",               HAL_CRC_CONFIG_CRC8,         0xF4UL },
+    { "CRC-16/CCITT-FALSE",  HAL_CRC_CONFIG_CRC16_CCITT,  0x29B1UL },
+    { "CRC-16/MODBUS",       HAL_CRC_CONFIG_CRC16_MODBUS, 0x4B37UL },
+    { "CRC-32",              HAL_CRC_CONFIG_CRC32,        0xCBF43926UL },
+    { "CRC-32C",             HAL_CRC_CONFIG_CRC32C,       0xE3069283UL },
+    // 非8倍數寬度與輸入/輸出反射不同的組合
+    { "CRC-5/USB",           { 5U, 0x05UL, 0x1FUL, true, true, 0x1FUL },          0x19UL },
+    { "CRC-12/UMTS",         { 12U, 0x80FUL, 0x000UL, false, true, 0x000UL },     0xDAFUL },
+    { "CRC-24/OPENPGP",      { 24U, 0x864CFBUL, 0xB704CEUL, false, false, 0x0UL }, 0x21CF02UL },
+};
+
+#define CASE_COUNT              (sizeof(cases) / sizeof(cases[0]))
+#define RANDOM_SIZE             4096U
+
+static const uint8_t check_input[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+static uint8_t random_data[RANDOM_SIZE];
+static hal_crc_table_t table;
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+/** 標準檢查值 (逐位元與查表) */
+static void test_check_values(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < CASE_COUNT; i++) {
+        const crc_case_t* c = &cases[i];
+        uint32_t bitwise = hal_crc_compute(&c->config, NULL, check_input, sizeof(check_input));
+        uint32_t table_crc;
+
+        TEST_ASSERT_EQ(hal_crc_table_build(&table, &c->config), HAL_OK);
+        table_crc = hal_crc_compute(&c->config, &table, check_input, sizeof(check_input));
+
+        if (bitwise != c->check || table_crc != c->check) {
+            printf("    %s\n", c->name);
+        }
+        TEST_ASSERT_EQ(bitwise, c->check);
+        TEST_ASSERT_EQ(table_crc, c->check);
+    }
+}
+
+/** 隨機資料與長度: 查表結果與逐位元結果相同 (含不足8位元組的尾端) */
+static void test_table_matches_bitwise(void)
+{
+    uint32_t seed = 0xC4C4C4C4UL;
+    uint32_t i;
+    uint32_t round;
+
+    for (i = 0; i < CASE_COUNT; i++) {
+        const crc_case_t* c = &cases[i];
+
+        (void)hal_crc_table_build(&table, &c->config);
+        for (round = 0; round < 200U; round++) {
+            uint32_t offset = test_random(&seed) % 64U;
+            uint32_t len = test_random(&seed) % (RANDOM_SIZE - 64U);
+
+            TEST_ASSERT_EQ(hal_crc_compute(&c->config, &table, &random_data[offset], len),
+                           hal_crc_compute(&c->config, NULL, &random_data[offset], len));
+        }
+    }
+}
+
+/** 任意分段累加與一次計算結果相同，hal_crc_final()不影響後續累加 */
+static void test_incremental(void)
+{
+    uint32_t seed = 0x1234ABCDUL;
+    uint32_t i;
+
+    for (i = 0; i < CASE_COUNT; i++) {
+        const crc_case_t* c = &cases[i];
+        uint32_t expected = hal_crc_compute(&c->config, NULL, random_data, RANDOM_SIZE);
+        uint32_t pass;
+
+        (void)hal_crc_table_build(&table, &c->config);
+
+        for (pass = 0; pass < 2U; pass++) {
+            hal_crc_t crc;
+            uint32_t pos = 0;
+
+            TEST_ASSERT_EQ(hal_crc_init(&crc, &c->config, (pass == 0U) ? NULL : &table), HAL_OK);
+            while (pos < RANDOM_SIZE) {
+                uint32_t n = test_random(&seed) % 40U;
+
+                if (n > RANDOM_SIZE - pos) {
+                    n = RANDOM_SIZE - pos;
+                }
+                hal_crc_update(&crc, &random_data[pos], n);
+                (void)hal_crc_final(&crc);
+                pos += n;
+            }
+            TEST_ASSERT_EQ(hal_crc_final(&crc), expected);
+
+            // 重新開始後得到相同結果
+            hal_crc_reset(&crc);
+            hal_crc_update(&crc, random_data, RANDOM_SIZE);
+            TEST_ASSERT_EQ(hal_crc_final(&crc), expected);
+        }
+    }
+}
+
+/** 查表與參數不符、無效寬度或多項式超出寬度時被拒絕 */
+static void test_invalid_params(void)
+{
+    static const hal_crc_config_t crc16 = HAL_CRC_CONFIG_CRC16_CCITT;
+    static const hal_crc_config_t crc32 = HAL_CRC_CONFIG_CRC32;
+    static const hal_crc_config_t zero_width = { 0U, 0x07UL, 0UL, false, false, 0UL };
+    static const hal_crc_config_t wide_poly = { 8U, 0x107UL, 0UL, false, false, 0UL };
+    hal_crc_t crc;
+
+    (void)hal_crc_table_build(&table, &crc32);
+    TEST_ASSERT_EQ(hal_crc_init(&crc, &crc16, &table), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_crc_init(&crc, &zero_width, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_crc_init(&crc, &wide_poly, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_crc_table_build(&table, &wide_poly), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_crc_init(NULL, &crc16, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_crc_compute(&wide_poly, NULL, check_input, sizeof(check_input)), 0);
+}
+
+/** 映像檢查: 相符與不符 */
+static void test_check_image(void)
+{
+    static const hal_crc_config_t crc32 = HAL_CRC_CONFIG_CRC32;
+    uint32_t expected = hal_crc_compute(&crc32, NULL, random_data, RANDOM_SIZE);
+
+    TEST_ASSERT_EQ(hal_crc_check_image(random_data, RANDOM_SIZE, expected), HAL_OK);
+    TEST_ASSERT_EQ(hal_crc_check_image(random_data, RANDOM_SIZE, expected ^ 1UL), HAL_ERROR);
+    TEST_ASSERT_EQ(hal_crc_check_image(check_input, sizeof(check_input), 0xCBF43926UL), HAL_OK);
+    TEST_ASSERT_EQ(hal_crc_check_image(NULL, 4, 0), HAL_INVALID_PARAM);
+}
+
+int main(void)
+{
+    uint32_t seed = 0xDEADBEEFUL;
+    uint32_t i;
+
+    for (i = 0; i < RANDOM_SIZE; i++) {
+        random_data[i] = (uint8_t)test_random(&seed);
+    }
+
+    TEST_RUN(test_check_values);
+    TEST_RUN(test_table_matches_bitwise);
+    TEST_RUN(test_incremental);
+    TEST_RUN(test_invalid_params);
+    TEST_RUN(test_check_image);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,373 @@
+/**
+ * @file test_critical.c
+ * @brief 可巢狀臨界區 (hal_critical) 的巢狀與狀態恢復測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 同一測試分別以三種平台設定編譯:
+ * - 主機端模擬 (hal_critical_host_primask/level)
+ * - PLATFORM_TI_C2000: INTM與IER由model/c2000/c28x_host.h與c2000_model.c提供，
+ *   以固定的hal_irq群組配置更新優先權轉換表
+ * - PLATFORM_STM32: PRIMASK與BASEPRI由model/stm32g4/stm32g4xx.h提供
+ * 共用部分只經hal_critical_is_masked()檢查遮罩範圍，平台部分檢查實際暫存器值。
+ */
+
+#include "hal_critical.h"
+#include "test_common.h"
+
+#define PRIO_MIN                HAL_IRQ_PRIORITY_HIGHEST
+#define NEST_DEPTH              16U
+
+/* ========================================================================== */
+/*                             平台狀態                                        */
+/* ========================================================================== */
+
+#if defined(PLATFORM_TI_C2000)
+
+    #define PLATFORM_NAME       "TI C2000 (INTM/IER)"
+
+    // INT1-INT13各登記一個優先權0-12的向量，INT14未登記 (視為優先權未知)；
+    // 優先權13-15只遮罩INT14，不在masked_from()的檢查範圍內
+    #define PRIO_MAX            12U
+
+    static void critical_reset(void)
+    {
+        uint16_t group_lowest[14];
+        uint16_t j;
+
+        for (j = 0; j < 13U; j++) {
+            group_lowest[j] = j + 1U;
+        }
+        group_lowest[13] = 0U;
+        hal_critical_update_ier_keep(group_lowest);
+
+        // INTM清除，INT1-INT14致能
+        c28x_host_intm = 0U;
+        IER = HAL_CRITICAL_IER_GROUPS;
+    }
+
+#elif defined(PLATFORM_STM32)
+
+    #define PLATFORM_NAME       "STM32 (PRIMASK/BASEPRI)"
+    #define PRIO_MAX            HAL_IRQ_PRIORITY_LOWEST
+
+    static void critical_reset(void)
+    {
+        cortexm_host_primask = 0U;
+        cortexm_host_basepri = 0U;
+    }
+
+#else
+
+    #define PLATFORM_NAME       "主機端模擬"
+    #define PRIO_MAX            HAL_IRQ_PRIORITY_LOWEST
+
+    static void critical_reset(void)
+    {
+        hal_critical_host_primask = 0U;
+        hal_critical_host_level = HAL_CRITICAL_HOST_LEVEL_NONE;
+    }
+
+#endif
+
+/**
+ * @brief 目前被遮罩的最高優先權 (數值最小者)
+ * @return 該優先權及數值更大者全部被遮罩；PRIO_MAX + 1表示沒有遮罩
+ */
+static uint16_t masked_from(void)
+{
+    uint16_t prio;
+    uint16_t p;
+
+    for (prio = PRIO_MIN; prio <= PRIO_MAX; prio++) {
+        if (hal_critical_is_masked(prio)) {
+            break;
+        }
+    }
+
+    // 遮罩範圍必須連續
+    for (p = prio; p <= PRIO_MAX; p++) {
+        TEST_ASSERT(hal_critical_is_masked(p));
+    }
+
+    return prio;
+}
+
+/* ========================================================================== */
+/*                             全域臨界區                                      */
+/* ========================================================================== */
+
+/** 巢狀enter/exit: 只有最外層的exit恢復中斷 */
+static void test_enter_exit_nesting(void)
+{
+    hal_critical_state_t outer;
+    hal_critical_state_t inner;
+
+    critical_reset();
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+
+    outer = hal_critical_enter();
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+    inner = hal_critical_enter();
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+
+    hal_critical_exit(inner);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+    hal_critical_exit(outer);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+}
+
+/* ========================================================================== */
+/*                             優先權臨界區                                    */
+/* ========================================================================== */
+
+/** 只遮罩prio及較低優先權，較高優先權的中斷仍可搶占 */
+static void test_level_masks_lower_only(void)
+{
+    hal_critical_level_t state;
+
+    critical_reset();
+    state = hal_critical_enter_level(5);
+
+    TEST_ASSERT(!hal_critical_is_masked(1));
+    TEST_ASSERT(!hal_critical_is_masked(4));
+    TEST_ASSERT(hal_critical_is_masked(5));
+    TEST_ASSERT(hal_critical_is_masked(PRIO_MAX));
+    TEST_ASSERT_EQ(masked_from(), 5);
+
+    hal_critical_exit_level(state);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+
+    // 超出範圍的優先權視為最低優先權
+    state = hal_critical_enter_level(HAL_IRQ_PRIORITY_LEVELS + 100U);
+    TEST_ASSERT(hal_critical_is_masked(HAL_IRQ_PRIORITY_LOWEST));
+    TEST_ASSERT(hal_critical_is_masked(HAL_IRQ_PRIORITY_LEVELS));
+    TEST_ASSERT(!hal_critical_is_masked(PRIO_MAX - 1U));
+    hal_critical_exit_level(state);
+    TEST_ASSERT(!hal_critical_is_masked(HAL_IRQ_PRIORITY_LOWEST));
+}
+
+/** 巢狀的enter_level只會提高遮罩範圍，離開時依序恢復 */
+static void test_level_nesting(void)
+{
+    hal_critical_level_t outer;
+    hal_critical_level_t wider;
+    hal_critical_level_t narrower;
+
+    critical_reset();
+    outer = hal_critical_enter_level(6);
+    TEST_ASSERT_EQ(masked_from(), 6);
+
+    // 較高優先權: 遮罩範圍擴大
+    wider = hal_critical_enter_level(3);
+    TEST_ASSERT_EQ(masked_from(), 3);
+
+    // 較低優先權: 不解除外層的遮罩
+    narrower = hal_critical_enter_level(10);
+    TEST_ASSERT_EQ(masked_from(), 3);
+
+    hal_critical_exit_level(narrower);
+    TEST_ASSERT_EQ(masked_from(), 3);
+    hal_critical_exit_level(wider);
+    TEST_ASSERT_EQ(masked_from(), 6);
+    hal_critical_exit_level(outer);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+}
+
+/** 兩種臨界區互相巢狀 */
+static void test_mixed_nesting(void)
+{
+    hal_critical_level_t level;
+    hal_critical_state_t state;
+
+    critical_reset();
+
+    level = hal_critical_enter_level(4);
+    state = hal_critical_enter();
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+    hal_critical_exit(state);
+    TEST_ASSERT_EQ(masked_from(), 4);
+    hal_critical_exit_level(level);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+
+    state = hal_critical_enter();
+    level = hal_critical_enter_level(8);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+    hal_critical_exit_level(level);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MIN);
+    hal_critical_exit(state);
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+}
+
+/** 隨機的巢狀序列與參考模型比對 (全域遮罩時全部遮罩，否則取最高的優先權遮罩) */
+static void test_random_nesting(void)
+{
+    struct {
+        bool global;
+        uint16_t prio;
+        hal_critical_state_t state;
+        hal_critical_level_t level;
+    } stack[NEST_DEPTH];
+    uint32_t depth = 0;
+    uint32_t seed = 0x13579BDU;
+    uint32_t i;
+
+    critical_reset();
+
+    for (i = 0; i < 20000U; i++) {
+        uint32_t r = test_random(&seed);
+        uint16_t expected = PRIO_MAX + 1U;
+        uint32_t j;
+
+        if (depth < NEST_DEPTH && (depth == 0U || (r & 1U) != 0U)) {
+            stack[depth].global = ((r >> 1) % 4U) == 0U;
+            if (stack[depth].global) {
+                stack[depth].state = hal_critical_enter();
+            } else {
+                stack[depth].prio = (uint16_t)(PRIO_MIN + ((r >> 8) % (PRIO_MAX - PRIO_MIN + 1U)));
+                stack[depth].level = hal_critical_enter_level(stack[depth].prio);
+            }
+            depth++;
+        } else {
+            depth--;
+            if (stack[depth].global) {
+                hal_critical_exit(stack[depth].state);
+            } else {
+                hal_critical_exit_level(stack[depth].level);
+            }
+        }
+
+        for (j = 0; j < depth; j++) {
+            if (stack[j].global) {
+                expected = PRIO_MIN;
+                break;
+            }
+            if (stack[j].prio < expected) {
+                expected = stack[j].prio;
+            }
+        }
+        TEST_ASSERT_EQ(masked_from(), expected);
+    }
+
+    while (depth > 0U) {
+        depth--;
+        if (stack[depth].global) {
+            hal_critical_exit(stack[depth].state);
+        } else {
+            hal_critical_exit_level(stack[depth].level);
+        }
+    }
+    TEST_ASSERT_EQ(masked_from(), PRIO_MAX + 1U);
+}
+
+/* ========================================================================== */
+/*                             平台暫存器                                      */
+/* ========================================================================== */
+
+#if defined(PLATFORM_TI_C2000)
+
+/** IER只清除含有prio及較低優先權的群組，離開時保留期間致能的DLOGINT/RTOSINT */
+static void test_platform_registers(void)
+{
+    uint16_t group_lowest[14] = { 0 };
+    hal_critical_level_t state;
+
+    critical_reset();
+    state = hal_critical_enter_level(4);
+    TEST_ASSERT_EQ(IER, 0x000FU);
+    TEST_ASSERT_EQ(c28x_host_intm, 0);
+
+    IER |= 0x4000U;
+    hal_critical_exit_level(state);
+    TEST_ASSERT_EQ(IER, 0x4000U | HAL_CRITICAL_IER_GROUPS);
+
+    // INT1有優先權1與9 → 以最低的9為準，INT2優先權0，INT3優先權3，其他群組未登記
+    group_lowest[0] = 10U;
+    group_lowest[1] = 1U;
+    group_lowest[2] = 4U;
+    hal_critical_update_ier_keep(group_lowest);
+    IER = HAL_CRITICAL_IER_GROUPS;
+
+    state = hal_critical_enter_level(5);
+    TEST_ASSERT_EQ(IER, 0x0006U);
+    TEST_ASSERT(hal_critical_is_masked(5));
+    TEST_ASSERT(hal_critical_is_masked(9));
+    TEST_ASSERT(!hal_critical_is_masked(3));
+    hal_critical_exit_level(state);
+
+    state = hal_critical_enter_level(10);
+    TEST_ASSERT_EQ(IER, 0x0007U);
+    hal_critical_exit_level(state);
+
+    // 沒有登記任何向量時，任何優先權都遮罩所有群組
+    group_lowest[0] = 0U;
+    group_lowest[1] = 0U;
+    group_lowest[2] = 0U;
+    hal_critical_update_ier_keep(group_lowest);
+    state = hal_critical_enter_level(HAL_IRQ_PRIORITY_LOWEST);
+    TEST_ASSERT_EQ(IER, 0x0000U);
+    hal_critical_exit_level(state);
+    TEST_ASSERT_EQ(IER, HAL_CRITICAL_IER_GROUPS);
+}
+
+#elif defined(PLATFORM_STM32)
+
+/** BASEPRI以高4位元存放優先權，優先權0改用PRIMASK，離開時兩者都恢復 */
+static void test_platform_registers(void)
+{
+    hal_critical_level_t outer;
+    hal_critical_level_t inner;
+
+    critical_reset();
+    outer = hal_critical_enter_level(5);
+    TEST_ASSERT_EQ(cortexm_host_basepri, 5U << 4);
+    TEST_ASSERT_EQ(cortexm_host_primask, 0);
+
+    inner = hal_critical_enter_level(0);
+    TEST_ASSERT_EQ(cortexm_host_primask, 1);
+    TEST_ASSERT(hal_critical_is_masked(0));
+
+    hal_critical_exit_level(inner);
+    TEST_ASSERT_EQ(cortexm_host_primask, 0);
+    TEST_ASSERT_EQ(cortexm_host_basepri, 5U << 4);
+    hal_critical_exit_level(outer);
+    TEST_ASSERT_EQ(cortexm_host_basepri, 0);
+
+    // 超出範圍的優先權以最低優先權寫入，不能截斷成BASEPRI = 0 (不遮罩)
+    outer = hal_critical_enter_level(HAL_IRQ_PRIORITY_LEVELS);
+    TEST_ASSERT_EQ(cortexm_host_basepri, HAL_IRQ_PRIORITY_LOWEST << 4);
+    hal_critical_exit_level(outer);
+    TEST_ASSERT_EQ(cortexm_host_basepri, 0);
+}
+
+#else
+
+/** 主機端模擬的狀態變數 */
+static void test_platform_registers(void)
+{
+    hal_critical_level_t state;
+
+    critical_reset();
+    state = hal_critical_enter_level(0);
+    TEST_ASSERT_EQ(hal_critical_host_level, 0);
+    TEST_ASSERT(hal_critical_is_masked(0));
+    hal_critical_exit_level(state);
+    TEST_ASSERT_EQ(hal_critical_host_level, HAL_CRITICAL_HOST_LEVEL_NONE);
+    TEST_ASSERT_EQ(hal_critical_host_primask, 0);
+}
+
+#endif
+
+int main(void)
+{
+    printf("平台: %s\n", PLATFORM_NAME);
+
+    TEST_RUN(test_enter_exit_nesting);
+    TEST_RUN(test_level_masks_lower_only);
+    TEST_RUN(test_level_nesting);
+    TEST_RUN(test_mixed_nesting);
+    TEST_RUN(test_random_nesting);
+    TEST_RUN(test_platform_registers);
+
+    return TEST_REPORT();
+}
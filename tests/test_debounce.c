@@ -0,0 +1,275 @@
+/**
+ * @file test_debounce.c
+ * @brief 位元平行消抖單元測試 (模擬彈跳波形，與逐腳位參考計數器比對)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_debounce.h"
+#include "hal_gpio.h"
+#include "test_common.h"
+
+/* ========================================================================== */
+/*                             GPIO替身                                        */
+/* ========================================================================== */
+
+#define HOST_PORT_COUNT         4U
+
+/** hal_gpio_read_port()返回的各埠輸入值 */
+static uint32_t host_ports[HOST_PORT_COUNT];
+
+uint32_t hal_gpio_read_port(uint16_t port)
+{
+    return (port < HOST_PORT_COUNT) ? host_ports[port] : 0UL;
+}
+
+/* ========================================================================== */
+/*                             逐腳位參考模型                                  */
+/* ========================================================================== */
+
+/**
+ * 每個輸入一個計數器: 原始值與狀態相同時重設為3，不同時遞減，
+ * 計數為0時再次不同 (連續第4次) 才翻轉
+ */
+typedef struct {
+    uint8_t state;
+    uint8_t count;
+} ref_pin_t;
+
+static bool ref_update(ref_pin_t* pin, uint8_t raw)
+{
+    if (raw == pin->state) {
+        pin->count = 3U;
+        return false;
+    }
+    if (pin->count > 0U) {
+        pin->count--;
+        return false;
+    }
+    pin->state = raw;
+    pin->count = 3U;
+    return true;
+}
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+#define WORDS                   4U
+
+/** 初始化時以埠讀值為初始狀態，不產生變化 */
+static void test_init_from_ports(void)
+{
+    HAL_DEBOUNCE_DEFINE(deb, 0, 2);
+
+    host_ports[0] = 0x12345678UL;
+    host_ports[2] = 0xA5A5A5A5UL;
+    TEST_ASSERT_EQ(hal_debounce_init(&deb), HAL_OK);
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 0), 0x12345678UL);
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 1), 0xA5A5A5A5UL);
+
+    TEST_ASSERT(!hal_debounce_sample(&deb));
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 0), 0);
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 1), 0);
+
+    // 無效索引與參數
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 2), 0);
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 2), 0);
+    TEST_ASSERT_EQ(hal_debounce_init(NULL), HAL_INVALID_PARAM);
+}
+
+/** 乾淨的邊沿在連續第4次取樣時翻轉，changed在讀取後清除 */
+static void test_clean_edge(void)
+{
+    HAL_DEBOUNCE_DEFINE(deb, 1);
+    uint32_t i;
+
+    host_ports[1] = 0;
+    (void)hal_debounce_init(&deb);
+
+    host_ports[1] = 0x80000001UL;
+    for (i = 0; i < 3U; i++) {
+        TEST_ASSERT(!hal_debounce_sample(&deb));
+        TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 0), 0);
+    }
+    TEST_ASSERT(hal_debounce_sample(&deb));
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 0), 0x80000001UL);
+
+    // 穩定後不再翻轉，changed累積到讀取為止
+    TEST_ASSERT(!hal_debounce_sample(&deb));
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 0), 0x80000001UL);
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 0), 0);
+
+    // 放開: 上升沿與下降沿分開判斷
+    host_ports[1] = 0x00000001UL;
+    for (i = 0; i < 4U; i++) {
+        (void)hal_debounce_sample(&deb);
+    }
+    i = hal_debounce_get_changed(&deb, 0);
+    TEST_ASSERT_EQ(i, 0x80000000UL);
+    TEST_ASSERT_EQ(i & ~hal_debounce_get_state(&deb, 0), 0x80000000UL);
+}
+
+/** 短於4次取樣的彈跳被濾除，彈跳結束後4次取樣翻轉 */
+static void test_bounce_filtered(void)
+{
+    // 1 = 接點閉合的原始讀值，每個位元一種波形
+    static const uint8_t waves[][16] = {
+        { 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1 },    // 彈跳後閉合
+        { 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },    // 3次雜訊
+        { 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0 },    // 週期雜訊
+        { 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },    // 剛好4次的脈衝
+    };
+    // 各波形翻轉的取樣索引 (-1表示不再翻轉)
+    static const int flip_at[][3] = { { 10, -1 }, { -1 }, { -1 }, { 3, 7, -1 } };
+    HAL_DEBOUNCE_DEFINE(deb, 3);
+    uint32_t changed_seen[4] = { 0 };
+    uint32_t t;
+    uint32_t b;
+
+    host_ports[3] = 0;
+    (void)hal_debounce_init(&deb);
+
+    for (t = 0; t < 16U; t++) {
+        uint32_t raw = 0;
+        uint32_t changed;
+
+        for (b = 0; b < 4U; b++) {
+            raw |= (uint32_t)waves[b][t] << (b * 8U);
+        }
+        host_ports[3] = raw;
+        (void)hal_debounce_sample(&deb);
+
+        changed = hal_debounce_get_changed(&deb, 0);
+        for (b = 0; b < 4U; b++) {
+            if ((changed & (1UL << (b * 8U))) != 0U) {
+                TEST_ASSERT_EQ(t, (uint32_t)flip_at[b][changed_seen[b]]);
+                changed_seen[b]++;
+            }
+        }
+    }
+
+    TEST_ASSERT_EQ(changed_seen[0], 1);
+    TEST_ASSERT_EQ(changed_seen[1], 0);
+    TEST_ASSERT_EQ(changed_seen[2], 0);
+    TEST_ASSERT_EQ(changed_seen[3], 2);
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 0), 0x00000001UL);
+}
+
+/**
+ * 隨機彈跳: 每個輸入隨機切換目標電位，切換後數次取樣內隨機彈跳，
+ * 每次取樣的state與changed都與逐腳位參考模型相同
+ */
+static void test_random_bounce_matches_reference(void)
+{
+    static ref_pin_t ref[WORDS * 32U];
+    static uint32_t level[WORDS];
+    static uint8_t bounce_left[WORDS * 32U];
+    hal_debounce_word_t words[WORDS];
+    hal_debounce_t deb = { words, NULL, WORDS };
+    uint32_t raw[WORDS] = { 0 };
+    uint32_t seed = 0x5EED1234UL;
+    uint32_t flips = 0;
+    uint32_t t;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(hal_debounce_init(&deb), HAL_OK);
+    for (i = 0; i < WORDS * 32U; i++) {
+        ref[i].state = 0;
+        ref[i].count = 3U;
+        bounce_left[i] = 0;
+    }
+    for (i = 0; i < WORDS; i++) {
+        level[i] = 0;
+    }
+
+    for (t = 0; t < 50000U; t++) {
+        uint32_t mismatches = 0;
+        bool any = false;
+        bool ref_any = false;
+
+        for (i = 0; i < WORDS * 32U; i++) {
+            uint32_t w = i / 32U;
+            uint32_t bit = 1UL << (i % 32U);
+            uint32_t r = test_random(&seed);
+
+            // 約1/200的機率切換目標電位並開始0-9次取樣的彈跳
+            if ((r % 200U) == 0U) {
+                level[w] ^= bit;
+                bounce_left[i] = (uint8_t)((r >> 8) % 10U);
+            }
+
+            if (bounce_left[i] > 0U) {
+                bounce_left[i]--;
+                raw[w] = ((r & 0x10000UL) != 0U) ? (raw[w] | bit) : (raw[w] & ~bit);
+            } else {
+                raw[w] = ((level[w] & bit) != 0U) ? (raw[w] | bit) : (raw[w] & ~bit);
+            }
+        }
+
+        any = hal_debounce_update(&deb, raw);
+
+        for (i = 0; i < WORDS * 32U; i++) {
+            uint32_t w = i / 32U;
+            uint32_t bit = 1UL << (i % 32U);
+            bool toggled = ref_update(&ref[i], ((raw[w] & bit) != 0U) ? 1U : 0U);
+            bool state = ((hal_debounce_get_state(&deb, (uint16_t)w) & bit) != 0U);
+            bool changed = ((words[w].changed & bit) != 0U);
+
+            ref_any = ref_any || toggled;
+            if (state != (ref[i].state != 0U) || changed != toggled) {
+                mismatches++;
+            }
+            if (toggled) {
+                flips++;
+            }
+        }
+        for (i = 0; i < WORDS; i++) {
+            (void)hal_debounce_get_changed(&deb, (uint16_t)i);
+        }
+
+        TEST_ASSERT_EQ(mismatches, 0);
+        TEST_ASSERT_EQ(any, ref_any);
+    }
+
+    // 確認波形確實產生足夠多的翻轉
+    TEST_ASSERT(flips > 10000U);
+}
+
+/** 未讀取期間的多次翻轉累積在changed中 */
+static void test_changed_accumulates(void)
+{
+    HAL_DEBOUNCE_DEFINE(deb, 0);
+    uint32_t i;
+
+    host_ports[0] = 0;
+    (void)hal_debounce_init(&deb);
+
+    host_ports[0] = 0x1UL;
+    for (i = 0; i < 4U; i++) {
+        (void)hal_debounce_sample(&deb);
+    }
+    host_ports[0] = 0x3UL;
+    for (i = 0; i < 4U; i++) {
+        (void)hal_debounce_sample(&deb);
+    }
+    // bit0按下後放開: 翻轉兩次，changed仍為1，狀態回到0
+    host_ports[0] = 0x2UL;
+    for (i = 0; i < 4U; i++) {
+        (void)hal_debounce_sample(&deb);
+    }
+
+    TEST_ASSERT_EQ(hal_debounce_get_changed(&deb, 0), 0x3UL);
+    TEST_ASSERT_EQ(hal_debounce_get_state(&deb, 0), 0x2UL);
+}
+
+int main(void)
+{
+    TEST_RUN(test_init_from_ports);
+    TEST_RUN(test_clean_edge);
+    TEST_RUN(test_bounce_filtered);
+    TEST_RUN(test_random_bounce_matches_reference);
+    TEST_RUN(test_changed_accumulates);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,500 @@
+/**
+ * @file test_frame.c
+ * @brief 封包訊框層單元測試 (COBS/SLIP往返隨機測試、空訊框、串流分段、錯誤偵測)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_frame.h"
+#include "test_common.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                             UART替身                                        */
+/* ========================================================================== */
+
+#define TEST_UART               ((hal_uart_id_t)0)
+#define WIRE_SIZE               4096U
+
+static uint8_t wire[WIRE_SIZE];
+static uint16_t wire_len;
+static uint16_t wire_pos;
+
+hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data,
+                               uint16_t size, uint32_t timeout)
+{
+    (void)uart_id;
+    (void)timeout;
+
+    if (size > (uint16_t)(WIRE_SIZE - wire_len)) {
+        return HAL_ERROR;
+    }
+    memcpy(&wire[wire_len], data, size);
+    wire_len += size;
+
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeout)
+{
+    (void)uart_id;
+    (void)timeout;
+
+    if (wire_pos >= wire_len) {
+        return HAL_TIMEOUT;
+    }
+    *ch = wire[wire_pos++];
+
+    return HAL_OK;
+}
+
+/* ========================================================================== */
+/*                             測試輔助                                        */
+/* ========================================================================== */
+
+#define MAX_PAYLOAD             700U
+#define FUZZ_ROUNDS             3000U
+#define STREAM_FRAMES           64U
+
+static const hal_frame_encoding_t encodings[] = { HAL_FRAME_COBS, HAL_FRAME_SLIP };
+static const hal_frame_crc_t crcs[] = { HAL_FRAME_CRC_NONE, HAL_FRAME_CRC16, HAL_FRAME_CRC32 };
+
+static uint8_t payload[MAX_PAYLOAD];
+static uint8_t encoded[HAL_FRAME_SLIP_MAX_SIZE(MAX_PAYLOAD)];
+static uint8_t decode_buf[MAX_PAYLOAD + HAL_FRAME_CRC_MAX_SIZE];
+static hal_crc_table_t crc32_table;
+
+/** 偏向特殊字元的隨機資料 (分隔、跳脫字元與長的非零片段) */
+static void random_payload(uint32_t* seed, uint8_t* p, uint16_t len)
+{
+    static const uint8_t special[] = {
+        0x00U, HAL_FRAME_SLIP_END, HAL_FRAME_SLIP_ESC, HAL_FRAME_SLIP_ESC_END, HAL_FRAME_SLIP_ESC_ESC
+    };
+    uint32_t mode = test_random(seed) % 4U;
+    uint16_t i;
+
+    for (i = 0; i < len; i++) {
+        uint32_t r = test_random(seed);
+
+        if (mode == 0U) {
+            p[i] = (uint8_t)(r | 1U);                           // 無零位元組，測試254位元組區塊
+        } else if (mode == 1U) {
+            p[i] = special[r % sizeof(special)];
+        } else {
+            p[i] = ((r & 0x300U) == 0U) ? special[(r >> 12) % sizeof(special)] : (uint8_t)r;
+        }
+    }
+}
+
+static uint16_t max_encoded_size(hal_frame_encoding_t encoding, uint16_t len)
+{
+    return (encoding == HAL_FRAME_COBS) ? (uint16_t)HAL_FRAME_COBS_MAX_SIZE(len)
+                                        : (uint16_t)HAL_FRAME_SLIP_MAX_SIZE(len);
+}
+
+/** 分隔字元只出現在訊框尾端 (SLIP另有前置END) */
+static bool delimiters_only_at_ends(hal_frame_encoding_t encoding, const uint8_t* p, uint16_t len)
+{
+    uint8_t delimiter = (encoding == HAL_FRAME_COBS) ? 0x00U : HAL_FRAME_SLIP_END;
+    uint16_t first = (encoding == HAL_FRAME_COBS) ? 0U : 1U;
+    uint16_t i;
+
+    if (len < 2U || p[len - 1U] != delimiter || (first == 1U && p[0] != delimiter)) {
+        return false;
+    }
+    for (i = first; i < (uint16_t)(len - 1U); i++) {
+        if (p[i] == delimiter) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief 以隨機長度分段輸入解碼器
+ * @param frames 完整訊框數
+ * @param errors 訊框錯誤數
+ * @param check 每個完整訊框的檢查函式，可為NULL
+ */
+static void decode_chunked(hal_frame_decoder_t* decoder, const uint8_t* data, uint16_t len,
+                           uint32_t* seed, uint32_t* frames, uint32_t* errors,
+                           void (*check)(const hal_frame_decoder_t*, uint16_t, uint32_t))
+{
+    uint16_t pos = 0;
+
+    while (pos < len) {
+        uint16_t chunk = (uint16_t)(1U + test_random(seed) % 64U);
+        uint16_t consumed;
+        uint16_t frame_len;
+        hal_status_t status;
+
+        if (chunk > (uint16_t)(len - pos)) {
+            chunk = len - pos;
+        }
+
+        status = hal_frame_decode(decoder, &data[pos], chunk, &consumed, &frame_len);
+        TEST_ASSERT(consumed <= chunk);
+        pos += consumed;
+
+        if (status == HAL_OK) {
+            if (check != NULL) {
+                check(decoder, frame_len, *frames);
+            }
+            (*frames)++;
+        } else if (status == HAL_ERROR) {
+            (*errors)++;
+        } else {
+            TEST_ASSERT_EQ(status, HAL_BUSY);
+            TEST_ASSERT_EQ(consumed, chunk);
+        }
+    }
+}
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+static uint16_t expect_len;
+
+static void check_payload(const hal_frame_decoder_t* decoder, uint16_t frame_len, uint32_t index)
+{
+    (void)index;
+
+    TEST_ASSERT_EQ(frame_len, expect_len);
+    TEST_ASSERT(memcmp(decoder->buffer, payload, frame_len) == 0);
+}
+
+/** 各種編碼與CRC組合的隨機payload往返 (含0、1、253~255、508等邊界長度) */
+static void test_fuzz_round_trip(void)
+{
+    static const uint16_t edge_lengths[] = { 0, 1, 2, 253, 254, 255, 256, 507, 508, 509, MAX_PAYLOAD };
+    uint32_t seed = 0xC0B5511DUL;
+    uint32_t round;
+
+    for (round = 0; round < FUZZ_ROUNDS; round++) {
+        hal_frame_config_t config;
+        hal_frame_decoder_t decoder;
+        uint16_t out_len;
+        uint32_t frames = 0;
+        uint32_t errors = 0;
+        uint16_t len;
+
+        config.encoding = encodings[round % 2U];
+        config.crc = crcs[(round / 2U) % 3U];
+        config.crc_table = (config.crc == HAL_FRAME_CRC32 && (round & 8U) != 0U) ? &crc32_table : NULL;
+
+        if (round < 6U * (sizeof(edge_lengths) / sizeof(edge_lengths[0]))) {
+            len = edge_lengths[round / 6U];
+        } else {
+            len = (uint16_t)(test_random(&seed) % (MAX_PAYLOAD + 1U));
+        }
+        if (config.encoding == HAL_FRAME_SLIP && config.crc == HAL_FRAME_CRC_NONE && len == 0U) {
+            len = 1;
+        }
+        random_payload(&seed, payload, len);
+
+        TEST_ASSERT_EQ(hal_frame_encode_buf(&config, payload, len, encoded, sizeof(encoded),
+                                            &out_len), HAL_OK);
+        TEST_ASSERT(out_len <= max_encoded_size(config.encoding, len));
+        TEST_ASSERT(delimiters_only_at_ends(config.encoding, encoded, out_len));
+
+        TEST_ASSERT_EQ(hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf)),
+                       HAL_OK);
+        expect_len = len;
+        decode_chunked(&decoder, encoded, out_len, &seed, &frames, &errors, check_payload);
+        TEST_ASSERT_EQ(frames, 1);
+        TEST_ASSERT_EQ(errors, 0);
+    }
+}
+
+/** 空payload: COBS與有CRC的SLIP可往返，無CRC的SLIP被拒絕 */
+static void test_empty_frames(void)
+{
+    uint32_t seed = 1;
+    uint16_t e;
+    uint16_t c;
+
+    for (e = 0; e < 2U; e++) {
+        for (c = 0; c < 3U; c++) {
+            hal_frame_config_t config = { encodings[e], crcs[c], NULL };
+            hal_frame_decoder_t decoder;
+            uint16_t out_len = 0xFFFFU;
+            uint32_t frames = 0;
+            uint32_t errors = 0;
+            hal_status_t status;
+
+            status = hal_frame_encode_buf(&config, NULL, 0, encoded, sizeof(encoded), &out_len);
+            if (encodings[e] == HAL_FRAME_SLIP && crcs[c] == HAL_FRAME_CRC_NONE) {
+                TEST_ASSERT_EQ(status, HAL_INVALID_PARAM);
+                TEST_ASSERT_EQ(out_len, 0);
+                continue;
+            }
+
+            TEST_ASSERT_EQ(status, HAL_OK);
+            (void)hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf));
+            expect_len = 0;
+            decode_chunked(&decoder, encoded, out_len, &seed, &frames, &errors, check_payload);
+            TEST_ASSERT_EQ(frames, 1);
+            TEST_ASSERT_EQ(errors, 0);
+        }
+    }
+
+    // 連續的分隔字元不產生訊框
+    {
+        static const uint8_t ends[] = { 0xC0, 0xC0, 0xC0, 0xC0 };
+        hal_frame_config_t config = { HAL_FRAME_SLIP, HAL_FRAME_CRC_NONE, NULL };
+        hal_frame_decoder_t decoder;
+        uint16_t consumed;
+        uint16_t frame_len;
+
+        (void)hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf));
+        TEST_ASSERT_EQ(hal_frame_decode(&decoder, ends, sizeof(ends), &consumed, &frame_len),
+                       HAL_BUSY);
+        TEST_ASSERT_EQ(consumed, sizeof(ends));
+    }
+}
+
+// 串流測試: 每個訊框的payload長度與內容由索引決定
+static uint8_t stream[STREAM_FRAMES * HAL_FRAME_SLIP_MAX_SIZE(64U)];
+static uint16_t stream_lens[STREAM_FRAMES];
+static uint8_t stream_payloads[STREAM_FRAMES][64];
+
+static void check_stream(const hal_frame_decoder_t* decoder, uint16_t frame_len, uint32_t index)
+{
+    TEST_ASSERT(index < STREAM_FRAMES);
+    if (index >= STREAM_FRAMES) {
+        return;
+    }
+    TEST_ASSERT_EQ(frame_len, stream_lens[index]);
+    TEST_ASSERT(memcmp(decoder->buffer, stream_payloads[index], frame_len) == 0);
+}
+
+/** 連續訊框以任意分段輸入，依序解出 */
+static void test_back_to_back_stream(void)
+{
+    uint32_t seed = 0x5EED0001UL;
+    uint16_t e;
+    uint16_t c;
+
+    for (e = 0; e < 2U; e++) {
+        for (c = 0; c < 3U; c++) {
+            hal_frame_config_t config = { encodings[e], crcs[c], NULL };
+            hal_frame_decoder_t decoder;
+            uint16_t total = 0;
+            uint32_t frames = 0;
+            uint32_t errors = 0;
+            uint16_t i;
+
+            for (i = 0; i < STREAM_FRAMES; i++) {
+                uint16_t out_len;
+
+                stream_lens[i] = (uint16_t)(test_random(&seed) % 65U);
+                if (encodings[e] == HAL_FRAME_SLIP && crcs[c] == HAL_FRAME_CRC_NONE &&
+                    stream_lens[i] == 0U) {
+                    stream_lens[i] = 1;
+                }
+                random_payload(&seed, stream_payloads[i], stream_lens[i]);
+                TEST_ASSERT_EQ(hal_frame_encode_buf(&config, stream_payloads[i], stream_lens[i],
+                                                    &stream[total], (uint16_t)(sizeof(stream) - total),
+                                                    &out_len), HAL_OK);
+                total += out_len;
+            }
+
+            (void)hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf));
+            decode_chunked(&decoder, stream, total, &seed, &frames, &errors, check_stream);
+            TEST_ASSERT_EQ(frames, STREAM_FRAMES);
+            TEST_ASSERT_EQ(errors, 0);
+        }
+    }
+}
+
+/** 有CRC-32時任一位元錯誤都不會產生錯誤的訊框 */
+static void test_corruption_detected(void)
+{
+    uint32_t seed = 0xBADC0DE5UL;
+    uint32_t round;
+    uint32_t detected = 0;
+
+    for (round = 0; round < 2000U; round++) {
+        hal_frame_config_t config = { encodings[round % 2U], HAL_FRAME_CRC32, NULL };
+        hal_frame_decoder_t decoder;
+        uint16_t len = (uint16_t)(1U + test_random(&seed) % 200U);
+        uint16_t out_len;
+        uint16_t pos = 0;
+        uint16_t bit;
+
+        random_payload(&seed, payload, len);
+        (void)hal_frame_encode_buf(&config, payload, len, encoded, sizeof(encoded), &out_len);
+
+        // 翻轉分隔字元以外的一個位元
+        bit = (uint16_t)(test_random(&seed) % ((uint32_t)(out_len - 2U) * 8U));
+        encoded[1U + bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+
+        (void)hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf));
+        while (pos < out_len) {
+            uint16_t consumed;
+            uint16_t frame_len;
+            hal_status_t status = hal_frame_decode(&decoder, &encoded[pos], out_len - pos,
+                                                   &consumed, &frame_len);
+
+            pos += consumed;
+            TEST_ASSERT(status != HAL_OK);
+            if (status == HAL_ERROR) {
+                detected++;
+            }
+        }
+    }
+
+    TEST_ASSERT(detected >= 2000U);
+}
+
+/** 超過緩衝區的訊框被捨棄，之後的訊框正常解出 */
+static void test_decoder_overflow(void)
+{
+    hal_frame_config_t config = { HAL_FRAME_COBS, HAL_FRAME_CRC16, NULL };
+    hal_frame_decoder_t decoder;
+    uint8_t small[16];
+    uint16_t first_len;
+    uint16_t second_len;
+    uint16_t consumed;
+    uint16_t frame_len;
+    uint16_t i;
+
+    for (i = 0; i < 100U; i++) {
+        payload[i] = (uint8_t)i;
+    }
+    (void)hal_frame_encode_buf(&config, payload, 100, encoded, sizeof(encoded), &first_len);
+    (void)hal_frame_encode_buf(&config, payload, 10, &encoded[first_len],
+                               (uint16_t)(sizeof(encoded) - first_len), &second_len);
+
+    (void)hal_frame_decoder_init(&decoder, &config, small, sizeof(small));
+    TEST_ASSERT_EQ(hal_frame_decode(&decoder, encoded, first_len + second_len, &consumed, &frame_len),
+                   HAL_ERROR);
+    TEST_ASSERT_EQ(consumed, first_len);
+    TEST_ASSERT_EQ(hal_frame_decode(&decoder, &encoded[consumed], second_len, &consumed, &frame_len),
+                   HAL_OK);
+    TEST_ASSERT_EQ(frame_len, 10);
+    TEST_ASSERT(memcmp(small, payload, 10) == 0);
+}
+
+#define LONG_PAYLOAD            65535U
+
+static uint8_t long_payload[LONG_PAYLOAD];
+static uint8_t long_wire[HAL_FRAME_SLIP_MAX_SIZE(LONG_PAYLOAD)];
+static uint8_t long_decode[LONG_PAYLOAD];
+static uint32_t long_wire_len;
+
+static hal_status_t long_wire_write(void* context, const uint8_t* data, uint16_t len)
+{
+    (void)context;
+
+    if (len > sizeof(long_wire) - long_wire_len) {
+        return HAL_ERROR;
+    }
+    memcpy(&long_wire[long_wire_len], data, len);
+    long_wire_len += len;
+
+    return HAL_OK;
+}
+
+/**
+ * 接近uint16_t上限的SLIP訊框: 字組掃描到緩衝區尾端時索引不可溢位
+ * (沒有特殊字元的65535位元組片段在編碼與解碼中都會被整段掃描)
+ */
+static void test_slip_near_max_length(void)
+{
+    static const struct {
+        hal_frame_crc_t crc;
+        uint16_t len;
+    } cases[] = {
+        { HAL_FRAME_CRC_NONE, LONG_PAYLOAD },
+        { HAL_FRAME_CRC_NONE, LONG_PAYLOAD - 1U },
+        { HAL_FRAME_CRC16, LONG_PAYLOAD - 2U },
+        { HAL_FRAME_CRC32, LONG_PAYLOAD - 4U },
+    };
+    hal_frame_decoder_t decoder;
+    uint32_t pos;
+    uint16_t consumed;
+    uint16_t frame_len;
+    hal_status_t status = HAL_BUSY;
+    uint32_t c;
+
+    memset(long_payload, 0x41, sizeof(long_payload));
+
+    for (c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        hal_frame_config_t config = { HAL_FRAME_SLIP, cases[c].crc, &crc32_table };
+        uint16_t len = cases[c].len;
+
+        long_wire_len = 0;
+        TEST_ASSERT_EQ(hal_frame_encode(&config, long_payload, len, long_wire_write, NULL), HAL_OK);
+        TEST_ASSERT(long_wire_len >= (uint32_t)len + 2U);
+        TEST_ASSERT(long_wire_len <= HAL_FRAME_SLIP_MAX_SIZE((uint32_t)len));
+        TEST_ASSERT_EQ(long_wire[0], HAL_FRAME_SLIP_END);
+        TEST_ASSERT(memcmp(&long_wire[1], long_payload, len) == 0);
+
+        // 前置END單獨輸入，之後以最大長度分段，第一段是完整的65535位元組資料
+        (void)hal_frame_decoder_init(&decoder, &config, long_decode, sizeof(long_decode));
+        TEST_ASSERT_EQ(hal_frame_decode(&decoder, long_wire, 1, &consumed, &frame_len), HAL_BUSY);
+        pos = 1;
+        while (pos < long_wire_len) {
+            uint32_t chunk = long_wire_len - pos;
+
+            if (chunk > 0xFFFFUL) {
+                chunk = 0xFFFFUL;
+            }
+            status = hal_frame_decode(&decoder, &long_wire[pos], (uint16_t)chunk,
+                                      &consumed, &frame_len);
+            TEST_ASSERT(consumed > 0U);
+            pos += consumed;
+            if (status != HAL_BUSY) {
+                break;
+            }
+        }
+        TEST_ASSERT_EQ(status, HAL_OK);
+        TEST_ASSERT_EQ(pos, long_wire_len);
+        TEST_ASSERT_EQ(frame_len, len);
+        TEST_ASSERT(memcmp(long_decode, long_payload, len) == 0);
+    }
+}
+
+/** hal_frame_send()與hal_frame_receive()經由UART往返 */
+static void test_uart_send_receive(void)
+{
+    hal_frame_config_t config = { HAL_FRAME_SLIP, HAL_FRAME_CRC16, NULL };
+    hal_frame_decoder_t decoder;
+    uint32_t seed = 77;
+    uint16_t frame_len;
+
+    wire_len = 0;
+    wire_pos = 0;
+    random_payload(&seed, payload, 300);
+    TEST_ASSERT_EQ(hal_frame_send(TEST_UART, &config, payload, 300, 10), HAL_OK);
+    TEST_ASSERT(wire_len <= HAL_FRAME_SLIP_MAX_SIZE(300U));
+
+    (void)hal_frame_decoder_init(&decoder, &config, decode_buf, sizeof(decode_buf));
+    TEST_ASSERT_EQ(hal_frame_receive(TEST_UART, &decoder, &frame_len, 10), HAL_OK);
+    TEST_ASSERT_EQ(frame_len, 300);
+    TEST_ASSERT(memcmp(decode_buf, payload, 300) == 0);
+    TEST_ASSERT_EQ(wire_pos, wire_len);
+
+    // 沒有更多資料: UART超時
+    TEST_ASSERT_EQ(hal_frame_receive(TEST_UART, &decoder, &frame_len, 10), HAL_TIMEOUT);
+}
+
+int main(void)
+{
+    static const hal_crc_config_t crc32_config = HAL_CRC_CONFIG_CRC32;
+
+    (void)hal_crc_table_build(&crc32_table, &crc32_config);
+
+    TEST_RUN(test_fuzz_round_trip);
+    TEST_RUN(test_empty_frames);
+    TEST_RUN(test_back_to_back_stream);
+    TEST_RUN(test_corruption_detected);
+    TEST_RUN(test_decoder_overflow);
+    TEST_RUN(test_slip_near_max_length);
+    TEST_RUN(test_uart_send_receive);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,247 @@
+/**
+ * @file test_gpio_irq.c
+ * @brief GPIO邊沿中斷分派單元測試 (回呼、事件佇列、溢位計數、取消註冊、邊沿過濾)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 主機端使用hal_gpio_irq.c的模擬移植 (任何引腳皆可使用全部中斷線)，
+ * 邊沿由hal_gpio_irq_inject()注入，雙沿線路由hal_gpio_irq_dispatch()觸發。
+ */
+
+#include "hal_gpio.h"
+#include "host_platform.h"
+#include "test_common.h"
+
+/* ========================================================================== */
+/*                             回呼記錄                                        */
+/* ========================================================================== */
+
+#define LOG_SIZE                8U
+
+typedef struct {
+    hal_gpio_pin_t pin;
+    hal_gpio_edge_t edge;
+    void* context;
+} callback_record_t;
+
+static callback_record_t callback_log[LOG_SIZE];
+static uint32_t callback_count;
+
+static void record_callback(hal_gpio_pin_t pin, hal_gpio_edge_t edge, void* context)
+{
+    if (callback_count < LOG_SIZE) {
+        callback_log[callback_count].pin = pin;
+        callback_log[callback_count].edge = edge;
+        callback_log[callback_count].context = context;
+    }
+    callback_count++;
+}
+
+static void drain_events(void)
+{
+    hal_gpio_event_t event;
+
+    while (hal_gpio_event_read(&event)) {
+    }
+}
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+/** 回呼模式: 注入的邊沿帶著引腳、邊沿與註冊時的使用者資料立即呼叫回呼 */
+static void test_callback_mode(void)
+{
+    static int context_a;
+    static int context_b;
+
+    callback_count = 0;
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(5, HAL_GPIO_EDGE_BOTH, record_callback, &context_a), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(9, HAL_GPIO_EDGE_RISING, record_callback, &context_b), HAL_OK);
+
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(5, HAL_GPIO_EDGE_FALLING, 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(9, HAL_GPIO_EDGE_RISING, 200), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(5, HAL_GPIO_EDGE_RISING, 300), HAL_OK);
+
+    TEST_ASSERT_EQ(callback_count, 3U);
+    TEST_ASSERT_EQ(callback_log[0].pin, 5U);
+    TEST_ASSERT_EQ(callback_log[0].edge, HAL_GPIO_EDGE_FALLING);
+    TEST_ASSERT(callback_log[0].context == &context_a);
+    TEST_ASSERT_EQ(callback_log[1].pin, 9U);
+    TEST_ASSERT_EQ(callback_log[1].edge, HAL_GPIO_EDGE_RISING);
+    TEST_ASSERT(callback_log[1].context == &context_b);
+    TEST_ASSERT_EQ(callback_log[2].edge, HAL_GPIO_EDGE_RISING);
+
+    // 回呼模式不寫入事件佇列
+    {
+        hal_gpio_event_t event;
+        TEST_ASSERT(!hal_gpio_event_read(&event));
+    }
+
+    // 同一引腳不可重複註冊，NULL回呼無效
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(5, HAL_GPIO_EDGE_RISING, record_callback, NULL), HAL_BUSY);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(6, HAL_GPIO_EDGE_RISING, NULL, NULL), HAL_INVALID_PARAM);
+
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(5), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(9), HAL_OK);
+}
+
+/** 事件模式: 邊沿依序進入佇列，保留時間戳，讀完後佇列為空 */
+static void test_event_mode(void)
+{
+    hal_gpio_event_t event;
+    uint32_t dropped = hal_gpio_event_get_dropped();
+
+    TEST_ASSERT_EQ(hal_gpio_attach_irq_event(3, HAL_GPIO_EDGE_BOTH), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq_event(4, HAL_GPIO_EDGE_FALLING), HAL_OK);
+
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(3, HAL_GPIO_EDGE_RISING, 10), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(4, HAL_GPIO_EDGE_FALLING, 20), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(3, HAL_GPIO_EDGE_FALLING, 30), HAL_OK);
+
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.pin, 3U);
+    TEST_ASSERT_EQ(event.edge, HAL_GPIO_EDGE_RISING);
+    TEST_ASSERT_EQ(event.timestamp, 10U);
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.pin, 4U);
+    TEST_ASSERT_EQ(event.edge, HAL_GPIO_EDGE_FALLING);
+    TEST_ASSERT_EQ(event.timestamp, 20U);
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.pin, 3U);
+    TEST_ASSERT_EQ(event.edge, HAL_GPIO_EDGE_FALLING);
+    TEST_ASSERT_EQ(event.timestamp, 30U);
+    TEST_ASSERT(!hal_gpio_event_read(&event));
+    TEST_ASSERT(!hal_gpio_event_read(NULL));
+
+    // 雙沿線路由中斷分派時以電位判斷邊沿，時間戳取自hal_get_cycle_count()
+    host_cycles = 12345;
+    hal_gpio_irq_dispatch(0, HAL_GPIO_HIGH);
+    hal_gpio_irq_dispatch(0, HAL_GPIO_LOW);
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.pin, 3U);
+    TEST_ASSERT_EQ(event.edge, HAL_GPIO_EDGE_RISING);
+    TEST_ASSERT_EQ(event.timestamp, 12345U);
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.edge, HAL_GPIO_EDGE_FALLING);
+    TEST_ASSERT(!hal_gpio_event_read(&event));
+
+    TEST_ASSERT_EQ(hal_gpio_event_get_dropped(), dropped);
+
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(3), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(4), HAL_OK);
+}
+
+/** 佇列已滿時新事件被丟棄並計數，讀出後可再寫入，順序不變 */
+static void test_queue_overflow(void)
+{
+    hal_gpio_event_t event;
+    uint32_t dropped;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(hal_gpio_attach_irq_event(7, HAL_GPIO_EDGE_RISING), HAL_OK);
+    drain_events();
+    dropped = hal_gpio_event_get_dropped();
+
+    for (i = 0; i < HAL_GPIO_EVENT_QUEUE_SIZE + 5U; i++) {
+        TEST_ASSERT_EQ(hal_gpio_irq_inject(7, HAL_GPIO_EDGE_RISING, i), HAL_OK);
+    }
+    TEST_ASSERT_EQ(hal_gpio_event_get_dropped() - dropped, 5U);
+
+    // 保留的是最早的事件
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.timestamp, 0U);
+
+    // 空出一格後可再寫入，位於佇列尾端
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(7, HAL_GPIO_EDGE_RISING, 1000), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_event_get_dropped() - dropped, 5U);
+
+    for (i = 1; i < HAL_GPIO_EVENT_QUEUE_SIZE; i++) {
+        TEST_ASSERT(hal_gpio_event_read(&event));
+        TEST_ASSERT_EQ(event.timestamp, i);
+    }
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.timestamp, 1000U);
+    TEST_ASSERT(!hal_gpio_event_read(&event));
+
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(7), HAL_OK);
+}
+
+/** 取消註冊後不再觸發，中斷線可重新使用；全部中斷線用完時返回HAL_BUSY */
+static void test_detach(void)
+{
+    hal_gpio_pin_t pin;
+
+    callback_count = 0;
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(12, HAL_GPIO_EDGE_RISING, record_callback, NULL), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(12), HAL_OK);
+
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(12, HAL_GPIO_EDGE_RISING, 1), HAL_INVALID_PARAM);
+    hal_gpio_irq_dispatch(0, HAL_GPIO_HIGH);
+    TEST_ASSERT_EQ(callback_count, 0U);
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(12), HAL_INVALID_PARAM);
+
+    for (pin = 0; pin < HAL_GPIO_IRQ_MAX_LINES; pin++) {
+        TEST_ASSERT_EQ(hal_gpio_attach_irq(100U + pin, HAL_GPIO_EDGE_RISING, record_callback, NULL),
+                       HAL_OK);
+    }
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(200, HAL_GPIO_EDGE_RISING, record_callback, NULL), HAL_BUSY);
+
+    // 釋放一條線後新的引腳取得該線
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(105), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(200, HAL_GPIO_EDGE_RISING, record_callback, NULL), HAL_OK);
+    hal_gpio_irq_dispatch(5, HAL_GPIO_HIGH);
+    TEST_ASSERT_EQ(callback_count, 1U);
+    TEST_ASSERT_EQ(callback_log[0].pin, 200U);
+
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(200), HAL_OK);
+    for (pin = 0; pin < HAL_GPIO_IRQ_MAX_LINES; pin++) {
+        if (pin != 5U) {
+            TEST_ASSERT_EQ(hal_gpio_detach_irq(100U + pin), HAL_OK);
+        }
+    }
+}
+
+/** 未選擇的邊沿與無效邊沿不觸發 */
+static void test_edge_filtering(void)
+{
+    hal_gpio_event_t event;
+
+    callback_count = 0;
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(20, HAL_GPIO_EDGE_RISING, record_callback, NULL), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq_event(21, HAL_GPIO_EDGE_FALLING), HAL_OK);
+    drain_events();
+
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(20, HAL_GPIO_EDGE_FALLING, 1), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(21, HAL_GPIO_EDGE_RISING, 2), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(20, HAL_GPIO_EDGE_BOTH, 3), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(20, (hal_gpio_edge_t)0, 4), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(callback_count, 0U);
+    TEST_ASSERT(!hal_gpio_event_read(&event));
+
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(20, HAL_GPIO_EDGE_RISING, 5), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_irq_inject(21, HAL_GPIO_EDGE_FALLING, 6), HAL_OK);
+    TEST_ASSERT_EQ(callback_count, 1U);
+    TEST_ASSERT(hal_gpio_event_read(&event));
+    TEST_ASSERT_EQ(event.pin, 21U);
+    TEST_ASSERT(!hal_gpio_event_read(&event));
+
+    // 註冊時的邊沿必須為RISING、FALLING或BOTH
+    TEST_ASSERT_EQ(hal_gpio_attach_irq(22, (hal_gpio_edge_t)0, record_callback, NULL),
+                   HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_attach_irq_event(22, (hal_gpio_edge_t)4), HAL_INVALID_PARAM);
+
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(20), HAL_OK);
+    TEST_ASSERT_EQ(hal_gpio_detach_irq(21), HAL_OK);
+}
+
+int main(void)
+{
+    TEST_RUN(test_callback_mode);
+    TEST_RUN(test_event_mode);
+    TEST_RUN(test_queue_overflow);
+    TEST_RUN(test_detach);
+    TEST_RUN(test_edge_filtering);
+
+    return TEST_REPORT();
+}
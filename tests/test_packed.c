@@ -0,0 +1,272 @@
+/**
+ * @file test_packed.c
+ * @brief 緊縮位元組緩衝區單元測試 (緊縮/展開往返、奇數長度、位元組順序、UART分段與超時)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_packed.h"
+#include "hal_uart.h"
+#include "host_platform.h"
+#include "test_common.h"
+#include <string.h>
+
+/* ========================================================================== */
+/*                             UART替身                                        */
+/* ========================================================================== */
+
+#define WIRE_SIZE               256U
+#define TEST_UART               ((hal_uart_id_t)0)
+
+static uint8_t wire[WIRE_SIZE];             // 發送/接收的線上位元組
+static uint16_t wire_pos;
+static uint16_t wire_calls;
+static uint16_t wire_max_chunk;
+static uint16_t wire_avail = WIRE_SIZE;     // 可接收的位元組數，之後的讀取超時
+static uint32_t wire_char_ms;               // 每個字元經過的時間
+
+hal_status_t hal_uart_transmit(hal_uart_id_t uart_id, const uint8_t* data,
+                               uint16_t size, uint32_t timeout)
+{
+    (void)uart_id;
+    (void)timeout;
+
+    memcpy(&wire[wire_pos], data, size);
+    wire_pos += size;
+    wire_calls++;
+    if (size > wire_max_chunk) {
+        wire_max_chunk = size;
+    }
+    return HAL_OK;
+}
+
+hal_status_t hal_uart_getchar(hal_uart_id_t uart_id, uint8_t* ch, uint32_t timeout)
+{
+    (void)uart_id;
+
+    wire_calls++;
+    if (wire_pos >= wire_avail || (timeout != 0U && wire_char_ms > timeout)) {
+        host_tick += timeout;
+        return HAL_TIMEOUT;
+    }
+
+    host_tick += wire_char_ms;
+    *ch = wire[wire_pos++];
+    return HAL_OK;
+}
+
+static void wire_reset(void)
+{
+    wire_pos = 0;
+    wire_calls = 0;
+    wire_max_chunk = 0;
+    wire_avail = WIRE_SIZE;
+    wire_char_ms = 0;
+}
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+#define MAX_LEN                 67U
+#define GUARD                   0xDEADU
+
+/** 0到67位元組的往返結果與原資料相同，不寫出界 */
+static void test_round_trip_lengths(void)
+{
+    uint8_t src[MAX_LEN];
+    uint8_t out[MAX_LEN + 1U];
+    hal_packed_t packed[HAL_PACKED_WORDS(MAX_LEN) + 1U];
+    uint32_t seed = 0xC0FFEEUL;
+    uint16_t len;
+    uint16_t i;
+
+    for (len = 0; len <= MAX_LEN; len++) {
+        for (i = 0; i < len; i++) {
+            src[i] = (uint8_t)test_random(&seed);
+        }
+        for (i = 0; i < sizeof(packed) / sizeof(packed[0]); i++) {
+            packed[i] = GUARD;
+        }
+        memset(out, 0x5A, sizeof(out));
+
+        hal_packed_pack(packed, src, len);
+        hal_packed_unpack(out, packed, len);
+
+        TEST_ASSERT(memcmp(out, src, len) == 0);
+        TEST_ASSERT_EQ(out[len], 0x5A);
+        TEST_ASSERT_EQ(packed[HAL_PACKED_WORDS(len)], GUARD);
+        for (i = 0; i < len; i++) {
+            TEST_ASSERT_EQ(hal_packed_get(packed, i), src[i]);
+        }
+    }
+}
+
+/** 奇數長度只改寫最後一個字的低位元組 */
+static void test_odd_length_preserves_high_byte(void)
+{
+    static const uint8_t src[3] = { 0x11, 0x22, 0x33 };
+    hal_packed_t packed[2] = { 0xFFFF, 0xAB00 };
+
+    hal_packed_pack(packed, src, 3);
+
+    TEST_ASSERT_EQ(packed[0], 0x2211);
+    TEST_ASSERT_EQ(packed[1], 0xAB33);
+}
+
+/**
+ * 格式以字的數值定義 (低位元組在前)，與主機記憶體的位元組順序無關:
+ * 小端主機上緊縮字的記憶體內容等同原始位元組，大端主機上則相反，但字的數值相同。
+ */
+static void test_byte_order(void)
+{
+    static const uint8_t src[4] = { 0x12, 0x34, 0x56, 0x78 };
+    hal_packed_t packed[2];
+    uint8_t raw[4];
+    uint16_t probe = 0x0102;
+    bool little_endian = (*(const uint8_t*)&probe == 0x02U);
+
+    hal_packed_pack(packed, src, 4);
+
+    TEST_ASSERT_EQ(packed[0], 0x3412);
+    TEST_ASSERT_EQ(packed[1], 0x7856);
+
+    memcpy(raw, packed, sizeof(raw));
+    if (little_endian) {
+        TEST_ASSERT(memcmp(raw, src, sizeof(raw)) == 0);
+    } else {
+        TEST_ASSERT_EQ(raw[0], 0x34);
+        TEST_ASSERT_EQ(raw[1], 0x12);
+    }
+
+    // 大端欄位 (例如協定標頭的長度) 以逐位元組組合讀取
+    TEST_ASSERT_EQ((hal_packed_get(packed, 0) << 8) | hal_packed_get(packed, 1), 0x1234);
+    TEST_ASSERT_EQ((hal_packed_get(packed, 3) << 8) | hal_packed_get(packed, 2), 0x7856);
+}
+
+/** 單一位元組寫入不影響同一個字的另一個位元組，只使用值的低8位元 */
+static void test_get_set(void)
+{
+    hal_packed_t packed[2] = { 0, 0 };
+
+    hal_packed_set(packed, 1, 0xAB);
+    hal_packed_set(packed, 2, 0x1CD);
+    TEST_ASSERT_EQ(packed[0], 0xAB00);
+    TEST_ASSERT_EQ(packed[1], 0x00CD);
+
+    hal_packed_set(packed, 0, 0x12);
+    hal_packed_set(packed, 1, 0x00);
+    TEST_ASSERT_EQ(packed[0], 0x0012);
+    TEST_ASSERT_EQ(hal_packed_get(packed, 2), 0xCD);
+    TEST_ASSERT_EQ(hal_packed_get(packed, 3), 0);
+}
+
+/** UART發送/接收以16位元組分段，奇數長度與多段皆正確 */
+static void test_uart_chunking(void)
+{
+    static const uint16_t sizes[] = { 1, 15, 16, 17, 33, 64, 101 };
+    uint8_t src[128];
+    hal_packed_t packed[HAL_PACKED_WORDS(128)];
+    hal_packed_t received[HAL_PACKED_WORDS(128)];
+    uint8_t out[128];
+    uint32_t seed = 0x1234UL;
+    uint16_t s;
+    uint16_t i;
+
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint16_t size = sizes[s];
+
+        for (i = 0; i < size; i++) {
+            src[i] = (uint8_t)test_random(&seed);
+        }
+        hal_packed_pack(packed, src, size);
+
+        wire_reset();
+        TEST_ASSERT_EQ(hal_uart_transmit_packed(TEST_UART, packed, size, 100), HAL_OK);
+        TEST_ASSERT_EQ(wire_pos, size);
+        TEST_ASSERT_EQ(wire_calls, (size + 15U) / 16U);
+        TEST_ASSERT(wire_max_chunk <= 16U);
+        TEST_ASSERT(memcmp(wire, src, size) == 0);
+
+        memset(received, 0, sizeof(received));
+        wire_reset();
+        TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, size, 100, NULL), HAL_OK);
+        hal_packed_unpack(out, received, size);
+        TEST_ASSERT(memcmp(out, src, size) == 0);
+    }
+
+    TEST_ASSERT_EQ(hal_uart_transmit_packed(TEST_UART, NULL, 4, 100), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, 0, 100, NULL), HAL_INVALID_PARAM);
+}
+
+/** 超時前收到的位元組 (含不足一段的部分) 已緊縮到緩衝區並回報數量 */
+static void test_uart_receive_partial(void)
+{
+    static const uint16_t avail[] = { 0, 1, 7, 16, 21, 32 };
+    hal_packed_t received[HAL_PACKED_WORDS(64)];
+    uint8_t out[64];
+    uint16_t count;
+    uint16_t s;
+    uint16_t i;
+
+    for (i = 0; i < 64U; i++) {
+        wire[i] = (uint8_t)(0xA0U + i);
+    }
+
+    for (s = 0; s < sizeof(avail) / sizeof(avail[0]); s++) {
+        // 預設內容用來確認超出收到範圍的位元組未被覆寫
+        memset(received, 0x55, sizeof(received));
+        wire_reset();
+        wire_avail = avail[s];
+
+        TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, 40, 100, &count), HAL_TIMEOUT);
+        TEST_ASSERT_EQ(count, avail[s]);
+
+        hal_packed_unpack(out, received, 40);
+        TEST_ASSERT(memcmp(out, wire, avail[s]) == 0);
+        for (i = avail[s]; i < 40U; i++) {
+            TEST_ASSERT_EQ(out[i], 0x55);
+        }
+    }
+}
+
+/** 超時涵蓋整個接收，不會每段重新計時 */
+static void test_uart_receive_single_deadline(void)
+{
+    hal_packed_t received[HAL_PACKED_WORDS(64)];
+    uint16_t count;
+    uint32_t start;
+
+    // 每個字元10ms、超時100ms: 只收得到10個字元，雖然每一段都不超過100ms
+    wire_reset();
+    wire_char_ms = 10;
+    start = host_tick;
+    TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, 40, 100, &count), HAL_TIMEOUT);
+    TEST_ASSERT_EQ(count, 10);
+    TEST_ASSERT_EQ(host_tick - start, 100);
+
+    // 期限內完成
+    wire_reset();
+    wire_char_ms = 2;
+    TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, 40, 100, &count), HAL_OK);
+    TEST_ASSERT_EQ(count, 40);
+
+    // timeout為0時沿用驅動的語義 (C2000: 一直等待)
+    wire_reset();
+    wire_char_ms = 0;
+    TEST_ASSERT_EQ(hal_uart_receive_packed(TEST_UART, received, 40, 0, &count), HAL_OK);
+    TEST_ASSERT_EQ(count, 40);
+}
+
+int main(void)
+{
+    TEST_RUN(test_round_trip_lengths);
+    TEST_RUN(test_odd_length_preserves_high_byte);
+    TEST_RUN(test_byte_order);
+    TEST_RUN(test_get_set);
+    TEST_RUN(test_uart_chunking);
+    TEST_RUN(test_uart_receive_partial);
+    TEST_RUN(test_uart_receive_single_deadline);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_pool.c
+ * @brief 固定區塊記憶體池單元測試 (配置/釋放、統計、無效與重複釋放)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_pool.h"
+#include "test_common.h"
+
+#define TEST_BLOCKS             40U         // 超過一個位元圖字
+
+HAL_POOL_DEFINE(test_pool, 24, TEST_BLOCKS);
+HAL_POOL_DEFINE(other_pool, 24, 2);
+
+// 以HAL_POOL_CHECK_DOUBLE_FREE=0編譯的目標檔定義的記憶體池 (沒有位元圖)
+static hal_pool_align_t nomap_storage[HAL_POOL_BLOCK_UNITS(24) * 4U];
+static hal_pool_t nomap_pool = { NULL, nomap_storage, (uint16_t)HAL_POOL_BLOCK_UNITS(24), 4, 0, 0, 0, NULL };
+
+static void* blocks[TEST_BLOCKS];
+
+/** 配置全部區塊後用盡，區塊互不重疊且對齊 */
+static void test_alloc_all(void)
+{
+    uint32_t size;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_ASSERT_EQ(hal_pool_init(&test_pool), HAL_OK);
+    size = hal_pool_get_block_size(&test_pool);
+    TEST_ASSERT(size >= 24U);
+    TEST_ASSERT_EQ(size % sizeof(hal_pool_align_t), 0);
+
+    for (i = 0; i < TEST_BLOCKS; i++) {
+        blocks[i] = hal_pool_alloc(&test_pool);
+        TEST_ASSERT(blocks[i] != NULL);
+    }
+
+    TEST_ASSERT(hal_pool_alloc(&test_pool) == NULL);
+    TEST_ASSERT_EQ(hal_pool_get_free(&test_pool), 0);
+    TEST_ASSERT_EQ(hal_pool_get_failures(&test_pool), 1);
+    TEST_ASSERT_EQ(hal_pool_get_high_water(&test_pool), TEST_BLOCKS);
+
+    for (i = 0; i < TEST_BLOCKS; i++) {
+        for (j = i + 1U; j < TEST_BLOCKS; j++) {
+            const char* a = (const char*)blocks[i];
+            const char* b = (const char*)blocks[j];
+            TEST_ASSERT(a + size <= b || b + size <= a);
+        }
+    }
+
+    for (i = 0; i < TEST_BLOCKS; i++) {
+        TEST_ASSERT_EQ(hal_pool_free(&test_pool, blocks[i]), HAL_OK);
+    }
+    TEST_ASSERT_EQ(hal_pool_get_free(&test_pool), TEST_BLOCKS);
+    TEST_ASSERT_EQ(hal_pool_get_high_water(&test_pool), TEST_BLOCKS);
+}
+
+/** 釋放後的區塊可再配置 (LIFO) */
+static void test_reuse(void)
+{
+    void* a;
+    void* b;
+
+    TEST_ASSERT_EQ(hal_pool_init(&test_pool), HAL_OK);
+    a = hal_pool_alloc(&test_pool);
+    b = hal_pool_alloc(&test_pool);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a), HAL_OK);
+    TEST_ASSERT(hal_pool_alloc(&test_pool) == a);
+    TEST_ASSERT_EQ(hal_pool_get_free(&test_pool), TEST_BLOCKS - 2U);
+    TEST_ASSERT_EQ(hal_pool_get_high_water(&test_pool), 2);
+    (void)b;
+}
+
+/** 不屬於記憶體池或不是區塊起始的位址被拒絕，不影響統計 */
+static void test_invalid_free(void)
+{
+    uint32_t size = hal_pool_get_block_size(&test_pool);
+    char* a;
+    void* foreign;
+
+    TEST_ASSERT_EQ(hal_pool_init(&test_pool), HAL_OK);
+    TEST_ASSERT_EQ(hal_pool_init(&other_pool), HAL_OK);
+    a = (char*)hal_pool_alloc(&test_pool);
+    foreign = hal_pool_alloc(&other_pool);
+
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_pool_free(NULL, a), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, foreign), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a + sizeof(hal_pool_align_t)), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a + size * TEST_BLOCKS), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_pool_get_free(&test_pool), TEST_BLOCKS - 1U);
+
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a), HAL_OK);
+    TEST_ASSERT_EQ(hal_pool_free(&other_pool, foreign), HAL_OK);
+}
+
+/** 重複釋放返回HAL_ERROR，空閒串列不被破壞 */
+static void test_double_free(void)
+{
+    void* a;
+    void* b;
+    void* c;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(hal_pool_init(&test_pool), HAL_OK);
+    a = hal_pool_alloc(&test_pool);
+    b = hal_pool_alloc(&test_pool);
+
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a), HAL_OK);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, a), HAL_ERROR);
+    TEST_ASSERT_EQ(hal_pool_get_free(&test_pool), TEST_BLOCKS - 1U);
+
+    // 從未配置過的區塊 (位於空閒串列中) 也視為重複釋放
+    c = (char*)b + hal_pool_get_block_size(&test_pool);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, c), HAL_ERROR);
+
+    // 空閒串列中每個區塊只出現一次: 可配置的數量剛好等於空閒數
+    for (i = 0; i < TEST_BLOCKS - 1U; i++) {
+        blocks[i] = hal_pool_alloc(&test_pool);
+        TEST_ASSERT(blocks[i] != NULL && blocks[i] != b);
+    }
+    TEST_ASSERT(hal_pool_alloc(&test_pool) == NULL);
+
+    // 重新初始化後清除配置標記
+    TEST_ASSERT_EQ(hal_pool_init(&test_pool), HAL_OK);
+    TEST_ASSERT_EQ(hal_pool_free(&test_pool, b), HAL_ERROR);
+}
+
+/** 沒有位元圖的記憶體池可正常使用，只是不偵測重複釋放 */
+static void test_pool_without_map(void)
+{
+    void* a;
+    uint32_t i;
+
+    TEST_ASSERT_EQ(hal_pool_init(&nomap_pool), HAL_OK);
+    for (i = 0; i < 4U; i++) {
+        blocks[i] = hal_pool_alloc(&nomap_pool);
+        TEST_ASSERT(blocks[i] != NULL);
+    }
+    TEST_ASSERT(hal_pool_alloc(&nomap_pool) == NULL);
+
+    for (i = 0; i < 4U; i++) {
+        TEST_ASSERT_EQ(hal_pool_free(&nomap_pool, blocks[i]), HAL_OK);
+    }
+    TEST_ASSERT_EQ(hal_pool_get_free(&nomap_pool), 4);
+
+    a = hal_pool_alloc(&nomap_pool);
+    TEST_ASSERT(a != NULL);
+    TEST_ASSERT_EQ(hal_pool_free(&nomap_pool, a), HAL_OK);
+}
+
+int main(void)
+{
+    TEST_RUN(test_alloc_all);
+    TEST_RUN(test_reuse);
+    TEST_RUN(test_invalid_free);
+    TEST_RUN(test_double_free);
+    TEST_RUN(test_pool_without_map);
+
+    return TEST_REPORT();
+}
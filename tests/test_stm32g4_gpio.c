@@ -0,0 +1,266 @@
+/**
+ * @file test_stm32g4_gpio.c
+ * @brief STM32G4 LL版GPIO驅動在GPIO暫存器模型上的測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 驅動原始碼 (ll/stm32g4_gpio_ll.c、stm32g4_gpio_table.c) 以主機gcc編譯，
+ * GPIO與RCC暫存器由model/stm32g4_model.c模擬。
+ */
+
+#include "hal_gpio.h"
+#include "stm32g4_model.h"
+#include "test_common.h"
+
+#define PORT_A                  0U
+#define PORT_B                  1U
+#define PORT_C                  2U
+#define PORT_G                  6U
+
+#define PIN(port, n)            ((hal_gpio_pin_t)(((port) << 8) | (n)))
+
+static hal_gpio_config_t gpio_config(hal_gpio_pin_t pin, hal_gpio_mode_t mode,
+                                     hal_gpio_pull_t pull, hal_gpio_state_t initial)
+{
+    hal_gpio_config_t config;
+
+    config.pin = pin;
+    config.mode = mode;
+    config.pull = pull;
+    config.initial_state = initial;
+    return config;
+}
+
+/** GPIO區域所有暫存器的存取總數 */
+static uint32_t gpio_accesses(void)
+{
+    mmio_region_t* region = stm32g4_model_gpio_region();
+
+    return region->reads + region->writes;
+}
+
+/* ========================================================================== */
+/*                             模式與上下拉                                    */
+/* ========================================================================== */
+
+/** set_mode只讀改寫MODER，不改變上下拉、速度與輸出類型 */
+static void test_set_mode_keeps_pull(void)
+{
+    stm32g4_model_init();
+    stm32g4_model_gpio_set(PORT_C, STM32G4_GPIOx_PUPDR, 0x00000004UL);
+    stm32g4_model_gpio_set(PORT_C, STM32G4_GPIOx_OSPEEDR, 0x0000000CUL);
+    stm32g4_model_counts_clear();
+
+    TEST_ASSERT_EQ(hal_gpio_set_mode(PIN(PORT_C, 1), HAL_GPIO_MODE_OUTPUT), HAL_OK);
+
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER), (uint32_t)~(2UL << 2));
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR), 0x00000004UL);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_OSPEEDR), 0x0000000CUL);
+    TEST_ASSERT_EQ(stm32g4_model_gpio_reads(PORT_C, STM32G4_GPIOx_MODER), 1);
+    TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_C, STM32G4_GPIOx_MODER), 1);
+    TEST_ASSERT_EQ(gpio_accesses(), 2);
+}
+
+/** set_pull只讀改寫PUPDR，不把引腳切換為輸入 */
+static void test_set_pull_keeps_mode(void)
+{
+    stm32g4_model_init();
+    TEST_ASSERT_EQ(hal_gpio_set_mode(PIN(PORT_C, 5), HAL_GPIO_MODE_OUTPUT), HAL_OK);
+    stm32g4_model_counts_clear();
+
+    TEST_ASSERT_EQ(hal_gpio_set_pull(PIN(PORT_C, 5), HAL_GPIO_PULLDOWN), HAL_OK);
+
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR), 2UL << 10);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER), (uint32_t)~(2UL << 10));
+    TEST_ASSERT_EQ(gpio_accesses(), 2);
+
+    TEST_ASSERT_EQ(hal_gpio_set_pull(PIN(PORT_C, 5), HAL_GPIO_PULLUP), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR), 1UL << 10);
+    TEST_ASSERT_EQ(hal_gpio_set_pull(PIN(PORT_C, 5), HAL_GPIO_NOPULL), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR), 0);
+}
+
+/* ========================================================================== */
+/*                             讀寫與翻轉                                      */
+/* ========================================================================== */
+
+/** 寫入為單一BSRR寫入，翻轉為一次ODR讀取加一次BSRR寫入 */
+static void test_write_toggle_accesses(void)
+{
+    stm32g4_model_init();
+    stm32g4_model_gpio_set(PORT_B, STM32G4_GPIOx_MODER, 0x55555555UL);
+    stm32g4_model_counts_clear();
+
+    TEST_ASSERT_EQ(hal_gpio_write(PIN(PORT_B, 7), HAL_GPIO_HIGH), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_B, STM32G4_GPIOx_BSRR), 1);
+    TEST_ASSERT_EQ(gpio_accesses(), 1);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_B, STM32G4_GPIOx_ODR), 1UL << 7);
+
+    stm32g4_model_counts_clear();
+    TEST_ASSERT_EQ(hal_gpio_write(PIN(PORT_B, 7), HAL_GPIO_LOW), HAL_OK);
+    TEST_ASSERT_EQ(gpio_accesses(), 1);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_B, STM32G4_GPIOx_ODR), 0);
+
+    stm32g4_model_counts_clear();
+    TEST_ASSERT_EQ(hal_gpio_toggle(PIN(PORT_B, 15)), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_gpio_reads(PORT_B, STM32G4_GPIOx_ODR), 1);
+    TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_B, STM32G4_GPIOx_BSRR), 1);
+    TEST_ASSERT_EQ(gpio_accesses(), 2);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_B, STM32G4_GPIOx_ODR), 1UL << 15);
+
+    // 沒有任何暫存器被直接寫入ODR
+    TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_B, STM32G4_GPIOx_ODR), 0);
+}
+
+/** 隨機寫入/翻轉序列與軟體參考值比對 */
+static void test_write_toggle_random(void)
+{
+    uint32_t expected[7] = { 0 };
+    uint32_t seed = 0x2468ACEU;
+    uint32_t i;
+    uint16_t port;
+
+    stm32g4_model_init();
+    for (port = 0; port < 7U; port++) {
+        stm32g4_model_gpio_set(port, STM32G4_GPIOx_MODER, 0x55555555UL);
+    }
+
+    for (i = 0; i < 5000U; i++) {
+        uint32_t r = test_random(&seed);
+        uint16_t p = (uint16_t)(r % 7U);
+        uint32_t n = (r >> 8) & 15U;
+        hal_gpio_pin_t pin = PIN(p, n);
+
+        switch ((r >> 16) % 3U) {
+            case 0:
+                TEST_ASSERT_EQ(hal_gpio_write(pin, HAL_GPIO_HIGH), HAL_OK);
+                expected[p] |= (1UL << n);
+                break;
+            case 1:
+                TEST_ASSERT_EQ(hal_gpio_write(pin, HAL_GPIO_LOW), HAL_OK);
+                expected[p] &= ~(1UL << n);
+                break;
+            default:
+                TEST_ASSERT_EQ(hal_gpio_toggle(pin), HAL_OK);
+                expected[p] ^= (1UL << n);
+                break;
+        }
+        TEST_ASSERT_EQ(hal_gpio_read(pin),
+                       ((expected[p] & (1UL << n)) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW);
+    }
+
+    for (port = 0; port < 7U; port++) {
+        TEST_ASSERT_EQ(hal_gpio_read_port(port), expected[port]);
+    }
+}
+
+/** 輸入引腳讀取外部電平 */
+static void test_read_inputs(void)
+{
+    hal_gpio_config_t config = gpio_config(PIN(PORT_G, 3), HAL_GPIO_MODE_INPUT,
+                                           HAL_GPIO_PULLUP, HAL_GPIO_LOW);
+
+    stm32g4_model_init();
+    TEST_ASSERT_EQ(hal_gpio_init(&config), HAL_OK);
+
+    stm32g4_model_gpio_set_input(PORT_G, 1UL << 3, 1UL << 3);
+    TEST_ASSERT_EQ(hal_gpio_read(PIN(PORT_G, 3)), HAL_GPIO_HIGH);
+    TEST_ASSERT_EQ(hal_gpio_read_port(PORT_G), 1UL << 3);
+
+    stm32g4_model_gpio_set_input(PORT_G, 1UL << 3, 0);
+    TEST_ASSERT_EQ(hal_gpio_read(PIN(PORT_G, 3)), HAL_GPIO_LOW);
+}
+
+/* ========================================================================== */
+/*                             初始化                                          */
+/* ========================================================================== */
+
+/** 輸出初始化: 使能時鐘、初始電平、推挽高速，反初始化回到重設狀態 */
+static void test_init_deinit(void)
+{
+    hal_gpio_config_t config = gpio_config(PIN(PORT_C, 9), HAL_GPIO_MODE_OUTPUT,
+                                           HAL_GPIO_NOPULL, HAL_GPIO_HIGH);
+
+    stm32g4_model_init();
+    stm32g4_model_gpio_set(PORT_C, STM32G4_GPIOx_OTYPER, 1UL << 9);
+    stm32g4_model_gpio_set(PORT_C, STM32G4_GPIOx_AFRH, 0x000000F0UL);
+
+    TEST_ASSERT_EQ(hal_gpio_init(&config), HAL_OK);
+    TEST_ASSERT_EQ(mmio_peek32(stm32g4_model_rcc_region(), STM32G4_RCC_AHB2ENR), 1UL << PORT_C);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_ODR), 1UL << 9);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER), (uint32_t)~(2UL << 18));
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_OSPEEDR), 2UL << 18);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_OTYPER), 0);
+
+    TEST_ASSERT_EQ(hal_gpio_deinit(PIN(PORT_C, 9)), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER), 0xFFFFFFFFUL);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_OSPEEDR), 0);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_AFRH), 0);
+}
+
+/** 配置表: 每個埠的每個配置暫存器只讀改寫一次，時鐘一次使能 */
+static void test_table_one_access_per_register(void)
+{
+    static const uint16_t regs[] = {
+        STM32G4_GPIOx_MODER, STM32G4_GPIOx_OTYPER, STM32G4_GPIOx_OSPEEDR, STM32G4_GPIOx_PUPDR
+    };
+    hal_gpio_config_t table[16];
+    mmio_region_t* rcc;
+    uint32_t i;
+
+    stm32g4_model_init();
+    for (i = 0; i < 16U; i++) {
+        table[i] = gpio_config(PIN(PORT_C, i),
+                               ((i & 1U) != 0U) ? HAL_GPIO_MODE_OUTPUT : HAL_GPIO_MODE_INPUT,
+                               HAL_GPIO_PULLUP, ((i & 2U) != 0U) ? HAL_GPIO_HIGH : HAL_GPIO_LOW);
+    }
+
+    TEST_ASSERT_EQ(hal_gpio_init_table(table, 16), HAL_OK);
+
+    for (i = 0; i < sizeof(regs) / sizeof(regs[0]); i++) {
+        TEST_ASSERT_EQ(stm32g4_model_gpio_reads(PORT_C, regs[i]), 1);
+        TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_C, regs[i]), 1);
+    }
+    TEST_ASSERT_EQ(stm32g4_model_gpio_writes(PORT_C, STM32G4_GPIOx_BSRR), 1);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_MODER), 0x44444444UL);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_PUPDR), 0x55555555UL);
+    TEST_ASSERT_EQ(stm32g4_model_gpio(PORT_C, STM32G4_GPIOx_ODR), 0xCCCCUL & 0xAAAAUL);
+
+    rcc = stm32g4_model_rcc_region();
+    TEST_ASSERT_EQ(rcc->writes, 1);
+}
+
+/** 無效引腳不存取任何暫存器 */
+static void test_invalid_pins(void)
+{
+    hal_gpio_config_t config = gpio_config(PIN(7, 0), HAL_GPIO_MODE_OUTPUT,
+                                           HAL_GPIO_NOPULL, HAL_GPIO_LOW);
+
+    stm32g4_model_init();
+
+    TEST_ASSERT_EQ(hal_gpio_init(&config), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_write(PIN(PORT_A, 16), HAL_GPIO_HIGH), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_toggle(PIN(9, 1)), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_set_mode(PIN(PORT_B, 20), HAL_GPIO_MODE_OUTPUT), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_set_pull(PIN(8, 0), HAL_GPIO_PULLUP), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_gpio_read(PIN(PORT_A, 16)), HAL_GPIO_LOW);
+    TEST_ASSERT_EQ(hal_gpio_read_port(7), 0);
+    TEST_ASSERT_EQ(hal_gpio_init_table(&config, 1), HAL_INVALID_PARAM);
+
+    TEST_ASSERT_EQ(gpio_accesses(), 0);
+    TEST_ASSERT_EQ(stm32g4_model_rcc_region()->writes, 0);
+}
+
+int main(void)
+{
+    TEST_RUN(test_set_mode_keeps_pull);
+    TEST_RUN(test_set_pull_keeps_mode);
+    TEST_RUN(test_write_toggle_accesses);
+    TEST_RUN(test_write_toggle_random);
+    TEST_RUN(test_read_inputs);
+    TEST_RUN(test_init_deinit);
+    TEST_RUN(test_table_one_access_per_register);
+    TEST_RUN(test_invalid_pins);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,287 @@
+/**
+ * @file test_stm32g4_uart.c
+ * @brief STM32G4 UART驅動在USART暫存器模型上的測試
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 驅動原始碼 (stm32g4_uart.c) 以主機gcc編譯，model/stm32g4的LL替身以暫存器操作
+ * 實現，存取落在model/stm32g4_model.c的USART模型上。接收中斷由測試在放入資料後
+ * 直接呼叫USART2_IRQHandler()。
+ */
+
+#include "hal.h"
+#include "hal_uart.h"
+#include "stm32g4_model.h"
+#include "stm32g4xx.h"
+#include "test_common.h"
+#include <string.h>
+
+#define CYCLES_PER_MS           (STM32G4_MODEL_CPU_HZ / 1000UL)
+#define UART_ID                 ((hal_uart_id_t)USART2)
+#define FAST_BAUD               5312500UL   // BRR = 32，每字元320個CPU週期
+#define MATCH_CHAR              0x8AU       // 最高位元為1的結束字元
+
+static uint8_t pattern[256];
+static uint32_t frame_done_count;
+
+void USART2_IRQHandler(void);
+
+/** 系統tick由模型時間換算，每次讀取計為一次輪詢 */
+uint32_t hal_get_tick(void)
+{
+    (void)hal_get_cycle_count();
+    return (uint32_t)(stm32g4_model_now() / CYCLES_PER_MS);
+}
+
+static hal_status_t uart_setup_format(uint32_t baudrate, hal_uart_databits_t databits,
+                                      hal_uart_parity_t parity)
+{
+    hal_uart_config_t config = { baudrate, databits, HAL_UART_STOPBITS_1, parity };
+    hal_status_t status;
+    uint32_t i;
+
+    stm32g4_model_init();
+    status = hal_uart_init(UART_ID, &config);
+    (void)hal_uart_reset_stats(UART_ID);
+    frame_done_count = 0;
+
+    for (i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = (uint8_t)(i * 7U + 3U);
+    }
+
+    return status;
+}
+
+static void uart_setup(uint32_t baudrate)
+{
+    TEST_ASSERT_EQ(uart_setup_format(baudrate, HAL_UART_DATABITS_8, HAL_UART_PARITY_NONE),
+                   HAL_OK);
+}
+
+static void rx_bytes(const uint8_t* data, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        stm32g4_model_usart_rx(STM32G4_USART2, data[i], 0);
+    }
+}
+
+static bool usart2_irq_enabled(void)
+{
+    return (cortexm_host_nvic_iser[USART2_IRQn >> 5] & (1UL << (USART2_IRQn & 0x1FU))) != 0U;
+}
+
+static void frame_done(void* context)
+{
+    (void)context;
+    frame_done_count++;
+}
+
+/* ========================================================================== */
+/*                             初始化                                          */
+/* ========================================================================== */
+
+/** M[1:0]的字長包含校驗位元: 7N/7E/8N/8E/9N可設定，9位元加校驗被拒絕 */
+static void test_init_word_length(void)
+{
+    static const struct {
+        hal_uart_databits_t databits;
+        hal_uart_parity_t parity;
+        uint32_t cr1;
+    } cases[] = {
+        { HAL_UART_DATABITS_7, HAL_UART_PARITY_NONE, USART_CR1_M1 },
+        { HAL_UART_DATABITS_7, HAL_UART_PARITY_EVEN, USART_CR1_PCE },
+        { HAL_UART_DATABITS_8, HAL_UART_PARITY_NONE, 0 },
+        { HAL_UART_DATABITS_8, HAL_UART_PARITY_ODD, USART_CR1_M0 | USART_CR1_PCE | USART_CR1_PS },
+        { HAL_UART_DATABITS_9, HAL_UART_PARITY_NONE, USART_CR1_M0 },
+    };
+    const uint32_t mask = USART_CR1_M | USART_CR1_PCE | USART_CR1_PS;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        TEST_ASSERT_EQ(uart_setup_format(115200, cases[i].databits, cases[i].parity), HAL_OK);
+        TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_CR1) & mask,
+                       cases[i].cr1);
+        TEST_ASSERT(stm32g4_model_usart_ready(STM32G4_USART2));
+    }
+
+    TEST_ASSERT_EQ(uart_setup_format(115200, HAL_UART_DATABITS_9, HAL_UART_PARITY_EVEN),
+                   HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(uart_setup_format(115200, HAL_UART_DATABITS_9, HAL_UART_PARITY_ODD),
+                   HAL_INVALID_PARAM);
+}
+
+/* ========================================================================== */
+/*                             發送                                            */
+/* ========================================================================== */
+
+/** 輪詢TXFNF連續填入FIFO: 字元之間沒有空檔，也不使用TX FIFO閾值中斷 */
+static void test_tx_full_line_rate(void)
+{
+    stm32g4_usart_tx_t* tx;
+    uint32_t cr3;
+
+    uart_setup(FAST_BAUD);
+    tx = stm32g4_model_usart_tx(STM32G4_USART2);
+    TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_BRR), 32U);
+    TEST_ASSERT_EQ(stm32g4_model_usart_char_cycles(STM32G4_USART2), 320U);
+
+    TEST_ASSERT_EQ(hal_uart_transmit(UART_ID, pattern, sizeof(pattern), 100), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_flush_tx(UART_ID), HAL_OK);
+
+    TEST_ASSERT_EQ(tx->count, sizeof(pattern));
+    TEST_ASSERT_EQ(tx->gaps, 0U);
+    TEST_ASSERT_EQ(tx->overruns, 0U);
+    TEST_ASSERT(memcmp(tx->data, pattern, sizeof(pattern)) == 0);
+    TEST_ASSERT(!hal_uart_is_busy(UART_ID));
+
+    cr3 = stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_CR3);
+    TEST_ASSERT_EQ(cr3 & (USART_CR3_TXFTIE | USART_CR3_TXFTCFG), 0U);
+}
+
+/* ========================================================================== */
+/*                             自動波特率                                      */
+/* ========================================================================== */
+
+/** 重新使能後等待TEACK/REACK: 返回時發送與接收器已就緒 */
+static void test_autobaud_ready(void)
+{
+    const uint32_t detected_brr = 1476U;    // 170 MHz / 1476 = 115176 baud
+    uint32_t baudrate = 0;
+
+    uart_setup(9600);
+    stm32g4_model_usart_autobaud(STM32G4_USART2, detected_brr, false);
+
+    TEST_ASSERT_EQ(hal_uart_autobaud(UART_ID, 100, &baudrate), HAL_OK);
+    TEST_ASSERT(stm32g4_model_usart_ready(STM32G4_USART2));
+    TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_BRR), detected_brr);
+    TEST_ASSERT_EQ(baudrate, STM32G4_MODEL_CPU_HZ / detected_brr);
+    TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_CR2) & USART_CR2_ABREN,
+                   0U);
+
+    // 量測失敗時恢復初始化的波特率，同樣在就緒後返回
+    stm32g4_model_usart_autobaud(STM32G4_USART2, 7U, true);
+    TEST_ASSERT_EQ(hal_uart_autobaud(UART_ID, 100, &baudrate), HAL_ERROR);
+    TEST_ASSERT(stm32g4_model_usart_ready(STM32G4_USART2));
+    TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_BRR), detected_brr);
+
+    // 沒有0x55字元時超時
+    TEST_ASSERT_EQ(hal_uart_autobaud(UART_ID, 2, &baudrate), HAL_TIMEOUT);
+    TEST_ASSERT(stm32g4_model_usart_ready(STM32G4_USART2));
+}
+
+/* ========================================================================== */
+/*                             訊框接收                                        */
+/* ========================================================================== */
+
+/**
+ * 字元比對以完整的8位元組寫入ADD: 最高位元為1的結束字元也能觸發CMF，
+ * 低7位元相同的0x0A不會結束訊框，結束字元之後的資料進入環形緩衝區
+ */
+static void test_frame_match_full_byte(void)
+{
+    static const uint8_t first[] = { 0x01, 0x0A, 0x03 };
+    static const uint8_t second[] = { 0x04, MATCH_CHAR, 0x55, 0x66 };
+    uint8_t frame[32];
+    uint8_t rest[2];
+    uint16_t length = 0;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_config_frame(UART_ID, 0, (int16_t)MATCH_CHAR), HAL_OK);
+    TEST_ASSERT_EQ(stm32g4_model_usart(STM32G4_USART2, STM32G4_USARTx_CR2) >> USART_CR2_ADD_Pos,
+                   MATCH_CHAR);
+    TEST_ASSERT(stm32g4_model_usart_ready(STM32G4_USART2));
+
+    TEST_ASSERT_EQ(hal_uart_receive_frame(UART_ID, frame, sizeof(frame), &length,
+                                          frame_done, NULL), HAL_OK);
+
+    rx_bytes(first, sizeof(first));
+    USART2_IRQHandler();
+    TEST_ASSERT(hal_uart_frame_pending(UART_ID));
+    TEST_ASSERT_EQ(frame_done_count, 0U);
+
+    rx_bytes(second, sizeof(second));
+    USART2_IRQHandler();
+    TEST_ASSERT(!hal_uart_frame_pending(UART_ID));
+    TEST_ASSERT_EQ(frame_done_count, 1U);
+    TEST_ASSERT_EQ(length, 5U);
+    TEST_ASSERT(memcmp(frame, first, sizeof(first)) == 0);
+    TEST_ASSERT(memcmp(frame + sizeof(first), second, 2) == 0);
+
+    TEST_ASSERT_EQ(hal_uart_receive(UART_ID, rest, sizeof(rest), 10), HAL_OK);
+    TEST_ASSERT_EQ(rest[0], 0x55U);
+    TEST_ASSERT_EQ(rest[1], 0x66U);
+}
+
+/** 閒置超時 (RTOF) 結束已收到資料的訊框 */
+static void test_frame_idle(void)
+{
+    uint8_t frame[32];
+    uint16_t length = 0;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_config_frame(UART_ID, 0, HAL_UART_FRAME_NO_MATCH), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_receive_frame(UART_ID, frame, sizeof(frame), &length,
+                                          frame_done, NULL), HAL_OK);
+
+    rx_bytes(pattern, 5);
+    USART2_IRQHandler();
+    TEST_ASSERT(hal_uart_frame_pending(UART_ID));
+
+    stm32g4_model_usart_idle(STM32G4_USART2);
+    USART2_IRQHandler();
+    TEST_ASSERT(!hal_uart_frame_pending(UART_ID));
+    TEST_ASSERT_EQ(frame_done_count, 1U);
+    TEST_ASSERT_EQ(length, 5U);
+    TEST_ASSERT(memcmp(frame, pattern, 5) == 0);
+}
+
+/** 取消後中斷不再寫入訊框緩衝區或呼叫回呼，且USART中斷恢復使能 */
+static void test_frame_abort(void)
+{
+    uint8_t frame[32];
+    uint8_t rest[3];
+    uint16_t length = 0xFFFFU;
+
+    uart_setup(FAST_BAUD);
+    TEST_ASSERT_EQ(hal_uart_config_frame(UART_ID, 0, (int16_t)MATCH_CHAR), HAL_OK);
+    memset(frame, 0, sizeof(frame));
+    TEST_ASSERT_EQ(hal_uart_receive_frame(UART_ID, frame, sizeof(frame), &length,
+                                          frame_done, NULL), HAL_OK);
+
+    rx_bytes(pattern, 2);
+    USART2_IRQHandler();
+    TEST_ASSERT(usart2_irq_enabled());
+    TEST_ASSERT_EQ(hal_uart_abort_frame(UART_ID), HAL_OK);
+    TEST_ASSERT(usart2_irq_enabled());
+    TEST_ASSERT(!hal_uart_frame_pending(UART_ID));
+
+    rest[0] = 0x11;
+    rest[1] = MATCH_CHAR;
+    rest[2] = 0x22;
+    rx_bytes(rest, sizeof(rest));
+    USART2_IRQHandler();
+
+    TEST_ASSERT_EQ(frame_done_count, 0U);
+    TEST_ASSERT_EQ(length, 0xFFFFU);
+    TEST_ASSERT_EQ(frame[2], 0U);
+
+    memset(rest, 0, sizeof(rest));
+    TEST_ASSERT_EQ(hal_uart_receive(UART_ID, rest, sizeof(rest), 10), HAL_OK);
+    TEST_ASSERT_EQ(rest[0], 0x11U);
+    TEST_ASSERT_EQ(rest[1], MATCH_CHAR);
+    TEST_ASSERT_EQ(rest[2], 0x22U);
+}
+
+int main(void)
+{
+    TEST_RUN(test_init_word_length);
+    TEST_RUN(test_tx_full_line_rate);
+    TEST_RUN(test_autobaud_ready);
+    TEST_RUN(test_frame_match_full_byte);
+    TEST_RUN(test_frame_idle);
+    TEST_RUN(test_frame_abort);
+
+    return TEST_REPORT();
+}
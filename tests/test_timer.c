@@ -0,0 +1,314 @@
+/**
+ * @file test_timer.c
+ * @brief 軟體計時輪單元測試 (到期精確度、週期、回呼中啟動/停止、參數範圍)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ */
+
+#include "hal_timer.h"
+#include "test_common.h"
+
+/* ========================================================================== */
+/*                             測試輔助                                        */
+/* ========================================================================== */
+
+#define RANDOM_TIMERS           2000U
+#define RANDOM_MAX_BITS         20U
+
+typedef struct {
+    hal_timer_t timer;
+    uint32_t start;                 // 啟動時的tick
+    uint32_t delay;
+    uint32_t fired_at;              // 最後一次到期的tick
+    uint32_t fire_count;
+    uint32_t late;                  // 週期計時器不準時的次數
+} probe_t;
+
+static probe_t probes[RANDOM_TIMERS];
+
+static void probe_callback(hal_timer_t* timer, void* context)
+{
+    probe_t* probe = (probe_t*)context;
+    uint32_t now = hal_timer_get_ticks();
+
+    (void)timer;
+
+    if (probe->timer.period != 0U && probe->fire_count > 0U &&
+        now - probe->fired_at != probe->timer.period) {
+        probe->late++;
+    }
+
+    probe->fired_at = now;
+    probe->fire_count++;
+}
+
+/** 每個tick都處理一次，回呼看到的tick即為到期時間 */
+static void advance(uint32_t ticks)
+{
+    while (ticks-- > 0U) {
+        hal_timer_tick();
+        (void)hal_timer_process();
+    }
+}
+
+static void probe_start(probe_t* probe, uint32_t delay, uint32_t period)
+{
+    probe->start = hal_timer_get_ticks();
+    probe->delay = delay;
+    probe->fired_at = 0;
+    probe->fire_count = 0;
+    probe->late = 0;
+    TEST_ASSERT_EQ(hal_timer_setup(&probe->timer, probe_callback, probe), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_start(&probe->timer, delay, period), HAL_OK);
+}
+
+/* ========================================================================== */
+/*                             測試                                            */
+/* ========================================================================== */
+
+/** 各層邊界的延時都在精確的tick到期 */
+static void test_level_boundaries(void)
+{
+    static const uint32_t delays[] = {
+        1, 2, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 262145, 300000
+    };
+    uint32_t i;
+
+    hal_timer_service_init();
+
+    // 從非對齊的時間點開始，讓到期時間跨越各層槽位
+    advance(37);
+
+    for (i = 0; i < sizeof(delays) / sizeof(delays[0]); i++) {
+        probe_start(&probes[i], delays[i], 0);
+    }
+
+    advance(300001);
+
+    for (i = 0; i < sizeof(delays) / sizeof(delays[0]); i++) {
+        TEST_ASSERT_EQ(probes[i].fire_count, 1);
+        TEST_ASSERT_EQ(probes[i].fired_at, probes[i].start + delays[i]);
+        TEST_ASSERT(!hal_timer_is_active(&probes[i].timer));
+    }
+}
+
+/** 隨機延時與啟動時間的計時器全部在預期tick到期 */
+static void test_random_accuracy(void)
+{
+    uint32_t seed = 0x12345678UL;
+    uint32_t wrong = 0;
+    uint32_t i;
+
+    hal_timer_service_init();
+
+    for (i = 0; i < RANDOM_TIMERS; i++) {
+        // 對數分布: 短延時與長延時都有足夠的樣本
+        uint32_t bits = test_random(&seed) % (RANDOM_MAX_BITS + 1U);
+        uint32_t delay = (test_random(&seed) & ((1UL << bits) - 1UL)) + 1UL;
+
+        probe_start(&probes[i], delay, 0);
+        advance(test_random(&seed) % 3U);
+    }
+
+    advance(1UL << RANDOM_MAX_BITS);
+
+    for (i = 0; i < RANDOM_TIMERS; i++) {
+        if (probes[i].fire_count != 1U ||
+            probes[i].fired_at != probes[i].start + probes[i].delay) {
+            wrong++;
+        }
+    }
+
+    TEST_ASSERT_EQ(wrong, 0);
+}
+
+/** 延時0在下一個tick到期 */
+static void test_zero_delay(void)
+{
+    hal_timer_service_init();
+    advance(5);
+
+    probe_start(&probes[0], 0, 0);
+    TEST_ASSERT_EQ(hal_timer_process(), 0);
+    advance(1);
+    TEST_ASSERT_EQ(probes[0].fire_count, 1);
+    TEST_ASSERT_EQ(probes[0].fired_at, probes[0].start + 1U);
+}
+
+/** 超出計時輪範圍的延時在最上層等待後仍準時到期 */
+static void test_beyond_wheel_range(void)
+{
+    uint32_t range = 1UL << (HAL_TIMER_WHEEL_BITS * HAL_TIMER_WHEEL_LEVELS);
+
+    hal_timer_service_init();
+    probe_start(&probes[0], range + 999U, 0);
+
+    advance(range + 998U);
+    TEST_ASSERT_EQ(probes[0].fire_count, 0);
+    advance(1);
+    TEST_ASSERT_EQ(probes[0].fire_count, 1);
+    TEST_ASSERT_EQ(probes[0].fired_at, probes[0].start + range + 999U);
+}
+
+/** 週期計時器每個週期準時到期，停止後不再到期 */
+static void test_periodic(void)
+{
+    hal_timer_service_init();
+
+    probe_start(&probes[0], 3, 7);
+    probe_start(&probes[1], 100, 64);
+
+    advance(1000);
+
+    TEST_ASSERT_EQ(probes[0].fire_count, 1U + (1000U - 3U) / 7U);
+    TEST_ASSERT_EQ(probes[0].late, 0);
+    TEST_ASSERT_EQ(probes[1].fire_count, 1U + (1000U - 100U) / 64U);
+    TEST_ASSERT_EQ(probes[1].late, 0);
+
+    TEST_ASSERT_EQ(hal_timer_stop(&probes[0].timer), HAL_OK);
+    advance(100);
+    TEST_ASSERT_EQ(probes[0].fire_count, 1U + (1000U - 3U) / 7U);
+    TEST_ASSERT(!hal_timer_is_active(&probes[0].timer));
+}
+
+/** 重新啟動以新的延時取代舊的 */
+static void test_restart(void)
+{
+    hal_timer_service_init();
+
+    probe_start(&probes[0], 10, 0);
+    advance(5);
+    TEST_ASSERT_EQ(hal_timer_start(&probes[0].timer, 10, 0), HAL_OK);
+    advance(9);
+    TEST_ASSERT_EQ(probes[0].fire_count, 0);
+    advance(1);
+    TEST_ASSERT_EQ(probes[0].fire_count, 1);
+    TEST_ASSERT_EQ(probes[0].fired_at, probes[0].start + 15U);
+}
+
+// 回呼中停止另一個同時到期的計時器 (context指向另一個計時器)
+static uint32_t stop_fired;
+
+static void stop_other_callback(hal_timer_t* timer, void* context)
+{
+    (void)timer;
+
+    stop_fired++;
+    (void)hal_timer_stop((hal_timer_t*)context);
+}
+
+/** 回呼停止同一到期串列中尚未執行的計時器 */
+static void test_stop_from_callback(void)
+{
+    hal_timer_t a;
+    hal_timer_t b;
+
+    hal_timer_service_init();
+
+    stop_fired = 0;
+    TEST_ASSERT_EQ(hal_timer_setup(&a, stop_other_callback, &b), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_setup(&b, stop_other_callback, &a), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_start(&a, 20, 0), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_start(&b, 20, 0), HAL_OK);
+
+    advance(30);
+
+    // 先執行的回呼停止另一個，只會到期一次
+    TEST_ASSERT_EQ(stop_fired, 1);
+    TEST_ASSERT(!hal_timer_is_active(&a));
+    TEST_ASSERT(!hal_timer_is_active(&b));
+}
+
+// 回呼中重新啟動自身 (單次計時器串成固定間隔)
+static uint32_t rearm_count;
+static uint32_t rearm_last;
+
+static void rearm_callback(hal_timer_t* timer, void* context)
+{
+    (void)context;
+
+    rearm_count++;
+    rearm_last = hal_timer_get_ticks();
+    if (rearm_count < 5U) {
+        (void)hal_timer_start(timer, 50, 0);
+    }
+}
+
+/** 回呼中重新啟動自身 */
+static void test_rearm_from_callback(void)
+{
+    hal_timer_t timer;
+    uint32_t start;
+
+    hal_timer_service_init();
+
+    rearm_count = 0;
+    start = hal_timer_get_ticks();
+    TEST_ASSERT_EQ(hal_timer_setup(&timer, rearm_callback, NULL), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_start(&timer, 50, 0), HAL_OK);
+
+    advance(1000);
+
+    TEST_ASSERT_EQ(rearm_count, 5);
+    TEST_ASSERT_EQ(rearm_last, start + 250U);
+}
+
+/** 延時與週期需小於2^31，NULL參數被拒絕 */
+static void test_parameter_range(void)
+{
+    hal_timer_t timer;
+
+    hal_timer_service_init();
+
+    TEST_ASSERT_EQ(hal_timer_setup(&timer, probe_callback, &probes[0]), HAL_OK);
+    TEST_ASSERT_EQ(hal_timer_start(&timer, 0x80000000UL, 0), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_timer_start(&timer, 0xFFFFFFFFUL, 0), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_timer_start(&timer, 1, 0x80000000UL), HAL_INVALID_PARAM);
+    TEST_ASSERT(!hal_timer_is_active(&timer));
+
+    TEST_ASSERT_EQ(hal_timer_start(&timer, 0x7FFFFFFFUL, 0), HAL_OK);
+    TEST_ASSERT(hal_timer_is_active(&timer));
+    TEST_ASSERT_EQ(hal_timer_stop(&timer), HAL_OK);
+
+    TEST_ASSERT_EQ(hal_timer_setup(NULL, probe_callback, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_timer_setup(&timer, NULL, NULL), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_timer_start(NULL, 1, 0), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_timer_stop(NULL), HAL_INVALID_PARAM);
+}
+
+/** 延後處理時一次補上所有錯過的tick，到期順序不變 */
+static void test_catch_up(void)
+{
+    uint32_t i;
+
+    hal_timer_service_init();
+
+    for (i = 0; i < 10U; i++) {
+        probe_start(&probes[i], 100U + i * 10U, 0);
+    }
+
+    for (i = 0; i < 500U; i++) {
+        hal_timer_tick();
+    }
+    TEST_ASSERT_EQ(hal_timer_process(), 10);
+
+    for (i = 0; i < 10U; i++) {
+        TEST_ASSERT_EQ(probes[i].fire_count, 1);
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_level_boundaries);
+    TEST_RUN(test_random_accuracy);
+    TEST_RUN(test_zero_delay);
+    TEST_RUN(test_beyond_wheel_range);
+    TEST_RUN(test_periodic);
+    TEST_RUN(test_restart);
+    TEST_RUN(test_stop_from_callback);
+    TEST_RUN(test_rearm_from_callback);
+    TEST_RUN(test_parameter_range);
+    TEST_RUN(test_catch_up);
+
+    return TEST_REPORT();
+}
@@ -0,0 +1,283 @@
+/**
+ * @file test_uart_baud.c
+ * @brief UART波特率除頻計算單元測試 (STM32 USART 16/8倍取樣、C2000 SCI)
+ * @author Cross-MCU Framework Team
+ * @date 2024
+ *
+ * 以浮點數窮舉每個預除頻值與取樣模式附近的除頻值，作為獨立的參考結果，
+ * 與hal_uart_calc_*_divisor()的選擇比較。8倍取樣依BRR編碼只有fck的整數除頻。
+ */
+
+#include "hal_uart.h"
+#include "test_common.h"
+#include <math.h>
+#include <stdlib.h>
+
+/* ========================================================================== */
+/*                             參考計算                                        */
+/* ========================================================================== */
+
+static const uint32_t kernel_clocks[] = {
+    16000000UL, 48000000UL, 64000000UL, 80000000UL, 100000000UL,
+    144000000UL, 150000000UL, 160000000UL, 170000000UL
+};
+
+static const uint32_t lspclk_clocks[] = {
+    25000000UL, 37500000UL, 50000000UL, 60000000UL, 100000000UL
+};
+
+static const uint32_t baudrates[] = {
+    300UL, 1200UL, 9600UL, 19200UL, 38400UL, 57600UL, 115200UL, 230400UL,
+    460800UL, 921600UL, 1000000UL, 2000000UL, 3000000UL, 4000000UL, 5000000UL,
+    6000000UL, 8000000UL, 10000000UL, 12500000UL, 15000000UL, 20000000UL
+};
+
+static const uint32_t presc_div[] = { 1, 2, 4, 6, 8, 10, 12, 16, 32, 64, 128, 256 };
+
+#define COUNT_OF(a)             (sizeof(a) / sizeof((a)[0]))
+
+/** 實際波特率相對誤差 (ppm)，與被測函式相同的四捨五入方式 */
+static uint32_t ref_error_ppm(double actual, uint32_t baudrate)
+{
+    return (uint32_t)floor(fabs(floor(actual + 0.5) - baudrate) * 1e6 / baudrate);
+}
+
+/** 所有預除頻值與取樣模式中可達到的最小誤差 (ppm)，無有效設定時為UINT32_MAX */
+static uint32_t ref_usart_best(uint32_t kernel_hz, uint32_t baudrate)
+{
+    uint32_t best = UINT32_MAX;
+    uint32_t p;
+    uint32_t over8;
+
+    for (p = 0; p < COUNT_OF(presc_div); p++) {
+        for (over8 = 0; over8 < 2U; over8++) {
+            // 8倍取樣的USARTDIV[0]被捨棄，只有偶數USARTDIV (fck的整數除頻) 有效
+            double ideal = (double)kernel_hz / ((double)presc_div[p] * baudrate);
+            double div;
+
+            for (div = floor(ideal) - 1.0; div <= ceil(ideal) + 1.0; div += 1.0) {
+                double usartdiv = div * (over8 + 1U);
+                uint32_t error;
+
+                if (div < 1.0 || usartdiv < 16.0 || usartdiv > 65535.0) {
+                    continue;
+                }
+                error = ref_error_ppm((double)kernel_hz / (presc_div[p] * div), baudrate);
+                if (error < best) {
+                    best = error;
+                }
+            }
+        }
+    }
+
+    return best;
+}
+
+/** BRR暫存器值還原為USARTDIV */
+static uint32_t brr_to_usartdiv(const hal_uart_baud_result_t* r)
+{
+    return r->over8 ? ((r->divisor & 0xFFF0UL) | ((r->divisor & 0x7UL) << 1)) : r->divisor;
+}
+
+/* ========================================================================== */
+/*                             STM32 USART                                    */
+/* ========================================================================== */
+
+/** 8倍取樣: BRR捨棄USARTDIV[0]，奇數USARTDIV不代表半步除頻 */
+static void test_usart_over8_granularity(void)
+{
+    hal_uart_baud_result_t r;
+
+    // USARTDIV = 27寫入BRR = 0x15，硬體還原為26: 2 * 170 / 26 = 13.08 Mbaud
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 0, true, 0x15), 13076923UL);
+
+    // 170 MHz、12.5 Mbaud: 最佳為fck/14 = 12.14 Mbaud (-2.86%)，超過誤差上限
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 12500000UL, &r), HAL_INVALID_PARAM);
+
+    // 170 MHz、11.5 Mbaud: 16倍取樣無法達到 (USARTDIV < 16)，8倍取樣fck/15 = 11.33 Mbaud
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 11500000UL, &r), HAL_OK);
+    TEST_ASSERT(r.over8);
+    TEST_ASSERT_EQ(r.prescaler, 0);
+    TEST_ASSERT_EQ(brr_to_usartdiv(&r), 30);
+    TEST_ASSERT_EQ(r.divisor, 0x17);
+    TEST_ASSERT_EQ(r.actual_baudrate, 11333333UL);
+    TEST_ASSERT_EQ(r.error_ppm, -14492);
+}
+
+/** 預除頻後的時鐘不截斷: 170 MHz / 6 = 28.33 MHz */
+static void test_usart_prescaled_clock_exact(void)
+{
+    hal_uart_baud_result_t r;
+
+    // 170 MHz / (6 * 17) = 1666666.67 baud (先截斷fck時為1666666)
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 3, false, 17), 1666667UL);
+
+    // 選擇結果的實際波特率與誤差以同一公式計算
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 300UL, &r), HAL_OK);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, r.prescaler, r.over8, r.divisor),
+                   r.actual_baudrate);
+}
+
+/** 可整除時使用16倍取樣、不預除頻，誤差為0 */
+static void test_usart_exact_over16(void)
+{
+    hal_uart_baud_result_t r;
+
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(160000000UL, 1000000UL, &r), HAL_OK);
+    TEST_ASSERT(!r.over8);
+    TEST_ASSERT_EQ(r.prescaler, 0);
+    TEST_ASSERT_EQ(r.divisor, 160);
+    TEST_ASSERT_EQ(r.error_ppm, 0);
+
+    // 8 Mbaud在160 MHz時16倍取樣的除頻為20，不需要8倍取樣
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(160000000UL, 8000000UL, &r), HAL_OK);
+    TEST_ASSERT(!r.over8);
+    TEST_ASSERT_EQ(r.divisor, 20);
+}
+
+/** 低波特率需要預除頻 (USARTDIV超過0xFFFF) */
+static void test_usart_prescaler(void)
+{
+    hal_uart_baud_result_t r;
+
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 300UL, &r), HAL_OK);
+    TEST_ASSERT(r.prescaler > 0);
+    TEST_ASSERT(brr_to_usartdiv(&r) <= 0xFFFFUL);
+    TEST_ASSERT_EQ(r.error_ppm, 0);
+}
+
+/** 誤差相同時取先搜尋到的候選: 較小的預除頻值、16倍取樣、較小的除頻值 */
+static void test_usart_tie_first_candidate(void)
+{
+    hal_uart_baud_result_t r;
+
+    // 16 MHz、500 kbaud: PRESC 1/2/4與16/8倍取樣共五組皆無誤差
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(16000000UL, 500000UL, &r), HAL_OK);
+    TEST_ASSERT_EQ(r.prescaler, 0);
+    TEST_ASSERT(!r.over8);
+    TEST_ASSERT_EQ(r.divisor, 32);
+    TEST_ASSERT_EQ(r.error_ppm, 0);
+
+    // 170 MHz、300 baud: /10的USARTDIV 56666與56667捨入後皆為0 ppm，取先試的56666
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 300UL, &r), HAL_OK);
+    TEST_ASSERT_EQ(r.prescaler, 5);
+    TEST_ASSERT(!r.over8);
+    TEST_ASSERT_EQ(r.divisor, 56666);
+    TEST_ASSERT_EQ(r.error_ppm, 0);
+}
+
+/** 超過時鐘/8或參數無效時被拒絕 */
+static void test_usart_out_of_range(void)
+{
+    hal_uart_baud_result_t r;
+
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 25000000UL, &r), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(16000000UL, 2500000UL, &r), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(0, 9600UL, &r), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 0, &r), HAL_INVALID_PARAM);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_divisor(170000000UL, 9600UL, NULL), HAL_INVALID_PARAM);
+}
+
+/** 時鐘與波特率矩陣: 誤差等於參考最小值，BRR可反算出相同的實際波特率 */
+static void test_usart_matrix(void)
+{
+    uint32_t k;
+    uint32_t b;
+
+    for (k = 0; k < COUNT_OF(kernel_clocks); k++) {
+        for (b = 0; b < COUNT_OF(baudrates); b++) {
+            uint32_t kernel_hz = kernel_clocks[k];
+            uint32_t baudrate = baudrates[b];
+            uint32_t best = ref_usart_best(kernel_hz, baudrate);
+            hal_uart_baud_result_t r;
+            hal_status_t status = hal_uart_calc_usart_divisor(kernel_hz, baudrate, &r);
+
+            if (best > (uint32_t)HAL_UART_BAUD_MAX_ERROR_PPM) {
+                TEST_ASSERT_EQ(status, HAL_INVALID_PARAM);
+                continue;
+            }
+
+            TEST_ASSERT_EQ(status, HAL_OK);
+            if (status != HAL_OK) {
+                printf("    %lu Hz / %lu baud\n", (unsigned long)kernel_hz, (unsigned long)baudrate);
+                continue;
+            }
+
+            TEST_ASSERT_EQ((uint32_t)labs((long)r.error_ppm), best);
+            TEST_ASSERT(brr_to_usartdiv(&r) >= 16U && brr_to_usartdiv(&r) <= 0xFFFFUL);
+            TEST_ASSERT(!r.over8 || (r.divisor & 0x8UL) == 0U);
+            TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(kernel_hz, r.prescaler, r.over8, r.divisor),
+                           r.actual_baudrate);
+        }
+    }
+}
+
+/** BRR反算: 無效的預除頻值或BRR為0時返回0 */
+static void test_usart_baudrate_from_brr(void)
+{
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 0, false, 1476), 115176UL);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 0, true, 0x17), 11333333UL);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 12, false, 100), 0);
+    TEST_ASSERT_EQ(hal_uart_calc_usart_baudrate(170000000UL, 0, false, 0), 0);
+}
+
+/* ========================================================================== */
+/*                             C2000 SCI                                       */
+/* ========================================================================== */
+
+/** 時鐘與波特率矩陣: 誤差等於參考最小值，超過上限時被拒絕 */
+static void test_sci_matrix(void)
+{
+    uint32_t k;
+    uint32_t b;
+
+    for (k = 0; k < COUNT_OF(lspclk_clocks); k++) {
+        for (b = 0; b < COUNT_OF(baudrates); b++) {
+            uint32_t lspclk_hz = lspclk_clocks[k];
+            uint32_t baudrate = baudrates[b];
+            double ideal = (double)lspclk_hz / (8.0 * baudrate);
+            uint32_t best = UINT32_MAX;
+            double div;
+            hal_uart_baud_result_t r;
+            hal_status_t status;
+
+            for (div = floor(ideal) - 1.0; div <= ceil(ideal) + 1.0; div += 1.0) {
+                uint32_t error;
+
+                if (div < 2.0 || div > 65536.0) {
+                    continue;
+                }
+                error = ref_error_ppm((double)lspclk_hz / (8.0 * div), baudrate);
+                if (error < best) {
+                    best = error;
+                }
+            }
+
+            status = hal_uart_calc_sci_divisor(lspclk_hz, baudrate, &r);
+            if (best > (uint32_t)HAL_UART_BAUD_MAX_ERROR_PPM) {
+                TEST_ASSERT_EQ(status, HAL_INVALID_PARAM);
+                continue;
+            }
+
+            TEST_ASSERT_EQ(status, HAL_OK);
+            TEST_ASSERT_EQ(r.actual_baudrate,
+                           (uint32_t)floor((double)lspclk_hz / (8.0 * (r.divisor + 1U)) + 0.5));
+            TEST_ASSERT_EQ((uint32_t)labs((long)r.error_ppm), best);
+        }
+    }
+}
+
+int main(void)
+{
+    TEST_RUN(test_usart_over8_granularity);
+    TEST_RUN(test_usart_prescaled_clock_exact);
+    TEST_RUN(test_usart_exact_over16);
+    TEST_RUN(test_usart_prescaler);
+    TEST_RUN(test_usart_tie_first_candidate);
+    TEST_RUN(test_usart_out_of_range);
+    TEST_RUN(test_usart_matrix);
+    TEST_RUN(test_usart_baudrate_from_brr);
+    TEST_RUN(test_sci_matrix);
+
+    return TEST_REPORT();
+}